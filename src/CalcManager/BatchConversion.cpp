@@ -0,0 +1,228 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <algorithm>
+#include <future>
+#include <thread>
+#include <vector>
+#include "BatchConversion.h"
+
+#if defined(_M_X64) || defined(__x86_64__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#define BATCH_CONVERSION_X86 1
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define BATCH_CONVERSION_TARGET_AVX
+#else
+#define BATCH_CONVERSION_TARGET_AVX __attribute__((target("avx")))
+#endif
+#elif defined(_M_ARM64) || defined(__aarch64__)
+#define BATCH_CONVERSION_NEON 1
+#include <arm_neon.h>
+#endif
+
+using namespace std;
+using namespace UnitConversionManager;
+
+namespace
+{
+    // Inputs smaller than this are converted on the calling thread, below it the cost of starting threads dominates.
+    constexpr size_t PARALLELCONVERSIONTHRESHOLD = 1 << 18;
+
+    // Number of values converted with every conversion before moving to the next block, sized so that a block of input stays in L1.
+    constexpr size_t CONVERSIONBLOCKSIZE = 2048;
+
+    using ConvertKernel = void (*)(const double*, size_t, double, double, bool, double*);
+
+    // All kernels compute (value * ratio) + offset or (value + offset) * ratio with separate multiply and add
+    // instructions, in the same order as UnitConverter::Convert, so every kernel produces the same results.
+    void ConvertScalar(const double* values, size_t count, double ratio, double offset, bool offsetFirst, double* results)
+    {
+        if (offsetFirst)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                results[i] = (values[i] + offset) * ratio;
+            }
+        }
+        else
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                results[i] = (values[i] * ratio) + offset;
+            }
+        }
+    }
+
+#if defined(BATCH_CONVERSION_X86)
+    void ConvertSse2(const double* values, size_t count, double ratio, double offset, bool offsetFirst, double* results)
+    {
+        const __m128d ratios = _mm_set1_pd(ratio);
+        const __m128d offsets = _mm_set1_pd(offset);
+        size_t i = 0;
+        if (offsetFirst)
+        {
+            for (; i + 2 <= count; i += 2)
+            {
+                _mm_storeu_pd(results + i, _mm_mul_pd(_mm_add_pd(_mm_loadu_pd(values + i), offsets), ratios));
+            }
+        }
+        else
+        {
+            for (; i + 2 <= count; i += 2)
+            {
+                _mm_storeu_pd(results + i, _mm_add_pd(_mm_mul_pd(_mm_loadu_pd(values + i), ratios), offsets));
+            }
+        }
+
+        ConvertScalar(values + i, count - i, ratio, offset, offsetFirst, results + i);
+    }
+
+    BATCH_CONVERSION_TARGET_AVX void ConvertAvx(const double* values, size_t count, double ratio, double offset, bool offsetFirst, double* results)
+    {
+        const __m256d ratios = _mm256_set1_pd(ratio);
+        const __m256d offsets = _mm256_set1_pd(offset);
+        size_t i = 0;
+        if (offsetFirst)
+        {
+            for (; i + 4 <= count; i += 4)
+            {
+                _mm256_storeu_pd(results + i, _mm256_mul_pd(_mm256_add_pd(_mm256_loadu_pd(values + i), offsets), ratios));
+            }
+        }
+        else
+        {
+            for (; i + 4 <= count; i += 4)
+            {
+                _mm256_storeu_pd(results + i, _mm256_add_pd(_mm256_mul_pd(_mm256_loadu_pd(values + i), ratios), offsets));
+            }
+        }
+
+        ConvertScalar(values + i, count - i, ratio, offset, offsetFirst, results + i);
+    }
+
+    bool IsAvxSupported()
+    {
+#ifdef _MSC_VER
+        // AVX needs both the CPU feature and the OS saving the YMM registers on context switches
+        int cpuInfo[4];
+        __cpuid(cpuInfo, 1);
+        const bool hasOsxsave = (cpuInfo[2] & (1 << 27)) != 0;
+        const bool hasAvx = (cpuInfo[2] & (1 << 28)) != 0;
+        return hasOsxsave && hasAvx && (_xgetbv(0) & 0x6) == 0x6;
+#else
+        return __builtin_cpu_supports("avx");
+#endif
+    }
+#elif defined(BATCH_CONVERSION_NEON)
+    void ConvertNeon(const double* values, size_t count, double ratio, double offset, bool offsetFirst, double* results)
+    {
+        const float64x2_t ratios = vdupq_n_f64(ratio);
+        const float64x2_t offsets = vdupq_n_f64(offset);
+        size_t i = 0;
+        if (offsetFirst)
+        {
+            for (; i + 2 <= count; i += 2)
+            {
+                vst1q_f64(results + i, vmulq_f64(vaddq_f64(vld1q_f64(values + i), offsets), ratios));
+            }
+        }
+        else
+        {
+            for (; i + 2 <= count; i += 2)
+            {
+                vst1q_f64(results + i, vaddq_f64(vmulq_f64(vld1q_f64(values + i), ratios), offsets));
+            }
+        }
+
+        ConvertScalar(values + i, count - i, ratio, offset, offsetFirst, results + i);
+    }
+#endif
+
+    ConvertKernel GetConvertKernel()
+    {
+        static const ConvertKernel kernel = [] {
+#if defined(BATCH_CONVERSION_X86)
+            return IsAvxSupported() ? &ConvertAvx : &ConvertSse2;
+#elif defined(BATCH_CONVERSION_NEON)
+            return &ConvertNeon;
+#else
+            return &ConvertScalar;
+#endif
+        }();
+
+        return kernel;
+    }
+
+    // Runs convertRange over [0, count), split in block aligned chunks across threads when count is large enough.
+    template <typename TConvertRange>
+    void ForEachChunk(size_t count, const TConvertRange& convertRange)
+    {
+        const size_t threadCount = count < PARALLELCONVERSIONTHRESHOLD ? size_t{ 1 } : static_cast<size_t>(max(1u, thread::hardware_concurrency()));
+        if (threadCount == 1)
+        {
+            convertRange(0, count);
+            return;
+        }
+
+        size_t chunkSize = (count + threadCount - 1) / threadCount;
+        chunkSize = (chunkSize + CONVERSIONBLOCKSIZE - 1) / CONVERSIONBLOCKSIZE * CONVERSIONBLOCKSIZE;
+
+        vector<future<void>> chunks;
+        for (size_t begin = chunkSize; begin < count; begin += chunkSize)
+        {
+            const size_t end = min(count, begin + chunkSize);
+            chunks.push_back(async(launch::async, [&convertRange, begin, end] { convertRange(begin, end); }));
+        }
+
+        // The calling thread converts the first chunk itself
+        convertRange(0, min(count, chunkSize));
+        for (auto& chunk : chunks)
+        {
+            chunk.get();
+        }
+    }
+}
+
+namespace UnitConversionManager::BatchConversion
+{
+    /// <summary>
+    /// Converts count values with the given conversion data
+    /// </summary>
+    /// <param name="values">values to convert</param>
+    /// <param name="count">number of values</param>
+    /// <param name="conversionData">offset and ratio to use</param>
+    /// <param name="results">receives the count converted values, can be the same buffer as values</param>
+    void Convert(_In_ const double* values, size_t count, const ConversionData& conversionData, _Out_ double* results)
+    {
+        const ConvertKernel kernel = GetConvertKernel();
+        ForEachChunk(count, [&](size_t begin, size_t end) {
+            kernel(values + begin, end - begin, conversionData.ratio, conversionData.offset, conversionData.offsetFirst, results + begin);
+        });
+    }
+
+    /// <summary>
+    /// Converts count values with several conversions, the input is walked block by block
+    /// so that each block is read from memory once for all the conversions.
+    /// </summary>
+    /// <param name="values">values to convert</param>
+    /// <param name="count">number of values</param>
+    /// <param name="conversions">conversion data for each output</param>
+    /// <param name="conversionCount">number of conversions</param>
+    /// <param name="results">one buffer of count values per conversion</param>
+    void ConvertToMany(_In_ const double* values, size_t count, _In_ const ConversionData* conversions, size_t conversionCount, _In_ double* const* results)
+    {
+        const ConvertKernel kernel = GetConvertKernel();
+        ForEachChunk(count, [&](size_t begin, size_t end) {
+            for (size_t blockBegin = begin; blockBegin < end; blockBegin += CONVERSIONBLOCKSIZE)
+            {
+                const size_t blockSize = min(CONVERSIONBLOCKSIZE, end - blockBegin);
+                for (size_t i = 0; i < conversionCount; i++)
+                {
+                    const ConversionData& conversionData = conversions[i];
+                    kernel(values + blockBegin, blockSize, conversionData.ratio, conversionData.offset, conversionData.offsetFirst, results[i] + blockBegin);
+                }
+            }
+        });
+    }
+}
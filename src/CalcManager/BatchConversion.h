@@ -0,0 +1,23 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstddef>
+#include "sal_cross_platform.h"
+#include "UnitConverter.h"
+
+namespace UnitConversionManager::BatchConversion
+{
+    // Converts count values with the given conversion data. The results are identical to converting each value
+    // with UnitConverter::Convert, the work is vectorized and split across threads for large inputs.
+    void Convert(_In_ const double* values, size_t count, const ConversionData& conversionData, _Out_ double* results);
+
+    // Converts count values with each of the conversionCount conversions, results[i] receives the values converted with conversions[i].
+    void ConvertToMany(
+        _In_ const double* values,
+        size_t count,
+        _In_ const ConversionData* conversions,
+        size_t conversionCount,
+        _In_ double* const* results);
+}
@@ -424,9 +424,9 @@ void CHistoryCollector::SetDecimalSymbol(wchar_t decimalSymbol)
 }
 
 // Update the commands corresponding to the passed string Number
-std::shared_ptr<std::vector<int>> CHistoryCollector::GetOperandCommandsFromString(wstring_view numStr) const
+CPackedCommands CHistoryCollector::GetOperandCommandsFromString(wstring_view numStr) const
 {
-    std::shared_ptr<std::vector<int>> commands = std::make_shared<std::vector<int>>();
+    CPackedCommands commands;
     // Check for negate
     bool fNegative = (numStr[0] == L'-');
 
@@ -434,15 +434,15 @@ std::shared_ptr<std::vector<int>> CHistoryCollector::GetOperandCommandsFromStrin
     {
         if (numStr[i] == m_decimalSymbol)
         {
-            commands->push_back(IDC_PNT);
+            commands.push_back(IDC_PNT);
         }
         else if (numStr[i] == L'e')
         {
-            commands->push_back(IDC_EXP);
+            commands.push_back(IDC_EXP);
         }
         else if (numStr[i] == L'-')
         {
-            commands->push_back(IDC_SIGN);
+            commands.push_back(IDC_SIGN);
         }
         else if (numStr[i] == L'+')
         {
@@ -453,21 +453,21 @@ std::shared_ptr<std::vector<int>> CHistoryCollector::GetOperandCommandsFromStrin
         {
             int num = static_cast<int>(numStr[i]) - ASCII_0;
             num += IDC_0;
-            commands->push_back(num);
+            commands.push_back(num);
         }
     }
 
     // If the number is negative, append a sign command at the end.
     if (fNegative)
     {
-        commands->push_back(IDC_SIGN);
+        commands.push_back(IDC_SIGN);
     }
     return commands;
 }
 
 std::shared_ptr<COpndCommand> CHistoryCollector::GetOperandCommandsFromString(std::wstring_view numStr, Rational const& rat) const
 {
-    std::shared_ptr<std::vector<int>> commands = std::make_shared<vector<int>>();
+    CPackedCommands commands;
     // Check for negate
     bool fNegative = (numStr[0] == L'-');
     bool fSciFmt = false;
@@ -477,7 +477,7 @@ std::shared_ptr<COpndCommand> CHistoryCollector::GetOperandCommandsFromString(st
     {
         if (numStr[i] == m_decimalSymbol)
         {
-            commands->push_back(IDC_PNT);
+            commands.push_back(IDC_PNT);
             if (!fSciFmt)
             {
                 fDecimal = true;
@@ -485,12 +485,12 @@ std::shared_ptr<COpndCommand> CHistoryCollector::GetOperandCommandsFromString(st
         }
         else if (numStr[i] == L'e')
         {
-            commands->push_back(IDC_EXP);
+            commands.push_back(IDC_EXP);
             fSciFmt = true;
         }
         else if (numStr[i] == L'-')
         {
-            commands->push_back(IDC_SIGN);
+            commands.push_back(IDC_SIGN);
         }
         else if (numStr[i] == L'+')
         {
@@ -501,11 +501,11 @@ std::shared_ptr<COpndCommand> CHistoryCollector::GetOperandCommandsFromString(st
         {
             int num = static_cast<int>(numStr[i]) - ASCII_0;
             num += IDC_0;
-            commands->push_back(num);
+            commands.push_back(num);
         }
     }
 
-    auto operandCommand = std::make_shared<COpndCommand>(commands, fNegative, fDecimal, fSciFmt);
+    auto operandCommand = std::make_shared<COpndCommand>(std::move(commands), fNegative, fDecimal, fSciFmt);
     operandCommand->Initialize(rat);
     return operandCommand;
 }
@@ -19,28 +19,16 @@ namespace CalcEngine
     {
     }
 
+    // The mantissa is kept in digits of LEGACYBASEX, so it stays the same whatever BASEX ratpak uses.
     Number::Number(PNUMBER p) noexcept
         : m_sign{ p->sign }
-        , m_exp{ p->exp }
     {
-        m_mantissa.reserve(p->cdigit);
-        copy_n(p->mant, p->cdigit, back_inserter(m_mantissa));
+        m_exp = numtolegacy(p, m_mantissa);
     }
 
     PNUMBER Number::ToPNUMBER() const
     {
-        PNUMBER ret = _createnum(static_cast<uint32_t>(this->Mantissa().size()) + 1);
-        ret->sign = this->Sign();
-        ret->exp = this->Exp();
-        ret->cdigit = static_cast<int32_t>(this->Mantissa().size());
-
-        MANTTYPE* ptrRet = ret->mant;
-        for (auto const& digit : this->Mantissa())
-        {
-            *ptrRet++ = digit;
-        }
-
-        return ret;
+        return legacytonum(this->Sign(), this->Exp(), this->Mantissa().data(), static_cast<int32_t>(this->Mantissa().size()));
     }
 
     int32_t const& Number::Sign() const
@@ -0,0 +1,821 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <algorithm>
+#include <cmath>
+#include "Header Files/QuadDouble.h"
+
+using namespace std;
+using namespace CalcEngine;
+
+namespace
+{
+    // A value c[0] + c[1] + c[2] + c[3] made of four doubles of decreasing magnitude, together with an upper bound on its
+    // distance to the exact value it stands for. Every operation first computes its result exactly as a longer expansion
+    // of doubles and then keeps its four leading components, so the bound only grows by what was actually dropped.
+    struct Quad
+    {
+        double c[4];
+        double error;
+    };
+
+    // The bounds themselves are computed in double, scaling them up by this factor after every one or two operations
+    // covers their own round off.
+    constexpr double BOUNDUP = 1.0 + 0x1p-50;
+    constexpr double BOUNDDOWN = 1.0 - 0x1p-50;
+
+    // A component is complete when the terms behind it add up to less than this fraction of it.
+    constexpr double COMPRESSEPSILON = 0x1p-45;
+    constexpr int MAXCOMPRESSPASSES = 6;
+
+    // Terms of a series below this fraction of the sum end the series, what is left is bounded separately.
+    constexpr double SERIESEPSILON = 0x1p-230;
+    constexpr int MAXSERIESTERMS = 80;
+
+    // Components below this fraction of the leading one are folded into the bound before converting back to a Rational.
+    constexpr double TRIMEPSILON = 0x1p-240;
+
+    // The bound has to prove far more than the certified digits, so that the returned value is also a good argument to
+    // the operations that follow it.
+    constexpr double MAXRELATIVEERROR = 0x1p-150;
+
+    // Results are only certified in this range, ratpak rounds values next to zero down to zero and the decimal scaling
+    // of the rounding check uses powers of ten that are exact in four doubles.
+    constexpr double MINCERTIFIED = 0x1p-100;
+    constexpr double MAXCERTIFIED = 0x1p+200;
+
+    // Bounds on the arguments, they keep every intermediate value and the components of its error terms far from the
+    // overflow and underflow thresholds of double.
+    constexpr int32_t MAXBINARYSCALE = 900;
+    constexpr double MAXEXPARGUMENT = 256.0;
+    constexpr double MAXTRIGARGUMENT = 0x1p+40;
+
+    // exp reduces its argument below ln(2)/2^EXPSQUARINGS before the series and squares the sum back.
+    constexpr int EXPSQUARINGS = 10;
+
+    constexpr double SQRTHALF = 0.70710678118654752440;
+
+    // Bits and mask of a digit of a Number mantissa, signed so that digit offsets below the leading one stay negative.
+    constexpr int32_t DIGITBITS = static_cast<int32_t>(LEGACYBASEXPWR);
+    constexpr int64_t DIGITBASE = static_cast<int64_t>(LEGACYBASEX);
+    constexpr uint64_t DIGITMASK = LEGACYBASEX - 1;
+
+    // Constants rounded to four doubles, their errors are bounds on the distance to the exact constant.
+    constexpr Quad ONE = { { 1.0, 0.0, 0.0, 0.0 }, 0.0 };
+    constexpr Quad LN2 = { { 0x1.62e42fefa39efp-1, 0x1.abc9e3b39803fp-56, 0x1.7b57a079a1934p-111, -0x1.ace93a4ebe5d1p-165 }, 0x1p-218 };
+    constexpr Quad PIOVER2 = { { 0x1.921fb54442d18p+0, 0x1.1a62633145c07p-54, -0x1.f1976b7ed8fbcp-110, 0x1.4cf98e804177dp-164 }, 0x1p-217 };
+    constexpr Quad PIOVER180 = { { 0x1.1df46a2529d39p-6, 0x1.5c1d8becdd291p-62, -0x1.1d937fa428858p-116, 0x1.b5e6b8e502a9bp-173 }, 0x1p-226 };
+    constexpr Quad PIOVER200 = { { 0x1.015bf9217271ap-6, -0x1.c9bf81089c7a5p-61, -0x1.1a1bf970456f4p-115, -0x1.80f7d26651734p-169 }, 0x1p-224 };
+
+    double Up(double bound)
+    {
+        return bound * BOUNDUP;
+    }
+
+    double Down(double bound)
+    {
+        return bound * BOUNDDOWN;
+    }
+
+    // Error free transformations, s + e is exactly a + b and p + e is exactly a * b.
+    void TwoSum(double a, double b, double& s, double& e)
+    {
+        s = a + b;
+        double bb = s - a;
+        e = (a - (s - bb)) + (b - bb);
+    }
+
+    void TwoProd(double a, double b, double& p, double& e)
+    {
+        p = a * b;
+        e = fma(a, b, -p);
+    }
+
+    Quad FromDouble(double d)
+    {
+        return Quad{ { d, 0.0, 0.0, 0.0 }, 0.0 };
+    }
+
+    // Upper bound of the magnitude of the value, without its error.
+    double Magnitude(Quad const& a)
+    {
+        return Up(Up(fabs(a.c[0]) + fabs(a.c[1])) + Up(fabs(a.c[2]) + fabs(a.c[3])));
+    }
+
+    // Upper bound of the magnitude of the exact value.
+    double MagnitudeBound(Quad const& a)
+    {
+        return Up(Magnitude(a) + a.error);
+    }
+
+    // Sums the n terms exactly and keeps the four leading components of the sum, the sum of the terms left behind goes
+    // into the bound. Each pass is a VecSum: it moves the rounded sum of the remaining terms to their front and leaves
+    // the round off of every addition in their place, so no information is lost between passes. When terms cancel the
+    // front can be far from the sum after one pass, passes are repeated until the terms behind it are negligible.
+    Quad Compress(double* t, int n, double error)
+    {
+        Quad result{ { 0.0, 0.0, 0.0, 0.0 }, 0.0 };
+        int components = min(n, 4);
+        for (int k = 0; k < components; k++)
+        {
+            for (int pass = 0; pass < MAXCOMPRESSPASSES; pass++)
+            {
+                double s = t[n - 1];
+                for (int j = n - 2; j >= k; j--)
+                {
+                    TwoSum(t[j], s, s, t[j + 1]);
+                }
+
+                t[k] = s;
+                double behind = 0.0;
+                for (int j = k + 1; j < n; j++)
+                {
+                    behind += fabs(t[j]);
+                }
+
+                if (behind <= fabs(s) * COMPRESSEPSILON)
+                {
+                    break;
+                }
+            }
+
+            result.c[k] = t[k];
+        }
+
+        double dropped = 0.0;
+        for (int j = components; j < n; j++)
+        {
+            dropped = Up(dropped + fabs(t[j]));
+        }
+
+        result.error = Up(error + dropped);
+        return result;
+    }
+
+    Quad Negate(Quad a)
+    {
+        for (double& component : a.c)
+        {
+            component = -component;
+        }
+
+        return a;
+    }
+
+    Quad Add(Quad const& a, Quad const& b)
+    {
+        double t[8] = { a.c[0], b.c[0], a.c[1], b.c[1], a.c[2], b.c[2], a.c[3], b.c[3] };
+        return Compress(t, 8, Up(a.error + b.error));
+    }
+
+    Quad Sub(Quad const& a, Quad const& b)
+    {
+        return Add(a, Negate(b));
+    }
+
+    // Products of components whose indices add up to at most three are kept exactly, the next ones are rounded and the
+    // remaining ones, below 2^-260 of the product, are only bounded.
+    Quad Mul(Quad const& a, Quad const& b)
+    {
+        double t[23];
+        int n = 0;
+        double low[4];
+        int lowCount = 0;
+        for (int level = 0; level <= 3; level++)
+        {
+            double high[4];
+            for (int i = 0; i <= level; i++)
+            {
+                TwoProd(a.c[i], b.c[level - i], t[n], high[i]);
+                n++;
+            }
+
+            copy_n(low, lowCount, t + n);
+            n += lowCount;
+            copy_n(high, level + 1, low);
+            lowCount = level + 1;
+        }
+
+        double error = 0.0;
+        for (int i = 1; i <= 3; i++)
+        {
+            t[n] = a.c[i] * b.c[4 - i];
+            error = Up(error + fabs(t[n]) * 0x1p-53);
+            n++;
+        }
+
+        copy_n(low, lowCount, t + n);
+        n += lowCount;
+
+        error = Up(error + Up(fabs(a.c[2] * b.c[3]) + fabs(a.c[3] * b.c[2])));
+        error = Up(error + fabs(a.c[3] * b.c[3]));
+
+        // The inputs are only known within their bounds: |ab - AB| <= |a| eb + ea (|b| + eb)
+        error = Up(error + Up(Magnitude(a) * b.error));
+        error = Up(error + Up(a.error * MagnitudeBound(b)));
+
+        return Compress(t, n, error);
+    }
+
+    // Multiplication and division by a power of two are exact.
+    Quad Scale(Quad a, int exponent)
+    {
+        for (double& component : a.c)
+        {
+            component = ldexp(component, exponent);
+        }
+
+        a.error = ldexp(a.error, exponent);
+        return a;
+    }
+
+    Quad Poison()
+    {
+        return Quad{ { 0.0, 0.0, 0.0, 0.0 }, INFINITY };
+    }
+
+    // Bounds |a - q * b| from the exact expansion of the residual.
+    double ResidualBound(Quad const& a, Quad const& q, Quad const& b)
+    {
+        double t[36];
+        int n = 0;
+        for (double component : a.c)
+        {
+            t[n++] = component;
+        }
+
+        for (double qi : q.c)
+        {
+            for (double bj : b.c)
+            {
+                TwoProd(-qi, bj, t[n], t[n + 1]);
+                n += 2;
+            }
+        }
+
+        Quad residual = Compress(t, n, 0.0);
+        return MagnitudeBound(residual);
+    }
+
+    // Long division, each quotient component comes from the leading components of the running remainder. The bound is
+    // taken from the exact residual of the final quotient rather than from the steps that produced it.
+    Quad Div(Quad const& a, Quad const& b)
+    {
+        double bLow = Down(fabs(b.c[0]) - Up(Up(fabs(b.c[1]) + fabs(b.c[2])) + Up(fabs(b.c[3]) + b.error)));
+        if (!(bLow > 0.0))
+        {
+            return Poison();
+        }
+
+        Quad remainder = a;
+        remainder.error = 0.0;
+        double q[4];
+        for (int k = 0; k < 4; k++)
+        {
+            q[k] = remainder.c[0] / b.c[0];
+            Quad product = Mul(b, FromDouble(q[k]));
+            remainder = Sub(remainder, product);
+        }
+
+        Quad quotient = Compress(q, 4, 0.0);
+
+        // |A/B - q| = |A - qB| / |B| <= (|a - qb| + ea + |q| eb) / |B|
+        double error = Up(ResidualBound(a, quotient, b) + a.error);
+        error = Up(error + Up(Magnitude(quotient) * b.error));
+        quotient.error = Up(error / bLow);
+        return quotient;
+    }
+
+    // Division by a double that is an exact small integer, the denominators of the series.
+    Quad Div(Quad const& a, double d)
+    {
+        Quad remainder = a;
+        double q[4];
+        for (int k = 0; k < 4; k++)
+        {
+            q[k] = remainder.c[0] / d;
+            double p, e;
+            TwoProd(q[k], d, p, e);
+            double t[6] = { remainder.c[0], -p, remainder.c[1], -e, remainder.c[2], remainder.c[3] };
+            remainder = Compress(t, 6, 0.0);
+        }
+
+        Quad quotient = Compress(q, 4, 0.0);
+        quotient.error = Up(Up(ResidualBound(a, quotient, FromDouble(d)) + a.error) / fabs(d));
+        return quotient;
+    }
+
+    // The bound of the remainder of a series whose terms past the last computed one shrink at least by ratio < 1/2
+    // from one term to the next.
+    double SeriesTail(Quad const& lastTerm, double ratio)
+    {
+        return Up(MagnitudeBound(lastTerm) * Up(ratio / Down(1.0 - ratio)));
+    }
+
+    bool IsSmallTerm(Quad const& term, Quad const& sum)
+    {
+        return Magnitude(term) <= fabs(sum.c[0]) * SERIESEPSILON;
+    }
+
+    //-----------------------------------------------------------------------------
+    //
+    //    FUNCTION: Exp
+    //
+    //    EXPLANATION: x = k ln(2) + r with |r| <= ln(2)/2, the Taylor series of
+    //    e^(r/2^EXPSQUARINGS) is squared EXPSQUARINGS times and scaled by 2^k.
+    //    The caller keeps |x| below MAXEXPARGUMENT.
+    //
+    //-----------------------------------------------------------------------------
+    Quad Exp(Quad const& x)
+    {
+        double k = nearbyint(x.c[0] / LN2.c[0]);
+        Quad r = Scale(Sub(x, Mul(LN2, FromDouble(k))), -EXPSQUARINGS);
+        double rho = MagnitudeBound(r);
+
+        Quad term = r;
+        Quad sum = Add(ONE, r);
+        int n = 1;
+        while (n < MAXSERIESTERMS && !IsSmallTerm(term, sum))
+        {
+            n++;
+            term = Div(Mul(term, r), n);
+            sum = Add(sum, term);
+        }
+
+        sum.error = Up(sum.error + SeriesTail(term, Up(rho / (n + 1))));
+
+        for (int i = 0; i < EXPSQUARINGS; i++)
+        {
+            sum = Mul(sum, sum);
+        }
+
+        return Scale(sum, static_cast<int>(k));
+    }
+
+    //-----------------------------------------------------------------------------
+    //
+    //    FUNCTION: Log
+    //
+    //    EXPLANATION: x = 2^k m with m in [sqrt(1/2), sqrt(2)), then
+    //    ln(m) = 2 atanh(z) with z = (m - 1)/(m + 1) and |z| < 0.172, from the
+    //    series z + z^3/3 + z^5/5 + ... The caller keeps x positive.
+    //
+    //-----------------------------------------------------------------------------
+    Quad Log(Quad const& x)
+    {
+        int k;
+        double mantissa = frexp(x.c[0], &k);
+        if (mantissa < SQRTHALF)
+        {
+            k--;
+        }
+
+        Quad m = Scale(x, -k);
+        Quad z = Div(Sub(m, ONE), Add(m, ONE));
+        Quad z2 = Mul(z, z);
+        double rho2 = MagnitudeBound(z2);
+        if (!(rho2 < 0.5))
+        {
+            return Poison();
+        }
+
+        Quad power = z;
+        Quad sum = z;
+        Quad term = z;
+        for (int j = 1; j < MAXSERIESTERMS && !IsSmallTerm(term, sum); j++)
+        {
+            power = Mul(power, z2);
+            term = Div(power, 2.0 * j + 1.0);
+            sum = Add(sum, term);
+        }
+
+        // The denominators of the remaining terms are larger than one
+        sum.error = Up(sum.error + SeriesTail(power, rho2));
+
+        return Add(Mul(LN2, FromDouble(k)), Scale(sum, 1));
+    }
+
+    //-----------------------------------------------------------------------------
+    //
+    //    FUNCTION: SinSeries, CosSeries
+    //
+    //    EXPLANATION: Taylor series of sin and cos for |r| below one, each term
+    //    is the previous one times -r^2/((n+1)(n+2)).
+    //
+    //-----------------------------------------------------------------------------
+    Quad TrigSeries(Quad const& r, Quad const& first, int firstPower)
+    {
+        Quad r2 = Mul(r, r);
+        double rho2 = MagnitudeBound(r2);
+        if (!(rho2 < 1.0))
+        {
+            return Poison();
+        }
+
+        Quad term = first;
+        Quad sum = first;
+        int n = firstPower;
+        while (n < 2 * MAXSERIESTERMS && !IsSmallTerm(term, sum))
+        {
+            term = Negate(Div(Mul(term, r2), static_cast<double>((n + 1) * (n + 2))));
+            n += 2;
+            sum = Add(sum, term);
+        }
+
+        sum.error = Up(sum.error + SeriesTail(term, Up(rho2 / ((n + 1.0) * (n + 2.0)))));
+        return sum;
+    }
+
+    Quad SinSeries(Quad const& r)
+    {
+        return TrigSeries(r, r, 1);
+    }
+
+    Quad CosSeries(Quad const& r)
+    {
+        return TrigSeries(r, ONE, 0);
+    }
+
+    // Reduces the angle to r radians in about [-pi/4, pi/4] so that the angle is r + quadrant * pi/2. Degrees and
+    // gradians are reduced before the conversion to radians, so multiples of a right angle reduce to exactly zero.
+    bool ReduceAngle(Quad const& x, AngleType angletype, Quad& r, int& quadrant)
+    {
+        if (!(fabs(x.c[0]) <= MAXTRIGARGUMENT))
+        {
+            return false;
+        }
+
+        double k;
+        switch (angletype)
+        {
+        case AngleType::Degrees:
+            k = nearbyint(x.c[0] / 90.0);
+            r = Mul(Sub(x, FromDouble(90.0 * k)), PIOVER180);
+            break;
+        case AngleType::Gradians:
+            k = nearbyint(x.c[0] / 100.0);
+            r = Mul(Sub(x, FromDouble(100.0 * k)), PIOVER200);
+            break;
+        default:
+            k = nearbyint(x.c[0] / PIOVER2.c[0]);
+            r = Sub(x, Mul(PIOVER2, FromDouble(k)));
+            break;
+        }
+
+        quadrant = static_cast<int>(fmod(k, 4.0));
+        if (quadrant < 0)
+        {
+            quadrant += 4;
+        }
+
+        return true;
+    }
+
+    // Converts the magnitude of the number, returning it scaled by 2^-scale to keep it in the range of double.
+    Quad FromNumber(Number const& number, int32_t& scale)
+    {
+        auto const& mantissa = number.Mantissa();
+        int32_t top = static_cast<int32_t>(mantissa.size()) - 1;
+        while (top >= 0 && mantissa[top] == 0)
+        {
+            top--;
+        }
+
+        scale = 0;
+        if (top < 0)
+        {
+            return FromDouble(0.0);
+        }
+
+        // Eight digits hold more than four doubles, the digits below them add up to less than one unit of the last one.
+        int32_t first = max(0, top - 7);
+        double t[8];
+        int n = 0;
+        for (int32_t j = top; j >= first; j--)
+        {
+            t[n++] = ldexp(static_cast<double>(mantissa[j]), DIGITBITS * (j - top));
+        }
+
+        scale = DIGITBITS * (top + number.Exp());
+        return Compress(t, n, first > 0 ? ldexp(1.0, DIGITBITS * (first - top)) : 0.0);
+    }
+
+    bool FromRational(Rational const& rat, Quad& x)
+    {
+        int32_t pScale, qScale;
+        Quad p = FromNumber(rat.P(), pScale);
+        Quad q = FromNumber(rat.Q(), qScale);
+        if (q.c[0] == 0.0)
+        {
+            return false;
+        }
+
+        int32_t scale = pScale - qScale;
+        if (scale > MAXBINARYSCALE || scale < -MAXBINARYSCALE)
+        {
+            return false;
+        }
+
+        x = Scale(Div(p, q), scale);
+        if (rat.P().Sign() * rat.Q().Sign() < 0)
+        {
+            x = Negate(x);
+        }
+
+        return x.error < INFINITY;
+    }
+
+    // Folds the components that are negligible next to the leading one into the bound, so the conversion to a Rational
+    // never spans a wide range of exponents.
+    Quad Trim(Quad a)
+    {
+        double threshold = fabs(a.c[0]) * TRIMEPSILON;
+        for (double& component : a.c)
+        {
+            if (fabs(component) < threshold)
+            {
+                a.error = Up(a.error + fabs(component));
+                component = 0.0;
+            }
+        }
+
+        return a;
+    }
+
+    // Converts the exact value of the components, the sum of signed 53 bit integers times powers of two, into
+    // digits of LEGACYBASEX, the digits of a Number mantissa.
+    Rational ToRational(Quad const& a)
+    {
+        int64_t integers[4];
+        int exponents[4];
+        int lowest = INT32_MAX;
+        for (int i = 0; i < 4; i++)
+        {
+            integers[i] = 0;
+            exponents[i] = 0;
+            if (a.c[i] != 0.0)
+            {
+                int e;
+                double fraction = frexp(a.c[i], &e);
+                integers[i] = static_cast<int64_t>(ldexp(fraction, 53));
+                exponents[i] = e - 53;
+                lowest = min(lowest, exponents[i]);
+            }
+        }
+
+        if (lowest == INT32_MAX)
+        {
+            return Rational{};
+        }
+
+        // The exponent of the lowest digit, rounded down to a whole number of digits
+        int32_t digitExp = (lowest >= 0 ? lowest : lowest - (DIGITBITS - 1)) / DIGITBITS;
+        int32_t base = digitExp * DIGITBITS;
+
+        int32_t highest = *max_element(begin(exponents), end(exponents)) + 53;
+        vector<int64_t> digits((highest - base) / DIGITBITS + 3, 0);
+        for (int i = 0; i < 4; i++)
+        {
+            if (integers[i] == 0)
+            {
+                continue;
+            }
+
+            int64_t sign = integers[i] < 0 ? -1 : 1;
+            uint64_t magnitude = static_cast<uint64_t>(integers[i] * sign);
+            int32_t shift = exponents[i] - base;
+            int32_t index = shift / DIGITBITS;
+            int32_t bit = shift % DIGITBITS;
+
+            // Split in pieces below 2^31 before shifting so that no product overflows 64 bits
+            uint64_t low = (magnitude & DIGITMASK) << bit;
+            uint64_t high = (magnitude >> DIGITBITS) << bit;
+            digits[index] += sign * static_cast<int64_t>(low & DIGITMASK);
+            digits[index + 1] += sign * static_cast<int64_t>((low >> DIGITBITS) + (high & DIGITMASK));
+            digits[index + 2] += sign * static_cast<int64_t>(high >> DIGITBITS);
+        }
+
+        auto normalize = [&digits]() {
+            for (size_t i = 0; i + 1 < digits.size(); i++)
+            {
+                int64_t carry = digits[i] >= 0 ? digits[i] / DIGITBASE : -((-digits[i] + DIGITBASE - 1) / DIGITBASE);
+                digits[i] -= carry * DIGITBASE;
+                digits[i + 1] += carry;
+            }
+        };
+
+        normalize();
+        int32_t sign = 1;
+        if (digits.back() < 0)
+        {
+            sign = -1;
+            for (auto& digit : digits)
+            {
+                digit = -digit;
+            }
+
+            normalize();
+        }
+
+        vector<uint32_t> mantissa;
+        mantissa.reserve(digits.size());
+        size_t start = 0;
+        while (start < digits.size() && digits[start] == 0)
+        {
+            start++;
+        }
+
+        size_t end = digits.size();
+        while (end > start && digits[end - 1] == 0)
+        {
+            end--;
+        }
+
+        if (start == end)
+        {
+            return Rational{};
+        }
+
+        for (size_t i = start; i < end; i++)
+        {
+            mantissa.push_back(static_cast<uint32_t>(digits[i]));
+        }
+
+        digitExp += static_cast<int32_t>(start);
+        if (digitExp >= 0)
+        {
+            return Rational{ Number{ sign, digitExp, mantissa }, Number{ 1, 0, { 1 } } };
+        }
+
+        return Rational{ Number{ sign, 0, mantissa }, Number{ 1, -digitExp, { 1 } } };
+    }
+
+    Quad PowerOfTen(int exponent)
+    {
+        Quad result = ONE;
+        Quad power = FromDouble(10.0);
+        while (exponent > 0)
+        {
+            if (exponent & 1)
+            {
+                result = Mul(result, power);
+            }
+
+            exponent >>= 1;
+            if (exponent > 0)
+            {
+                power = Mul(power, power);
+            }
+        }
+
+        return result;
+    }
+
+    // Scales the magnitude so that its CERTIFIED_DIGITS leading digits are its integer part.
+    Quad ScaleToCertifiedDigits(Quad const& magnitude, int32_t decimalExp)
+    {
+        int32_t exponent = QuadDouble::CERTIFIED_DIGITS - 1 - decimalExp;
+        return exponent >= 0 ? Mul(magnitude, PowerOfTen(exponent)) : Div(magnitude, PowerOfTen(-exponent));
+    }
+
+    // True when every value within the bound rounds to the same CERTIFIED_DIGITS significant digits as the value.
+    bool IsCertified(Quad const& value)
+    {
+        double leading = fabs(value.c[0]);
+        if (!(leading >= MINCERTIFIED && leading <= MAXCERTIFIED) || !(value.error <= leading * MAXRELATIVEERROR))
+        {
+            return false;
+        }
+
+        Quad magnitude = value.c[0] < 0.0 ? Negate(value) : value;
+        int32_t decimalExp = static_cast<int32_t>(floor(log10(leading)));
+        Quad scaled = ScaleToCertifiedDigits(magnitude, decimalExp);
+
+        // log10 can be off by one next to a power of ten
+        static const double lowestScaled = pow(10.0, QuadDouble::CERTIFIED_DIGITS - 1);
+        if (scaled.c[0] < lowestScaled)
+        {
+            scaled = ScaleToCertifiedDigits(magnitude, --decimalExp);
+        }
+        else if (scaled.c[0] >= 10.0 * lowestScaled)
+        {
+            scaled = ScaleToCertifiedDigits(magnitude, ++decimalExp);
+        }
+
+        // Remove the integer part, the leading components of a number this large are integers themselves
+        Quad fraction = scaled;
+        for (int i = 0; i < 4; i++)
+        {
+            fraction = Sub(fraction, FromDouble(nearbyint(fraction.c[0])));
+        }
+
+        // The remaining components are far below the slack
+        double distanceToHalf = 0.5 - fabs(fraction.c[0] + fraction.c[1]);
+        return distanceToHalf > Up(fraction.error + 0x1p-40);
+    }
+
+    bool TryResult(Quad const& value, Rational& result)
+    {
+        Quad trimmed = Trim(value);
+        if (!IsCertified(trimmed))
+        {
+            return false;
+        }
+
+        result = ToRational(trimmed);
+        return true;
+    }
+
+    // The certified digits are only the right ones when the series would not give more of them, in the same radix
+    bool IsPrecisionCertified()
+    {
+        return g_radix == QuadDouble::CERTIFIED_RADIX && g_precision <= QuadDouble::CERTIFIED_DIGITS;
+    }
+
+    bool TryTrig(Rational const& rat, AngleType angletype, bool sine, Rational& result)
+    {
+        if (!IsPrecisionCertified())
+        {
+            return false;
+        }
+
+        Quad x, r;
+        int quadrant;
+        if (!FromRational(rat, x) || !ReduceAngle(x, angletype, r, quadrant))
+        {
+            return false;
+        }
+
+        // sin(r + pi/2) = cos(r) and cos(r + pi/2) = -sin(r)
+        if (!sine)
+        {
+            quadrant = (quadrant + 1) % 4;
+        }
+
+        Quad value = (quadrant % 2 == 0) ? SinSeries(r) : CosSeries(r);
+        return TryResult(quadrant >= 2 ? Negate(value) : value, result);
+    }
+}
+
+bool QuadDouble::TryExp(Rational const& rat, Rational& result)
+{
+    if (!IsPrecisionCertified())
+    {
+        return false;
+    }
+
+    Quad x;
+    if (!FromRational(rat, x) || !(fabs(x.c[0]) <= MAXEXPARGUMENT))
+    {
+        return false;
+    }
+
+    return TryResult(Exp(x), result);
+}
+
+bool QuadDouble::TryLog(Rational const& rat, Rational& result)
+{
+    if (!IsPrecisionCertified())
+    {
+        return false;
+    }
+
+    Quad x;
+    if (!FromRational(rat, x) || !(x.c[0] > 0.0) || !(x.error < x.c[0] * 0.5))
+    {
+        return false;
+    }
+
+    return TryResult(Log(x), result);
+}
+
+bool QuadDouble::TrySin(Rational const& rat, AngleType angletype, Rational& result)
+{
+    return TryTrig(rat, angletype, true, result);
+}
+
+bool QuadDouble::TryCos(Rational const& rat, AngleType angletype, Rational& result)
+{
+    return TryTrig(rat, angletype, false, result);
+}
+
+bool QuadDouble::TryTan(Rational const& rat, AngleType angletype, Rational& result)
+{
+    if (!IsPrecisionCertified())
+    {
+        return false;
+    }
+
+    Quad x, r;
+    int quadrant;
+    if (!FromRational(rat, x) || !ReduceAngle(x, angletype, r, quadrant))
+    {
+        return false;
+    }
+
+    // tan(r + pi/2) = -cos(r)/sin(r), the period is pi
+    Quad sine = SinSeries(r);
+    Quad cosine = CosSeries(r);
+    Quad value = (quadrant % 2 == 0) ? Div(sine, cosine) : Negate(Div(cosine, sine));
+    return TryResult(value, result);
+}
@@ -1,11 +1,25 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+#include <atomic>
 #include "Header Files/RationalMath.h"
+#include "Header Files/QuadDouble.h"
 
 using namespace std;
 using namespace CalcEngine;
 
+namespace
+{
+    atomic<uint64_t> s_fastPathHits{ 0 };
+    atomic<uint64_t> s_fastPathMisses{ 0 };
+
+    bool CountFastPath(bool hit)
+    {
+        (hit ? s_fastPathHits : s_fastPathMisses).fetch_add(1, memory_order_relaxed);
+        return hit;
+    }
+}
+
 Rational RationalMath::Frac(Rational const& rat)
 {
     PRAT prat = rat.ToPRAT();
@@ -94,6 +108,12 @@ Rational RationalMath::Fact(Rational const& rat)
 
 Rational RationalMath::Exp(Rational const& rat)
 {
+    Rational certified;
+    if (CountFastPath(QuadDouble::TryExp(rat, certified)))
+    {
+        return certified;
+    }
+
     PRAT prat = rat.ToPRAT();
 
     try
@@ -114,6 +134,12 @@ Rational RationalMath::Exp(Rational const& rat)
 
 Rational RationalMath::Log(Rational const& rat)
 {
+    Rational certified;
+    if (CountFastPath(QuadDouble::TryLog(rat, certified)))
+    {
+        return certified;
+    }
+
     PRAT prat = rat.ToPRAT();
 
     try
@@ -149,6 +175,12 @@ Rational RationalMath::Abs(Rational const& rat)
 
 Rational RationalMath::Sin(Rational const& rat, AngleType angletype)
 {
+    Rational certified;
+    if (CountFastPath(QuadDouble::TrySin(rat, angletype, certified)))
+    {
+        return certified;
+    }
+
     PRAT prat = rat.ToPRAT();
 
     try
@@ -169,6 +201,12 @@ Rational RationalMath::Sin(Rational const& rat, AngleType angletype)
 
 Rational RationalMath::Cos(Rational const& rat, AngleType angletype)
 {
+    Rational certified;
+    if (CountFastPath(QuadDouble::TryCos(rat, angletype, certified)))
+    {
+        return certified;
+    }
+
     PRAT prat = rat.ToPRAT();
 
     try
@@ -189,6 +227,12 @@ Rational RationalMath::Cos(Rational const& rat, AngleType angletype)
 
 Rational RationalMath::Tan(Rational const& rat, AngleType angletype)
 {
+    Rational certified;
+    if (CountFastPath(QuadDouble::TryTan(rat, angletype, certified)))
+    {
+        return certified;
+    }
+
     PRAT prat = rat.ToPRAT();
 
     try
@@ -416,3 +460,14 @@ Rational RationalMath::Mod(Rational const& a, Rational const& b)
     destroyrat(prat);
     return res;
 }
+
+RationalMath::FastPathStatistics RationalMath::GetFastPathStatistics()
+{
+    return FastPathStatistics{ s_fastPathHits.load(memory_order_relaxed), s_fastPathMisses.load(memory_order_relaxed) };
+}
+
+void RationalMath::ResetFastPathStatistics()
+{
+    s_fastPathHits.store(0, memory_order_relaxed);
+    s_fastPathMisses.store(0, memory_order_relaxed);
+}
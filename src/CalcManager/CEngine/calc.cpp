@@ -24,7 +24,7 @@ static constexpr wstring_view DEFAULT_NUMBER_STR = L"0";
 // Read strings for keys, errors, trig types, etc.
 // These will be copied from the resources to local memory.
 
-unordered_map<wstring_view, wstring> CCalcEngine::s_engineStrings;
+array<wstring, ENGINESTR_TABLE_SIZE> CCalcEngine::s_engineStrings;
 
 void CCalcEngine::LoadEngineStrings(CalculationManager::IResourceProvider& resourceProvider)
 {
@@ -33,7 +33,7 @@ void CCalcEngine::LoadEngineStrings(CalculationManager::IResourceProvider& resou
         auto locString = resourceProvider.GetCEngineString(sid);
         if (!locString.empty())
         {
-            s_engineStrings[sid] = locString;
+            s_engineStrings[EngineStringIndex(sid)] = locString;
         }
     }
 }
@@ -186,7 +186,7 @@ void CCalcEngine::SettingsChanged()
         m_HistoryCollector.SetDecimalSymbol(m_decimalSeparator);
 
         // put the new decimal symbol into the table used to draw the decimal key
-        s_engineStrings[SIDS_DECIMAL_SEPARATOR] = m_decimalSeparator;
+        s_engineStrings[EngineStringIndex(SIDS_DECIMAL_SEPARATOR)] = m_decimalSeparator;
 
         // we need to redraw to update the decimal point button
         numChanged = true;
@@ -912,24 +912,44 @@ void CCalcEngine::DisplayAnnounceBinaryOperator()
 // Unary operator Function Name table Element
 // since unary operators button names aren't exactly friendly for history purpose,
 // we have this separate table to get its localized name and for its Inv function if it exists.
+// The resource keys are turned into engine string table indices at compile time, -1 when there is no string.
 struct FunctionNameElement
 {
-    wstring degreeString;        // Used by default if there are no rad or grad specific strings.
-    wstring inverseDegreeString; // Will fall back to degreeString if empty
+    constexpr FunctionNameElement(
+        wstring_view degree,
+        wstring_view inverseDegree = {},
+        wstring_view rad = {},
+        wstring_view inverseRad = {},
+        wstring_view grad = {},
+        wstring_view inverseGrad = {},
+        wstring_view programmerMode = {})
+        : degreeString{ EngineStringIndex(degree) }
+        , inverseDegreeString{ EngineStringIndex(inverseDegree) }
+        , radString{ EngineStringIndex(rad) }
+        , inverseRadString{ EngineStringIndex(inverseRad) }
+        , gradString{ EngineStringIndex(grad) }
+        , inverseGradString{ EngineStringIndex(inverseGrad) }
+        , programmerModeString{ EngineStringIndex(programmerMode) }
+        , hasAngleStrings{ (radString != -1) || (inverseRadString != -1) || (gradString != -1) || (inverseGradString != -1) }
+    {
+    }
 
-    wstring radString;
-    wstring inverseRadString; // Will fall back to radString if empty
+    int degreeString;        // Used by default if there are no rad or grad specific strings.
+    int inverseDegreeString; // Will fall back to degreeString if empty
 
-    wstring gradString;
-    wstring inverseGradString; // Will fall back to gradString if empty
+    int radString;
+    int inverseRadString; // Will fall back to radString if empty
 
-    wstring programmerModeString;
+    int gradString;
+    int inverseGradString; // Will fall back to gradString if empty
 
-    bool hasAngleStrings = ((!radString.empty()) || (!inverseRadString.empty()) || (!gradString.empty()) || (!inverseGradString.empty()));
+    int programmerModeString;
+
+    bool hasAngleStrings;
 };
 
 // Table for each unary operator
-static const std::unordered_map<int, FunctionNameElement> operatorStringTable = {
+static constexpr pair<int, FunctionNameElement> operatorStringTable[] = {
     { IDC_CHOP, { L"", SIDS_FRAC } },
 
     { IDC_SIN, { SIDS_SIND, SIDS_ASIND, SIDS_SINR, SIDS_ASINR, SIDS_SING, SIDS_ASING } },
@@ -970,53 +990,84 @@ static const std::unordered_map<int, FunctionNameElement> operatorStringTable =
     { IDC_MOD, { SIDS_MOD, L"", L"", L"", L"", L"", SIDS_PROGRAMMER_MOD } },
 };
 
+static constexpr int operatorStringTableMax = [] {
+    int maxOpCode = 0;
+    for (const auto& entry : operatorStringTable)
+    {
+        maxOpCode = max(maxOpCode, entry.first);
+    }
+    return maxOpCode;
+}();
+
+// Position of each op code in operatorStringTable, -1 if the op code has no entry
+static constexpr auto operatorStringTableIndex = [] {
+    array<int8_t, operatorStringTableMax + 1> index{};
+    for (auto& position : index)
+    {
+        position = -1;
+    }
+    for (size_t i = 0; i < size(operatorStringTable); i++)
+    {
+        index[operatorStringTable[i].first] = static_cast<int8_t>(i);
+    }
+    return index;
+}();
+
+static const FunctionNameElement* FindFunctionNameElement(int nOpCode)
+{
+    if (nOpCode < 0 || nOpCode > operatorStringTableMax || operatorStringTableIndex[nOpCode] == -1)
+    {
+        return nullptr;
+    }
+    return &operatorStringTable[operatorStringTableIndex[nOpCode]].second;
+}
+
 wstring_view CCalcEngine::OpCodeToUnaryString(int nOpCode, bool fInv, AngleType angletype)
 {
     // Try to lookup the ID in the UFNE table
-    wstring ids = L"";
+    int ids = -1;
 
-    if (auto pair = operatorStringTable.find(nOpCode); pair != operatorStringTable.end())
+    if (const FunctionNameElement* element = FindFunctionNameElement(nOpCode))
     {
-        const FunctionNameElement& element = pair->second;
-        if (!element.hasAngleStrings || AngleType::Degrees == angletype)
+        if (!element->hasAngleStrings || AngleType::Degrees == angletype)
         {
             if (fInv)
             {
-                ids = element.inverseDegreeString;
+                ids = element->inverseDegreeString;
             }
 
-            if (ids.empty())
+            if (ids == -1)
             {
-                ids = element.degreeString;
+                ids = element->degreeString;
             }
         }
         else if (AngleType::Radians == angletype)
         {
             if (fInv)
             {
-                ids = element.inverseRadString;
+                ids = element->inverseRadString;
             }
-            if (ids.empty())
+            if (ids == -1)
             {
-                ids = element.radString;
+                ids = element->radString;
             }
         }
         else if (AngleType::Gradians == angletype)
         {
             if (fInv)
             {
-                ids = element.inverseGradString;
+                ids = element->inverseGradString;
             }
-            if (ids.empty())
+            if (ids == -1)
             {
-                ids = element.gradString;
+                ids = element->gradString;
             }
         }
     }
 
-    if (!ids.empty())
+    if (ids != -1)
     {
-        return GetString(ids);
+        return EngineString(ids);
     }
 
     // If we didn't find an ID in the table, use the op code.
@@ -1026,23 +1077,23 @@ wstring_view CCalcEngine::OpCodeToUnaryString(int nOpCode, bool fInv, AngleType
 wstring_view CCalcEngine::OpCodeToBinaryString(int nOpCode, bool isIntegerMode)
 {
     // Try to lookup the ID in the UFNE table
-    wstring ids = L"";
+    int ids = -1;
 
-    if (auto pair = operatorStringTable.find(nOpCode); pair != operatorStringTable.end())
+    if (const FunctionNameElement* element = FindFunctionNameElement(nOpCode))
     {
-        if (isIntegerMode && !pair->second.programmerModeString.empty())
+        if (isIntegerMode && element->programmerModeString != -1)
         {
-            ids = pair->second.programmerModeString;
+            ids = element->programmerModeString;
         }
         else
         {
-            ids = pair->second.degreeString;
+            ids = element->degreeString;
         }
     }
 
-    if (!ids.empty())
+    if (ids != -1)
     {
-        return GetString(ids);
+        return EngineString(ids);
     }
 
     // If we didn't find an ID in the table, use the op code.
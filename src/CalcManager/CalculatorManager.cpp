@@ -5,6 +5,7 @@
 #include "Header Files/CalcEngine.h"
 #include "CalculatorManager.h"
 #include "CalculatorResource.h"
+#include "StateSerializer.h"
 
 using namespace std;
 using namespace CalcEngine;
@@ -100,6 +101,21 @@ namespace CalculationManager
         m_displayCallback->SetMemorizedNumbers(memorizedNumbers);
     }
 
+    void CalculatorManager::OnMemorizedNumberInserted(_In_ unsigned int indexOfMemory, _In_ const wstring& memorizedNumber)
+    {
+        m_displayCallback->OnMemorizedNumberInserted(indexOfMemory, memorizedNumber);
+    }
+
+    void CalculatorManager::OnMemorizedNumberUpdated(_In_ unsigned int indexOfMemory, _In_ const wstring& memorizedNumber)
+    {
+        m_displayCallback->OnMemorizedNumberUpdated(indexOfMemory, memorizedNumber);
+    }
+
+    void CalculatorManager::OnMemorizedNumberRemoved(_In_ unsigned int indexOfMemory)
+    {
+        m_displayCallback->OnMemorizedNumberRemoved(indexOfMemory);
+    }
+
     /// <summary>
     /// Callback from the engine
     /// </summary>
@@ -318,7 +334,7 @@ namespace CalculationManager
 
     /// <summary>
     /// Memorize the current displayed value
-    /// Notify the client with new the new memorize value vector
+    /// Notify the client with the new memorized value, and with the oldest one if it was dropped
     /// </summary>
     void CalculatorManager::MemorizeNumber()
     {
@@ -330,16 +346,19 @@ namespace CalculationManager
         m_currentCalculatorEngine->ProcessCommand(IDC_STORE);
 
         auto memoryObjectPtr = m_currentCalculatorEngine->PersistedMemObject();
-        if (memoryObjectPtr != nullptr)
+        if (memoryObjectPtr == nullptr)
         {
-            m_memorizedNumbers.insert(m_memorizedNumbers.begin(), *memoryObjectPtr);
+            return;
         }
 
-        if (m_memorizedNumbers.size() > m_maximumMemorySize)
+        if (m_memorizedNumbers.size() >= m_maximumMemorySize)
         {
-            m_memorizedNumbers.resize(m_maximumMemorySize);
+            m_memorizedNumbers.pop_back();
+            this->OnMemorizedNumberRemoved(static_cast<unsigned int>(m_memorizedNumbers.size()));
         }
-        this->SetMemorizedNumbersString();
+
+        m_memorizedNumbers.push_front(*memoryObjectPtr);
+        this->OnMemorizedNumberInserted(0, MemorizedNumberString(m_memorizedNumbers.front()));
     }
 
     /// <summary>
@@ -382,8 +401,6 @@ namespace CalculationManager
             m_currentCalculatorEngine->ProcessCommand(IDC_MPLUS);
 
             this->MemorizedNumberChanged(indexOfMemory);
-
-            this->SetMemorizedNumbersString();
         }
 
         m_displayCallback->MemoryItemChanged(indexOfMemory);
@@ -394,6 +411,7 @@ namespace CalculationManager
         if (indexOfMemory < m_memorizedNumbers.size())
         {
             m_memorizedNumbers.erase(m_memorizedNumbers.begin() + indexOfMemory);
+            this->OnMemorizedNumberRemoved(indexOfMemory);
         }
     }
 
@@ -423,8 +441,6 @@ namespace CalculationManager
             m_currentCalculatorEngine->ProcessCommand(IDC_MMINUS);
 
             this->MemorizedNumberChanged(indexOfMemory);
-
-            this->SetMemorizedNumbersString();
         }
 
         m_displayCallback->MemoryItemChanged(indexOfMemory);
@@ -461,6 +477,7 @@ namespace CalculationManager
     /// <summary>
     /// Helper function that needs to be executed when memory is modified
     /// When memory is modified, destroy the old RAT and put the new RAT in vector
+    /// Notify the client with the new string of that memory only
     /// </summary>
     /// <param name="indexOfMemory">Index of the target memory</param>
     void CalculatorManager::MemorizedNumberChanged(_In_ unsigned int indexOfMemory)
@@ -474,9 +491,21 @@ namespace CalculationManager
         if (memoryObject != nullptr)
         {
             m_memorizedNumbers.at(indexOfMemory) = *memoryObject;
+            this->OnMemorizedNumberUpdated(indexOfMemory, MemorizedNumberString(*memoryObject));
         }
     }
 
+    /// <summary>
+    /// Helper function that renders a memory with the current display format
+    /// </summary>
+    /// <param name="memorizedNumber">The target memory</param>
+    wstring CalculatorManager::MemorizedNumberString(_In_ Rational const& memorizedNumber)
+    {
+        auto radix = m_currentCalculatorEngine->GetCurrentRadix();
+        wstring stringValue = m_currentCalculatorEngine->GetStringForDisplay(memorizedNumber, radix);
+        return stringValue.empty() ? stringValue : m_currentCalculatorEngine->GroupDigitsPerRadix(stringValue, radix);
+    }
+
     vector<shared_ptr<HISTORYITEM>> const& CalculatorManager::GetHistoryItems() const
     {
         return m_pHistory->GetHistory();
@@ -538,17 +567,21 @@ namespace CalculationManager
         SetMemorizedNumbersString();
     }
 
+    /// <summary>
+    /// Render all the memories again with the current display format and send them to the client
+    /// Used when the radix, precision or word size of the display changed
+    /// </summary>
     void CalculatorManager::SetMemorizedNumbersString()
     {
         vector<wstring> resultVector;
-        for (auto const& memoryItem : m_memorizedNumbers)
+        resultVector.reserve(m_memorizedNumbers.size());
+        for (auto& memoryItem : m_memorizedNumbers)
         {
-            auto radix = m_currentCalculatorEngine->GetCurrentRadix();
-            wstring stringValue = m_currentCalculatorEngine->GetStringForDisplay(memoryItem, radix);
+            wstring stringValue = MemorizedNumberString(memoryItem);
 
             if (!stringValue.empty())
             {
-                resultVector.push_back(m_currentCalculatorEngine->GroupDigitsPerRadix(stringValue, radix));
+                resultVector.push_back(stringValue);
             }
         }
         m_displayCallback->SetMemorizedNumbers(resultVector);
@@ -570,7 +603,13 @@ namespace CalculationManager
 
     void CalculatorManager::SetPrecision(int32_t precision)
     {
+        // A mode switch changes the precision, the memories are then shown with the digits of the new mode
+        bool isPrecisionChanged = m_currentCalculatorEngine->GetPrecision() != precision;
         m_currentCalculatorEngine->ChangePrecision(precision);
+        if (isPrecisionChanged && !m_memorizedNumbers.empty())
+        {
+            SetMemorizedNumbersString();
+        }
     }
 
     void CalculatorManager::UpdateMaxIntDigits()
@@ -602,4 +641,64 @@ namespace CalculationManager
     {
         return m_currentCalculatorEngine->GetHistoryCollectorCommandsSnapshot();
     }
+
+    /// <summary>
+    /// Write the history of both modes and the memories into a buffer LoadState can restore them from
+    /// </summary>
+    vector<uint8_t> CalculatorManager::SaveState() const
+    {
+        CalculatorState state;
+        state.standardHistory = m_pStdHistory->GetHistory();
+        state.scientificHistory = m_pSciHistory->GetHistory();
+
+        state.memorizedNumbers.assign(m_memorizedNumbers.begin(), m_memorizedNumbers.end());
+
+        return StateSerializer::Serialize(state);
+    }
+
+    /// <summary>
+    /// Replace the history of both modes and the memories with the ones saved by SaveState
+    /// No command is sent to the engine, the operands keep the values they were saved with
+    /// </summary>
+    /// <param name="data">Buffer written by SaveState</param>
+    /// <param name="size">Size of the buffer in bytes</param>
+    /// <returns>False if the buffer could not be read, the current state is then left as it is</returns>
+    bool CalculatorManager::LoadState(_In_ const uint8_t* data, size_t size)
+    {
+        CalculatorState state;
+        if (!StateSerializer::Deserialize(data, size, state))
+        {
+            return false;
+        }
+
+        auto restoreHistory = [this](CalculatorHistory* history, vector<shared_ptr<HISTORYITEM>> const& historyItems) {
+            history->ClearHistory();
+            for (auto const& historyItem : historyItems)
+            {
+                auto index = history->AddItem(historyItem);
+                if (history == m_pHistory)
+                {
+                    OnHistoryItemAdded(index);
+                }
+            }
+        };
+        restoreHistory(m_pStdHistory.get(), state.standardHistory);
+        restoreHistory(m_pSciHistory.get(), state.scientificHistory);
+
+        m_memorizedNumbers.clear();
+        for (auto& rat : state.memorizedNumbers)
+        {
+            if (m_memorizedNumbers.size() < m_maximumMemorySize)
+            {
+                m_memorizedNumbers.push_back(move(rat));
+            }
+        }
+
+        if (m_currentCalculatorEngine != nullptr)
+        {
+            SetMemorizedNumbersString();
+        }
+
+        return true;
+    }
 }
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <deque>
 #include "CalculatorHistory.h"
 #include "Header Files/CalcEngine.h"
 #include "Header Files/Rational.h"
@@ -53,13 +54,14 @@ namespace CalculationManager
         IResourceProvider* const m_resourceProvider;
         bool m_inHistoryItemLoadMode;
 
-        std::vector<CalcEngine::Rational> m_memorizedNumbers;
+        std::deque<CalcEngine::Rational> m_memorizedNumbers;
         CalcEngine::Rational m_persistedPrimaryValue;
         bool m_isExponentialFormat;
         Command m_currentDegreeMode;
 
         void MemorizedNumberSelect(_In_ unsigned int);
         void MemorizedNumberChanged(_In_ unsigned int);
+        std::wstring MemorizedNumberString(_In_ CalcEngine::Rational const& memorizedNumber);
 
         void LoadPersistedPrimaryValue();
 
@@ -75,6 +77,9 @@ namespace CalculationManager
             _Inout_ std::shared_ptr<std::vector<std::pair<std::wstring, int>>> const& tokens,
             _Inout_ std::shared_ptr<std::vector<std::shared_ptr<IExpressionCommand>>> const& commands) override;
         void SetMemorizedNumbers(_In_ const std::vector<std::wstring>& memorizedNumbers) override;
+        void OnMemorizedNumberInserted(_In_ unsigned int indexOfMemory, _In_ const std::wstring& memorizedNumber) override;
+        void OnMemorizedNumberUpdated(_In_ unsigned int indexOfMemory, _In_ const std::wstring& memorizedNumber) override;
+        void OnMemorizedNumberRemoved(_In_ unsigned int indexOfMemory) override;
         void OnHistoryItemAdded(_In_ unsigned int addedItemIndex) override;
         void SetParenthesisNumber(_In_ unsigned int parenthesisCount) override;
         void OnNoRightParenAdded() override;
@@ -120,5 +125,8 @@ namespace CalculationManager
         CalculationManager::Command GetCurrentDegreeMode();
         void SetInHistoryItemLoadMode(_In_ bool isHistoryItemLoadMode);
         std::vector<std::shared_ptr<IExpressionCommand>> GetDisplayCommandsSnapshot() const;
+
+        std::vector<uint8_t> SaveState() const;
+        bool LoadState(_In_ const uint8_t* data, size_t size);
     };
 }
@@ -1,6 +1,7 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+#include <stdexcept>
 #include <string>
 #include "Header Files/CCommand.h"
 #include "ExpressionCommand.h"
@@ -12,6 +13,170 @@ constexpr wchar_t chNegate = L'-';
 constexpr wchar_t chExp = L'e';
 constexpr wchar_t chPlus = L'+';
 
+// 4 bit codes of the packable keystrokes, the digits use their own value
+constexpr uint8_t PACKED_PNT = 10;
+constexpr uint8_t PACKED_EXP = 11;
+constexpr uint8_t PACKED_SIGN = 12;
+constexpr uint8_t PACKED_NONE = 0xFF;
+
+static uint8_t PackedCodeFromCommand(int command)
+{
+    if (command >= IDC_0 && command <= IDC_9)
+    {
+        return static_cast<uint8_t>(command - IDC_0);
+    }
+
+    switch (command)
+    {
+    case IDC_PNT:
+        return PACKED_PNT;
+    case IDC_EXP:
+        return PACKED_EXP;
+    case IDC_SIGN:
+        return PACKED_SIGN;
+    default:
+        return PACKED_NONE;
+    }
+}
+
+static int CommandFromPackedCode(uint8_t code)
+{
+    switch (code)
+    {
+    case PACKED_PNT:
+        return IDC_PNT;
+    case PACKED_EXP:
+        return IDC_EXP;
+    case PACKED_SIGN:
+        return IDC_SIGN;
+    default:
+        return IDC_0 + code;
+    }
+}
+
+CPackedCommands::CPackedCommands()
+    : m_codes{}
+    , m_size(0)
+{
+}
+
+CPackedCommands::CPackedCommands(vector<int> const& commands)
+    : CPackedCommands()
+{
+    for (int command : commands)
+    {
+        push_back(command);
+    }
+}
+
+CPackedCommands::CPackedCommands(CPackedCommands const& other)
+    : m_codes(other.m_codes)
+    , m_size(other.m_size)
+    , m_unpacked(other.m_unpacked ? make_unique<vector<int>>(*other.m_unpacked) : nullptr)
+{
+}
+
+CPackedCommands& CPackedCommands::operator=(CPackedCommands const& other)
+{
+    if (this != &other)
+    {
+        m_codes = other.m_codes;
+        m_size = other.m_size;
+        m_unpacked = other.m_unpacked ? make_unique<vector<int>>(*other.m_unpacked) : nullptr;
+    }
+    return *this;
+}
+
+size_t CPackedCommands::size() const
+{
+    return m_unpacked ? m_unpacked->size() : m_size;
+}
+
+bool CPackedCommands::empty() const
+{
+    return size() == 0;
+}
+
+int CPackedCommands::at(size_t index) const
+{
+    if (m_unpacked)
+    {
+        return m_unpacked->at(index);
+    }
+
+    if (index >= m_size)
+    {
+        throw out_of_range("CPackedCommands::at");
+    }
+
+    uint8_t code = m_codes[index / 2];
+    return CommandFromPackedCode((index % 2 == 0) ? (code & 0x0F) : (code >> 4));
+}
+
+int CPackedCommands::back() const
+{
+    return at(size() - 1);
+}
+
+void CPackedCommands::push_back(int command)
+{
+    if (!m_unpacked)
+    {
+        uint8_t code = PackedCodeFromCommand(command);
+        if (code != PACKED_NONE && m_size < c_inlineCommands)
+        {
+            uint8_t& packed = m_codes[m_size / 2];
+            packed = (m_size % 2 == 0) ? code : static_cast<uint8_t>((packed & 0x0F) | (code << 4));
+            m_size++;
+            return;
+        }
+
+        Unpack();
+    }
+
+    m_unpacked->push_back(command);
+}
+
+void CPackedCommands::pop_back()
+{
+    if (m_unpacked)
+    {
+        m_unpacked->pop_back();
+    }
+    else if (m_size > 0)
+    {
+        m_size--;
+    }
+}
+
+void CPackedCommands::clear()
+{
+    m_unpacked.reset();
+    m_size = 0;
+}
+
+vector<int> CPackedCommands::ToVector() const
+{
+    if (m_unpacked)
+    {
+        return *m_unpacked;
+    }
+
+    vector<int> commands;
+    commands.reserve(m_size);
+    for (size_t i = 0; i < m_size; i++)
+    {
+        commands.push_back(at(i));
+    }
+    return commands;
+}
+
+void CPackedCommands::Unpack()
+{
+    m_unpacked = make_unique<vector<int>>(ToVector());
+    m_size = 0;
+}
+
 CParentheses::CParentheses(_In_ int command)
     : m_command(command)
 {
@@ -33,21 +198,24 @@ void CParentheses::Accept(_In_ ISerializeCommandVisitor& commandVisitor)
 }
 
 CUnaryCommand::CUnaryCommand(int command)
+    : m_command{ command, 0 }
+    , m_commandCount(1)
 {
-    m_command = make_shared<vector<int>>();
-    m_command->push_back(command);
 }
 
 CUnaryCommand::CUnaryCommand(int command1, int command2)
+    : m_command{ command1, command2 }
+    , m_commandCount(2)
 {
-    m_command = make_shared<vector<int>>();
-    m_command->push_back(command1);
-    m_command->push_back(command2);
 }
 
 const shared_ptr<vector<int>>& CUnaryCommand::GetCommands() const
 {
-    return m_command;
+    if (m_commandVector == nullptr)
+    {
+        m_commandVector = make_shared<vector<int>>(m_command.begin(), m_command.begin() + m_commandCount);
+    }
+    return m_commandVector;
 }
 
 CalculationManager::CommandType CUnaryCommand::GetCommandType() const
@@ -57,15 +225,16 @@ CalculationManager::CommandType CUnaryCommand::GetCommandType() const
 
 void CUnaryCommand::SetCommand(int command)
 {
-    m_command->clear();
-    m_command->push_back(command);
+    m_command = { command, 0 };
+    m_commandCount = 1;
+    m_commandVector = nullptr;
 }
 
 void CUnaryCommand::SetCommands(int command1, int command2)
 {
-    m_command->clear();
-    m_command->push_back(command1);
-    m_command->push_back(command2);
+    m_command = { command1, command2 };
+    m_commandCount = 2;
+    m_commandVector = nullptr;
 }
 
 void CUnaryCommand::Accept(_In_ ISerializeCommandVisitor& commandVisitor)
@@ -99,11 +268,17 @@ void CBinaryCommand::Accept(_In_ ISerializeCommandVisitor& commandVisitor)
 }
 
 COpndCommand::COpndCommand(shared_ptr<vector<int>> const& commands, bool fNegative, bool fDecimal, bool fSciFmt)
-    : m_commands(commands)
+    : COpndCommand(CPackedCommands(*commands), fNegative, fDecimal, fSciFmt)
+{
+}
+
+COpndCommand::COpndCommand(CPackedCommands commands, bool fNegative, bool fDecimal, bool fSciFmt)
+    : m_commands(move(commands))
     , m_fNegative(fNegative)
     , m_fSciFmt(fSciFmt)
     , m_fDecimal(fDecimal)
     , m_fInitialized(false)
+    , m_tokenDecimalSymbol(0)
     , m_value{}
 {
 }
@@ -114,14 +289,34 @@ void COpndCommand::Initialize(Rational const& rat)
     m_fInitialized = true;
 }
 
+bool COpndCommand::HasValue() const
+{
+    return m_fInitialized;
+}
+
+Rational const& COpndCommand::GetValue() const
+{
+    return m_value;
+}
+
 const shared_ptr<vector<int>>& COpndCommand::GetCommands() const
 {
-    return m_commands;
+    if (m_commandVector == nullptr)
+    {
+        m_commandVector = make_shared<vector<int>>(m_commands.ToVector());
+    }
+    return m_commandVector;
 }
 
 void COpndCommand::SetCommands(shared_ptr<vector<int>> const& commands)
 {
-    m_commands = commands;
+    SetCommands(CPackedCommands(*commands));
+}
+
+void COpndCommand::SetCommands(CPackedCommands commands)
+{
+    m_commands = move(commands);
+    CommandsChanged();
 }
 
 void COpndCommand::AppendCommand(int command)
@@ -132,7 +327,8 @@ void COpndCommand::AppendCommand(int command)
     }
     else
     {
-        m_commands->push_back(command);
+        m_commands.push_back(command);
+        CommandsChanged();
     }
 
     if (command == IDC_PNT)
@@ -143,11 +339,12 @@ void COpndCommand::AppendCommand(int command)
 
 void COpndCommand::ToggleSign()
 {
-    for (int nOpCode : *m_commands)
+    for (size_t i = 0; i < m_commands.size(); i++)
     {
-        if (nOpCode != IDC_0)
+        if (m_commands.at(i) != IDC_0)
         {
             m_fNegative = !m_fNegative;
+            m_tokenDecimalSymbol = 0;
             break;
         }
     }
@@ -161,7 +358,7 @@ void COpndCommand::RemoveFromEnd()
     }
     else
     {
-        const size_t nCommands = m_commands->size();
+        const size_t nCommands = m_commands.size();
 
         if (nCommands == 1)
         {
@@ -169,14 +366,15 @@ void COpndCommand::RemoveFromEnd()
         }
         else
         {
-            int nOpCode = m_commands->at(nCommands - 1);
+            int nOpCode = m_commands.at(nCommands - 1);
 
             if (nOpCode == IDC_PNT)
             {
                 m_fDecimal = false;
             }
 
-            m_commands->pop_back();
+            m_commands.pop_back();
+            CommandsChanged();
         }
     }
 }
@@ -203,23 +401,36 @@ CalculationManager::CommandType COpndCommand::GetCommandType() const
 
 void COpndCommand::ClearAllAndAppendCommand(CalculationManager::Command command)
 {
-    m_commands->clear();
-    m_commands->push_back(static_cast<int>(command));
+    m_commands.clear();
+    m_commands.push_back(static_cast<int>(command));
     m_fSciFmt = false;
     m_fNegative = false;
     m_fDecimal = false;
+    CommandsChanged();
+}
+
+// Drop everything derived from the keystrokes, they are rebuilt the next time they are asked for
+void COpndCommand::CommandsChanged()
+{
+    m_commandVector = nullptr;
+    m_tokenDecimalSymbol = 0;
 }
 
 const wstring& COpndCommand::GetToken(wchar_t decimalSymbol)
 {
     static const wchar_t chZero = L'0';
 
-    const size_t nCommands = m_commands->size();
+    if (m_tokenDecimalSymbol != 0 && m_tokenDecimalSymbol == decimalSymbol)
+    {
+        return m_token;
+    }
+
+    const size_t nCommands = m_commands.size();
     m_token.clear();
 
     for (size_t i = 0; i < nCommands; i++)
     {
-        int nOpCode = (*m_commands)[i];
+        int nOpCode = m_commands.at(i);
 
         if (nOpCode == IDC_PNT)
         {
@@ -228,7 +439,7 @@ const wstring& COpndCommand::GetToken(wchar_t decimalSymbol)
         else if (nOpCode == IDC_EXP)
         {
             m_token += chExp;
-            int nextOpCode = m_commands->at(i + 1);
+            int nextOpCode = m_commands.at(i + 1);
             if (nextOpCode != IDC_SIGN)
             {
                 m_token += chPlus;
@@ -238,6 +449,10 @@ const wstring& COpndCommand::GetToken(wchar_t decimalSymbol)
         {
             m_token += chNegate;
         }
+        else if (nOpCode >= IDC_0 && nOpCode <= IDC_9)
+        {
+            m_token += static_cast<wchar_t>(chZero + (nOpCode - IDC_0));
+        }
         else
         {
             wstring num = to_wstring(nOpCode - IDC_0);
@@ -264,11 +479,13 @@ const wstring& COpndCommand::GetToken(wchar_t decimalSymbol)
                 m_token.insert(0, 1, chNegate);
             }
 
+            m_tokenDecimalSymbol = decimalSymbol;
             return m_token;
         }
     }
 
     m_token = chZero;
+    m_tokenDecimalSymbol = decimalSymbol;
 
     return m_token;
 }
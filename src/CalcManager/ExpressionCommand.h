@@ -2,10 +2,43 @@
 // Licensed under the MIT License.
 
 #pragma once
+#include <array>
 #include "ExpressionCommandInterface.h"
 #include "Header Files/CalcEngine.h"
 #include "Header Files/Rational.h"
 
+// Keystrokes of an operand. The digits 0 to 9, the decimal point, the exponent and the sign are packed as 4 bit
+// codes in an inline buffer, which holds a full precision scientific number with its exponent. An operand with
+// any other keystroke, or one that is too long for the buffer, falls back to a vector of ints.
+class CPackedCommands
+{
+public:
+    CPackedCommands();
+    CPackedCommands(std::vector<int> const& commands);
+    CPackedCommands(CPackedCommands const& other);
+    CPackedCommands(CPackedCommands&& other) noexcept = default;
+    CPackedCommands& operator=(CPackedCommands const& other);
+    CPackedCommands& operator=(CPackedCommands&& other) noexcept = default;
+
+    size_t size() const;
+    bool empty() const;
+    int at(size_t index) const;
+    int back() const;
+    void push_back(int command);
+    void pop_back();
+    void clear();
+    std::vector<int> ToVector() const;
+
+private:
+    static constexpr size_t c_inlineCommands = 40;
+
+    void Unpack();
+
+    std::array<uint8_t, c_inlineCommands / 2> m_codes;
+    uint8_t m_size;
+    std::unique_ptr<std::vector<int>> m_unpacked;
+};
+
 class CParentheses final : public IParenthesisCommand
 {
 public:
@@ -30,7 +63,9 @@ public:
     void Accept(_In_ ISerializeCommandVisitor& commandVisitor) override;
 
 private:
-    std::shared_ptr<std::vector<int>> m_command;
+    std::array<int, 2> m_command;
+    size_t m_commandCount;
+    mutable std::shared_ptr<std::vector<int>> m_commandVector; // built by GetCommands, reset when the commands change
 };
 
 class CBinaryCommand final : public IBinaryCommand
@@ -50,10 +85,14 @@ class COpndCommand final : public IOpndCommand
 {
 public:
     COpndCommand(std::shared_ptr<std::vector<int>> const& commands, bool fNegative, bool fDecimal, bool fSciFmt);
+    COpndCommand(CPackedCommands commands, bool fNegative, bool fDecimal, bool fSciFmt);
     void Initialize(CalcEngine::Rational const& rat);
+    bool HasValue() const;
+    CalcEngine::Rational const& GetValue() const;
 
     const std::shared_ptr<std::vector<int>>& GetCommands() const override;
     void SetCommands(std::shared_ptr<std::vector<int>> const& commands) override;
+    void SetCommands(CPackedCommands commands);
     void AppendCommand(int command) override;
     void ToggleSign() override;
     void RemoveFromEnd() override;
@@ -66,14 +105,17 @@ public:
     std::wstring GetString(uint32_t radix, int32_t precision);
 
 private:
-    std::shared_ptr<std::vector<int>> m_commands;
+    CPackedCommands m_commands;
+    mutable std::shared_ptr<std::vector<int>> m_commandVector; // built by GetCommands, reset when the commands change
     bool m_fNegative;
     bool m_fSciFmt;
     bool m_fDecimal;
     bool m_fInitialized;
+    wchar_t m_tokenDecimalSymbol; // decimal symbol m_token was built with, 0 when m_token is out of date
     std::wstring m_token;
     CalcEngine::Rational m_value;
     void ClearAllAndAppendCommand(CalculationManager::Command command);
+    void CommandsChanged();
 };
 
 class ISerializeCommandVisitor
@@ -84,6 +84,10 @@ public:
         m_precision = precision;
         ChangeConstants(m_radix, precision);
     }
+    int32_t GetPrecision() const
+    {
+        return m_precision;
+    }
     std::wstring GroupDigitsPerRadix(std::wstring_view numberString, uint32_t radix);
     std::wstring GetStringForDisplay(CalcEngine::Rational const& rat, uint32_t radix);
     void UpdateMaxIntDigits();
@@ -95,12 +99,13 @@ public:
     static void
     InitialOneTimeOnlySetup(CalculationManager::IResourceProvider& resourceProvider); // Once per load time to call to initialize all shared global variables
     // returns the ptr to string representing the operator. Mostly same as the button, but few special cases for x^y etc.
+    // Only the numeric resource keys are ids, the named keys stored after them are not reachable from here.
     static std::wstring_view GetString(int ids)
     {
-        return s_engineStrings[std::to_wstring(ids)];
-    }
-    static std::wstring_view GetString(std::wstring_view ids)
-    {
+        if (ids < 0 || ids >= SIDS_NUMERIC_COUNT)
+        {
+            return {};
+        }
         return s_engineStrings[ids];
     }
     static std::wstring_view OpCodeToString(int nOpCode)
@@ -160,13 +165,23 @@ private:
 
     CHistoryCollector m_HistoryCollector; // Accumulator of each line of history as various commands are processed
 
-    std::array<CalcEngine::Rational, NUM_WIDTH_LENGTH> m_chopNumbers;           // word size enforcement
-    std::array<std::wstring, NUM_WIDTH_LENGTH> m_maxDecimalValueStrings;        // maximum values represented by a given word width based off m_chopNumbers
-    static std::unordered_map<std::wstring_view, std::wstring> s_engineStrings; // the string table shared across all instances
+    std::array<CalcEngine::Rational, NUM_WIDTH_LENGTH> m_chopNumbers;      // word size enforcement
+    std::array<std::wstring, NUM_WIDTH_LENGTH> m_maxDecimalValueStrings;   // maximum values represented by a given word width based off m_chopNumbers
+    static std::array<std::wstring, ENGINESTR_TABLE_SIZE> s_engineStrings; // the string table shared across all instances
     wchar_t m_decimalSeparator;
     wchar_t m_groupSeparator;
 
 private:
+    // Looks up any slot of the engine string table, as returned by EngineStringIndex.
+    static std::wstring_view EngineString(int index)
+    {
+        if (index < 0 || static_cast<size_t>(index) >= s_engineStrings.size())
+        {
+            return {};
+        }
+        return s_engineStrings[index];
+    }
+
     void ProcessCommandWorker(OpCode wParam);
     void ResolveHighestPrecedenceOperation();
     void HandleErrorCommand(OpCode idc);
@@ -360,3 +360,73 @@ inline constexpr std::array<std::wstring_view, 152> g_sids = {
     SIDS_CUBEROOT,
     SIDS_PROGRAMMER_MOD,
 };
+
+// Resource keys "0" to "120" are stored at their own number in the engine string table, the named keys follow them
+// in the order they appear in g_sids, so that strings can be looked up without hashing or building key strings.
+inline constexpr int SIDS_NUMERIC_COUNT = 121;
+
+constexpr bool IsNumericSid(std::wstring_view sid)
+{
+    if (sid.empty())
+    {
+        return false;
+    }
+
+    for (wchar_t ch : sid)
+    {
+        if (ch < L'0' || ch > L'9')
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Returns the index of the resource key in the engine string table, or -1 if the key is empty or not in g_sids.
+constexpr int EngineStringIndex(std::wstring_view sid)
+{
+    if (IsNumericSid(sid))
+    {
+        int index = 0;
+        for (wchar_t ch : sid)
+        {
+            index = index * 10 + (ch - L'0');
+        }
+
+        return index < SIDS_NUMERIC_COUNT ? index : -1;
+    }
+
+    int index = SIDS_NUMERIC_COUNT;
+    for (const auto& key : g_sids)
+    {
+        if (IsNumericSid(key))
+        {
+            continue;
+        }
+
+        if (key == sid)
+        {
+            return index;
+        }
+        index++;
+    }
+
+    return -1;
+}
+
+constexpr size_t EngineStringCount()
+{
+    size_t count = SIDS_NUMERIC_COUNT;
+    for (const auto& key : g_sids)
+    {
+        if (!IsNumericSid(key))
+        {
+            count++;
+        }
+    }
+
+    return count;
+}
+
+inline constexpr size_t ENGINESTR_TABLE_SIZE = EngineStringCount();
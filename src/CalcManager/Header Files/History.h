@@ -10,6 +10,7 @@
 #include "Rational.h"
 
 class COpndCommand;
+class CPackedCommands;
 
 // maximum depth you can get by precedence. It is just an array's size limit.
 static constexpr size_t MAXPRECDEPTH = 25;
@@ -65,5 +66,5 @@ private:
     void TruncateEquationSzFromIch(int ich);
     void SetExpressionDisplay();
     void InsertSzInEquationSz(std::wstring_view str, int icommandIndex, int ich);
-    std::shared_ptr<std::vector<int>> GetOperandCommandsFromString(std::wstring_view numStr) const;
+    CPackedCommands GetOperandCommandsFromString(std::wstring_view numStr) const;
 };
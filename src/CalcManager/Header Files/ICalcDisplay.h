@@ -20,6 +20,9 @@ public:
     virtual void BinaryOperatorReceived() = 0;
     virtual void OnHistoryItemAdded(_In_ unsigned int addedItemIndex) = 0;
     virtual void SetMemorizedNumbers(const std::vector<std::wstring>& memorizedNumbers) = 0;
+    virtual void OnMemorizedNumberInserted(_In_ unsigned int indexOfMemory, const std::wstring& memorizedNumber) = 0;
+    virtual void OnMemorizedNumberUpdated(_In_ unsigned int indexOfMemory, const std::wstring& memorizedNumber) = 0;
+    virtual void OnMemorizedNumberRemoved(_In_ unsigned int indexOfMemory) = 0;
     virtual void MemoryItemChanged(unsigned int indexOfMemory) = 0;
     virtual void InputChanged() = 0;
 };
@@ -0,0 +1,25 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "Rational.h"
+
+namespace CalcEngine::QuadDouble
+{
+    // Number of significant digits the fast path has to prove before it returns, the display precision of scientific mode,
+    // and the radix they are counted in.
+    inline constexpr int32_t CERTIFIED_DIGITS = 32;
+    inline constexpr uint32_t CERTIFIED_RADIX = 10;
+
+    // Evaluate the function in quad-double arithmetic while carrying a bound on the distance to the exact result.
+    // They return false and leave result untouched when the constants were last changed to another radix or to more
+    // than CERTIFIED_DIGITS of precision, when the argument is outside of the supported range, or when the bound cannot
+    // prove that rounding the value to CERTIFIED_DIGITS significant digits gives the correctly rounded digits, the
+    // caller then has to fall back to the ratpak series.
+    bool TryExp(Rational const& rat, Rational& result);
+    bool TryLog(Rational const& rat, Rational& result);
+    bool TrySin(Rational const& rat, AngleType angletype, Rational& result);
+    bool TryCos(Rational const& rat, AngleType angletype, Rational& result);
+    bool TryTan(Rational const& rat, AngleType angletype, Rational& result);
+}
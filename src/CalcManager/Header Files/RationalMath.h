@@ -35,4 +35,15 @@ namespace CalcEngine::RationalMath
     Rational ASinh(Rational const& rat);
     Rational ACosh(Rational const& rat);
     Rational ATanh(Rational const& rat);
+
+    // Exp, Log, Sin, Cos and Tan first try the quad-double fast path, hits count the calls it answered and misses the
+    // calls that fell back to the ratpak series.
+    struct FastPathStatistics
+    {
+        uint64_t hits;
+        uint64_t misses;
+    };
+
+    FastPathStatistics GetFastPathStatistics();
+    void ResetFastPathStatistics();
 }
@@ -1,8 +1,35 @@
 #include "pch.h"
+#include <array>
+#include <charconv>
 #include "NumberFormattingUtils.h"
 
 using namespace std;
 
+namespace
+{
+    // std::to_chars is locale independent and rounds exactly like printf, so it produces the same characters as
+    // the fixed and scientific stream formatting in the "C" locale, without the stream and string allocations.
+    template <typename... TFormat>
+    size_t FormatDouble(double value, wchar_t* buffer, size_t bufferSize, TFormat... format)
+    {
+        if (!isfinite(value))
+        {
+            return 0;
+        }
+
+        array<char, UnitConversionManager::NumberFormattingUtils::FORMATTEDNUMBERBUFFERSIZE> characters;
+        const auto [end, error] = to_chars(characters.data(), characters.data() + characters.size(), value, format...);
+        const size_t length = static_cast<size_t>(end - characters.data());
+        if (error != errc{} || length > bufferSize)
+        {
+            return 0;
+        }
+
+        copy(characters.data(), end, buffer);
+        return length;
+    }
+}
+
 namespace UnitConversionManager::NumberFormattingUtils
 {
     /// <summary>
@@ -30,11 +57,22 @@ namespace UnitConversionManager::NumberFormattingUtils
     /// <summary>
     /// Get number of digits (whole number part + decimal part)</summary>
     /// <param name="value">the number</param>
-    unsigned int GetNumberDigits(wstring value)
+    unsigned int GetNumberDigits(const wstring& value)
     {
-        TrimTrailingZeros(value);
-        unsigned int numberSignificantDigits = static_cast<unsigned int>(value.size());
-        if (value.find(L'.') != wstring::npos)
+        // Count the digits as if TrimTrailingZeros was applied, without copying the string
+        size_t length = value.size();
+        const size_t decimalPosition = value.find(L'.');
+        if (decimalPosition != wstring::npos)
+        {
+            length = value.find_last_not_of(L'0') + 1;
+            if (length == decimalPosition + 1)
+            {
+                --length;
+            }
+        }
+
+        unsigned int numberSignificantDigits = static_cast<unsigned int>(length);
+        if (decimalPosition < length)
         {
             --numberSignificantDigits;
         }
@@ -60,6 +98,13 @@ namespace UnitConversionManager::NumberFormattingUtils
     /// <param name="numSignificant">unsigned int number of significant digits to round to</param>
     wstring RoundSignificantDigits(double num, unsigned int numSignificant)
     {
+        array<wchar_t, FORMATTEDNUMBERBUFFERSIZE> buffer;
+        if (const size_t length = RoundSignificantDigits(num, numSignificant, buffer.data(), buffer.size()); length != 0)
+        {
+            return wstring(buffer.data(), length);
+        }
+
+        // Infinities, NaN and very long results keep the stream formatting
         wstringstream out(wstringstream::out);
         out << fixed;
         out.precision(numSignificant);
@@ -73,8 +118,40 @@ namespace UnitConversionManager::NumberFormattingUtils
     /// <param name="number">number to convert</param>
     wstring ToScientificNumber(double number)
     {
+        array<wchar_t, FORMATTEDNUMBERBUFFERSIZE> buffer;
+        if (const size_t length = ToScientificNumber(number, buffer.data(), buffer.size()); length != 0)
+        {
+            return wstring(buffer.data(), length);
+        }
+
         wstringstream out(wstringstream::out);
         out << scientific << number;
         return out.str();
     }
+
+    /// <summary>
+    /// Rounds the given double to the given number of decimals into a caller supplied buffer
+    /// </summary>
+    /// <param name="num">input double</param>
+    /// <param name="numSignificant">unsigned int number of decimals to round to</param>
+    /// <param name="buffer">receives the characters, without a terminating null</param>
+    /// <param name="bufferSize">size of buffer in characters</param>
+    /// <returns>the number of characters written, 0 if num isn't finite or the result doesn't fit</returns>
+    size_t RoundSignificantDigits(double num, unsigned int numSignificant, _Out_writes_(bufferSize) wchar_t* buffer, size_t bufferSize)
+    {
+        return FormatDouble(num, buffer, bufferSize, chars_format::fixed, static_cast<int>(min<size_t>(numSignificant, FORMATTEDNUMBERBUFFERSIZE)));
+    }
+
+    /// <summary>
+    ///  Convert a Number to Scientific Notation into a caller supplied buffer
+    /// </summary>
+    /// <param name="number">number to convert</param>
+    /// <param name="buffer">receives the characters, without a terminating null</param>
+    /// <param name="bufferSize">size of buffer in characters</param>
+    /// <returns>the number of characters written, 0 if number isn't finite or the result doesn't fit</returns>
+    size_t ToScientificNumber(double number, _Out_writes_(bufferSize) wchar_t* buffer, size_t bufferSize)
+    {
+        // 6 decimals is the default precision of the scientific stream formatting
+        return FormatDouble(number, buffer, bufferSize, chars_format::scientific, 6);
+    }
 }
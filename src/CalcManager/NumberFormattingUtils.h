@@ -3,14 +3,23 @@
 
 #pragma once
 
+#include <cstddef>
 #include <string>
 #include "sal_cross_platform.h"
 
 namespace UnitConversionManager::NumberFormattingUtils
 {
+    // Fits any finite double in fixed notation with up to 64 decimals (309 integer digits, sign and decimal point)
+    constexpr size_t FORMATTEDNUMBERBUFFERSIZE = 384;
+
     void TrimTrailingZeros(_Inout_ std::wstring& input);
-    unsigned int GetNumberDigits(std::wstring value);
+    unsigned int GetNumberDigits(const std::wstring& value);
     unsigned int GetNumberDigitsWholeNumberPart(double value);
     std::wstring RoundSignificantDigits(double value, unsigned int numberSignificantDigits);
     std::wstring ToScientificNumber(double number);
+
+    // Buffer based variants, they don't allocate and don't write a terminating null. They return the number of characters
+    // written, or 0 when the value isn't finite or doesn't fit in bufferSize characters.
+    size_t RoundSignificantDigits(double value, unsigned int numberSignificantDigits, _Out_writes_(bufferSize) wchar_t* buffer, size_t bufferSize);
+    size_t ToScientificNumber(double number, _Out_writes_(bufferSize) wchar_t* buffer, size_t bufferSize);
 }
@@ -15,9 +15,10 @@
 //
 //-----------------------------------------------------------------------------
 #include "ratpak.h"
-#include <cstring> // for memmove
+#include <cstring> // for memmove, memset
 
 void _mulnumx(PNUMBER* pa, PNUMBER b);
+static void _mulnumxinto(_In_ PNUMBER a, _In_ PNUMBER b, _Inout_ PNUMBER* pc);
 
 //----------------------------------------------------------------------------
 //
@@ -60,6 +61,45 @@ void mulnumx(_Inout_ PNUMBER* pa, _In_ PNUMBER b)
     }
 }
 
+//----------------------------------------------------------------------------
+//
+//    FUNCTION: mulnumx_into
+//
+//    ARGUMENTS: pointer to a number, a second number, and a pointer to a
+//               scratch number, the base is always BASEX.
+//
+//    RETURN: None, changes first and scratch pointers.
+//
+//    DESCRIPTION: Does the number equivalent of *pa *= b like mulnumx.
+//    The product is built in *pscratch, which is grown only when too small,
+//    and then swapped with *pa, so the old *pa becomes the scratch of the
+//    next call and a loop of multiplies stops allocating.
+//
+//----------------------------------------------------------------------------
+
+void mulnumx_into(_Inout_ PNUMBER* pa, _In_ PNUMBER b, _Inout_ PNUMBER* pscratch)
+
+{
+    if (b->cdigit > 1 || b->mant[0] != 1 || b->exp != 0)
+    {
+        if ((*pa)->cdigit > 1 || (*pa)->mant[0] != 1 || (*pa)->exp != 0)
+        {
+            _mulnumxinto(*pa, b, pscratch);
+            std::swap(*pa, *pscratch);
+        }
+        else
+        {
+            int32_t sign = (*pa)->sign;
+            DUPNUM(*pa, b);
+            (*pa)->sign *= sign;
+        }
+    }
+    else
+    {
+        (*pa)->sign *= b->sign;
+    }
+}
+
 //----------------------------------------------------------------------------
 //
 //    FUNCTION: _mulnumx
@@ -70,81 +110,48 @@ void mulnumx(_Inout_ PNUMBER* pa, _In_ PNUMBER b)
 //    RETURN: None, changes first pointer.
 //
 //    DESCRIPTION: Does the number equivalent of *pa *= b.
-//    Assumes the base is BASEX of both numbers.  This algorithm is the
-//    same one you learned in grade school, except the base isn't 10 it's
-//    BASEX.
+//    Assumes the base is BASEX of both numbers.
 //
 //----------------------------------------------------------------------------
 
 void _mulnumx(PNUMBER* pa, PNUMBER b)
 
 {
-    PNUMBER c = nullptr;  // c will contain the result.
-    PNUMBER a = nullptr;  // a is the dereferenced number pointer from *pa
-    MANTTYPE* ptra;       // ptra is a pointer to the mantissa of a.
-    MANTTYPE* ptrb;       // ptrb is a pointer to the mantissa of b.
-    MANTTYPE* ptrc;       // ptrc is a pointer to the mantissa of c.
-    MANTTYPE* ptrcoffset; // ptrcoffset, is the anchor location of the next
-                          // single digit multiply partial result.
-    int32_t iadigit = 0;  // Index of digit being used in the first number.
-    int32_t ibdigit = 0;  // Index of digit being used in the second number.
-    MANTTYPE da = 0;      // da is the digit from the fist number.
-    TWO_MANTTYPE cy = 0;  // cy is the carry resulting from the addition of
-                          // a multiplied row into the result.
-    TWO_MANTTYPE mcy = 0; // mcy is the resultant from a single
-                          // multiply, AND the carry of that multiply.
-    int32_t icdigit = 0;  // Index of digit being calculated in final result.
-
-    a = *pa;
-
-    ibdigit = a->cdigit + b->cdigit - 1;
-    createnum(c, ibdigit + 1);
-    c->cdigit = ibdigit;
-    c->sign = a->sign * b->sign;
-
-    c->exp = a->exp + b->exp;
-    ptra = a->mant;
-    ptrcoffset = c->mant;
+    PNUMBER c = nullptr; // c will contain the result.
 
-    for (iadigit = a->cdigit; iadigit > 0; iadigit--)
-    {
-        da = *ptra++;
-        ptrb = b->mant;
+    _mulnumxinto(*pa, b, &c);
 
-        // Shift ptrc, and ptrcoffset, one for each digit
-        ptrc = ptrcoffset++;
+    destroynum(*pa);
+    *pa = c;
+}
 
-        for (ibdigit = b->cdigit; ibdigit > 0; ibdigit--)
-        {
-            cy = 0;
-            mcy = (uint64_t)da * (*ptrb);
-            if (mcy)
-            {
-                icdigit = 0;
-                if (ibdigit == 1 && iadigit == 1)
-                {
-                    c->cdigit++;
-                }
-            }
+//----------------------------------------------------------------------------
+//
+//    FUNCTION: _mulnumxinto
+//
+//    ARGUMENTS: two numbers and a pointer to the number receiving the
+//               product, the base is always BASEX.
+//
+//    RETURN: None, changes the last pointer.
+//
+//    DESCRIPTION: Does the number equivalent of *pc = a * b, *pc is reused
+//    when it can hold the product and must not be a or b.
+//
+//----------------------------------------------------------------------------
 
-            // If result is nonzero, or while result of carry is nonzero...
-            while (mcy || cy)
-            {
-                // update carry from addition(s) and multiply.
-                cy += (TWO_MANTTYPE)ptrc[icdigit] + ((uint32_t)mcy & ((uint32_t)~BASEX));
+static void _mulnumxinto(_In_ PNUMBER a, _In_ PNUMBER b, _Inout_ PNUMBER* pc)
 
-                // update result digit from
-                ptrc[icdigit++] = (MANTTYPE)((uint32_t)cy & ((uint32_t)~BASEX));
+{
+    const int32_t cdigit = a->cdigit + b->cdigit;
+    _reservenum(pc, cdigit);
 
-                // update carries from
-                mcy >>= BASEXPWR;
-                cy >>= BASEXPWR;
-            }
+    PNUMBER c = *pc;
+    c->cdigit = cdigit;
+    c->sign = a->sign * b->sign;
+    c->exp = a->exp + b->exp;
+    memset(c->mant, 0, cdigit * sizeof(MANTTYPE));
 
-            ptrb++;
-            ptrc++;
-        }
-    }
+    _mulmantx(a->mant, a->cdigit, b->mant, b->cdigit, c->mant);
 
     // prevent different kinds of zeros, by stripping leading duplicate zeros.
     // digits are in order of increasing significance.
@@ -152,10 +159,61 @@ void _mulnumx(PNUMBER* pa, PNUMBER b)
     {
         c->cdigit--;
     }
+}
 
-    destroynum(*pa);
-    *pa = c;
+//----------------------------------------------------------------------------
+//
+//    FUNCTION: _mulmantx
+//
+//    ARGUMENTS: two mantissas with their digit counts, and the mantissa
+//               receiving the product, the base is always BASEX.
+//
+//    RETURN: None, fills in pc.
+//
+//    DESCRIPTION: Multiplies the mantissas pa and pb into pc, which must
+//    hold acdigit + bcdigit digits set to zero. This algorithm is the
+//    same one you learned in grade school, except the base isn't 10 it's
+//    BASEX.
+//    Each row adds da * b into the result with a single running carry,
+//    a digit product plus a result digit plus the carry is at most
+//    (2^32-1)^2 + 2*(2^32-1) = 2^64-1 and always fits in TWO_MANTTYPE, so
+//    the inner loop has no branches.
+//
+//----------------------------------------------------------------------------
+
+void _mulmantx(_In_ const MANTTYPE* pa, int32_t acdigit, _In_ const MANTTYPE* pb, int32_t bcdigit, _Inout_ MANTTYPE* pc)
+
+{
+    MANTTYPE* ptrc;      // ptrc is a pointer to the mantissa of c.
+    int32_t iadigit = 0; // Index of digit being used in the first number.
+    int32_t ibdigit = 0; // Index of digit being used in the second number.
+    TWO_MANTTYPE da = 0; // da is the digit from the fist number.
+    TWO_MANTTYPE cy = 0; // cy is the sum of a digit product, the result
+                         // digit it is added to, and the carry.
+
+    for (iadigit = 0; iadigit < acdigit; iadigit++)
+    {
+        da = pa[iadigit];
+        if (da == 0)
+        {
+            continue;
+        }
+
+        // The row for this digit starts at its own significance.
+        ptrc = pc + iadigit;
+        cy = 0;
+        for (ibdigit = 0; ibdigit < bcdigit; ibdigit++)
+        {
+            cy += da * pb[ibdigit] + ptrc[ibdigit];
+            ptrc[ibdigit] = (MANTTYPE)(cy & (BASEX - 1));
+            cy >>= BASEXPWR;
+        }
+
+        // The carry out of a row lands on a digit no earlier row has reached.
+        ptrc[ibdigit] = (MANTTYPE)cy;
+    }
 }
+
 //-----------------------------------------------------------------------------
 //
 //    FUNCTION: numpowi32x
@@ -298,7 +356,7 @@ void _divnumx(PNUMBER* pa, PNUMBER b, int32_t precision)
 
     while (cdigits++ < thismax && !zernum(rem))
     {
-        int32_t digit = 0;
+        MANTTYPE digit = 0;
         *ptrc = 0;
         while (!lessnum(rem, b))
         {
@@ -130,7 +130,33 @@ void* zmalloc(size_t a)
 
 void _dupnum(_In_ PNUMBER dest, _In_ const NUMBER* const src)
 {
+    // The destination keeps its own allocation size.
+    const int32_t cdigitmax = dest->cdigitmax;
     memcpy(dest, src, (int)(sizeof(NUMBER) + ((src)->cdigit) * (sizeof(MANTTYPE))));
+    dest->cdigitmax = cdigitmax;
+}
+
+//-----------------------------------------------------------------------------
+//
+//    FUNCTION: _reservenum
+//
+//    ARGUMENTS: pointer to a number, possibly nullptr, and a size in 'digits'
+//
+//    RETURN: None
+//
+//    DESCRIPTION: Makes *ppnum hold at least size digits. A number that is
+//    already large enough is kept with its old digits, otherwise it is
+//    replaced by a new zeroed one, so callers cannot count on zero digits.
+//
+//-----------------------------------------------------------------------------
+
+void _reservenum(_Inout_ PNUMBER* ppnum, uint32_t size)
+{
+    if (*ppnum == nullptr || (*ppnum)->cdigitmax < static_cast<int32_t>(size))
+    {
+        destroynum(*ppnum);
+        createnum(*ppnum, size);
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -205,6 +231,7 @@ PNUMBER _createnum(_In_ uint32_t size)
         {
             throw(CALC_E_OUTOFMEMORY);
         }
+        pnumret->cdigitmax = static_cast<int32_t>(size);
     }
     else
     {
@@ -304,7 +331,10 @@ PNUMBER nRadixxtonum(_In_ PNUMBER a, uint32_t radix, int32_t precision)
 
 {
     PNUMBER sum = i32tonum(0, radix);
-    PNUMBER powofnRadix = i32tonum(BASEX, radix);
+
+    // BASEX doesn't fit an int32_t, it is built as (2^(BASEXPWR/2))^2.
+    PNUMBER powofnRadix = i32tonum(1 << (BASEXPWR / 2), radix);
+    mulnum(&powofnRadix, powofnRadix, radix);
 
     // A large penalty is paid for conversion of digits no one will see anyway.
     // limit the digits to the minimum of the existing precision or the
@@ -322,7 +352,7 @@ PNUMBER nRadixxtonum(_In_ PNUMBER a, uint32_t radix, int32_t precision)
     for (MANTTYPE* ptr = &(a->mant[a->cdigit - 1]); cdigits > 0; ptr--, cdigits--)
     {
         // Loop over all the bits from MSB to LSB
-        for (uint32_t bitmask = BASEX / 2; bitmask > 0; bitmask /= 2)
+        for (MANTTYPE bitmask = static_cast<MANTTYPE>(BASEX / 2); bitmask > 0; bitmask /= 2)
         {
             addnum(&sum, sum, radix);
             if (*ptr & bitmask)
@@ -389,6 +419,121 @@ PNUMBER numtonRadixx(_In_ PNUMBER a, uint32_t radix)
     return (pnumret);
 }
 
+//-----------------------------------------------------------------------------
+//
+//    FUNCTION: _regroupmant
+//
+//    ARGUMENTS: mantissa of cdigit digits of srcbits bits, the exponent of
+//               its lowest digit, the bits of a digit to regroup into, the
+//               mantissa receiving them and pointers for its digit count
+//               and exponent.
+//
+//    RETURN: None, fills in pdest, *pcdigit and *pexp.
+//
+//    DESCRIPTION: Both radices are powers of 2, so the value
+//    sum(pmant[i] * 2^(srcbits * (exp + i))) is regrouped exactly by moving
+//    bits, no arithmetic is needed. pdest must hold
+//    cdigit * srcbits / dstbits + 2 digits, the leading zero digits left by
+//    the regrouping are not counted in *pcdigit.
+//
+//-----------------------------------------------------------------------------
+
+static void _regroupmant(
+    _In_ const MANTTYPE* pmant,
+    int32_t cdigit,
+    int32_t exp,
+    uint32_t srcbits,
+    uint32_t dstbits,
+    _Out_ MANTTYPE* pdest,
+    _Out_ int32_t* pcdigit,
+    _Out_ int32_t* pexp)
+{
+    // The lowest source bit lands shift bits into the lowest destination digit.
+    const int64_t lowbit = static_cast<int64_t>(exp) * srcbits;
+    int64_t dexp = lowbit / static_cast<int64_t>(dstbits);
+    if (dexp * static_cast<int64_t>(dstbits) > lowbit)
+    {
+        dexp--;
+    }
+    const uint32_t shift = static_cast<uint32_t>(lowbit - dexp * static_cast<int64_t>(dstbits));
+
+    // Less than dstbits bits wait in acc before a source digit is added, so
+    // it never holds more than 64.
+    const TWO_MANTTYPE mask = (static_cast<TWO_MANTTYPE>(1) << dstbits) - 1;
+    TWO_MANTTYPE acc = 0;
+    uint32_t accbits = shift;
+    int32_t cdest = 0;
+    for (int32_t i = 0; i < cdigit; i++)
+    {
+        acc |= static_cast<TWO_MANTTYPE>(pmant[i]) << accbits;
+        accbits += srcbits;
+        while (accbits >= dstbits)
+        {
+            pdest[cdest++] = static_cast<MANTTYPE>(acc & mask);
+            acc >>= dstbits;
+            accbits -= dstbits;
+        }
+    }
+    if (accbits > 0)
+    {
+        pdest[cdest++] = static_cast<MANTTYPE>(acc);
+    }
+
+    while (cdest > 1 && pdest[cdest - 1] == 0)
+    {
+        cdest--;
+    }
+    *pcdigit = cdest;
+    *pexp = static_cast<int32_t>(dexp);
+}
+
+//-----------------------------------------------------------------------------
+//
+//    FUNCTION: legacytonum
+//
+//    ARGUMENTS: sign, exponent and mantissa of cdigit digits of
+//               LEGACYBASEX.
+//
+//    RETURN: number representation in internal radix.
+//
+//    DESCRIPTION: Reads a number kept in digits of LEGACYBASEX, the
+//    ratconst tables and the Number mantissas of CalcEngine, see
+//    _regroupmant.
+//
+//-----------------------------------------------------------------------------
+
+PNUMBER legacytonum(int32_t sign, int32_t exp, _In_ const MANTTYPE* pmant, int32_t cdigit)
+{
+    PNUMBER pnumret = nullptr;
+    createnum(pnumret, cdigit * LEGACYBASEXPWR / BASEXPWR + 2);
+    pnumret->sign = sign;
+    _regroupmant(pmant, cdigit, exp, LEGACYBASEXPWR, BASEXPWR, pnumret->mant, &(pnumret->cdigit), &(pnumret->exp));
+    return pnumret;
+}
+
+//-----------------------------------------------------------------------------
+//
+//    FUNCTION: numtolegacy
+//
+//    ARGUMENTS: number in internal radix and the mantissa receiving its
+//               digits of LEGACYBASEX.
+//
+//    RETURN: the exponent of the lowest digit of mant.
+//
+//    DESCRIPTION: The inverse of legacytonum, the sign is unchanged.
+//
+//-----------------------------------------------------------------------------
+
+int32_t numtolegacy(_In_ PNUMBER a, _Out_ vector<MANTTYPE>& mant)
+{
+    mant.resize(static_cast<size_t>(a->cdigit) * BASEXPWR / LEGACYBASEXPWR + 2);
+    int32_t cdigit;
+    int32_t exp;
+    _regroupmant(a->mant, a->cdigit, a->exp, BASEXPWR, LEGACYBASEXPWR, mant.data(), &cdigit, &exp);
+    mant.resize(cdigit);
+    return exp;
+}
+
 //-----------------------------------------------------------------------------
 //
 //  FUNCTION: StringToRat
@@ -802,7 +947,7 @@ PRAT Ui32torat(uint32_t inui32)
 //
 //-----------------------------------------------------------------------------
 
-PNUMBER i32tonum(int32_t ini32, uint32_t radix)
+PNUMBER i32tonum(int32_t ini32, uint64_t radix)
 
 {
     MANTTYPE* pmant;
@@ -812,22 +957,17 @@ PNUMBER i32tonum(int32_t ini32, uint32_t radix)
     pmant = pnumret->mant;
     pnumret->cdigit = 0;
     pnumret->exp = 0;
-    if (ini32 < 0)
-    {
-        pnumret->sign = -1;
-        ini32 *= -1;
-    }
-    else
-    {
-        pnumret->sign = 1;
-    }
+
+    // The magnitude is taken unsigned so that INT32_MIN has one too.
+    uint64_t ui64 = static_cast<uint64_t>(ini32 < 0 ? -static_cast<int64_t>(ini32) : ini32);
+    pnumret->sign = (ini32 < 0) ? -1 : 1;
 
     do
     {
-        *pmant++ = (MANTTYPE)(ini32 % radix);
-        ini32 /= radix;
+        *pmant++ = (MANTTYPE)(ui64 % radix);
+        ui64 /= radix;
         pnumret->cdigit++;
-    } while (ini32);
+    } while (ui64);
 
     return (pnumret);
 }
@@ -846,7 +986,7 @@ PNUMBER i32tonum(int32_t ini32, uint32_t radix)
 //
 //-----------------------------------------------------------------------------
 
-PNUMBER Ui32tonum(uint32_t ini32, uint32_t radix)
+PNUMBER Ui32tonum(uint32_t ini32, uint64_t radix)
 {
     MANTTYPE* pmant;
     PNUMBER pnumret = nullptr;
@@ -857,12 +997,13 @@ PNUMBER Ui32tonum(uint32_t ini32, uint32_t radix)
     pnumret->exp = 0;
     pnumret->sign = 1;
 
+    uint64_t ui64 = ini32;
     do
     {
-        *pmant++ = (MANTTYPE)(ini32 % radix);
-        ini32 /= radix;
+        *pmant++ = (MANTTYPE)(ui64 % radix);
+        ui64 /= radix;
         pnumret->cdigit++;
-    } while (ini32);
+    } while (ui64);
 
     return (pnumret);
 }
@@ -988,9 +1129,10 @@ uint64_t rattoUi64(_In_ PRAT prat, uint32_t radix, int32_t precision)
 //    base   claimed.
 //
 //-----------------------------------------------------------------------------
-int32_t numtoi32(_In_ PNUMBER pnum, uint32_t radix)
+int32_t numtoi32(_In_ PNUMBER pnum, uint64_t radix)
 {
-    int32_t lret = 0;
+    // Only the low 32 bits are kept, as they would be by int32_t arithmetic.
+    uint64_t lret = 0;
 
     MANTTYPE* pmant = pnum->mant;
     pmant += pnum->cdigit - 1;
@@ -1006,9 +1148,8 @@ int32_t numtoi32(_In_ PNUMBER pnum, uint32_t radix)
     {
         lret *= radix;
     }
-    lret *= pnum->sign;
 
-    return lret;
+    return static_cast<int32_t>(static_cast<uint32_t>(lret)) * pnum->sign;
 }
 
 //-----------------------------------------------------------------------------
@@ -1285,7 +1426,9 @@ wstring NumberToString(_Inout_ PNUMBER& pnum, NumberFormat format, uint32_t radi
 //-----------------------------------------------------------------------------
 wstring RatToString(_Inout_ PRAT& prat, NumberFormat format, uint32_t radix, int32_t precision)
 {
-    PNUMBER p = RatToNumber(prat, radix, precision);
+    // NumberToString never looks past the leading precision + 2 digits, the
+    // last kept digit is followed by the one it rounds on and one more.
+    PNUMBER p = RatToDigits(prat, radix, precision, precision + 2);
 
     wstring result = NumberToString(p, format, radix, precision);
     destroynum(p);
@@ -1293,11 +1436,11 @@ wstring RatToString(_Inout_ PRAT& prat, NumberFormat format, uint32_t radix, int
     return result;
 }
 
-PNUMBER RatToNumber(_In_ PRAT prat, uint32_t radix, int32_t precision)
+// Converts p and q of rational form from internal base to requested base.
+static void rattonRadixnums(_In_ PRAT prat, uint32_t radix, int32_t precision, _Out_ PNUMBER* pp, _Out_ PNUMBER* pq)
 {
     PRAT temprat = nullptr;
     DUPRAT(temprat, prat);
-    // Convert p and q of rational form from internal base to requested base.
     // Scale by largest power of BASEX possible.
     int32_t scaleby = min(temprat->pp->exp, temprat->pq->exp);
     scaleby = max<int32_t>(scaleby, 0);
@@ -1305,10 +1448,17 @@ PNUMBER RatToNumber(_In_ PRAT prat, uint32_t radix, int32_t precision)
     temprat->pp->exp -= scaleby;
     temprat->pq->exp -= scaleby;
 
-    PNUMBER p = nRadixxtonum(temprat->pp, radix, precision);
-    PNUMBER q = nRadixxtonum(temprat->pq, radix, precision);
+    *pp = nRadixxtonum(temprat->pp, radix, precision);
+    *pq = nRadixxtonum(temprat->pq, radix, precision);
 
     destroyrat(temprat);
+}
+
+PNUMBER RatToNumber(_In_ PRAT prat, uint32_t radix, int32_t precision)
+{
+    PNUMBER p = nullptr;
+    PNUMBER q = nullptr;
+    rattonRadixnums(prat, radix, precision, &p, &q);
 
     // finally take the time hit to actually divide.
     divnum(&p, q, radix, precision);
@@ -1317,6 +1467,187 @@ PNUMBER RatToNumber(_In_ PRAT prat, uint32_t radix, int32_t precision)
     return p;
 }
 
+//-----------------------------------------------------------------------------
+//
+//  FUNCTION: RatToDigits
+//
+//  ARGUMENTS:
+//              PRAT representation of a number.
+//              radix to convert to.
+//              precision the rational is converted at.
+//              cdigits, the number of leading digits wanted.
+//
+//  RETURN: number representation in radix requested.
+//
+//  DESCRIPTION: Returns the leading cdigits significant digits of the
+//  number RatToNumber would return, truncated, not rounded. Digits are
+//  taken from a digit stream, so none past the last one wanted are divided
+//  out.
+//
+//-----------------------------------------------------------------------------
+
+PNUMBER RatToDigits(_In_ PRAT prat, uint32_t radix, int32_t precision, int32_t cdigits)
+{
+    PDIGITSTREAM pds = createdigitstream(prat, radix, precision);
+
+    PNUMBER pnum = nullptr;
+    createnum(pnum, cdigits);
+    pnum->sign = pds->sign;
+
+    // Digits are stored in reverse order, fill them in from the MSD down.
+    MANTTYPE* ptrdigit = pnum->mant + cdigits;
+    int32_t cdigit = 0;
+    int32_t exp = 0;
+    while (cdigit < cdigits && moredigits(pds))
+    {
+        exp = pds->exp;
+        MANTTYPE digit = nextdigit(pds);
+        // The quotient may start with a zero, it isn't significant.
+        if (digit || cdigit)
+        {
+            *--ptrdigit = digit;
+            cdigit++;
+        }
+    }
+    destroydigitstream(pds);
+
+    if (cdigit == 0)
+    {
+        pnum->cdigit = 1;
+        pnum->exp = 0;
+    }
+    else
+    {
+        if (ptrdigit != pnum->mant)
+        {
+            memmove(pnum->mant, ptrdigit, cdigit * sizeof(MANTTYPE));
+        }
+        pnum->cdigit = cdigit;
+        pnum->exp = exp;
+    }
+
+    return pnum;
+}
+
+//-----------------------------------------------------------------------------
+//
+//  FUNCTION: createdigitstream
+//
+//  ARGUMENTS:
+//              PRAT representation of a number.
+//              radix to hand the digits out in.
+//              precision the rational is converted at.
+//
+//  RETURN: digit stream positioned on the most significant digit.
+//
+//  DESCRIPTION: Converts p and q exactly like RatToNumber does and sets up
+//  the long division of p by q, without dividing out any digit yet. The
+//  stream ends where the division in RatToNumber stops, the digits handed
+//  out are the digits it would have produced, the first one may be a zero.
+//
+//-----------------------------------------------------------------------------
+
+PDIGITSTREAM createdigitstream(_In_ PRAT prat, uint32_t radix, int32_t precision)
+{
+    PNUMBER p = nullptr;
+    PNUMBER q = nullptr;
+    rattonRadixnums(prat, radix, precision, &p, &q);
+
+    PDIGITSTREAM pds = new DIGITSTREAM;
+    pds->radix = radix;
+    pds->sign = p->sign * q->sign;
+    pds->exp = (p->cdigit + p->exp) - (q->cdigit + q->exp);
+    pds->cdigit = max({ precision + 2, p->cdigit, q->cdigit });
+    pds->scratch = nullptr;
+
+    // Line the MSD of the remainder up with the MSD of the divisor, the
+    // digits are then the quotient of the two.
+    pds->rem = p;
+    pds->rem->sign = 1;
+    pds->rem->exp = q->cdigit + q->exp - p->cdigit;
+
+    // Build a table of multiplications of the divisor, the next digit is
+    // found by bisecting it.
+    q->sign = 1;
+    pds->multiples.reserve(radix);
+    pds->multiples.push_back(i32tonum(0L, radix));
+    for (uint32_t i = 1; i < radix; i++)
+    {
+        PNUMBER multiple = nullptr;
+        DUPNUM(multiple, pds->multiples.back());
+        addnum(&multiple, q, radix);
+        pds->multiples.push_back(multiple);
+    }
+    destroynum(q);
+
+    return pds;
+}
+
+//-----------------------------------------------------------------------------
+//
+//  FUNCTION: nextdigit
+//
+//  ARGUMENTS: digit stream.
+//
+//  RETURN: the digit at the radix exponent pds->exp.
+//
+//  DESCRIPTION: Divides the next digit out of the remainder and moves the
+//  stream on to the digit after it.
+//
+//-----------------------------------------------------------------------------
+
+MANTTYPE nextdigit(_Inout_ PDIGITSTREAM pds)
+{
+    // Find the largest multiple of the divisor that still fits.
+    uint32_t low = 0;
+    uint32_t high = pds->radix - 1;
+    while (low < high)
+    {
+        uint32_t middle = (low + high + 1) / 2;
+        if (lessnum(pds->rem, pds->multiples[middle]))
+        {
+            high = middle - 1;
+        }
+        else
+        {
+            low = middle;
+        }
+    }
+
+    if (low)
+    {
+        PNUMBER multiple = pds->multiples[low];
+        multiple->sign = -1;
+        addnum_into(&(pds->rem), multiple, pds->radix, &(pds->scratch));
+        multiple->sign = 1;
+    }
+    pds->rem->exp++;
+    pds->exp--;
+    pds->cdigit--;
+
+    return (MANTTYPE)low;
+}
+
+bool moredigits(_In_ PDIGITSTREAM pds)
+{
+    return pds->cdigit > 0 && !zernum(pds->rem);
+}
+
+void destroydigitstream(_Inout_ PDIGITSTREAM& pds)
+{
+    if (pds != nullptr)
+    {
+        for (auto& multiple : pds->multiples)
+        {
+            destroynum(multiple);
+        }
+        destroynum(pds->rem);
+        destroynum(pds->scratch);
+        delete pds;
+        pds = nullptr;
+    }
+}
+
 // Converts a PRAT to a PNUMBER and back to a PRAT, flattening/simplifying the rational in the process
 void flatrat(_Inout_ PRAT& prat, uint32_t radix, int32_t precision)
 {
@@ -14,6 +14,7 @@
 //
 //
 //-----------------------------------------------------------------------------
+#include <cmath> // for log2, exp2
 #include "ratpak.h"
 
 //-----------------------------------------------------------------------------
@@ -318,7 +319,14 @@ void powratNumeratorDenominator(_Inout_ PRAT* px, _In_ PRAT y, uint32_t radix, i
 
     // 2. Calculate pxPowNumDenom = pxPowNum ^ (1/yDenominator),
     // if yDenominator is not 1
-    if (!rat_equ(yDenominator, rat_one, precision))
+    int32_t root = 0;
+    if (smallrootnum(yDenominator->pp, &root))
+    {
+        // Small roots are taken with Newton's method, which also finds exact roots.
+        rootrati32(&pxPow, root, radix, precision);
+        DUPRAT(*px, pxPow);
+    }
+    else if (!rat_equ(yDenominator, rat_one, precision))
     {
         // Calculate 1 over y
         PRAT oneoveryDenom = nullptr;
@@ -382,6 +390,183 @@ void powratNumeratorDenominator(_Inout_ PRAT* px, _In_ PRAT y, uint32_t radix, i
     destroyrat(pxPow);
 }
 
+// Largest root taken by rootrati32, N = p*q^(n-1) grows with n.
+static constexpr uint32_t MAXROOTI32 = 64;
+
+// Correct bits of the estimate _rootestimate computes with doubles.
+static constexpr int32_t ROOTESTIMATEBITS = 48;
+
+//---------------------------------------------------------------------------
+//
+//  FUNCTION: smallrootnum
+//
+//  ARGUMENTS: PNUMBER num, and int32_t *proot
+//
+//  RETURN: true and sets *proot to num if num is an integer root small
+//  enough for rootrati32, false otherwise.
+//
+//---------------------------------------------------------------------------
+bool smallrootnum(_In_ PNUMBER num, _Out_ int32_t* proot)
+{
+    *proot = 0;
+    if (num->sign != 1 || num->exp != 0 || num->cdigit != 1 || num->mant[0] < 2 || num->mant[0] > MAXROOTI32)
+    {
+        return false;
+    }
+
+    *proot = static_cast<int32_t>(num->mant[0]);
+    return true;
+}
+
+//---------------------------------------------------------------------------
+//
+//  FUNCTION: _rootestimate
+//
+//  ARGUMENTS: PNUMBER num, a positive integer, and int32_t n
+//
+//  RETURN: the nth root of num to about 50 bits, as a rational.
+//
+//  EXPLANATION: log2(num) is read from the top two digits of num, the root
+//  2^(log2(num)/n) is written as a two digit NUMBER v * BASEX^k with
+//  2^31 <= v < 2^63, clear of the 2^64 a rounded exp2 could reach.
+//
+//---------------------------------------------------------------------------
+static PRAT _rootestimate(_In_ PNUMBER num, int32_t n)
+{
+    double top = static_cast<double>(num->mant[num->cdigit - 1]);
+    if (num->cdigit > 1)
+    {
+        top += static_cast<double>(num->mant[num->cdigit - 2]) / static_cast<double>(BASEX);
+    }
+    const double log2root = (log2(top) + static_cast<double>(BASEXPWR) * (LOGNUM2(num) - 1)) / n;
+    const int32_t k = static_cast<int32_t>(floor((log2root + 1) / BASEXPWR)) - 1;
+    const auto v = static_cast<TWO_MANTTYPE>(exp2(log2root - static_cast<double>(BASEXPWR) * k));
+
+    PRAT pret = nullptr;
+    createrat(pret);
+    createnum(pret->pp, 2);
+    pret->pp->cdigit = 2;
+    pret->pp->sign = 1;
+    pret->pp->exp = std::max(k, 0);
+    pret->pp->mant[0] = static_cast<MANTTYPE>(v & (BASEX - 1));
+    pret->pp->mant[1] = static_cast<MANTTYPE>(v >> BASEXPWR);
+    pret->pq = i32tonum(1, BASEX);
+    pret->pq->exp = std::max(-k, 0);
+    return pret;
+}
+
+//---------------------------------------------------------------------------
+//
+//  FUNCTION: rootrati32
+//
+//  ARGUMENTS: PRAT *px, int32_t n, 2 <= n <= MAXROOTI32, radix and precision
+//
+//  RETURN: none, sets *px to the nth root of *px.
+//
+//  EXPLANATION: With *px = p/q, p and q integers, the root is taken of the
+//  integer N = p*q^(n-1) so that root(*px) = root(N)/q.
+//  Newton's method
+//
+//      y    = ((n-1)*y  + N / y ^(n-1)) / n
+//       j+1          j         j
+//
+//  doubles the correct digits every step starting from _rootestimate.
+//  When y rounded to an integer R has R^n == N the root is exactly R/q,
+//  which covers every *px that is the nth power of a rational.
+//  Negative *px only have odd roots, even roots throw CALC_E_DOMAIN.
+//
+//---------------------------------------------------------------------------
+void rootrati32(_Inout_ PRAT* px, int32_t n, uint32_t radix, int32_t precision)
+{
+    const int32_t sign = SIGN(*px);
+    if (zernum((*px)->pp))
+    {
+        return;
+    }
+    if (sign == -1 && (n & 1) == 0)
+    {
+        throw(CALC_E_DOMAIN);
+    }
+
+    // Make p and q integers and positive.
+    PNUMBER pnum = nullptr;
+    PNUMBER qnum = nullptr;
+    DUPNUM(pnum, (*px)->pp);
+    DUPNUM(qnum, (*px)->pq);
+    pnum->sign = 1;
+    qnum->sign = 1;
+    const int32_t shift = std::min(pnum->exp, qnum->exp);
+    if (shift < 0)
+    {
+        pnum->exp -= shift;
+        qnum->exp -= shift;
+    }
+
+    // N = p*q^(n-1), exact since integers are never trimmed.
+    PRAT pN = nullptr;
+    createrat(pN);
+    DUPNUM(pN->pp, qnum);
+    numpowi32x(&(pN->pp), n - 1);
+    mulnumx(&(pN->pp), pnum);
+    pN->pq = i32tonum(1, BASEX);
+    destroynum(pnum);
+
+    PRAT py = _rootestimate(pN->pp, n);
+    PRAT pn = i32torat(n);
+    PRAT pnminusone = i32torat(n - 1);
+    PRAT ppow = nullptr;
+    PRAT pterm = nullptr;
+
+    // Every step doubles the correct bits, one more step than needed absorbs
+    // the trimming of the previous ones.
+    const int32_t bits = static_cast<int32_t>(BASEXPWR) * (precision / g_ratio + 2);
+    for (int32_t correct = ROOTESTIMATEBITS; correct / 2 < bits; correct *= 2)
+    {
+        DUPRAT(ppow, py);
+        ratpowi32(&ppow, n - 1, precision);
+        DUPRAT(pterm, pN);
+        divrat(&pterm, ppow, precision);
+        mulrat(&py, pnminusone, precision);
+        addrat(&py, pterm, precision);
+        divrat(&py, pn, precision);
+    }
+
+    // Check whether the nearest integer is the exact root.
+    DUPRAT(pterm, py);
+    addrat(&pterm, rat_half, precision);
+    intrat(&pterm, radix, precision);
+    bool exact = false;
+    if (equnum(pterm->pq, num_one))
+    {
+        PNUMBER pnumpow = nullptr;
+        DUPNUM(pnumpow, pterm->pp);
+        numpowi32x(&pnumpow, n);
+        exact = equnum(pnumpow, pN->pp);
+        destroynum(pnumpow);
+    }
+
+    if (exact)
+    {
+        DUPRAT(*px, pterm);
+        DUPNUM((*px)->pq, qnum);
+    }
+    else
+    {
+        DUPRAT(*px, py);
+        mulnumx(&((*px)->pq), qnum);
+        trimit(px, precision);
+    }
+    (*px)->pp->sign = sign;
+
+    destroyrat(ppow);
+    destroyrat(pterm);
+    destroyrat(pn);
+    destroyrat(pnminusone);
+    destroyrat(py);
+    destroyrat(pN);
+    destroynum(qnum);
+}
+
 //---------------------------------------------------------------------------
 //
 //  FUNCTION: powratcomp
@@ -289,16 +289,16 @@ void atanrat(_Inout_ PRAT* px, uint32_t radix, int32_t precision)
     {
         if (rat_gt((*px), rat_two, precision))
         {
-            (*px)->pp->sign = sgn;
-            (*px)->pq->sign = 1;
+            // atan(x) = pi/2 - atan(1/x) for x > 0, the sign is put back
+            // afterwards, atan is odd.
             DUPRAT(tmpx, rat_one);
             divrat(&tmpx, (*px), precision);
             _atanrat(&tmpx, precision);
-            tmpx->pp->sign = sgn;
-            tmpx->pq->sign = 1;
             DUPRAT(*px, pi_over_two);
             subrat(px, tmpx, precision);
             destroyrat(tmpx);
+            (*px)->pp->sign = sgn;
+            (*px)->pq->sign = 1;
         }
         else
         {
@@ -320,8 +320,4 @@ void atanrat(_Inout_ PRAT* px, uint32_t radix, int32_t precision)
         (*px)->pq->sign = 1;
         _atanrat(px, precision);
     }
-    if (rat_gt(*px, pi_over_two, precision))
-    {
-        subrat(px, pi, precision);
-    }
 }
@@ -246,7 +246,8 @@ void modrat(_Inout_ PRAT* pa, _In_ PRAT b)
 
     if (needAdjust && !zerrat(*pa))
     {
-        addrat(pa, b, BASEX);
+        // modrat takes no precision, the one of the last ChangeConstants is used.
+        addrat(pa, b, g_precision);
     }
 
     // Get *pa back in the integer over integer form.
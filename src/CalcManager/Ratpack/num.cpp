@@ -18,7 +18,7 @@
 //
 //-----------------------------------------------------------------------------
 #include <list>
-#include <cstring> // for memmove
+#include <cstring> // for memmove, memcpy, memset
 #include "ratpak.h"
 
 using namespace std;
@@ -41,9 +41,10 @@ using namespace std;
 //
 //----------------------------------------------------------------------------
 
-void _addnum(PNUMBER* pa, PNUMBER b, uint32_t radix);
+void _addnum(PNUMBER* pa, PNUMBER b, uint64_t radix);
+static void _addnuminto(_In_ PNUMBER a, _In_ PNUMBER b, uint64_t radix, _Inout_ PNUMBER* pc);
 
-void addnum(_Inout_ PNUMBER* pa, _In_ PNUMBER b, uint32_t radix)
+void addnum(_Inout_ PNUMBER* pa, _In_ PNUMBER b, uint64_t radix)
 
 {
     if (b->cdigit > 1 || b->mant[0] != 0)
@@ -59,113 +60,215 @@ void addnum(_Inout_ PNUMBER* pa, _In_ PNUMBER b, uint32_t radix)
     }
 }
 
-void _addnum(PNUMBER* pa, PNUMBER b, uint32_t radix)
+//----------------------------------------------------------------------------
+//
+//    FUNCTION: addnum_into
+//
+//    ARGUMENTS: pointer to a number, a second number, the radix, and a
+//               pointer to a scratch number.
+//
+//    RETURN: None, changes first and scratch pointers.
+//
+//    DESCRIPTION: Does the number equivalent of *pa += b like addnum.
+//    The sum is built in *pscratch, which is grown only when too small, and
+//    then swapped with *pa, so the old *pa becomes the scratch of the next
+//    call.
+//
+//----------------------------------------------------------------------------
 
-{
-    PNUMBER c = nullptr; // c will contain the result.
-    PNUMBER a = nullptr; // a is the dereferenced number pointer from *pa
-    MANTTYPE* pcha;      // pcha is a pointer to the mantissa of a.
-    MANTTYPE* pchb;      // pchb is a pointer to the mantissa of b.
-    MANTTYPE* pchc;      // pchc is a pointer to the mantissa of c.
-    int32_t cdigits;     // cdigits is the max count of the digits results used as a counter.
-    int32_t mexp;        // mexp is the exponent of the result.
-    MANTTYPE da;         // da is a single 'digit' after possible padding.
-    MANTTYPE db;         // db is a single 'digit' after possible padding.
-    MANTTYPE cy = 0;     // cy is the value of a carry after adding two 'digits'
-    int32_t fcompla = 0; // fcompla is a flag to signal a is negative.
-    int32_t fcomplb = 0; // fcomplb is a flag to signal b is negative.
+void addnum_into(_Inout_ PNUMBER* pa, _In_ PNUMBER b, uint64_t radix, _Inout_ PNUMBER* pscratch)
 
-    a = *pa;
+{
+    if (b->cdigit > 1 || b->mant[0] != 0)
+    {
+        if ((*pa)->cdigit > 1 || (*pa)->mant[0] != 0)
+        {
+            _addnuminto(*pa, b, radix, pscratch);
+            swap(*pa, *pscratch);
+        }
+        else
+        {
+            DUPNUM(*pa, b);
+        }
+    }
+}
 
-    // Calculate the overlap of the numbers after alignment, this includes
-    // necessary padding 0's
-    cdigits = max(a->cdigit + a->exp, b->cdigit + b->exp) - min(a->exp, b->exp);
+//----------------------------------------------------------------------------
+//
+//    FUNCTION: _addmant, _submant
+//
+//    ARGUMENTS: mantissa pc of cdigitc digits, mantissa pb of cdigitb
+//               digits, cdigitb <= cdigitc, and the radix.
+//
+//    RETURN: _addmant returns the carry out of pc.
+//
+//    DESCRIPTION: Does pc += pb, or pc -= pb with pc >= pb, in place, the
+//    carry or borrow runs into the digits of pc past pb until it is used up.
+//    Digits are below radix <= BASEX so a digit sum fits a TWO_MANTTYPE and
+//    the carry is a compare rather than a division. fbasex makes the radix a
+//    constant so the compare and multiply turn into shifts and masks.
+//
+//----------------------------------------------------------------------------
 
-    createnum(c, cdigits + 1);
-    c->exp = min(a->exp, b->exp);
-    mexp = c->exp;
-    c->cdigit = cdigits;
-    pcha = a->mant;
-    pchb = b->mant;
-    pchc = c->mant;
+template <bool fbasex>
+static MANTTYPE _addmant(_Inout_ MANTTYPE* pc, _In_ const MANTTYPE* pb, int32_t cdigitb, int32_t cdigitc, TWO_MANTTYPE radix)
+{
+    const TWO_MANTTYPE r = fbasex ? BASEX : radix;
+    MANTTYPE cy = 0;
+    int32_t i = 0;
+    for (; i < cdigitb; i++)
+    {
+        const TWO_MANTTYPE sum = static_cast<TWO_MANTTYPE>(pc[i]) + pb[i] + cy;
+        cy = static_cast<MANTTYPE>(sum >= r);
+        pc[i] = static_cast<MANTTYPE>(sum - r * cy);
+    }
+    for (; cy && i < cdigitc; i++)
+    {
+        const TWO_MANTTYPE sum = static_cast<TWO_MANTTYPE>(pc[i]) + cy;
+        cy = static_cast<MANTTYPE>(sum >= r);
+        pc[i] = static_cast<MANTTYPE>(sum - r * cy);
+    }
+    return cy;
+}
 
-    // Figure out the sign of the numbers
-    if (a->sign != b->sign)
+template <bool fbasex>
+static void _submant(_Inout_ MANTTYPE* pc, _In_ const MANTTYPE* pb, int32_t cdigitb, int32_t cdigitc, TWO_MANTTYPE radix)
+{
+    const TWO_MANTTYPE r = fbasex ? BASEX : radix;
+    TWO_MANTTYPE bw = 0;
+    int32_t i = 0;
+    for (; i < cdigitb; i++)
+    {
+        // Digits are below 2^32, so the top bit of the difference is the borrow.
+        const TWO_MANTTYPE diff = static_cast<TWO_MANTTYPE>(pc[i]) - pb[i] - bw;
+        bw = diff >> (sizeof(TWO_MANTTYPE) * 8 - 1);
+        pc[i] = static_cast<MANTTYPE>(diff + r * bw);
+    }
+    for (; bw && i < cdigitc; i++)
     {
-        cy = 1;
-        fcompla = (a->sign == -1);
-        fcomplb = (b->sign == -1);
+        const TWO_MANTTYPE diff = static_cast<TWO_MANTTYPE>(pc[i]) - bw;
+        bw = diff >> (sizeof(TWO_MANTTYPE) * 8 - 1);
+        pc[i] = static_cast<MANTTYPE>(diff + r * bw);
     }
+}
 
-    // Loop over all the digits, real and 0 padded. Here we know a and b are
-    // aligned
-    for (; cdigits > 0; cdigits--, mexp++)
+//----------------------------------------------------------------------------
+//
+//    FUNCTION: _cmpalignednum
+//
+//    ARGUMENTS: two numbers, and the exponent and digit count of the range
+//               covering both.
+//
+//    RETURN: <0, 0 or >0 as abs(a) is less, equal or greater than abs(b).
+//
+//    DESCRIPTION: Compares from the most significant position down, digits
+//    outside of a number are 0, so leading zeros do not matter.
+//
+//----------------------------------------------------------------------------
+
+static int32_t _cmpalignednum(_In_ PNUMBER a, _In_ PNUMBER b, int32_t mexp, int32_t cdigits)
+{
+    for (int32_t pos = mexp + cdigits - 1; pos >= mexp; pos--)
     {
-        // Get digit from a, taking padding into account.
-        da = (((mexp >= a->exp) && (cdigits + a->exp - c->exp > (c->cdigit - a->cdigit))) ? *pcha++ : 0);
-        // Get digit from b, taking padding into account.
-        db = (((mexp >= b->exp) && (cdigits + b->exp - c->exp > (c->cdigit - b->cdigit))) ? *pchb++ : 0);
-
-        // Handle complementing for a and b digit. Might be a better way, but
-        // haven't found it yet.
-        if (fcompla)
-        {
-            da = (MANTTYPE)(radix)-1 - da;
-        }
-        if (fcomplb)
+        const MANTTYPE da = (pos >= a->exp && pos < a->exp + a->cdigit) ? a->mant[pos - a->exp] : 0;
+        const MANTTYPE db = (pos >= b->exp && pos < b->exp + b->cdigit) ? b->mant[pos - b->exp] : 0;
+        if (da != db)
         {
-            db = (MANTTYPE)(radix)-1 - db;
+            return da < db ? -1 : 1;
         }
-
-        // Update carry as necessary
-        cy = da + db + cy;
-        *pchc++ = (MANTTYPE)(cy % (MANTTYPE)radix);
-        cy /= (MANTTYPE)radix;
     }
+    return 0;
+}
+
+void _addnum(PNUMBER* pa, PNUMBER b, uint64_t radix)
+
+{
+    PNUMBER c = nullptr; // c will contain the result.
 
-    // Handle carry from last sum as extra digit
-    if (cy && !(fcompla || fcomplb))
+    _addnuminto(*pa, b, radix, &c);
+
+    destroynum(*pa);
+    *pa = c;
+}
+
+//----------------------------------------------------------------------------
+//
+//    FUNCTION: _addnuminto
+//
+//    ARGUMENTS: two numbers, the radix and a pointer to the number
+//               receiving the sum.
+//
+//    RETURN: None, changes the last pointer.
+//
+//    DESCRIPTION: Does the number equivalent of *pc = a + b, *pc is reused
+//    when it can hold the sum and must not be a or b.
+//
+//----------------------------------------------------------------------------
+
+static void _addnuminto(_In_ PNUMBER a, _In_ PNUMBER b, uint64_t radix, _Inout_ PNUMBER* pc)
+
+{
+    // Calculate the overlap of the numbers after alignment, this includes
+    // necessary padding 0's
+    const int32_t mexp = min(a->exp, b->exp);
+    const int32_t cdigits = max(a->cdigit + a->exp, b->cdigit + b->exp) - mexp;
+
+    _reservenum(pc, cdigits + 1);
+    PNUMBER c = *pc;
+    c->exp = mexp;
+    c->cdigit = cdigits;
+    c->sign = a->sign;
+    memset(c->mant, 0, (cdigits + 1) * sizeof(MANTTYPE));
+
+    // c starts as the number of larger magnitude, the other one is then
+    // added to it or subtracted from it in place.
+    PNUMBER big = a;
+    PNUMBER small = b;
+    const bool fsub = (a->sign != b->sign);
+    if (fsub)
     {
-        *pchc++ = cy;
-        c->cdigit++;
+        const int32_t cmp = _cmpalignednum(a, b, mexp, cdigits);
+        if (cmp < 0)
+        {
+            big = b;
+            small = a;
+        }
+        // a + -a is a positive zero.
+        c->sign = (cmp == 0) ? 1 : big->sign;
     }
+    memcpy(c->mant + (big->exp - mexp), big->mant, big->cdigit * sizeof(MANTTYPE));
 
-    // Compute sign of result
-    if (!(fcompla || fcomplb))
+    MANTTYPE* pchc = c->mant + (small->exp - mexp);
+    const int32_t cdigitc = cdigits - (small->exp - mexp);
+    if (fsub)
     {
-        c->sign = a->sign;
+        if (radix == BASEX)
+        {
+            _submant<true>(pchc, small->mant, small->cdigit, cdigitc, radix);
+        }
+        else
+        {
+            _submant<false>(pchc, small->mant, small->cdigit, cdigitc, radix);
+        }
     }
     else
     {
+        const MANTTYPE cy = (radix == BASEX) ? _addmant<true>(pchc, small->mant, small->cdigit, cdigitc, radix)
+                                             : _addmant<false>(pchc, small->mant, small->cdigit, cdigitc, radix);
+
+        // Handle carry from last sum as extra digit
         if (cy)
         {
-            c->sign = 1;
-        }
-        else
-        {
-            // In this particular case an overflow or underflow has occurred
-            // and all the digits need to be complemented, at one time an
-            // attempt to handle this above was made, it turned out to be much
-            // slower on average.
-            c->sign = -1;
-            cy = 1;
-            for ((cdigits = c->cdigit), (pchc = c->mant); cdigits > 0; cdigits--)
-            {
-                cy = (MANTTYPE)radix - (MANTTYPE)1 - *pchc + cy;
-                *pchc++ = (MANTTYPE)(cy % (MANTTYPE)radix);
-                cy /= (MANTTYPE)radix;
-            }
+            c->mant[c->cdigit++] = cy;
         }
     }
 
     // Remove leading zeros, remember digits are in order of
     // increasing significance. i.e. 100 would be 0,0,1
-    while (c->cdigit > 1 && *(--pchc) == 0)
+    while (c->cdigit > 1 && c->mant[c->cdigit - 1] == 0)
     {
         c->cdigit--;
     }
-    destroynum(*pa);
-    *pa = c;
 }
 
 //----------------------------------------------------------------------------
@@ -301,7 +404,7 @@ void _mulnum(PNUMBER* pa, PNUMBER b, uint32_t radix)
 //
 //----------------------------------------------------------------------------
 
-void remnum(_Inout_ PNUMBER* pa, _In_ PNUMBER b, uint32_t radix)
+void remnum(_Inout_ PNUMBER* pa, _In_ PNUMBER b, uint64_t radix)
 
 {
     PNUMBER tmp = nullptr;     // tmp is the working remainder.
@@ -577,10 +680,9 @@ bool lessnum(_In_ PNUMBER a, _In_ PNUMBER b)
     {
         MANTTYPE da = ((cdigits > (ccdigits - a->cdigit)) ? *pa-- : 0);
         MANTTYPE db = ((cdigits > (ccdigits - b->cdigit)) ? *pb-- : 0);
-        diff = da - db;
-        if (diff)
+        if (da != db)
         {
-            return (diff < 0);
+            return (da < db);
         }
     }
     // In this case, they are equal.
@@ -87,9 +87,10 @@ void fracrat(_Inout_ PRAT* pa, uint32_t radix, int32_t precision)
 
 //-----------------------------------------------------------------------------
 //
-//    FUNCTION: mulrat
+//    FUNCTION: mulrat, mulrat_into
 //
-//    ARGUMENTS: pointer to a rational a second rational.
+//    ARGUMENTS: pointer to a rational a second rational, and for
+//               mulrat_into the scratch numbers to build the result in.
 //
 //    RETURN: None, changes first pointer.
 //
@@ -100,12 +101,20 @@ void fracrat(_Inout_ PRAT* pa, uint32_t radix, int32_t precision)
 
 void mulrat(_Inout_ PRAT* pa, _In_ PRAT b, int32_t precision)
 
+{
+    SCRATCH scratch = {};
+    mulrat_into(pa, b, precision, &scratch);
+    destroyscratch(scratch);
+}
+
+void mulrat_into(_Inout_ PRAT* pa, _In_ PRAT b, int32_t precision, _Inout_ PSCRATCH pscratch)
+
 {
     // Only do the multiply if it isn't zero.
     if (!zernum((*pa)->pp))
     {
-        mulnumx(&((*pa)->pp), b->pp);
-        mulnumx(&((*pa)->pq), b->pq);
+        mulnumx_into(&((*pa)->pp), b->pp, &(pscratch->pnum));
+        mulnumx_into(&((*pa)->pq), b->pq, &(pscratch->pnum));
         trimit(pa, precision);
     }
     else
@@ -121,9 +130,10 @@ void mulrat(_Inout_ PRAT* pa, _In_ PRAT b, int32_t precision)
 
 //-----------------------------------------------------------------------------
 //
-//    FUNCTION: divrat
+//    FUNCTION: divrat, divrat_into
 //
-//    ARGUMENTS: pointer to a rational a second rational.
+//    ARGUMENTS: pointer to a rational a second rational, and for
+//               divrat_into the scratch numbers to build the result in.
 //
 //    RETURN: None, changes first pointer.
 //
@@ -134,18 +144,26 @@ void mulrat(_Inout_ PRAT* pa, _In_ PRAT b, int32_t precision)
 
 void divrat(_Inout_ PRAT* pa, _In_ PRAT b, int32_t precision)
 
+{
+    SCRATCH scratch = {};
+    divrat_into(pa, b, precision, &scratch);
+    destroyscratch(scratch);
+}
+
+void divrat_into(_Inout_ PRAT* pa, _In_ PRAT b, int32_t precision, _Inout_ PSCRATCH pscratch)
+
 {
     if (!zernum((*pa)->pp))
     {
-        // Only do the divide if the top isn't zero.
-        mulnumx(&((*pa)->pp), b->pq);
-        mulnumx(&((*pa)->pq), b->pp);
-
-        if (zernum((*pa)->pq))
+        if (zernum(b->pp))
         {
             // raise an exception if the bottom is 0.
             throw(CALC_E_DIVIDEBYZERO);
         }
+
+        // Only do the divide if the top isn't zero.
+        mulnumx_into(&((*pa)->pp), b->pq, &(pscratch->pnum));
+        mulnumx_into(&((*pa)->pq), b->pp, &(pscratch->pnum));
         trimit(pa, precision);
     }
     else
@@ -171,30 +189,40 @@ void divrat(_Inout_ PRAT* pa, _In_ PRAT b, int32_t precision)
 
 //-----------------------------------------------------------------------------
 //
-//    FUNCTION: subrat
+//    FUNCTION: subrat, subrat_into
 //
-//    ARGUMENTS: pointer to a rational a second rational.
+//    ARGUMENTS: pointer to a rational a second rational, and for
+//               subrat_into the scratch numbers to build the result in.
 //
 //    RETURN: None, changes first pointer.
 //
-//    DESCRIPTION: Does the rational equivalent of *pa += b.
+//    DESCRIPTION: Does the rational equivalent of *pa -= b.
 //    Assumes base is internal throughout.
 //
 //-----------------------------------------------------------------------------
 
 void subrat(_Inout_ PRAT* pa, _In_ PRAT b, int32_t precision)
 
+{
+    SCRATCH scratch = {};
+    subrat_into(pa, b, precision, &scratch);
+    destroyscratch(scratch);
+}
+
+void subrat_into(_Inout_ PRAT* pa, _In_ PRAT b, int32_t precision, _Inout_ PSCRATCH pscratch)
+
 {
     b->pp->sign *= -1;
-    addrat(pa, b, precision);
+    addrat_into(pa, b, precision, pscratch);
     b->pp->sign *= -1;
 }
 
 //-----------------------------------------------------------------------------
 //
-//    FUNCTION: addrat
+//    FUNCTION: addrat, addrat_into
 //
-//    ARGUMENTS: pointer to a rational a second rational.
+//    ARGUMENTS: pointer to a rational a second rational, and for
+//               addrat_into the scratch numbers to build the result in.
 //
 //    RETURN: None, changes first pointer.
 //
@@ -206,8 +234,14 @@ void subrat(_Inout_ PRAT* pa, _In_ PRAT b, int32_t precision)
 void addrat(_Inout_ PRAT* pa, _In_ PRAT b, int32_t precision)
 
 {
-    PNUMBER bot = nullptr;
+    SCRATCH scratch = {};
+    addrat_into(pa, b, precision, &scratch);
+    destroyscratch(scratch);
+}
+
+void addrat_into(_Inout_ PRAT* pa, _In_ PRAT b, int32_t precision, _Inout_ PSCRATCH pscratch)
 
+{
     if (equnum((*pa)->pq, b->pq))
     {
         // Very special case, q's match.,
@@ -218,18 +252,17 @@ void addrat(_Inout_ PRAT* pa, _In_ PRAT b, int32_t precision)
         (*pa)->pq->sign = 1;
         b->pp->sign *= b->pq->sign;
         b->pq->sign = 1;
-        addnum(&((*pa)->pp), b->pp, BASEX);
+        addnum_into(&((*pa)->pp), b->pp, BASEX, &(pscratch->pnum));
     }
     else
     {
         // Usual case q's aren't the same.
-        DUPNUM(bot, (*pa)->pq);
-        mulnumx(&bot, b->pq);
-        mulnumx(&((*pa)->pp), b->pq);
-        mulnumx(&((*pa)->pq), b->pp);
-        addnum(&((*pa)->pp), (*pa)->pq, BASEX);
-        destroynum((*pa)->pq);
-        (*pa)->pq = bot;
+        DUPNUM(pscratch->pbot, (*pa)->pq);
+        mulnumx_into(&(pscratch->pbot), b->pq, &(pscratch->pnum));
+        mulnumx_into(&((*pa)->pp), b->pq, &(pscratch->pnum));
+        mulnumx_into(&((*pa)->pq), b->pp, &(pscratch->pnum));
+        addnum_into(&((*pa)->pp), (*pa)->pq, BASEX, &(pscratch->pnum));
+        swap((*pa)->pq, pscratch->pbot);
         trimit(pa, precision);
 
         // Get rid of negative zeros here.
@@ -251,12 +284,20 @@ void addrat(_Inout_ PRAT* pa, _In_ PRAT b, int32_t precision)
 //
 //  RETURN: bth root of a in rat form.
 //
-//  EXPLANATION: This is now a stub function to powrat().
+//  EXPLANATION: Small integer roots are taken by rootrati32, other roots
+//  through powrat().
 //
 //-----------------------------------------------------------------------------
 
 void rootrat(_Inout_ PRAT* py, _In_ PRAT n, uint32_t radix, int32_t precision)
 {
+    int32_t root = 0;
+    if (equnum(n->pq, num_one) && smallrootnum(n->pp, &root))
+    {
+        rootrati32(py, root, radix, precision);
+        return;
+    }
+
     // Initialize 1/n
     PRAT oneovern = nullptr;
     DUPRAT(oneovern, rat_one);
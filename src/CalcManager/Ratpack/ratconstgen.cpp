@@ -0,0 +1,56 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+//-----------------------------------------------------------------------------
+//  Package Title  ratpak
+//  File           ratconstgen.cpp
+//
+//
+//  Description
+//
+//  Writes ratconsttables.h, the constants ChangeConstants would otherwise
+//  calculate, for the radices calc uses at a ladder of precisions. It is not
+//  part of the library, the GenerateRatConstTables target of CalcManager
+//  builds it with the rest of ratpak and runs it. Rerun it whenever the
+//  series the constants are calculated with change.
+//
+//-----------------------------------------------------------------------------
+
+#include <iostream>
+#include "ratpak.h"
+
+using namespace std;
+
+static constexpr uint32_t RADICES[] = { 2, 8, 10, 16 };
+static constexpr int32_t PRECISIONS[] = { 32, 64, 128, 256, 512 };
+
+int main()
+{
+    wcout << L"// Copyright (c) Microsoft Corporation. All rights reserved.\n";
+    wcout << L"// Licensed under the MIT License.\n\n";
+    wcout << L"#pragma once\n\n";
+    wcout << L"// Autogenerated by ratconstgen, do not edit.\n\n";
+
+    for (uint32_t radix : RADICES)
+    {
+        for (int32_t precision : PRECISIONS)
+        {
+            _dumpconstants(radix, precision, wcout);
+            wcout << L"\n";
+        }
+    }
+
+    // ChangeConstants takes the first table of the radix with enough precision.
+    wcout << L"// Autogenerated by ratconstgen\n";
+    wcout << L"inline const RATCONSTTABLE* const init_ratconsttables[] = {\n";
+    for (uint32_t radix : RADICES)
+    {
+        for (int32_t precision : PRECISIONS)
+        {
+            wcout << L"    &init_ratconsttable_" << radix << L"_" << precision << L",\n";
+        }
+    }
+    wcout << L"};\n";
+
+    return 0;
+}
@@ -0,0 +1,2650 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+// Autogenerated by ratconstgen, do not edit.
+
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_pi_2_32 = { 1, 4, 0, 4, {
+    649351340, 1372584375, 1348089120, 4817,
+} };
+inline const NUMBER init_q_pi_2_32 = { 1, 4, 0, 4, {
+    200216756, 487962539, 1070610162, 1533,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_two_pi_2_32 = { 1, 4, 0, 4, {
+    1298702680, 597685102, 548694593, 9635,
+} };
+inline const NUMBER init_q_two_pi_2_32 = { 1, 4, 0, 4, {
+    200216756, 487962539, 1070610162, 1533,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_pi_over_two_2_32 = { 1, 4, 0, 4, {
+    649351340, 1372584375, 1348089120, 4817,
+} };
+inline const NUMBER init_q_pi_over_two_2_32 = { 1, 4, 0, 4, {
+    400433512, 975925078, 2141220324, 3066,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_one_pt_five_pi_2_32 = { 1, 4, 0, 4, {
+    1442368931, 1421967408, 860580500, 22163475,
+} };
+inline const NUMBER init_q_one_pt_five_pi_2_32 = { 1, 4, 0, 4, {
+    204923718, 1212770419, 1191490475, 4703235,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_e_to_one_half_2_32 = { 1, 4, 0, 4, {
+    193434992, 1741050347, 674044076, 168206900,
+} };
+inline const NUMBER init_q_e_to_one_half_2_32 = { 1, 4, 0, 4, {
+    262785506, 1573732410, 462981405, 102022642,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rat_exp_2_32 = { 1, 4, 0, 4, {
+    2015878913, 155829055, 999491830, 10,
+} };
+inline const NUMBER init_q_rat_exp_2_32 = { 1, 4, 0, 4, {
+    1690060622, 886954497, 1825392395, 3,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_ln_ten_2_32 = { 1, 4, 0, 4, {
+    895579220, 1169357818, 43263824, 25,
+} };
+inline const NUMBER init_q_ln_ten_2_32 = { 1, 4, 0, 4, {
+    1057708184, 1851878181, 1859960217, 10,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_ln_two_2_32 = { 1, 4, 0, 4, {
+    11406146, 895634676, 902410259, 425,
+} };
+inline const NUMBER init_q_ln_two_2_32 = { 1, 4, 0, 4, {
+    758437048, 2143074486, 1614130559, 613,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rad_to_deg_2_32 = { 1, 4, 0, 4, {
+    1679277712, 1933911116, 1583784528, 276029,
+} };
+inline const NUMBER init_q_rad_to_deg_2_32 = { 1, 4, 0, 4, {
+    649351340, 1372584375, 1348089120, 4817,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rad_to_grad_2_32 = { 1, 4, 0, 4, {
+    1388645536, 955743658, 1521151293, 306699,
+} };
+inline const NUMBER init_q_rad_to_grad_2_32 = { 1, 4, 0, 4, {
+    649351340, 1372584375, 1348089120, 4817,
+} };
+// Autogenerated by _dumpconstants in support.cpp
+inline const RATCONSTTABLE init_ratconsttable_2_32 = {
+    2,
+    32,
+    {
+        { &init_p_pi_2_32, &init_q_pi_2_32 },
+        { &init_p_two_pi_2_32, &init_q_two_pi_2_32 },
+        { &init_p_pi_over_two_2_32, &init_q_pi_over_two_2_32 },
+        { &init_p_one_pt_five_pi_2_32, &init_q_one_pt_five_pi_2_32 },
+        { &init_p_e_to_one_half_2_32, &init_q_e_to_one_half_2_32 },
+        { &init_p_rat_exp_2_32, &init_q_rat_exp_2_32 },
+        { &init_p_ln_ten_2_32, &init_q_ln_ten_2_32 },
+        { &init_p_ln_two_2_32, &init_q_ln_two_2_32 },
+        { &init_p_rad_to_deg_2_32, &init_q_rad_to_deg_2_32 },
+        { &init_p_rad_to_grad_2_32, &init_q_rad_to_grad_2_32 },
+    }
+};
+
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_pi_2_64 = { 1, 5, 0, 5, {
+    669757824, 1231725241, 1898797585, 1610960359, 10,
+} };
+inline const NUMBER init_q_pi_2_64 = { 1, 5, 0, 5, {
+    1971851007, 1386896587, 1214730469, 905986420, 3,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_two_pi_2_64 = { 1, 5, 0, 5, {
+    1339515648, 315966834, 1650111523, 1074437071, 21,
+} };
+inline const NUMBER init_q_two_pi_2_64 = { 1, 5, 0, 5, {
+    1971851007, 1386896587, 1214730469, 905986420, 3,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_pi_over_two_2_64 = { 1, 5, 0, 5, {
+    669757824, 1231725241, 1898797585, 1610960359, 10,
+} };
+inline const NUMBER init_q_pi_over_two_2_64 = { 1, 5, 0, 5, {
+    1796218366, 626309527, 281977291, 1811972841, 6,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_one_pt_five_pi_2_64 = { 1, 5, 0, 5, {
+    1971204441, 1511206336, 1752173180, 767472311, 110,
+} };
+inline const NUMBER init_q_one_pt_five_pi_2_64 = { 1, 5, 0, 5, {
+    712223082, 517000986, 1618931840, 898858987, 23,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_e_to_one_half_2_64 = { 1, 5, 0, 5, {
+    103360069, 1464994315, 1927742800, 1413238841, 3,
+} };
+inline const NUMBER init_q_e_to_one_half_2_64 = { 1, 5, 0, 5, {
+    715856521, 1796519227, 726521525, 469749412, 2,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rat_exp_2_64 = { 1, 5, 0, 5, {
+    2078702322, 432383226, 1891178804, 1991503480, 2448,
+} };
+inline const NUMBER init_q_rat_exp_2_64 = { 1, 5, 0, 5, {
+    1002755194, 994520233, 18495258, 1954276479, 900,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_ln_ten_2_64 = { 1, 5, 0, 5, {
+    1002298678, 1292293582, 484915126, 1762837104, 975062,
+} };
+inline const NUMBER init_q_ln_ten_2_64 = { 1, 5, 0, 5, {
+    1157427430, 395718369, 615636314, 864618518, 423464,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_ln_two_2_64 = { 1, 5, 0, 5, {
+    279135838, 785595230, 366362089, 458893056, 4961776,
+} };
+inline const NUMBER init_q_ln_two_2_64 = { 1, 5, 0, 5, {
+    742465488, 1703430924, 488167231, 2013243479, 7158329,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rad_to_deg_2_64 = { 1, 5, 0, 5, {
+    598379340, 533282657, 1755636088, 2016282101, 615,
+} };
+inline const NUMBER init_q_rad_to_deg_2_64 = { 1, 5, 0, 5, {
+    669757824, 1231725241, 1898797585, 1610960359, 10,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rad_to_grad_2_64 = { 1, 5, 0, 5, {
+    1380693816, 353926991, 280441705, 808657681, 684,
+} };
+inline const NUMBER init_q_rad_to_grad_2_64 = { 1, 5, 0, 5, {
+    669757824, 1231725241, 1898797585, 1610960359, 10,
+} };
+// Autogenerated by _dumpconstants in support.cpp
+inline const RATCONSTTABLE init_ratconsttable_2_64 = {
+    2,
+    64,
+    {
+        { &init_p_pi_2_64, &init_q_pi_2_64 },
+        { &init_p_two_pi_2_64, &init_q_two_pi_2_64 },
+        { &init_p_pi_over_two_2_64, &init_q_pi_over_two_2_64 },
+        { &init_p_one_pt_five_pi_2_64, &init_q_one_pt_five_pi_2_64 },
+        { &init_p_e_to_one_half_2_64, &init_q_e_to_one_half_2_64 },
+        { &init_p_rat_exp_2_64, &init_q_rat_exp_2_64 },
+        { &init_p_ln_ten_2_64, &init_q_ln_ten_2_64 },
+        { &init_p_ln_two_2_64, &init_q_ln_two_2_64 },
+        { &init_p_rad_to_deg_2_64, &init_q_rad_to_deg_2_64 },
+        { &init_p_rad_to_grad_2_64, &init_q_rad_to_grad_2_64 },
+    }
+};
+
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_pi_2_128 = { 1, 7, 0, 7, {
+    1358503228, 1246868245, 1798201471, 311572633, 2010801287, 530865666, 77808493,
+} };
+inline const NUMBER init_q_pi_2_128 = { 1, 7, 0, 7, {
+    370507393, 530173052, 1088859723, 42188320, 730030596, 1352162262, 24767212,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_two_pi_2_128 = { 1, 7, 0, 7, {
+    569522808, 346252843, 1448919295, 623145267, 1874118926, 1061731333, 155616986,
+} };
+inline const NUMBER init_q_two_pi_2_128 = { 1, 7, 0, 7, {
+    370507393, 530173052, 1088859723, 42188320, 730030596, 1352162262, 24767212,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_pi_over_two_2_128 = { 1, 7, 0, 7, {
+    1358503228, 1246868245, 1798201471, 311572633, 2010801287, 530865666, 77808493,
+} };
+inline const NUMBER init_q_pi_over_two_2_128 = { 1, 7, 0, 7, {
+    741014786, 1060346104, 30235798, 84376641, 1460061192, 556840876, 49534425,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_one_pt_five_pi_2_128 = { 1, 7, 0, 7, {
+    454331246, 953941684, 88290308, 404322154, 1515677007, 1926582795, 2692126,
+} };
+inline const NUMBER init_q_one_pt_five_pi_2_128 = { 1, 7, 0, 7, {
+    1347631680, 2082376666, 680061765, 2118193426, 565266616, 152069575, 571287,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_e_to_one_half_2_128 = { 1, 7, 0, 7, {
+    1093125840, 1622066915, 2020002465, 170636825, 1642272715, 323644390, 629,
+} };
+inline const NUMBER init_q_e_to_one_half_2_128 = { 1, 7, 0, 7, {
+    714080820, 636441742, 687204551, 1614840687, 1127157355, 1286760142, 381,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rat_exp_2_128 = { 1, 7, 0, 7, {
+    1683172894, 765630206, 1043590701, 522706668, 1012334744, 297387774, 30087,
+} };
+inline const NUMBER init_q_rat_exp_2_128 = { 1, 7, 0, 7, {
+    745461927, 2003556565, 1097298767, 621799884, 720794174, 944229654, 11068,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_ln_ten_2_128 = { 1, 7, 0, 7, {
+    915920410, 2067301983, 713174221, 1965948679, 225620169, 352175099, 395,
+} };
+inline const NUMBER init_q_ln_ten_2_128 = { 1, 7, 0, 7, {
+    1578249690, 1426166077, 1429253555, 355655175, 497830931, 1326161724, 171,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_ln_two_2_128 = { 1, 7, 0, 7, {
+    312469216, 1910428904, 372383075, 2094935184, 1297392401, 146734242, 478,
+} };
+inline const NUMBER init_q_ln_two_2_128 = { 1, 7, 0, 7, {
+    1670813292, 1527719145, 244944578, 1452603753, 192119285, 1517855766, 689,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rad_to_deg_2_128 = { 1, 8, 0, 8, {
+    119337652, 941868879, 573738216, 1151446747, 409004755, 723554997, 163130977, 2,
+} };
+inline const NUMBER init_q_rad_to_deg_2_128 = { 1, 7, 0, 7, {
+    1358503228, 1246868245, 1798201471, 311572633, 2010801287, 530865666, 77808493,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rad_to_grad_2_128 = { 1, 8, 0, 8, {
+    1087034568, 807911682, 876096201, 1995213157, 2124714787, 1996996467, 658475229, 2,
+} };
+inline const NUMBER init_q_rad_to_grad_2_128 = { 1, 7, 0, 7, {
+    1358503228, 1246868245, 1798201471, 311572633, 2010801287, 530865666, 77808493,
+} };
+// Autogenerated by _dumpconstants in support.cpp
+inline const RATCONSTTABLE init_ratconsttable_2_128 = {
+    2,
+    128,
+    {
+        { &init_p_pi_2_128, &init_q_pi_2_128 },
+        { &init_p_two_pi_2_128, &init_q_two_pi_2_128 },
+        { &init_p_pi_over_two_2_128, &init_q_pi_over_two_2_128 },
+        { &init_p_one_pt_five_pi_2_128, &init_q_one_pt_five_pi_2_128 },
+        { &init_p_e_to_one_half_2_128, &init_q_e_to_one_half_2_128 },
+        { &init_p_rat_exp_2_128, &init_q_rat_exp_2_128 },
+        { &init_p_ln_ten_2_128, &init_q_ln_ten_2_128 },
+        { &init_p_ln_two_2_128, &init_q_ln_two_2_128 },
+        { &init_p_rad_to_deg_2_128, &init_q_rad_to_deg_2_128 },
+        { &init_p_rad_to_grad_2_128, &init_q_rad_to_grad_2_128 },
+    }
+};
+
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_pi_2_256 = { 1, 11, 0, 11, {
+    1327928150, 882312797, 269300394, 1248973447, 220809324, 2079796583, 692122446, 565474195,
+    107719837, 53451009, 27655446,
+} };
+inline const NUMBER init_q_pi_2_256 = { 1, 11, 0, 11, {
+    1566513174, 700470862, 1279655007, 533218823, 419233813, 1606935979, 1006436275, 1028999551,
+    668047598, 1882365459, 8803001,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_two_pi_2_256 = { 1, 11, 0, 11, {
+    508372652, 1764625595, 538600788, 350463246, 441618649, 2012109518, 1384244893, 1130948390,
+    215439674, 106902018, 55310892,
+} };
+inline const NUMBER init_q_two_pi_2_256 = { 1, 11, 0, 11, {
+    1566513174, 700470862, 1279655007, 533218823, 419233813, 1606935979, 1006436275, 1028999551,
+    668047598, 1882365459, 8803001,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_pi_over_two_2_256 = { 1, 11, 0, 11, {
+    1327928150, 882312797, 269300394, 1248973447, 220809324, 2079796583, 692122446, 565474195,
+    107719837, 53451009, 27655446,
+} };
+inline const NUMBER init_q_pi_over_two_2_256 = { 1, 11, 0, 11, {
+    985542700, 1400941725, 411826366, 1066437647, 838467626, 1066388310, 2012872551, 2057999102,
+    1336095196, 1617247270, 17606003,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_one_pt_five_pi_2_256 = { 1, 11, 0, 11, {
+    1214856883, 1919023348, 208696256, 548569805, 214124178, 868197304, 2145922657, 77345764,
+    1379697466, 83527509, 340097,
+} };
+inline const NUMBER init_q_one_pt_five_pi_2_256 = { 1, 11, 0, 11, {
+    2034901532, 1014121741, 1699292960, 1294756722, 611323278, 601548966, 555587215, 1724641775,
+    1777974487, 1789200739, 72170,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_e_to_one_half_2_256 = { 1, 11, 0, 11, {
+    1474779009, 1095877347, 208056096, 1962810553, 251143977, 1250247638, 1525685711, 233912330,
+    69214808, 1542149824, 30796442,
+} };
+inline const NUMBER init_q_e_to_one_half_2_256 = { 1, 11, 0, 11, {
+    1954160879, 235728212, 2133064261, 877718706, 322109775, 93207579, 729334108, 1772154459,
+    1004996696, 1543231848, 18678986,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rat_exp_2_256 = { 1, 11, 0, 11, {
+    551791527, 744598997, 187465605, 587217230, 631383117, 1206264611, 1997685869, 1613907146,
+    459529974, 1828718314, 35,
+} };
+inline const NUMBER init_q_rat_exp_2_256 = { 1, 11, 0, 11, {
+    1152799580, 1289337592, 1718298154, 885857703, 1503457321, 1515928320, 1049543344, 1610538909,
+    1674576060, 405988399, 13,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_ln_ten_2_256 = { 1, 11, 0, 11, {
+    1926616780, 1635694285, 427990679, 82813926, 1675393107, 680000098, 1885129108, 705758535,
+    1921986858, 941004801, 15017743,
+} };
+inline const NUMBER init_q_ln_ten_2_256 = { 1, 11, 0, 11, {
+    202459902, 1488190835, 1848362236, 183481415, 1738894666, 968032509, 1237486532, 1324887613,
+    1410089193, 227299272, 6522123,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_ln_two_2_256 = { 1, 11, 0, 11, {
+    444893727, 1347731248, 1787281322, 1150708169, 63871459, 2101160823, 924753607, 1511332427,
+    578341298, 1975071372, 7796,
+} };
+inline const NUMBER init_q_ln_two_2_256 = { 1, 11, 0, 11, {
+    1585068710, 2036516204, 1172741874, 1587276788, 1475486351, 1031629107, 1370295700, 1135781432,
+    1524888044, 1239969938, 11248,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rad_to_deg_2_256 = { 1, 11, 0, 11, {
+    652013432, 1530703707, 557150982, 1490107735, 300158704, 1485667423, 769903202, 536325536,
+    2136967086, 1670849939, 1584540337,
+} };
+inline const NUMBER init_q_rad_to_deg_2_256 = { 1, 11, 0, 11, {
+    1327928150, 882312797, 269300394, 1248973447, 220809324, 2079796583, 692122446, 565474195,
+    107719837, 53451009, 27655446,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rad_to_grad_2_256 = { 1, 11, 0, 11, {
+    1917505840, 507735425, 380447353, 1417065967, 94900377, 1412132287, 1571275885, 1788963733,
+    465533519, 663453462, 1760600375,
+} };
+inline const NUMBER init_q_rad_to_grad_2_256 = { 1, 11, 0, 11, {
+    1327928150, 882312797, 269300394, 1248973447, 220809324, 2079796583, 692122446, 565474195,
+    107719837, 53451009, 27655446,
+} };
+// Autogenerated by _dumpconstants in support.cpp
+inline const RATCONSTTABLE init_ratconsttable_2_256 = {
+    2,
+    256,
+    {
+        { &init_p_pi_2_256, &init_q_pi_2_256 },
+        { &init_p_two_pi_2_256, &init_q_two_pi_2_256 },
+        { &init_p_pi_over_two_2_256, &init_q_pi_over_two_2_256 },
+        { &init_p_one_pt_five_pi_2_256, &init_q_one_pt_five_pi_2_256 },
+        { &init_p_e_to_one_half_2_256, &init_q_e_to_one_half_2_256 },
+        { &init_p_rat_exp_2_256, &init_q_rat_exp_2_256 },
+        { &init_p_ln_ten_2_256, &init_q_ln_ten_2_256 },
+        { &init_p_ln_two_2_256, &init_q_ln_two_2_256 },
+        { &init_p_rad_to_deg_2_256, &init_q_rad_to_deg_2_256 },
+        { &init_p_rad_to_grad_2_256, &init_q_rad_to_grad_2_256 },
+    }
+};
+
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_pi_2_512 = { 1, 20, 0, 20, {
+    1673358142, 998374701, 1096971264, 1006081525, 919588106, 756265719, 1917292197, 2125863647,
+    808394976, 14464869, 731028054, 1636427354, 877649070, 1253688376, 1655458952, 1726880641,
+    26689675, 1927707210, 2017019530, 83284146,
+} };
+inline const NUMBER init_q_pi_2_512 = { 1, 20, 0, 20, {
+    747095143, 1736052456, 95088975, 1539874416, 615530215, 1313867102, 732581322, 249839293,
+    1087443495, 515574843, 1879923825, 209779286, 427973249, 2116673459, 147262366, 626354604,
+    1685405501, 2132359594, 715425803, 26510167,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_two_pi_2_512 = { 1, 20, 0, 20, {
+    1199232636, 1996749403, 46458880, 2012163051, 1839176212, 1512531438, 1687100746, 2104243647,
+    1616789953, 28929738, 1462056108, 1125371060, 1755298141, 359893104, 1163434257, 1306277635,
+    53379351, 1707930772, 1886555413, 166568293,
+} };
+inline const NUMBER init_q_two_pi_2_512 = { 1, 20, 0, 20, {
+    747095143, 1736052456, 95088975, 1539874416, 615530215, 1313867102, 732581322, 249839293,
+    1087443495, 515574843, 1879923825, 209779286, 427973249, 2116673459, 147262366, 626354604,
+    1685405501, 2132359594, 715425803, 26510167,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_pi_over_two_2_512 = { 1, 20, 0, 20, {
+    1673358142, 998374701, 1096971264, 1006081525, 919588106, 756265719, 1917292197, 2125863647,
+    808394976, 14464869, 731028054, 1636427354, 877649070, 1253688376, 1655458952, 1726880641,
+    26689675, 1927707210, 2017019530, 83284146,
+} };
+inline const NUMBER init_q_pi_over_two_2_512 = { 1, 20, 0, 20, {
+    1494190286, 1324621264, 190177951, 932265184, 1231060431, 480250556, 1465162645, 499678586,
+    27403342, 1031149687, 1612364002, 419558573, 855946498, 2085863270, 294524733, 1252709208,
+    1223327354, 2117235541, 1430851607, 53020334,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_one_pt_five_pi_2_512 = { 1, 20, 0, 20, {
+    926345196, 388666293, 639059102, 790637761, 1200776871, 2116446953, 413828028, 1288154129,
+    375419311, 419321597, 1010506388, 707654857, 1860817594, 579340122, 227647101, 1149149114,
+    1712041695, 851331361, 170258905, 3084368,
+} };
+inline const NUMBER init_q_one_pt_five_pi_2_512 = { 1, 20, 0, 20, {
+    1897854166, 1826787285, 1923617477, 1827017509, 995964711, 1198631231, 93713155, 1227676869,
+    1053301014, 1083960114, 1338343222, 867358253, 1625748775, 187828054, 1519519185, 142637437,
+    2089695722, 641709214, 504322909, 654523,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_e_to_one_half_2_512 = { 1, 20, 0, 20, {
+    212879837, 1042091623, 513490847, 867878618, 1914086479, 1779487343, 1965584185, 578760967,
+    18690622, 677640063, 1073684691, 564055891, 464355479, 1298191457, 1456348684, 974879356,
+    1677808476, 1039219532, 761476314, 1324468,
+} };
+inline const NUMBER init_q_e_to_one_half_2_512 = { 1, 20, 0, 20, {
+    1742568709, 1015769145, 1812900303, 1801573365, 707020733, 1566581740, 1102832360, 1785817211,
+    496889353, 2013513040, 1297253918, 786704582, 360926266, 1853757516, 1567686337, 2127128927,
+    1435134541, 1266115667, 1427814640, 803330,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rat_exp_2_512 = { 1, 20, 0, 20, {
+    93936759, 2066596791, 2143642034, 1125949805, 989737264, 769371807, 2120913159, 350800066,
+    1288942905, 1447693119, 731243906, 472221574, 1291039328, 362915861, 991004817, 123985965,
+    346551309, 966965162, 38803558, 4943502,
+} };
+inline const NUMBER init_q_rat_exp_2_512 = { 1, 20, 0, 20, {
+    992225797, 1360499520, 1042785288, 920802276, 842556222, 1027645828, 688294562, 1618534436,
+    1842080223, 1668234348, 787630108, 1524455745, 1026407387, 18229632, 123703771, 1149603165,
+    151859737, 1087644191, 1631738041, 1818612,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_ln_ten_2_512 = { 1, 20, 0, 20, {
+    950596184, 2022590067, 2142476998, 885725082, 962680319, 688499184, 942137125, 411721610,
+    428284140, 30929872, 1140874600, 582862927, 1626596213, 814006684, 2117904480, 307241013,
+    185953730, 13876645, 755396611, 1614,
+} };
+inline const NUMBER init_q_ln_ten_2_512 = { 1, 20, 0, 20, {
+    863608908, 125769835, 1521515788, 1054001153, 841838911, 949228769, 798290054, 130488060,
+    545075485, 1071733838, 57586128, 1639132903, 211281981, 1586006030, 1646154297, 1820607653,
+    2140703487, 530396878, 223468794, 701,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_ln_two_2_512 = { 1, 20, 0, 20, {
+    1638455629, 1811916752, 407457013, 2029926186, 338016397, 2018932122, 1378661107, 1607185865,
+    2146484316, 919958169, 356024336, 2009623163, 267611758, 2105579062, 177689452, 866201062,
+    1553173235, 1382476131, 2066985777, 51,
+} };
+inline const NUMBER init_q_ln_two_2_512 = { 1, 20, 0, 20, {
+    1590644010, 1860794348, 1267102837, 290036960, 585410926, 1399327931, 607040446, 540815862,
+    751634511, 144716547, 1060320906, 1776295499, 837129706, 136454102, 1376273103, 600920949,
+    845831467, 733223093, 2074604656, 74,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rad_to_deg_2_512 = { 1, 21, 0, 21, {
+    1333139564, 1104313182, 2083630109, 152004295, 1273772781, 272877131, 868135542, 2021399841,
+    318817152, 461674967, 1231355807, 1253049621, 1873257157, 896616959, 737422281, 1074679036,
+    577795864, 1572637717, 2075109486, 476862823, 2,
+} };
+inline const NUMBER init_q_rad_to_deg_2_512 = { 1, 20, 0, 20, {
+    1673358142, 998374701, 1096971264, 1006081525, 919588106, 756265719, 1917292197, 2125863647,
+    808394976, 14464869, 731028054, 1636427354, 877649070, 1253688376, 1655458952, 1726880641,
+    26689675, 1927707210, 2017019530, 83284146,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rad_to_grad_2_512 = { 1, 21, 0, 21, {
+    1242656888, 1465623941, 1837925977, 884721544, 699475207, 780415401, 487376458, 575734764,
+    592850575, 35753597, 175126648, 1153668063, 1842787547, 280413183, 1535185973, 716869229,
+    2073651170, 1270156652, 1351240030, 1007066170, 2,
+} };
+inline const NUMBER init_q_rad_to_grad_2_512 = { 1, 20, 0, 20, {
+    1673358142, 998374701, 1096971264, 1006081525, 919588106, 756265719, 1917292197, 2125863647,
+    808394976, 14464869, 731028054, 1636427354, 877649070, 1253688376, 1655458952, 1726880641,
+    26689675, 1927707210, 2017019530, 83284146,
+} };
+// Autogenerated by _dumpconstants in support.cpp
+inline const RATCONSTTABLE init_ratconsttable_2_512 = {
+    2,
+    512,
+    {
+        { &init_p_pi_2_512, &init_q_pi_2_512 },
+        { &init_p_two_pi_2_512, &init_q_two_pi_2_512 },
+        { &init_p_pi_over_two_2_512, &init_q_pi_over_two_2_512 },
+        { &init_p_one_pt_five_pi_2_512, &init_q_one_pt_five_pi_2_512 },
+        { &init_p_e_to_one_half_2_512, &init_q_e_to_one_half_2_512 },
+        { &init_p_rat_exp_2_512, &init_q_rat_exp_2_512 },
+        { &init_p_ln_ten_2_512, &init_q_ln_ten_2_512 },
+        { &init_p_ln_two_2_512, &init_q_ln_two_2_512 },
+        { &init_p_rad_to_deg_2_512, &init_q_rad_to_deg_2_512 },
+        { &init_p_rad_to_grad_2_512, &init_q_rad_to_grad_2_512 },
+    }
+};
+
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_pi_8_32 = { 1, 6, 0, 6, {
+    125527896, 283898350, 1960493936, 1672850762, 1288168272, 8,
+} };
+inline const NUMBER init_q_pi_8_32 = { 1, 6, 0, 6, {
+    1288380402, 1120116153, 1860424692, 1944118326, 1583591604, 2,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_two_pi_8_32 = { 1, 6, 0, 6, {
+    251055792, 567796700, 1773504224, 1198217877, 428852897, 17,
+} };
+inline const NUMBER init_q_two_pi_8_32 = { 1, 6, 0, 6, {
+    1288380402, 1120116153, 1860424692, 1944118326, 1583591604, 2,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_pi_over_two_8_32 = { 1, 6, 0, 6, {
+    125527896, 283898350, 1960493936, 1672850762, 1288168272, 8,
+} };
+inline const NUMBER init_q_pi_over_two_8_32 = { 1, 6, 0, 6, {
+    429277156, 92748659, 1573365737, 1740753005, 1019699561, 5,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_one_pt_five_pi_8_32 = { 1, 6, 0, 6, {
+    1241201312, 270061909, 1051574664, 1924965045, 1340320627, 70,
+} };
+inline const NUMBER init_q_one_pt_five_pi_8_32 = { 1, 6, 0, 6, {
+    1579671539, 1837970263, 1067644340, 523549916, 2119366659, 14,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_e_to_one_half_8_32 = { 1, 6, 0, 6, {
+    256945612, 216219427, 223516738, 477442596, 581063757, 23,
+} };
+inline const NUMBER init_q_e_to_one_half_8_32 = { 1, 6, 0, 6, {
+    1536828363, 698484484, 1127331835, 224219346, 245499408, 14,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rat_exp_8_32 = { 1, 6, 0, 6, {
+    943665199, 1606559160, 1094967530, 1759391384, 1671799163, 1123581,
+} };
+inline const NUMBER init_q_rat_exp_8_32 = { 1, 6, 0, 6, {
+    879242208, 2022880100, 617392930, 1374929092, 1367479163, 413342,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_ln_ten_8_32 = { 1, 6, 0, 6, {
+    2086268922, 165794492, 1416063951, 1851428830, 1893239400, 65366841,
+} };
+inline const NUMBER init_q_ln_ten_8_32 = { 1, 6, 0, 6, {
+    26790652, 564532679, 783998273, 216030448, 1564709968, 28388458,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_ln_two_8_32 = { 1, 6, 0, 6, {
+    1789230241, 1057927868, 715399197, 908801241, 1411265331, 3,
+} };
+inline const NUMBER init_q_ln_two_8_32 = { 1, 6, 0, 6, {
+    1559869847, 1930657510, 1228561531, 219003871, 593099283, 5,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rad_to_deg_8_32 = { 1, 6, 0, 6, {
+    2127722024, 1904928383, 2016479213, 2048947859, 1578647346, 492,
+} };
+inline const NUMBER init_q_rad_to_deg_8_32 = { 1, 6, 0, 6, {
+    125527896, 283898350, 1960493936, 1672850762, 1288168272, 8,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rad_to_grad_8_32 = { 1, 6, 0, 6, {
+    2125526288, 684931327, 570267400, 129125085, 1038224725, 547,
+} };
+inline const NUMBER init_q_rad_to_grad_8_32 = { 1, 6, 0, 6, {
+    125527896, 283898350, 1960493936, 1672850762, 1288168272, 8,
+} };
+// Autogenerated by _dumpconstants in support.cpp
+inline const RATCONSTTABLE init_ratconsttable_8_32 = {
+    8,
+    32,
+    {
+        { &init_p_pi_8_32, &init_q_pi_8_32 },
+        { &init_p_two_pi_8_32, &init_q_two_pi_8_32 },
+        { &init_p_pi_over_two_8_32, &init_q_pi_over_two_8_32 },
+        { &init_p_one_pt_five_pi_8_32, &init_q_one_pt_five_pi_8_32 },
+        { &init_p_e_to_one_half_8_32, &init_q_e_to_one_half_8_32 },
+        { &init_p_rat_exp_8_32, &init_q_rat_exp_8_32 },
+        { &init_p_ln_ten_8_32, &init_q_ln_ten_8_32 },
+        { &init_p_ln_two_8_32, &init_q_ln_two_8_32 },
+        { &init_p_rad_to_deg_8_32, &init_q_rad_to_deg_8_32 },
+        { &init_p_rad_to_grad_8_32, &init_q_rad_to_grad_8_32 },
+    }
+};
+
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_pi_8_64 = { 1, 9, 0, 9, {
+    864897102, 1566397137, 666177861, 1479369881, 468320172, 1718485152, 1829083640, 1219331804,
+    1174183109,
+} };
+inline const NUMBER init_q_pi_8_64 = { 1, 9, 0, 9, {
+    121073408, 1400196395, 1727968319, 1924074872, 1761993575, 874475651, 513289063, 2073297611,
+    373754091,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_two_pi_8_64 = { 1, 10, 0, 10, {
+    1729794204, 985310626, 1332355723, 811256114, 936640345, 1289486656, 1510683633, 291179961,
+    200882571, 1,
+} };
+inline const NUMBER init_q_two_pi_8_64 = { 1, 9, 0, 9, {
+    121073408, 1400196395, 1727968319, 1924074872, 1761993575, 874475651, 513289063, 2073297611,
+    373754091,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_pi_over_two_8_64 = { 1, 9, 0, 9, {
+    864897102, 1566397137, 666177861, 1479369881, 468320172, 1718485152, 1829083640, 1219331804,
+    1174183109,
+} };
+inline const NUMBER init_q_pi_over_two_8_64 = { 1, 9, 0, 9, {
+    242146816, 652909142, 1308452991, 1700666097, 1376503503, 1748951303, 1026578126, 1999111574,
+    747508183,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_one_pt_five_pi_8_64 = { 1, 9, 0, 9, {
+    596039446, 1939684762, 1370852912, 1579085045, 1796300886, 107478385, 1500942035, 367964360,
+    613074389,
+} };
+inline const NUMBER init_q_one_pt_five_pi_8_64 = { 1, 9, 0, 9, {
+    602044761, 782281823, 5321012, 1360332347, 1779536723, 509580050, 686975596, 56304694,
+    130098426,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_e_to_one_half_8_64 = { 1, 9, 0, 9, {
+    1680579191, 296734734, 1152892469, 996798847, 1086096962, 894653613, 2051194334, 1136869280,
+    2113,
+} };
+inline const NUMBER init_q_e_to_one_half_8_64 = { 1, 9, 0, 9, {
+    1903027915, 1542443625, 223916527, 1151225891, 1874295171, 1403882102, 148743407, 1976498607,
+    1281,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rat_exp_8_64 = { 1, 9, 0, 9, {
+    539507977, 255494882, 1696077880, 652138434, 80192617, 1578739907, 1212223504, 367781581,
+    50774750,
+} };
+inline const NUMBER init_q_rat_exp_8_64 = { 1, 9, 0, 9, {
+    2118638938, 877718706, 322109775, 93207579, 729334108, 1772154459, 1004996696, 1543231848,
+    18678986,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_ln_ten_8_64 = { 1, 9, 0, 9, {
+    751243148, 1467426298, 857980131, 1762017769, 1326381346, 469648541, 1478718092, 592760465,
+    140,
+} };
+inline const NUMBER init_q_ln_ten_8_64 = { 1, 9, 0, 9, {
+    831556702, 378601714, 1404343086, 2119178981, 221630275, 1615846162, 1889964728, 1978055481,
+    60,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_ln_two_8_64 = { 1, 9, 0, 9, {
+    1477098736, 1792519980, 2016124541, 46731040, 1798581260, 1598497884, 1735762872, 681682786,
+    25502,
+} };
+inline const NUMBER init_q_ln_two_8_64 = { 1, 9, 0, 9, {
+    1594619188, 1802949711, 953291776, 668059367, 1835089467, 785670279, 182162500, 143649852,
+    36792,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rad_to_deg_8_64 = { 1, 10, 0, 10, {
+    318376960, 779764294, 1796652225, 588609776, 1478747405, 639311023, 50234549, 1678898919,
+    703743465, 31,
+} };
+inline const NUMBER init_q_rad_to_deg_8_64 = { 1, 9, 0, 9, {
+    864897102, 1566397137, 666177861, 1479369881, 468320172, 1718485152, 1829083640, 1219331804,
+    1174183109,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rad_to_grad_8_64 = { 1, 10, 0, 10, {
+    592361472, 866404771, 1996280250, 415401568, 211396907, 948954876, 1726081225, 195178183,
+    1736374361, 34,
+} };
+inline const NUMBER init_q_rad_to_grad_8_64 = { 1, 9, 0, 9, {
+    864897102, 1566397137, 666177861, 1479369881, 468320172, 1718485152, 1829083640, 1219331804,
+    1174183109,
+} };
+// Autogenerated by _dumpconstants in support.cpp
+inline const RATCONSTTABLE init_ratconsttable_8_64 = {
+    8,
+    64,
+    {
+        { &init_p_pi_8_64, &init_q_pi_8_64 },
+        { &init_p_two_pi_8_64, &init_q_two_pi_8_64 },
+        { &init_p_pi_over_two_8_64, &init_q_pi_over_two_8_64 },
+        { &init_p_one_pt_five_pi_8_64, &init_q_one_pt_five_pi_8_64 },
+        { &init_p_e_to_one_half_8_64, &init_q_e_to_one_half_8_64 },
+        { &init_p_rat_exp_8_64, &init_q_rat_exp_8_64 },
+        { &init_p_ln_ten_8_64, &init_q_ln_ten_8_64 },
+        { &init_p_ln_two_8_64, &init_q_ln_two_8_64 },
+        { &init_p_rad_to_deg_8_64, &init_q_rad_to_deg_8_64 },
+        { &init_p_rad_to_grad_8_64, &init_q_rad_to_grad_8_64 },
+    }
+};
+
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_pi_8_128 = { 1, 15, 0, 15, {
+    36601938, 354088432, 1091623779, 563027307, 1728955991, 687594552, 1180194422, 1478477564,
+    664609058, 1276223218, 1593255242, 390894906, 365413419, 1775222984, 72286,
+} };
+inline const NUMBER init_q_pi_8_128 = { 1, 15, 0, 15, {
+    1434705866, 788819671, 799226105, 294668322, 1687569552, 2003459955, 583651551, 1459451686,
+    1951878327, 1435998673, 1154051331, 1064856835, 2095839900, 1313324511, 23009,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_two_pi_8_128 = { 1, 15, 0, 15, {
+    73203876, 708176864, 35763910, 1126054615, 1310428334, 1375189105, 212905196, 809471481,
+    1329218117, 404962788, 1039026837, 781789813, 730826838, 1402962320, 144573,
+} };
+inline const NUMBER init_q_two_pi_8_128 = { 1, 15, 0, 15, {
+    1434705866, 788819671, 799226105, 294668322, 1687569552, 2003459955, 583651551, 1459451686,
+    1951878327, 1435998673, 1154051331, 1064856835, 2095839900, 1313324511, 23009,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_pi_over_two_8_128 = { 1, 15, 0, 15, {
+    36601938, 354088432, 1091623779, 563027307, 1728955991, 687594552, 1180194422, 1478477564,
+    664609058, 1276223218, 1593255242, 390894906, 365413419, 1775222984, 72286,
+} };
+inline const NUMBER init_q_pi_over_two_8_128 = { 1, 15, 0, 15, {
+    721928084, 1577639343, 1598452210, 589336644, 1227655456, 1859436263, 1167303103, 771419724,
+    1756273007, 724513699, 160619015, 2129713671, 2044196152, 479165375, 46019,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_one_pt_five_pi_8_128 = { 1, 16, 0, 16, {
+    1498981483, 1566993156, 181870175, 1921617069, 1738053337, 195605719, 151838857, 1647695657,
+    1617807880, 2077988580, 589863980, 991126290, 1971787780, 1065164960, 694908111, 2,
+} };
+inline const NUMBER init_q_one_pt_five_pi_8_128 = { 1, 15, 0, 15, {
+    591349611, 1851548925, 766443951, 1022059998, 1263043122, 1900157130, 1949920471, 1538886018,
+    1902282316, 691403785, 1344213040, 1970518538, 213910242, 1476537880, 1058884448,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_e_to_one_half_8_128 = { 1, 15, 0, 15, {
+    1878833234, 1145402460, 584715350, 1997162522, 546516170, 1967726908, 624597401, 849299876,
+    1509389634, 1043847620, 637070780, 2145140183, 2073632164, 112032981, 155809,
+} };
+inline const NUMBER init_q_e_to_one_half_8_128 = { 1, 15, 0, 15, {
+    487089142, 2139381447, 484609992, 1623342746, 25683161, 1559872589, 1680679702, 435908580,
+    1162914811, 1827826847, 1000370451, 644667602, 1161372370, 2077049448, 94502,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rat_exp_8_128 = { 1, 15, 0, 15, {
+    36136641, 1480221141, 744022253, 1082406359, 1817591695, 1009368971, 2091005723, 587213781,
+    585992236, 288142048, 508031381, 1249132960, 1987936149, 1429528750, 8,
+} };
+inline const NUMBER init_q_rat_exp_8_128 = { 1, 15, 0, 15, {
+    1544448086, 1877478559, 1505149675, 1730780569, 731467700, 1204006188, 2076130084, 908717006,
+    824499551, 801372189, 890601238, 1209493978, 1798433981, 403563968, 3,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_ln_ten_8_128 = { 1, 15, 0, 15, {
+    1037744248, 610944839, 1048193861, 1867376753, 198320821, 1025679786, 205890768, 774101493,
+    1174774825, 937305704, 650899838, 1622904505, 1456761503, 105892947, 835840373,
+} };
+inline const NUMBER init_q_ln_ten_8_128 = { 1, 15, 0, 15, {
+    1160989114, 1834254459, 913863021, 600008468, 973016652, 1857517254, 1214719631, 1999949665,
+    137362883, 424879027, 902645733, 900199721, 1989045184, 1647701765, 363000861,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_ln_two_8_128 = { 1, 15, 0, 15, {
+    1164702582, 2103902685, 157530076, 1636406675, 793764906, 649663356, 1145209559, 523405935,
+    1457792402, 414061834, 2061930822, 1596466746, 678116953, 564676211, 37,
+} };
+inline const NUMBER init_q_ln_two_8_128 = { 1, 15, 0, 15, {
+    1991489456, 1252986629, 618563742, 396061440, 468252633, 2089791749, 1420030231, 1707610625,
+    626479465, 832093251, 606570851, 1452183644, 179583184, 1630090572, 53,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rad_to_deg_8_128 = { 1, 15, 0, 15, {
+    549018120, 253620132, 2126778198, 1500690474, 967325016, 1993022825, 1978064243, 708298472,
+    1298264358, 781723543, 1570809492, 548185724, 1441543689, 175210875, 4141730,
+} };
+inline const NUMBER init_q_rad_to_deg_8_128 = { 1, 15, 0, 15, {
+    36601938, 354088432, 1091623779, 563027307, 1728955991, 687594552, 1180194422, 1478477564,
+    664609058, 1276223218, 1593255242, 390894906, 365413419, 1775222984, 72286,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rad_to_grad_8_128 = { 1, 15, 0, 15, {
+    1325848016, 997628029, 931431121, 951605978, 358977691, 1260032629, 766193394, 1980044774,
+    1681125247, 1584409597, 1029515997, 370485955, 408668739, 671897339, 4601922,
+} };
+inline const NUMBER init_q_rad_to_grad_8_128 = { 1, 15, 0, 15, {
+    36601938, 354088432, 1091623779, 563027307, 1728955991, 687594552, 1180194422, 1478477564,
+    664609058, 1276223218, 1593255242, 390894906, 365413419, 1775222984, 72286,
+} };
+// Autogenerated by _dumpconstants in support.cpp
+inline const RATCONSTTABLE init_ratconsttable_8_128 = {
+    8,
+    128,
+    {
+        { &init_p_pi_8_128, &init_q_pi_8_128 },
+        { &init_p_two_pi_8_128, &init_q_two_pi_8_128 },
+        { &init_p_pi_over_two_8_128, &init_q_pi_over_two_8_128 },
+        { &init_p_one_pt_five_pi_8_128, &init_q_one_pt_five_pi_8_128 },
+        { &init_p_e_to_one_half_8_128, &init_q_e_to_one_half_8_128 },
+        { &init_p_rat_exp_8_128, &init_q_rat_exp_8_128 },
+        { &init_p_ln_ten_8_128, &init_q_ln_ten_8_128 },
+        { &init_p_ln_two_8_128, &init_q_ln_two_8_128 },
+        { &init_p_rad_to_deg_8_128, &init_q_rad_to_deg_8_128 },
+        { &init_p_rad_to_grad_8_128, &init_q_rad_to_grad_8_128 },
+    }
+};
+
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_pi_8_256 = { 1, 28, 0, 28, {
+    1397841292, 1181799210, 1562618617, 674605077, 2061393585, 297283430, 611874729, 565718746,
+    2138869871, 1599501286, 106852465, 288625018, 306216370, 278689715, 964325639, 1272342017,
+    1830869589, 338902343, 987118869, 635123253, 1713462551, 514598494, 664836347, 2010857058,
+    72256311, 360912039, 1226032198, 379,
+} };
+inline const NUMBER init_q_pi_8_256 = { 1, 28, 0, 28, {
+    970852705, 568284688, 108866039, 1200634068, 1513281286, 937951303, 1695397070, 1529450925,
+    754574315, 8527051, 2130549893, 1367739167, 1881201503, 954575716, 770618483, 1346383609,
+    1020384690, 1960037481, 279515253, 1180092363, 497863783, 1723038916, 425473314, 321108025,
+    263683761, 1984513854, 1763459852, 120,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_two_pi_8_256 = { 1, 28, 0, 28, {
+    648198936, 216114773, 977753587, 1349210155, 1975303522, 594566861, 1223749458, 1131437492,
+    2130256094, 1051518925, 213704931, 577250036, 612432740, 557379430, 1928651278, 397200386,
+    1514255531, 677804687, 1974237738, 1270246506, 1279441454, 1029196989, 1329672694, 1874230468,
+    144512623, 721824078, 304580748, 759,
+} };
+inline const NUMBER init_q_two_pi_8_256 = { 1, 28, 0, 28, {
+    970852705, 568284688, 108866039, 1200634068, 1513281286, 937951303, 1695397070, 1529450925,
+    754574315, 8527051, 2130549893, 1367739167, 1881201503, 954575716, 770618483, 1346383609,
+    1020384690, 1960037481, 279515253, 1180092363, 497863783, 1723038916, 425473314, 321108025,
+    263683761, 1984513854, 1763459852, 120,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_pi_over_two_8_256 = { 1, 28, 0, 28, {
+    1397841292, 1181799210, 1562618617, 674605077, 2061393585, 297283430, 611874729, 565718746,
+    2138869871, 1599501286, 106852465, 288625018, 306216370, 278689715, 964325639, 1272342017,
+    1830869589, 338902343, 987118869, 635123253, 1713462551, 514598494, 664836347, 2010857058,
+    72256311, 360912039, 1226032198, 379,
+} };
+inline const NUMBER init_q_pi_over_two_8_256 = { 1, 28, 0, 28, {
+    1941705410, 1136569376, 217732078, 253784488, 879078925, 1875902607, 1243310492, 911418203,
+    1509148631, 17054102, 2113616138, 587994687, 1614919359, 1909151433, 1541236966, 545283570,
+    2040769381, 1772591314, 559030507, 212701078, 995727567, 1298594184, 850946629, 642216050,
+    527367522, 1821544060, 1379436057, 241,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_one_pt_five_pi_8_256 = { 1, 28, 0, 28, {
+    1281546922, 963253959, 253356026, 600779252, 779493274, 1083583363, 121769673, 1393050037,
+    795893009, 1234621561, 1768926321, 1063335380, 828082908, 536209853, 976687515, 225761572,
+    379725692, 312203478, 1331231386, 1828829881, 322246401, 1322146579, 1166272905, 1367032677,
+    831991244, 1882982133, 1314446311, 137580,
+} };
+inline const NUMBER init_q_one_pt_five_pi_8_256 = { 1, 28, 0, 28, {
+    1164201598, 134470920, 861691385, 2060705677, 2130839941, 1862673946, 1882437981, 686637717,
+    1160769817, 125018775, 1711036558, 130004349, 1606944509, 1340280594, 1074290280, 65249990,
+    1658836049, 822352575, 932746475, 1770064969, 1758390701, 944691470, 1736278140, 1925716753,
+    1304318869, 1984761684, 1100906680, 29195,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_e_to_one_half_8_256 = { 1, 28, 0, 28, {
+    664520316, 1028895420, 827625247, 513624876, 984127761, 963812111, 1264756153, 239135425,
+    1881580818, 980076858, 658477831, 663408382, 35424721, 730073943, 1664857845, 324486355,
+    1561694786, 1462601651, 2003911755, 1496928818, 1015759972, 80638965, 945052592, 1952988559,
+    1258187342, 536092426, 1556111281, 5,
+} };
+inline const NUMBER init_q_e_to_one_half_8_256 = { 1, 28, 0, 28, {
+    1045856926, 1639510014, 62407403, 626566780, 2056682653, 18827806, 163855349, 1765386158,
+    688612660, 1866923131, 1325723411, 214426820, 1418127878, 546842763, 1288771851, 1434482254,
+    311243464, 261706610, 1904041139, 174888571, 963604696, 1822155333, 844655946, 793796721,
+    166445734, 1546783425, 1013951626, 3,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rat_exp_8_256 = { 1, 28, 0, 28, {
+    1913942833, 629583646, 820054209, 2126995430, 896902941, 497824663, 2063175791, 810661430,
+    89931380, 1567364580, 1413386702, 1286156830, 1310200355, 308950043, 955004601, 477801113,
+    479010914, 1010761193, 117150349, 1801298450, 1035790907, 1257138965, 772974605, 108352432,
+    1618328604, 1305350141, 1435545610, 544589,
+} };
+inline const NUMBER init_q_rat_exp_8_256 = { 1, 28, 0, 28, {
+    542342360, 1147874736, 101455032, 473098447, 1050386848, 910865810, 218628137, 1395134126,
+    1874460639, 529343012, 436751235, 703313029, 1729417294, 2104233130, 708633594, 1228516521,
+    1404486011, 1298869159, 817763533, 1625086234, 685611643, 1839389385, 1690536637, 665104056,
+    1287802710, 355836080, 736388107, 200343,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_ln_ten_8_256 = { 1, 28, 0, 28, {
+    1582577906, 1854814287, 1423655854, 2001740275, 1554262625, 19503680, 438112385, 2066168076,
+    550592783, 842662488, 1723991943, 44275058, 215057465, 185961438, 2107016916, 1535609829,
+    1024513644, 344122841, 978446155, 193355951, 504974781, 41547620, 997186226, 2134983745,
+    1948898207, 711781807, 2052416112, 336295865,
+} };
+inline const NUMBER init_q_ln_ten_8_256 = { 1, 28, 0, 28, {
+    1013137194, 991722522, 842438080, 1598984952, 391988545, 647620041, 671108806, 1465970978,
+    772617772, 241695100, 794631508, 1300905421, 1147003564, 478419600, 370675389, 1187428397,
+    953311271, 1949281130, 1670258469, 1117915736, 822969552, 1374413432, 1204070567, 518932889,
+    1085649683, 975584745, 1871423554, 146051438,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_ln_two_8_256 = { 1, 28, 0, 28, {
+    512848511, 2011889962, 1996565300, 1966363533, 854512488, 447173183, 558622215, 1648683346,
+    1001480717, 1206924628, 36683372, 894583074, 1119167737, 999523950, 260190452, 724040950,
+    1899823918, 1596698185, 1122189133, 255761513, 1643980855, 861384445, 121969986, 1601810527,
+    95229676, 174805229, 851989205, 1,
+} };
+inline const NUMBER init_q_ln_two_8_256 = { 1, 28, 0, 28, {
+    1339819799, 903180353, 391378768, 890866985, 695017806, 1982605835, 719848835, 2039492262,
+    1539169863, 70212499, 1554067800, 1168075033, 824320818, 1191525935, 649590346, 1251495687,
+    1185587792, 1348041280, 1399969301, 1340090846, 1660336656, 58258692, 1336592492, 1322549152,
+    2084563269, 905392300, 32357314, 2,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rad_to_deg_8_256 = { 1, 28, 0, 28, {
+    807311412, 1359512465, 268534235, 1365767449, 1807691932, 1327510122, 228794662, 423259698,
+    531907004, 1534869243, 1246891396, 1379914366, 1461337918, 24937197, 1272373548, 1830881108,
+    1133134232, 619428393, 920621800, 1963227859, 1568651470, 909359609, 1423268984, 1964869687,
+    218436750, 730208174, 1742677270, 21747,
+} };
+inline const NUMBER init_q_rad_to_deg_8_256 = { 1, 28, 0, 28, {
+    1397841292, 1181799210, 1562618617, 674605077, 2061393585, 297283430, 611874729, 565718746,
+    2138869871, 1599501286, 106852465, 288625018, 306216370, 278689715, 964325639, 1272342017,
+    1830869589, 338902343, 987118869, 635123253, 1713462551, 514598494, 664836347, 2010857058,
+    72256311, 360912039, 1226032198, 379,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rad_to_grad_8_256 = { 1, 28, 0, 28, {
+    897012680, 1987787994, 298371372, 1756128682, 2008546591, 759183364, 1924481351, 947507141,
+    591007782, 1705410270, 908216296, 817410302, 430662327, 1936582351, 1652357680, 841265871,
+    65991565, 1165472359, 68475934, 1942754994, 788508901, 1010399566, 1342800688, 1944579247,
+    1197144677, 1765779592, 504652312, 24164,
+} };
+inline const NUMBER init_q_rad_to_grad_8_256 = { 1, 28, 0, 28, {
+    1397841292, 1181799210, 1562618617, 674605077, 2061393585, 297283430, 611874729, 565718746,
+    2138869871, 1599501286, 106852465, 288625018, 306216370, 278689715, 964325639, 1272342017,
+    1830869589, 338902343, 987118869, 635123253, 1713462551, 514598494, 664836347, 2010857058,
+    72256311, 360912039, 1226032198, 379,
+} };
+// Autogenerated by _dumpconstants in support.cpp
+inline const RATCONSTTABLE init_ratconsttable_8_256 = {
+    8,
+    256,
+    {
+        { &init_p_pi_8_256, &init_q_pi_8_256 },
+        { &init_p_two_pi_8_256, &init_q_two_pi_8_256 },
+        { &init_p_pi_over_two_8_256, &init_q_pi_over_two_8_256 },
+        { &init_p_one_pt_five_pi_8_256, &init_q_one_pt_five_pi_8_256 },
+        { &init_p_e_to_one_half_8_256, &init_q_e_to_one_half_8_256 },
+        { &init_p_rat_exp_8_256, &init_q_rat_exp_8_256 },
+        { &init_p_ln_ten_8_256, &init_q_ln_ten_8_256 },
+        { &init_p_ln_two_8_256, &init_q_ln_two_8_256 },
+        { &init_p_rad_to_deg_8_256, &init_q_rad_to_deg_8_256 },
+        { &init_p_rad_to_grad_8_256, &init_q_rad_to_grad_8_256 },
+    }
+};
+
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_pi_8_512 = { 1, 54, 0, 54, {
+    1652246822, 571974746, 340215901, 1531796709, 1550425645, 2053972779, 1209579838, 940215657,
+    1398727383, 92438751, 273238525, 807034129, 674642745, 1100907847, 817662919, 185374958,
+    1742458902, 1483338601, 1382162678, 1160669686, 1836056319, 1892505279, 1842831708, 483248127,
+    1326536530, 1601952910, 14391772, 178153420, 1893787333, 1424282197, 1631381921, 642162124,
+    884171708, 55472904, 1740906018, 1542040847, 822162680, 700345694, 109881357, 1113603834,
+    730113838, 429219215, 88439750, 850988301, 1625471554, 647076953, 1082160485, 469746057,
+    1230706793, 960658001, 61456268, 595793772, 2089062843, 231,
+} };
+inline const NUMBER init_q_pi_8_512 = { 1, 54, 0, 54, {
+    825872586, 1841842513, 455852892, 1239377781, 813518743, 909076972, 1809711736, 823493639,
+    1747766527, 1003018404, 268128637, 378761508, 389416104, 1623428688, 347765496, 368893731,
+    35767887, 1663013326, 1941385841, 1694723514, 1048183910, 1693580168, 26362077, 740682449,
+    1929425653, 713689410, 1899564299, 2049320803, 1064162210, 1154530624, 915154346, 201213498,
+    517712544, 2052342415, 1319654131, 954324801, 1039358396, 595540443, 1414957035, 1474177018,
+    865868402, 1244679730, 1042142966, 1458045730, 551096065, 1732285646, 734161867, 327287013,
+    1265820300, 674910044, 1772132958, 64692276, 1802241710, 73,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_two_pi_8_512 = { 1, 54, 0, 54, {
+    1157009996, 1143949493, 680431802, 916109770, 953367643, 1960461911, 271676029, 1880431315,
+    649971118, 184877503, 546477050, 1614068258, 1349285490, 54332046, 1635325839, 370749916,
+    1337434156, 819193555, 616841709, 173855725, 1524628991, 1637526911, 1538179769, 966496255,
+    505589412, 1056422173, 28783545, 356306840, 1640091018, 701080747, 1115280195, 1284324249,
+    1768343416, 110945808, 1334328388, 936598047, 1644325361, 1400691388, 219762714, 79724020,
+    1460227677, 858438430, 176879500, 1701976602, 1103459460, 1294153907, 16837322, 939492115,
+    313929938, 1921316003, 122912536, 1191587544, 2030642038, 463,
+} };
+inline const NUMBER init_q_two_pi_8_512 = { 1, 54, 0, 54, {
+    825872586, 1841842513, 455852892, 1239377781, 813518743, 909076972, 1809711736, 823493639,
+    1747766527, 1003018404, 268128637, 378761508, 389416104, 1623428688, 347765496, 368893731,
+    35767887, 1663013326, 1941385841, 1694723514, 1048183910, 1693580168, 26362077, 740682449,
+    1929425653, 713689410, 1899564299, 2049320803, 1064162210, 1154530624, 915154346, 201213498,
+    517712544, 2052342415, 1319654131, 954324801, 1039358396, 595540443, 1414957035, 1474177018,
+    865868402, 1244679730, 1042142966, 1458045730, 551096065, 1732285646, 734161867, 327287013,
+    1265820300, 674910044, 1772132958, 64692276, 1802241710, 73,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_pi_over_two_8_512 = { 1, 54, 0, 54, {
+    1652246822, 571974746, 340215901, 1531796709, 1550425645, 2053972779, 1209579838, 940215657,
+    1398727383, 92438751, 273238525, 807034129, 674642745, 1100907847, 817662919, 185374958,
+    1742458902, 1483338601, 1382162678, 1160669686, 1836056319, 1892505279, 1842831708, 483248127,
+    1326536530, 1601952910, 14391772, 178153420, 1893787333, 1424282197, 1631381921, 642162124,
+    884171708, 55472904, 1740906018, 1542040847, 822162680, 700345694, 109881357, 1113603834,
+    730113838, 429219215, 88439750, 850988301, 1625471554, 647076953, 1082160485, 469746057,
+    1230706793, 960658001, 61456268, 595793772, 2089062843, 231,
+} };
+inline const NUMBER init_q_pi_over_two_8_512 = { 1, 54, 0, 54, {
+    1651745172, 1536201378, 911705785, 331271914, 1627037487, 1818153944, 1471939824, 1646987279,
+    1348049406, 2006036809, 536257274, 757523016, 778832208, 1099373728, 695530993, 737787462,
+    71535774, 1178543004, 1735288035, 1241963381, 2096367821, 1239676688, 52724155, 1481364898,
+    1711367658, 1427378821, 1651644950, 1951157959, 2128324421, 161577600, 1830308693, 402426996,
+    1035425088, 1957201182, 491824615, 1908649603, 2078716792, 1191080886, 682430422, 800870389,
+    1731736805, 341875812, 2084285933, 768607812, 1102192131, 1317087644, 1468323735, 654574026,
+    384156952, 1349820089, 1396782268, 129384553, 1456999772, 147,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_one_pt_five_pi_8_512 = { 1, 54, 0, 54, {
+    1105433249, 107310006, 291793730, 797131921, 562916531, 994093773, 750263822, 1211392982,
+    751245703, 1511468291, 1626106761, 1989893254, 2068545852, 1827372895, 1074931658, 989055216,
+    1859103208, 290558637, 60562026, 432623217, 2016465821, 1433622768, 151545545, 553264406,
+    1922394176, 852827908, 1849142477, 1664015773, 833405424, 463192658, 2068506668, 1921257828,
+    934415094, 1183250590, 595735202, 731343631, 1231904172, 1968611553, 1682917650, 1543177472,
+    632813692, 612236480, 1386801475, 276072610, 242067146, 36073550, 992298548, 574716978,
+    652320442, 365811805, 799509208, 1513685128, 173439191, 51386,
+} };
+inline const NUMBER init_q_one_pt_five_pi_8_512 = { 1, 54, 0, 54, {
+    823148527, 2027722073, 575511449, 131237651, 1873648204, 141294844, 814153442, 1433183642,
+    1253359324, 2043139731, 626343934, 1444894657, 2139588817, 1979292262, 2100063209, 792916084,
+    1365291345, 331913203, 1955639196, 349936310, 1842722289, 185254867, 1503041858, 869173602,
+    1611209670, 929376042, 1542240088, 1462385355, 1886634011, 925797269, 772918633, 1935978944,
+    1806995233, 2075351357, 226540657, 1544013209, 1858927568, 1242282483, 1843984619, 635394390,
+    1406388697, 34283583, 66797992, 1836328392, 1562401071, 1412067421, 1771515183, 1686385984,
+    302746595, 34487490, 746951290, 551268564, 998607661, 10904,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_e_to_one_half_8_512 = { 1, 54, 0, 54, {
+    628542047, 17212543, 2094014167, 161109600, 883158497, 329038719, 206257934, 285125611,
+    2111147946, 945469218, 46511954, 456639349, 1793113024, 1960974891, 1094680733, 868872264,
+    282124239, 1613581672, 800390957, 1610372893, 2122755158, 1992228285, 1645939697, 1518202665,
+    73858377, 407662653, 1885994361, 2085098021, 904943540, 388316617, 887777917, 1974468048,
+    368968133, 2024399204, 2058764548, 2110622659, 1674248769, 180060788, 518670759, 141404569,
+    662991480, 80180367, 1991629313, 235951983, 640101800, 1376472909, 1913190148, 144366961,
+    442571889, 569358052, 833094037, 1730732390, 1207209393, 225615,
+} };
+inline const NUMBER init_q_e_to_one_half_8_512 = { 1, 54, 0, 54, {
+    872389830, 626237643, 927903119, 914373592, 269239853, 245845542, 1154484142, 964419892,
+    1513207786, 581367621, 1875533117, 389420583, 892665492, 530718476, 887069526, 490232138,
+    1252646383, 979310879, 567023055, 1285617744, 1518897117, 1861525896, 1794069147, 704748490,
+    276479100, 169218243, 532931974, 1507561769, 1629197680, 385313340, 1195350467, 1470523967,
+    466730595, 1801372555, 429044704, 697185749, 623411031, 41104849, 2480755, 264108243,
+    1826032032, 531934509, 562918374, 283398800, 2029308389, 927036494, 1121520266, 1246983497,
+    211560418, 1171118936, 1308082941, 336365340, 1622966541, 136842,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rat_exp_8_512 = { 1, 54, 0, 54, {
+    1839861373, 1370643943, 445551557, 1439581192, 120578038, 1953114342, 1832324686, 1051099431,
+    729864773, 725517534, 1137177254, 1445882925, 1802009984, 145583442, 840045482, 1614462159,
+    108082547, 1662203821, 1646964695, 2011653699, 550640877, 418652421, 1854232796, 2044628898,
+    1062599751, 1967035519, 1769835752, 1503138379, 557402824, 1390060761, 621217381, 1095219292,
+    129346741, 651553297, 2141169697, 501791983, 1481849165, 1426648175, 823576221, 1461639230,
+    1836196152, 153003131, 948491341, 693428128, 174341212, 228657342, 651861307, 1072696752,
+    303006178, 531119691, 1945360987, 122734860, 676580945, 12559109,
+} };
+inline const NUMBER init_q_rat_exp_8_512 = { 1, 54, 0, 54, {
+    1819205963, 1164756772, 1051620287, 161535971, 1885817949, 64159442, 1960338467, 1611053416,
+    229432221, 393148649, 1042779684, 557042305, 1497295849, 1098419413, 95920558, 543213906,
+    2125995164, 58555413, 396420520, 1259542904, 542763568, 1911259231, 2100250292, 1235734421,
+    298928226, 1433345809, 1201645114, 633549269, 1297375946, 1599060495, 352121612, 622933925,
+    360549577, 2046990113, 1274874413, 2122469587, 595314556, 74646599, 208834077, 1407923677,
+    957353950, 1127989081, 1776313370, 620724477, 653271159, 84246182, 737847711, 1691746764,
+    994467130, 886496329, 1743633702, 1261734883, 250041031, 4620238,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_ln_ten_8_512 = { 1, 54, 0, 54, {
+    546500788, 1130669734, 397961621, 1673886824, 1534727, 470681355, 383283860, 1772112563,
+    1928508715, 2276861, 359032662, 1312560505, 379441968, 1644555275, 682583565, 659765041,
+    1469883435, 1600246532, 24262895, 1021917994, 1489300139, 1606789121, 822095802, 1978076444,
+    980549083, 697418181, 1062725063, 160418498, 1399546346, 1414155186, 610095874, 636164588,
+    1017604648, 2014375665, 1364779475, 2029493725, 1213328031, 1936911240, 91942209, 1797730360,
+    1218253814, 1781076766, 1207311291, 559529971, 660500399, 284214158, 1011636052, 1654717364,
+    191932133, 941086122, 811998355, 1215429882, 416004439, 125030,
+} };
+inline const NUMBER init_q_ln_ten_8_512 = { 1, 54, 0, 54, {
+    2003604674, 1934048333, 1131522140, 35513997, 1757439295, 120137880, 435302530, 1853141566,
+    1139367201, 327776757, 564689940, 1831614798, 1774544621, 935798658, 1240922401, 1852744533,
+    1793697304, 1522640056, 1346747293, 1897817690, 1172190461, 1804883797, 1613284447, 427306535,
+    1030243269, 50849261, 1127323050, 281949258, 523696724, 1058406487, 138790163, 561111732,
+    1776729367, 1717855373, 693795778, 671234705, 232990944, 753794906, 772934856, 1670460531,
+    1434578011, 1837174016, 479229153, 1041811051, 697233593, 795385119, 1638055862, 1475378908,
+    1666036091, 627230532, 1748182524, 1758690821, 1982562612, 54299,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_ln_two_8_512 = { 1, 54, 0, 54, {
+    1905736897, 1646838879, 1661510641, 742879448, 549190164, 2060785965, 1156677830, 1030269107,
+    949807715, 936367645, 1301329420, 1592563317, 1467857295, 731805840, 1881331759, 1643791940,
+    1077974848, 248533147, 170583438, 1316429583, 930760705, 64413545, 337793395, 1937445575,
+    647191178, 1212076581, 35356643, 1784275490, 1580542303, 441856579, 678340323, 878126613,
+    1148704308, 1383915299, 551162403, 354910805, 2064318444, 1245519771, 880045474, 232901898,
+    1810773280, 1707017466, 1127102848, 1146481121, 736550191, 123771762, 1765779571, 1470795318,
+    1137373906, 1477042375, 64868047, 1841371053, 2012460183, 2,
+} };
+inline const NUMBER init_q_ln_two_8_512 = { 1, 54, 0, 54, {
+    1447461268, 401847637, 967587956, 581752690, 1356614055, 1571319978, 1842720466, 778261372,
+    180039014, 1912884241, 1594453967, 488388243, 1089184663, 1752757779, 1069387563, 727552578,
+    1371315645, 2087822430, 719614424, 1318362195, 573755523, 1275244951, 762661031, 1360625753,
+    1515368441, 651971939, 1967169667, 723780528, 1817157848, 245960650, 1471529641, 1554756991,
+    1087201295, 1161514143, 894081579, 1424401029, 98884948, 1850709942, 1044854523, 1330551104,
+    2050384027, 585240601, 413843192, 1369597165, 1087181554, 579262593, 547740235, 2083542744,
+    1916547167, 236296582, 690772088, 2055405497, 509759753, 4,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rad_to_deg_8_512 = { 1, 54, 0, 54, {
+    480693768, 819170617, 449142090, 1897184874, 404485779, 425097780, 1478081708, 52483459,
+    1065362321, 154686434, 1018514488, 1605078374, 1375422015, 159387744, 320763624, 1976362169,
+    2143252394, 842171610, 1557100543, 107554666, 1842026566, 2049235959, 450206705, 178854646,
+    1551750274, 1762558729, 471673847, 1658040891, 423153299, 1657082201, 1519025128, 1858691348,
+    846461072, 54447287, 1314542472, 2127256098, 253433983, 1970581075, 1289195885, 1211374654,
+    1237489827, 704052080, 754656608, 455226431, 413044014, 426287366, 1152633677, 929603905,
+    214387339, 1224723738, 1156352592, 907191588, 133476957, 13291,
+} };
+inline const NUMBER init_q_rad_to_deg_8_512 = { 1, 54, 0, 54, {
+    1652246822, 571974746, 340215901, 1531796709, 1550425645, 2053972779, 1209579838, 940215657,
+    1398727383, 92438751, 273238525, 807034129, 674642745, 1100907847, 817662919, 185374958,
+    1742458902, 1483338601, 1382162678, 1160669686, 1836056319, 1892505279, 1842831708, 483248127,
+    1326536530, 1601952910, 14391772, 178153420, 1893787333, 1424282197, 1631381921, 642162124,
+    884171708, 55472904, 1740906018, 1542040847, 822162680, 700345694, 109881357, 1113603834,
+    730113838, 429219215, 88439750, 850988301, 1625471554, 647076953, 1082160485, 469746057,
+    1230706793, 960658001, 61456268, 595793772, 2089062843, 231,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rad_to_grad_8_512 = { 1, 54, 0, 54, {
+    1965759952, 1148798868, 976265355, 914936722, 1642475115, 1426768043, 1165094420, 1489970720,
+    1660954500, 887701698, 2086119941, 590373944, 573809507, 415706788, 833622615, 764302200,
+    711126490, 1890183411, 1730111714, 1789770244, 1330868301, 1561100961, 977448261, 2107601738,
+    1485557676, 1003961411, 1955737818, 1842267656, 231561038, 1125374563, 494759227, 1587994021,
+    463293714, 299106280, 1937821335, 1886399298, 1713249080, 996488056, 1671049167, 630143955,
+    1374988697, 1975326560, 122679459, 1698853617, 697547087, 712261923, 803485497, 1032893228,
+    1908473214, 1838022741, 91789742, 53553477, 1818572790, 14767,
+} };
+inline const NUMBER init_q_rad_to_grad_8_512 = { 1, 54, 0, 54, {
+    1652246822, 571974746, 340215901, 1531796709, 1550425645, 2053972779, 1209579838, 940215657,
+    1398727383, 92438751, 273238525, 807034129, 674642745, 1100907847, 817662919, 185374958,
+    1742458902, 1483338601, 1382162678, 1160669686, 1836056319, 1892505279, 1842831708, 483248127,
+    1326536530, 1601952910, 14391772, 178153420, 1893787333, 1424282197, 1631381921, 642162124,
+    884171708, 55472904, 1740906018, 1542040847, 822162680, 700345694, 109881357, 1113603834,
+    730113838, 429219215, 88439750, 850988301, 1625471554, 647076953, 1082160485, 469746057,
+    1230706793, 960658001, 61456268, 595793772, 2089062843, 231,
+} };
+// Autogenerated by _dumpconstants in support.cpp
+inline const RATCONSTTABLE init_ratconsttable_8_512 = {
+    8,
+    512,
+    {
+        { &init_p_pi_8_512, &init_q_pi_8_512 },
+        { &init_p_two_pi_8_512, &init_q_two_pi_8_512 },
+        { &init_p_pi_over_two_8_512, &init_q_pi_over_two_8_512 },
+        { &init_p_one_pt_five_pi_8_512, &init_q_one_pt_five_pi_8_512 },
+        { &init_p_e_to_one_half_8_512, &init_q_e_to_one_half_8_512 },
+        { &init_p_rat_exp_8_512, &init_q_rat_exp_8_512 },
+        { &init_p_ln_ten_8_512, &init_q_ln_ten_8_512 },
+        { &init_p_ln_two_8_512, &init_q_ln_two_8_512 },
+        { &init_p_rad_to_deg_8_512, &init_q_rad_to_deg_8_512 },
+        { &init_p_rad_to_grad_8_512, &init_q_rad_to_grad_8_512 },
+    }
+};
+
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_pi_10_32 = { 1, 6, 0, 6, {
+    125527896, 283898350, 1960493936, 1672850762, 1288168272, 8,
+} };
+inline const NUMBER init_q_pi_10_32 = { 1, 6, 0, 6, {
+    1288380402, 1120116153, 1860424692, 1944118326, 1583591604, 2,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_two_pi_10_32 = { 1, 6, 0, 6, {
+    251055792, 567796700, 1773504224, 1198217877, 428852897, 17,
+} };
+inline const NUMBER init_q_two_pi_10_32 = { 1, 6, 0, 6, {
+    1288380402, 1120116153, 1860424692, 1944118326, 1583591604, 2,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_pi_over_two_10_32 = { 1, 6, 0, 6, {
+    125527896, 283898350, 1960493936, 1672850762, 1288168272, 8,
+} };
+inline const NUMBER init_q_pi_over_two_10_32 = { 1, 6, 0, 6, {
+    429277156, 92748659, 1573365737, 1740753005, 1019699561, 5,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_one_pt_five_pi_10_32 = { 1, 6, 0, 6, {
+    1241201312, 270061909, 1051574664, 1924965045, 1340320627, 70,
+} };
+inline const NUMBER init_q_one_pt_five_pi_10_32 = { 1, 6, 0, 6, {
+    1579671539, 1837970263, 1067644340, 523549916, 2119366659, 14,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_e_to_one_half_10_32 = { 1, 6, 0, 6, {
+    256945612, 216219427, 223516738, 477442596, 581063757, 23,
+} };
+inline const NUMBER init_q_e_to_one_half_10_32 = { 1, 6, 0, 6, {
+    1536828363, 698484484, 1127331835, 224219346, 245499408, 14,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rat_exp_10_32 = { 1, 6, 0, 6, {
+    943665199, 1606559160, 1094967530, 1759391384, 1671799163, 1123581,
+} };
+inline const NUMBER init_q_rat_exp_10_32 = { 1, 6, 0, 6, {
+    879242208, 2022880100, 617392930, 1374929092, 1367479163, 413342,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_ln_ten_10_32 = { 1, 6, 0, 6, {
+    2086268922, 165794492, 1416063951, 1851428830, 1893239400, 65366841,
+} };
+inline const NUMBER init_q_ln_ten_10_32 = { 1, 6, 0, 6, {
+    26790652, 564532679, 783998273, 216030448, 1564709968, 28388458,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_ln_two_10_32 = { 1, 6, 0, 6, {
+    1789230241, 1057927868, 715399197, 908801241, 1411265331, 3,
+} };
+inline const NUMBER init_q_ln_two_10_32 = { 1, 6, 0, 6, {
+    1559869847, 1930657510, 1228561531, 219003871, 593099283, 5,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rad_to_deg_10_32 = { 1, 6, 0, 6, {
+    2127722024, 1904928383, 2016479213, 2048947859, 1578647346, 492,
+} };
+inline const NUMBER init_q_rad_to_deg_10_32 = { 1, 6, 0, 6, {
+    125527896, 283898350, 1960493936, 1672850762, 1288168272, 8,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rad_to_grad_10_32 = { 1, 6, 0, 6, {
+    2125526288, 684931327, 570267400, 129125085, 1038224725, 547,
+} };
+inline const NUMBER init_q_rad_to_grad_10_32 = { 1, 6, 0, 6, {
+    125527896, 283898350, 1960493936, 1672850762, 1288168272, 8,
+} };
+// Autogenerated by _dumpconstants in support.cpp
+inline const RATCONSTTABLE init_ratconsttable_10_32 = {
+    10,
+    32,
+    {
+        { &init_p_pi_10_32, &init_q_pi_10_32 },
+        { &init_p_two_pi_10_32, &init_q_two_pi_10_32 },
+        { &init_p_pi_over_two_10_32, &init_q_pi_over_two_10_32 },
+        { &init_p_one_pt_five_pi_10_32, &init_q_one_pt_five_pi_10_32 },
+        { &init_p_e_to_one_half_10_32, &init_q_e_to_one_half_10_32 },
+        { &init_p_rat_exp_10_32, &init_q_rat_exp_10_32 },
+        { &init_p_ln_ten_10_32, &init_q_ln_ten_10_32 },
+        { &init_p_ln_two_10_32, &init_q_ln_two_10_32 },
+        { &init_p_rad_to_deg_10_32, &init_q_rad_to_deg_10_32 },
+        { &init_p_rad_to_grad_10_32, &init_q_rad_to_grad_10_32 },
+    }
+};
+
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_pi_10_64 = { 1, 10, 0, 10, {
+    962580652, 1510894645, 1051732976, 169371223, 2002219168, 283512335, 569446854, 999754378,
+    117497696, 556874293,
+} };
+inline const NUMBER init_q_pi_10_64 = { 1, 10, 0, 10, {
+    364645255, 1790751376, 951726487, 977337910, 111970965, 1939438691, 1196821675, 884091635,
+    1805872571, 177258592,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_two_pi_10_64 = { 1, 10, 0, 10, {
+    1925161304, 874305642, 2103465953, 338742446, 1856954688, 567024671, 1138893708, 1999508756,
+    234995392, 1113748586,
+} };
+inline const NUMBER init_q_two_pi_10_64 = { 1, 10, 0, 10, {
+    364645255, 1790751376, 951726487, 977337910, 111970965, 1939438691, 1196821675, 884091635,
+    1805872571, 177258592,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_pi_over_two_10_64 = { 1, 10, 0, 10, {
+    962580652, 1510894645, 1051732976, 169371223, 2002219168, 283512335, 569446854, 999754378,
+    117497696, 556874293,
+} };
+inline const NUMBER init_q_pi_over_two_10_64 = { 1, 10, 0, 10, {
+    729290510, 1434019104, 1903452975, 1954675820, 223941930, 1731393734, 246159703, 1768183271,
+    1464261494, 354517185,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_one_pt_five_pi_10_64 = { 1, 10, 0, 10, {
+    500427601, 1021827845, 1259838570, 766874384, 732221974, 106476334, 811871730, 360037200,
+    1598114279, 137897329,
+} };
+inline const NUMBER init_q_one_pt_five_pi_10_64 = { 1, 10, 0, 10, {
+    569467078, 1220990889, 1466614808, 1819443241, 1164825203, 838188574, 1778216343, 562281654,
+    480919761, 29262722,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_e_to_one_half_10_64 = { 1, 10, 0, 10, {
+    115231874, 542975107, 860178044, 1609951464, 1527937055, 974603091, 858026239, 111415384,
+    993422802, 136,
+} };
+inline const NUMBER init_q_e_to_one_half_10_64 = { 1, 10, 0, 10, {
+    844713801, 1534155414, 1154827291, 1059218749, 1036998887, 1052564532, 1702902040, 1336898713,
+    1650877880, 82,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rat_exp_10_64 = { 1, 10, 0, 10, {
+    2002126568, 1387846986, 799704054, 554183535, 895754124, 633915568, 1280275369, 518242997,
+    744926660, 113734,
+} };
+inline const NUMBER init_q_rat_exp_10_64 = { 1, 10, 0, 10, {
+    29405807, 1742627872, 2107911011, 40506258, 585775845, 498608241, 1254604517, 1812084503,
+    1133814465, 41840,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_ln_ten_10_64 = { 1, 10, 0, 10, {
+    500842464, 2119979001, 1775575187, 256151841, 1597060634, 127908345, 1682948251, 1950416529,
+    1846201222, 11201,
+} };
+inline const NUMBER init_q_ln_ten_10_64 = { 1, 10, 0, 10, {
+    49973626, 383022472, 910176, 804126945, 383475698, 1416923397, 803159167, 400262971,
+    1945312433, 4864,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_ln_two_10_64 = { 1, 10, 0, 10, {
+    656677833, 155418136, 144742635, 225400114, 1011776636, 89945859, 81414965, 1811499285,
+    818540907, 188293,
+} };
+inline const NUMBER init_q_ln_two_10_64 = { 1, 10, 0, 10, {
+    1731292538, 1214716727, 325718366, 908424791, 1000558869, 260173914, 1212196236, 195687615,
+    1991223730, 271649,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rad_to_deg_10_64 = { 1, 11, 0, 11, {
+    1211636460, 212700510, 1659559618, 1974648391, 827420949, 1206613413, 679536862, 222704448,
+    787032006, 1841775639, 14,
+} };
+inline const NUMBER init_q_rad_to_deg_10_64 = { 1, 10, 0, 10, {
+    962580652, 1510894645, 1051732976, 169371223, 2002219168, 283512335, 569446854, 999754378,
+    117497696, 556874293,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rad_to_grad_10_64 = { 1, 11, 0, 11, {
+    2062090616, 1667989665, 1366736542, 46570120, 919356611, 1340681570, 993650252, 724667975,
+    397261418, 1091980200, 16,
+} };
+inline const NUMBER init_q_rad_to_grad_10_64 = { 1, 10, 0, 10, {
+    962580652, 1510894645, 1051732976, 169371223, 2002219168, 283512335, 569446854, 999754378,
+    117497696, 556874293,
+} };
+// Autogenerated by _dumpconstants in support.cpp
+inline const RATCONSTTABLE init_ratconsttable_10_64 = {
+    10,
+    64,
+    {
+        { &init_p_pi_10_64, &init_q_pi_10_64 },
+        { &init_p_two_pi_10_64, &init_q_two_pi_10_64 },
+        { &init_p_pi_over_two_10_64, &init_q_pi_over_two_10_64 },
+        { &init_p_one_pt_five_pi_10_64, &init_q_one_pt_five_pi_10_64 },
+        { &init_p_e_to_one_half_10_64, &init_q_e_to_one_half_10_64 },
+        { &init_p_rat_exp_10_64, &init_q_rat_exp_10_64 },
+        { &init_p_ln_ten_10_64, &init_q_ln_ten_10_64 },
+        { &init_p_ln_two_10_64, &init_q_ln_two_10_64 },
+        { &init_p_rad_to_deg_10_64, &init_q_rad_to_deg_10_64 },
+        { &init_p_rad_to_grad_10_64, &init_q_rad_to_grad_10_64 },
+    }
+};
+
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_pi_10_128 = { 1, 17, 0, 17, {
+    415415818, 888344649, 1754606818, 524838390, 253948926, 1985557549, 111311210, 512320940,
+    646790002, 1742354786, 576188112, 1657522569, 1370894440, 1646985394, 1096692690, 443173081,
+    19,
+} };
+inline const NUMBER init_q_pi_10_128 = { 1, 17, 0, 17, {
+    1065574689, 991327662, 295092336, 1593974139, 767496471, 1106283779, 1887149404, 1339925423,
+    498144856, 1315092428, 126078676, 1949439799, 1233576209, 1976722322, 188091383, 243904721,
+    6,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_two_pi_10_128 = { 1, 17, 0, 17, {
+    830831636, 1776689298, 1361729988, 1049676781, 507897852, 1823631450, 222622421, 1024641880,
+    1293580004, 1337225924, 1152376225, 1167561490, 594305233, 1146487141, 45901733, 886346163,
+    38,
+} };
+inline const NUMBER init_q_two_pi_10_128 = { 1, 17, 0, 17, {
+    1065574689, 991327662, 295092336, 1593974139, 767496471, 1106283779, 1887149404, 1339925423,
+    498144856, 1315092428, 126078676, 1949439799, 1233576209, 1976722322, 188091383, 243904721,
+    6,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_pi_over_two_10_128 = { 1, 17, 0, 17, {
+    415415818, 888344649, 1754606818, 524838390, 253948926, 1985557549, 111311210, 512320940,
+    646790002, 1742354786, 576188112, 1657522569, 1370894440, 1646985394, 1096692690, 443173081,
+    19,
+} };
+inline const NUMBER init_q_pi_over_two_10_128 = { 1, 17, 0, 17, {
+    2131149378, 1982655324, 590184672, 1040464630, 1534992943, 65083910, 1626815161, 532367199,
+    996289713, 482701208, 252157353, 1751395950, 319668771, 1805960997, 376182767, 487809442,
+    12,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_one_pt_five_pi_10_128 = { 1, 17, 0, 17, {
+    575050283, 769093533, 385474068, 585592376, 757124215, 215124960, 1340749584, 210313953,
+    627053159, 648384589, 1018389471, 798902078, 749385516, 1686818105, 735183765, 555850878,
+    352,
+} };
+inline const NUMBER init_q_one_pt_five_pi_10_128 = { 1, 17, 0, 17, {
+    902234617, 339924428, 447164068, 34824461, 1215628151, 608528092, 898226743, 1735657619,
+    701543433, 740871131, 242386123, 271951601, 641779355, 626617708, 1036850962, 1614149936,
+    74,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_e_to_one_half_10_128 = { 1, 17, 0, 17, {
+    367429443, 1971967273, 166223079, 986208131, 1201701045, 2084892851, 478305840, 359958829,
+    2074441565, 126256462, 317842076, 1698603958, 186564128, 2064897400, 1711562283, 1570958655,
+    1403436835,
+} };
+inline const NUMBER init_q_e_to_one_half_10_128 = { 1, 17, 0, 17, {
+    2034426974, 1248244733, 1947701165, 881259534, 2082581634, 790263585, 355051229, 49101247,
+    1316019247, 2110752061, 1639456204, 1963936831, 1730856995, 1996985996, 1350147234, 1806588750,
+    851227469,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rat_exp_10_128 = { 1, 17, 0, 17, {
+    192150747, 1739373946, 1115830241, 706800640, 739525951, 1649088981, 511230438, 1456321807,
+    1988228422, 990125112, 510058257, 863401130, 656243825, 1477538363, 1439341263, 1613308051,
+    374797018,
+} };
+inline const NUMBER init_q_rat_exp_10_128 = { 1, 17, 0, 17, {
+    1524839058, 390816034, 834136366, 848503586, 1596180527, 1964861665, 168576967, 1686553987,
+    1306537452, 948246199, 1986490332, 1560836046, 248585427, 1116307021, 1952562813, 1741468184,
+    137880117,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_ln_ten_10_128 = { 1, 17, 0, 17, {
+    847573508, 1362082268, 1230200203, 1368976599, 429809390, 732920635, 654647800, 427162983,
+    692217529, 1139160087, 1632553546, 1598001286, 248828204, 308203029, 1832786046, 245563608,
+    9731,
+} };
+inline const NUMBER init_q_ln_ten_10_128 = { 1, 17, 0, 17, {
+    1202813292, 1253747394, 2131573415, 767534322, 2049755491, 1862834571, 300224934, 1924651076,
+    433136574, 1964278945, 904415694, 2090760141, 921970576, 17921969, 416054695, 363493267,
+    4226,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_ln_two_10_128 = { 1, 17, 0, 17, {
+    790465559, 771928726, 147005101, 921863817, 1864420748, 1481390135, 1613103956, 1724142142,
+    1015735746, 1736286241, 79328793, 1233310444, 894626034, 682407787, 979575407, 2064723886,
+    20172,
+} };
+inline const NUMBER init_q_ln_two_10_128 = { 1, 17, 0, 17, {
+    304872450, 1242178635, 1960079716, 1544082997, 530262668, 1089349837, 1690560182, 75666819,
+    1859248638, 690374960, 573990982, 1381528672, 952908491, 276020574, 1023547713, 926555972,
+    29103,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rad_to_deg_10_128 = { 1, 17, 0, 17, {
+    677399348, 197836465, 1577013011, 1300019860, 710411441, 1562584668, 384476428, 668407722,
+    1619244624, 493435801, 1219325310, 859329206, 852902039, 1475216143, 1644194385, 953176835,
+    1100,
+} };
+inline const NUMBER init_q_rad_to_deg_10_128 = { 1, 17, 0, 17, {
+    415415818, 888344649, 1754606818, 524838390, 253948926, 1985557549, 111311210, 512320940,
+    646790002, 1742354786, 576188112, 1657522569, 1370894440, 1646985394, 1096692690, 443173081,
+    19,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rad_to_grad_10_128 = { 1, 17, 0, 17, {
+    514056648, 697036883, 1036408796, 967247923, 1027955340, 65940127, 1620242503, 1697112423,
+    844723516, 1025480590, 1593415194, 1193419523, 1902106109, 207473282, 1111054768, 1536303961,
+    1222,
+} };
+inline const NUMBER init_q_rad_to_grad_10_128 = { 1, 17, 0, 17, {
+    415415818, 888344649, 1754606818, 524838390, 253948926, 1985557549, 111311210, 512320940,
+    646790002, 1742354786, 576188112, 1657522569, 1370894440, 1646985394, 1096692690, 443173081,
+    19,
+} };
+// Autogenerated by _dumpconstants in support.cpp
+inline const RATCONSTTABLE init_ratconsttable_10_128 = {
+    10,
+    128,
+    {
+        { &init_p_pi_10_128, &init_q_pi_10_128 },
+        { &init_p_two_pi_10_128, &init_q_two_pi_10_128 },
+        { &init_p_pi_over_two_10_128, &init_q_pi_over_two_10_128 },
+        { &init_p_one_pt_five_pi_10_128, &init_q_one_pt_five_pi_10_128 },
+        { &init_p_e_to_one_half_10_128, &init_q_e_to_one_half_10_128 },
+        { &init_p_rat_exp_10_128, &init_q_rat_exp_10_128 },
+        { &init_p_ln_ten_10_128, &init_q_ln_ten_10_128 },
+        { &init_p_ln_two_10_128, &init_q_ln_two_10_128 },
+        { &init_p_rad_to_deg_10_128, &init_q_rad_to_deg_10_128 },
+        { &init_p_rad_to_grad_10_128, &init_q_rad_to_grad_10_128 },
+    }
+};
+
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_pi_10_256 = { 1, 31, 0, 31, {
+    1443324472, 2087375810, 1885009587, 560589394, 1547828379, 866620250, 598973537, 723409286,
+    1120242888, 617434958, 1042345599, 2137252071, 1854071286, 383332615, 261994068, 1572203979,
+    1249420447, 1234345605, 1201091751, 1232203599, 1606300187, 946262983, 1105534224, 438669083,
+    743224504, 797541034, 117503336, 1923092425, 1924955885, 26158890, 79894282,
+} };
+inline const NUMBER init_q_pi_10_256 = { 1, 31, 0, 31, {
+    1804595656, 1924048497, 1419605696, 1510645314, 2097653083, 1041493910, 1816839762, 1923601686,
+    1130714568, 209050639, 1551541878, 107086698, 1711388149, 1893297607, 2052147782, 1453710146,
+    441473439, 807301776, 1962310688, 161659002, 1951395179, 86392347, 1253296359, 508131990,
+    2092206987, 585360284, 750929204, 1756154970, 1227705829, 1748122699, 25431139,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_two_pi_10_256 = { 1, 31, 0, 31, {
+    739165296, 2027267973, 1622535527, 1121178789, 948173110, 1733240501, 1197947074, 1446818572,
+    93002128, 1234869917, 2084691198, 2127020494, 1560658925, 766665231, 523988136, 996924310,
+    351357247, 321207563, 254699855, 316923551, 1065116727, 1892525967, 63584800, 877338167,
+    1486449008, 1595082068, 235006672, 1698701202, 1702428123, 52317781, 159788564,
+} };
+inline const NUMBER init_q_two_pi_10_256 = { 1, 31, 0, 31, {
+    1804595656, 1924048497, 1419605696, 1510645314, 2097653083, 1041493910, 1816839762, 1923601686,
+    1130714568, 209050639, 1551541878, 107086698, 1711388149, 1893297607, 2052147782, 1453710146,
+    441473439, 807301776, 1962310688, 161659002, 1951395179, 86392347, 1253296359, 508131990,
+    2092206987, 585360284, 750929204, 1756154970, 1227705829, 1748122699, 25431139,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_pi_over_two_10_256 = { 1, 31, 0, 31, {
+    1443324472, 2087375810, 1885009587, 560589394, 1547828379, 866620250, 598973537, 723409286,
+    1120242888, 617434958, 1042345599, 2137252071, 1854071286, 383332615, 261994068, 1572203979,
+    1249420447, 1234345605, 1201091751, 1232203599, 1606300187, 946262983, 1105534224, 438669083,
+    743224504, 797541034, 117503336, 1923092425, 1924955885, 26158890, 79894282,
+} };
+inline const NUMBER init_q_pi_over_two_10_256 = { 1, 31, 0, 31, {
+    1461707664, 1700613347, 691727745, 873806981, 2047822519, 2082987821, 1486195876, 1699719725,
+    113945489, 418101279, 955600108, 214173397, 1275292650, 1639111567, 1956811917, 759936645,
+    882946879, 1614603552, 1777137728, 323318005, 1755306710, 172784695, 359109070, 1016263981,
+    2036930326, 1170720569, 1501858408, 1364826292, 307928011, 1348761751, 50862279,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_one_pt_five_pi_10_256 = { 1, 31, 0, 31, {
+    298167864, 727634266, 1771728435, 1593773270, 239974915, 1225719763, 1369898507, 347834399,
+    1289266034, 1041294450, 1250595678, 2025118764, 567777001, 525642969, 988874531, 1845215654,
+    1650229378, 739354980, 830609661, 1483227868, 772707237, 654888940, 239373355, 2115109412,
+    323739971, 1783699868, 990592390, 358012474, 522305603, 1119515740, 2838395,
+} };
+inline const NUMBER init_q_one_pt_five_pi_10_256 = { 1, 31, 0, 31, {
+    13066529, 1328347543, 1090121695, 1999270305, 1257234914, 394109585, 1619819351, 1904433552,
+    1665579738, 854142925, 455804150, 742948873, 1010382546, 1830766193, 1283278289, 1880944863,
+    1591549572, 484387927, 488917057, 1472609774, 52976132, 265042502, 1447027053, 590633983,
+    178013679, 1884218634, 316874130, 2000248758, 1288577291, 508716547, 602326,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_e_to_one_half_10_256 = { 1, 31, 0, 31, {
+    4352373, 744548521, 404819902, 37774165, 1870594522, 1240842211, 49222615, 1287806369,
+    444318174, 1018537421, 2095363440, 1250306377, 110522671, 2094311231, 1515728449, 1482767328,
+    1060368792, 2055555072, 573272048, 946128657, 1982961519, 298470841, 960896484, 493382239,
+    442496711, 214283893, 1845255981, 1247231106, 1349702685, 872859705, 56347,
+} };
+inline const NUMBER init_q_e_to_one_half_10_256 = { 1, 31, 0, 31, {
+    726716426, 693852709, 1930439976, 1650623245, 853784643, 2105859888, 1948070202, 1208500957,
+    1313495406, 194109112, 761911827, 294257195, 993085507, 667562362, 1105138565, 299247106,
+    1132706885, 1213616086, 1761729528, 545962041, 1714997142, 1173496226, 368061257, 551689972,
+    540258226, 514110966, 1295070398, 933699380, 1988593557, 922583551, 34176,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rat_exp_10_256 = { 1, 32, 0, 32, {
+    668588693, 1521094617, 858646742, 258395067, 1803768665, 1214410393, 971629776, 660487264,
+    68938824, 1758045506, 426318741, 1139484551, 246199803, 1925134817, 15944683, 2096493363,
+    389244683, 1718714058, 1503287118, 689582470, 994279320, 302995383, 1014988609, 856482825,
+    767839579, 1306908206, 452031825, 1844289470, 921990985, 1525155335, 549293438, 1,
+} };
+inline const NUMBER init_q_rat_exp_10_256 = { 1, 31, 0, 31, {
+    1798753983, 1315569717, 519686284, 1091565027, 1563980328, 335507252, 579286207, 710569290,
+    576091590, 687970451, 446513917, 924359811, 456289535, 830483759, 1882805716, 1026464595,
+    236288199, 1036015730, 1315464772, 1163215434, 761462661, 359571581, 1077538042, 1583323032,
+    1531269268, 645411468, 1894601938, 83991, 2046956679, 1337669200, 992088847,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_ln_ten_10_256 = { 1, 31, 0, 31, {
+    1485519455, 1362789826, 514095689, 1872854221, 781407794, 769005006, 52686121, 1270721660,
+    1177579387, 114671722, 1009483870, 875235236, 1672144209, 135270930, 211544609, 1005342314,
+    76387520, 953868162, 1693200054, 1622942090, 676447862, 1800685808, 151820826, 628610022,
+    438046227, 539136743, 229853041, 1611406023, 106776721, 941565240, 2,
+} };
+inline const NUMBER init_q_ln_ten_10_256 = { 1, 31, 0, 31, {
+    831609583, 2061011026, 650519833, 859214034, 1621577765, 1608286142, 1757734408, 971382234,
+    1463161577, 273907157, 1733373477, 2025741158, 1622403530, 1779258889, 1708100989, 973050842,
+    895473146, 1342317944, 1159991836, 1352151367, 51511613, 302738559, 208173126, 1859812779,
+    1194105465, 1612196772, 1604288807, 386949188, 1531661137, 126713536, 1,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_ln_two_10_256 = { 1, 31, 0, 31, {
+    1098226556, 398797539, 2067290951, 800696236, 1955733408, 521784095, 201732714, 2107488808,
+    781375510, 560041629, 1841418734, 1890947442, 759491942, 721471683, 1482224759, 590646302,
+    1032085869, 1432102305, 1062321332, 2143849767, 1946364311, 817029422, 778090574, 563689357,
+    570152464, 1390573891, 1105264075, 907326441, 66766538, 1632498265, 239,
+} };
+inline const NUMBER init_q_ln_two_10_256 = { 1, 31, 0, 31, {
+    475161812, 314207117, 670723484, 1868360990, 1553344409, 500550274, 1031955006, 1212800304,
+    421525282, 951105206, 604559084, 668893938, 1665280287, 1475411467, 993185051, 1200720940,
+    276209090, 2130221529, 5716944, 1747154593, 1264139676, 655046446, 808652186, 143816571,
+    278338041, 1323327904, 1833579837, 1100434493, 425465895, 1934536828, 345,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rad_to_deg_10_256 = { 1, 32, 0, 32, {
+    557187232, 583862283, 2125954977, 1333216990, 1767916666, 637826599, 613642751, 503436304,
+    1665159489, 1121893098, 104663817, 2095736586, 959705164, 1491153019, 19413462, 1822305044,
+    8324165, 1432915301, 1028605635, 1181333100, 1211297609, 518237087, 107561587, 1269445089,
+    787619302, 138152543, 2023270593, 427798406, 1943717271, 1129473314, 282637870, 2,
+} };
+inline const NUMBER init_q_rad_to_deg_10_256 = { 1, 31, 0, 31, {
+    1443324472, 2087375810, 1885009587, 560589394, 1547828379, 866620250, 598973537, 723409286,
+    1120242888, 617434958, 1042345599, 2137252071, 1854071286, 383332615, 261994068, 1572203979,
+    1249420447, 1234345605, 1201091751, 1232203599, 1606300187, 946262983, 1105534224, 438669083,
+    743224504, 797541034, 117503336, 1923092425, 1924955885, 26158890, 79894282,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rad_to_grad_10_256 = { 1, 32, 0, 32, {
+    141878336, 410126576, 453297843, 1481352212, 771305380, 2140351987, 443215984, 320764377,
+    657130739, 1007938593, 1070730307, 2089986912, 827729777, 702399511, 260179808, 831736911,
+    247858367, 399081641, 1620113739, 119545862, 1584495527, 98600397, 1551168640, 694666660,
+    1829569735, 1107940002, 2009469142, 1191159445, 728030091, 1732188938, 791260666, 2,
+} };
+inline const NUMBER init_q_rad_to_grad_10_256 = { 1, 31, 0, 31, {
+    1443324472, 2087375810, 1885009587, 560589394, 1547828379, 866620250, 598973537, 723409286,
+    1120242888, 617434958, 1042345599, 2137252071, 1854071286, 383332615, 261994068, 1572203979,
+    1249420447, 1234345605, 1201091751, 1232203599, 1606300187, 946262983, 1105534224, 438669083,
+    743224504, 797541034, 117503336, 1923092425, 1924955885, 26158890, 79894282,
+} };
+// Autogenerated by _dumpconstants in support.cpp
+inline const RATCONSTTABLE init_ratconsttable_10_256 = {
+    10,
+    256,
+    {
+        { &init_p_pi_10_256, &init_q_pi_10_256 },
+        { &init_p_two_pi_10_256, &init_q_two_pi_10_256 },
+        { &init_p_pi_over_two_10_256, &init_q_pi_over_two_10_256 },
+        { &init_p_one_pt_five_pi_10_256, &init_q_one_pt_five_pi_10_256 },
+        { &init_p_e_to_one_half_10_256, &init_q_e_to_one_half_10_256 },
+        { &init_p_rat_exp_10_256, &init_q_rat_exp_10_256 },
+        { &init_p_ln_ten_10_256, &init_q_ln_ten_10_256 },
+        { &init_p_ln_two_10_256, &init_q_ln_two_10_256 },
+        { &init_p_rad_to_deg_10_256, &init_q_rad_to_deg_10_256 },
+        { &init_p_rad_to_grad_10_256, &init_q_rad_to_grad_10_256 },
+    }
+};
+
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_pi_10_512 = { 1, 59, 0, 59, {
+    213267530, 1979852604, 985888541, 470227647, 1731031202, 123339597, 1823926887, 997751134,
+    2137106581, 97399424, 25190680, 1527279907, 1193544000, 1690547129, 1138769902, 497960760,
+    2049167949, 629964805, 78516889, 666020788, 980303537, 1139407169, 2144391848, 1036968956,
+    1578634290, 200756708, 1115592806, 2024852237, 978076357, 703898484, 2069998410, 1468560971,
+    1571503522, 1343457209, 336854785, 1613107892, 700664508, 626724834, 1966703507, 567153154,
+    1834750830, 1794374995, 2088576570, 906333899, 948939368, 1347942503, 1308236034, 171527508,
+    2096740499, 1957175450, 567827175, 1561967444, 1260134670, 237891341, 441439758, 404354167,
+    1486947322, 1276300382, 3176,
+} };
+inline const NUMBER init_q_pi_10_512 = { 1, 59, 0, 59, {
+    787996282, 1314367859, 687589820, 1903201658, 196180493, 240338547, 824886863, 1685500357,
+    50941834, 1642736044, 1679030925, 1900254723, 949807597, 73863180, 236632666, 2130793148,
+    2068150264, 370479335, 1548446560, 912716241, 271292810, 283808465, 389654006, 1237303669,
+    1924860191, 1522273372, 1873925740, 1896629475, 792026395, 1620304220, 374110353, 927279350,
+    929319111, 207587183, 1701820684, 1030463675, 498428250, 397699443, 870008207, 186764305,
+    1069788530, 643495339, 1636331194, 1247670863, 696039061, 942825455, 1904932212, 1733312793,
+    1809216911, 590283426, 460813155, 1713170303, 676237118, 1313127573, 795889425, 339866378,
+    639692137, 303606132, 1011,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_two_pi_10_512 = { 1, 59, 0, 59, {
+    426535060, 1812221560, 1971777083, 940455294, 1314578756, 246679195, 1500370126, 1995502269,
+    2126729514, 194798849, 50381360, 907076166, 239604353, 1233610611, 130056157, 995921521,
+    1950852250, 1259929611, 157033778, 1332041576, 1960607074, 131330690, 2141300049, 2073937913,
+    1009784932, 401513417, 83701964, 1902220827, 1956152715, 1407796968, 1992513172, 789638295,
+    995523397, 539430771, 673709571, 1078732136, 1401329017, 1253449668, 1785923366, 1134306309,
+    1522018012, 1441266343, 2029669493, 1812667799, 1897878736, 548401358, 468988421, 343055017,
+    2045997350, 1766867253, 1135654351, 976451240, 372785693, 475782683, 882879516, 808708334,
+    826410996, 405117117, 6353,
+} };
+inline const NUMBER init_q_two_pi_10_512 = { 1, 59, 0, 59, {
+    787996282, 1314367859, 687589820, 1903201658, 196180493, 240338547, 824886863, 1685500357,
+    50941834, 1642736044, 1679030925, 1900254723, 949807597, 73863180, 236632666, 2130793148,
+    2068150264, 370479335, 1548446560, 912716241, 271292810, 283808465, 389654006, 1237303669,
+    1924860191, 1522273372, 1873925740, 1896629475, 792026395, 1620304220, 374110353, 927279350,
+    929319111, 207587183, 1701820684, 1030463675, 498428250, 397699443, 870008207, 186764305,
+    1069788530, 643495339, 1636331194, 1247670863, 696039061, 942825455, 1904932212, 1733312793,
+    1809216911, 590283426, 460813155, 1713170303, 676237118, 1313127573, 795889425, 339866378,
+    639692137, 303606132, 1011,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_pi_over_two_10_512 = { 1, 59, 0, 59, {
+    213267530, 1979852604, 985888541, 470227647, 1731031202, 123339597, 1823926887, 997751134,
+    2137106581, 97399424, 25190680, 1527279907, 1193544000, 1690547129, 1138769902, 497960760,
+    2049167949, 629964805, 78516889, 666020788, 980303537, 1139407169, 2144391848, 1036968956,
+    1578634290, 200756708, 1115592806, 2024852237, 978076357, 703898484, 2069998410, 1468560971,
+    1571503522, 1343457209, 336854785, 1613107892, 700664508, 626724834, 1966703507, 567153154,
+    1834750830, 1794374995, 2088576570, 906333899, 948939368, 1347942503, 1308236034, 171527508,
+    2096740499, 1957175450, 567827175, 1561967444, 1260134670, 237891341, 441439758, 404354167,
+    1486947322, 1276300382, 3176,
+} };
+inline const NUMBER init_q_pi_over_two_10_512 = { 1, 59, 0, 59, {
+    1575992564, 481252070, 1375179641, 1658919668, 392360987, 480677094, 1649773726, 1223517066,
+    101883669, 1137988440, 1210578203, 1653025799, 1899615195, 147726360, 473265332, 2114102648,
+    1988816881, 740958671, 949409472, 1825432483, 542585620, 567616930, 779308012, 327123690,
+    1702236735, 897063097, 1600367833, 1645775303, 1584052791, 1093124792, 748220707, 1854558700,
+    1858638222, 415174366, 1256157720, 2060927351, 996856500, 795398886, 1740016414, 373528610,
+    2139577060, 1286990678, 1125178740, 347858079, 1392078123, 1885650910, 1662380776, 1319141939,
+    1470950175, 1180566853, 921626310, 1278856958, 1352474237, 478771498, 1591778851, 679732756,
+    1279384274, 607212264, 2022,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_one_pt_five_pi_10_512 = { 1, 59, 0, 59, {
+    1043630261, 1471552666, 134680914, 1313183551, 556350876, 256229247, 84669199, 787114457,
+    43740727, 995602883, 1625921226, 1706250687, 1636616384, 1608546004, 1560616630, 1133411227,
+    1812967612, 249560162, 1674227618, 1482192792, 1156612933, 442464126, 198060448, 5731435,
+    380296597, 150651518, 813955992, 991369549, 248228051, 1090418028, 761997652, 1329452809,
+    1261366454, 1814154559, 539136015, 1062136754, 1460240902, 950057721, 995330704, 887975850,
+    1755469118, 1320893531, 701798058, 1130066498, 798807199, 1011037133, 1080609166, 1599354021,
+    509433731, 347231469, 266665602, 564339214, 530764739, 745286711, 886228359, 128329339,
+    24827505, 1893602629, 9635957,
+} };
+inline const NUMBER init_q_one_pt_five_pi_10_512 = { 1, 59, 0, 59, {
+    868506147, 831231149, 225324217, 1554108702, 1386203346, 1895863432, 1690620658, 165939745,
+    1868303200, 1028556186, 1098564866, 1696168364, 1392635500, 195648567, 1459370374, 640155952,
+    1506660705, 2100803940, 1658055959, 163134495, 915623491, 960439592, 169654595, 244032466,
+    800115719, 218898457, 511507071, 513337316, 2021557421, 939437600, 846039696, 479663937,
+    2085862454, 974923088, 482033641, 548843453, 1707716561, 931427906, 877484859, 1528191850,
+    1743367987, 544026759, 914805561, 1352569469, 630743683, 520397294, 2071326090, 2013239345,
+    914543915, 1757607461, 1006900528, 530188941, 1722817249, 888251400, 721290043, 1106164338,
+    1904933489, 1655882230, 2044813,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_e_to_one_half_10_512 = { 1, 59, 0, 59, {
+    1834577876, 1113632078, 479751083, 338602404, 1399560818, 1919775326, 1531577992, 1238643811,
+    302035236, 1010877446, 1851815616, 1624778166, 1104216474, 1266070382, 1171256383, 1963008404,
+    1016485771, 1398374545, 2142740341, 555884047, 597024136, 1180426184, 1415196919, 1709303226,
+    204449169, 1180366832, 1524882015, 1890539220, 1872723465, 1086008154, 2101882672, 1647994735,
+    2127862602, 2037004011, 757038420, 1907646589, 1453929486, 8760070, 472204259, 1611546680,
+    968844353, 443831450, 1914209926, 558749638, 2142297828, 575996477, 755430230, 62845266,
+    244083136, 298309519, 235096336, 2047311920, 875361118, 533567708, 1100164239, 1414961200,
+    114655088, 2143826853, 3209,
+} };
+inline const NUMBER init_q_e_to_one_half_10_512 = { 1, 59, 0, 59, {
+    1449687943, 1130492383, 218685310, 1120250813, 1301463508, 2110714934, 837374439, 627243560,
+    1064546544, 1507134466, 947074058, 1679067834, 1327760431, 1994542089, 2069518415, 720746863,
+    1282980402, 109980839, 715325734, 2111230022, 636215538, 1718648482, 1835520749, 2094755341,
+    858566426, 391403338, 961661006, 1320456071, 1881735069, 21520221, 919650877, 700042663,
+    525287416, 1762830244, 1158067968, 2011487280, 244183535, 1701048496, 137326161, 431134822,
+    1810905234, 2063509379, 1938915737, 2102025623, 1552978085, 748244587, 701772126, 1584683143,
+    1878682416, 957576096, 1606384372, 543679382, 2084169067, 1815872221, 44302224, 1813496017,
+    1048885780, 2066705750, 1946,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rat_exp_10_512 = { 1, 59, 0, 59, {
+    1381926018, 1710636290, 1051213652, 826737030, 1094205507, 1055422023, 901945847, 518307659,
+    254285703, 141953572, 1780395989, 986177899, 1037179488, 2003528346, 133219054, 1040360465,
+    1844119288, 670811983, 828216709, 1343032851, 1444064287, 187237742, 1737358724, 120307599,
+    1604514679, 1823189113, 627582484, 1178110134, 187934995, 395367146, 1609200064, 1310059773,
+    1130135374, 170466283, 813148097, 1645748100, 230829954, 1667358085, 1337273015, 1073723470,
+    450178949, 1080132922, 592003030, 457508096, 164758063, 143046121, 585364941, 797758636,
+    1463438651, 2016068562, 98993680, 1220222369, 1141419271, 2135608809, 1560947106, 424221539,
+    546709157, 2128038933, 29762,
+} };
+inline const NUMBER init_q_rat_exp_10_512 = { 1, 59, 0, 59, {
+    334963084, 1446290854, 2011047740, 1651797857, 726585365, 1575920482, 1360203184, 765694783,
+    1896637800, 1983645619, 1655893264, 305893440, 725445944, 97790898, 2082907327, 2014070863,
+    1474209401, 1144969362, 974353164, 89496375, 1157108181, 451343483, 165230478, 967065050,
+    1150211485, 1488320456, 1477771386, 1867697351, 1475039549, 1033902860, 1403712825, 982070157,
+    62072012, 105756067, 157654741, 446238238, 1186696259, 2062297818, 823626413, 294048276,
+    826614836, 1901691325, 1423619611, 554750877, 414317521, 759756613, 855064855, 984016636,
+    1662692664, 592365587, 867344759, 967742224, 1021664804, 1664658808, 1667672465, 400303475,
+    1110872480, 413340277, 10949,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_ln_ten_10_512 = { 1, 59, 0, 59, {
+    11249230, 948881579, 1162352330, 1859218907, 1355244458, 1717177053, 1074621984, 326105784,
+    1718321734, 225015138, 421689709, 504160776, 564043529, 254669385, 1450303055, 1389216582,
+    2025010812, 342254228, 1210848203, 298646011, 1608289886, 108934058, 334732463, 1906956214,
+    177123612, 904175338, 779235991, 1083554567, 1692336316, 308689080, 1859210151, 153989142,
+    1150872585, 841143631, 1375008204, 1025676422, 128366452, 1609800316, 1002607792, 2073513473,
+    1008471250, 785003178, 1572878392, 448083403, 930531094, 921833748, 1207106064, 2023220955,
+    165642544, 1808179899, 465487858, 1136225671, 315586929, 1992969331, 410926133, 605552302,
+    99972862, 1968417160, 638,
+} };
+inline const NUMBER init_q_ln_ten_10_512 = { 1, 59, 0, 59, {
+    1097131162, 991815332, 314461, 662091245, 1271919006, 1095118466, 626678129, 1507622695,
+    1700988585, 1610090353, 1342372398, 571048186, 1620235843, 1178112632, 451931582, 472101609,
+    806102254, 1266574232, 398119227, 1161517966, 1971704868, 1878167950, 604712501, 1549364438,
+    1325961669, 448430796, 1882249219, 721141243, 567484413, 839006986, 808273911, 333716751,
+    814365324, 758023350, 1420321476, 1237867686, 1267336794, 1846258354, 1392573831, 482684077,
+    1416089185, 1043638099, 1797940566, 591612118, 677673208, 922755545, 1142718939, 1995303748,
+    1917415040, 956454971, 1030806651, 583624552, 84750674, 1489864706, 14023872, 121412363,
+    1198075343, 1026412532, 277,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_ln_two_10_512 = { 1, 59, 0, 59, {
+    1533940766, 913430963, 543079704, 1652898106, 1444664321, 1804471050, 1130920489, 1683900861,
+    47154805, 799748502, 615802120, 98863205, 1587038220, 1476170807, 1708190776, 1064204090,
+    222852783, 82579087, 1106642532, 14241786, 1697913359, 133716527, 1133624597, 637867359,
+    1194640660, 1523165961, 111277200, 50941296, 788944580, 748929824, 1394874231, 1047043053,
+    443890868, 933117899, 1426975564, 1562869381, 614490620, 1321758203, 853008624, 1158272221,
+    32047562, 1209779087, 1427093678, 226143854, 695067658, 492854311, 1737922908, 1188660800,
+    1693053926, 105914444, 474070916, 1719783532, 1081295771, 33514474, 1363418649, 650394929,
+    686271310, 1442803331, 13234096,
+} };
+inline const NUMBER init_q_ln_two_10_512 = { 1, 59, 0, 59, {
+    645797956, 1223400659, 1333739338, 1657643674, 369899114, 963803760, 726455521, 1658915465,
+    424029677, 681880866, 1223399229, 945237440, 1978412389, 939852943, 399308241, 201795152,
+    620694498, 2126246749, 837541870, 1857301122, 1944647674, 1017292791, 1118832997, 44443435,
+    1770231271, 115752239, 1948654440, 1328755894, 1073394031, 5794133, 258389690, 1755658474,
+    1981444681, 2101021850, 252639228, 1946346014, 417405698, 1398414798, 1993030163, 2109880774,
+    656919585, 141911655, 1211093265, 135399850, 2092431, 1936516531, 1277429198, 1843015473,
+    552174544, 1769036422, 1525332542, 2100252996, 238514367, 1168365888, 1839890006, 285416882,
+    1612765113, 1372530192, 19092765,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rad_to_deg_10_512 = { 1, 59, 0, 59, {
+    105409992, 363013406, 1359599774, 1126398465, 952750531, 311265516, 303263648, 594869961,
+    579595669, 1487228148, 1577855917, 595950248, 1314159427, 410470591, 1791690574, 1290677315,
+    752376594, 114287385, 1694990239, 1080166261, 1588065620, 1693399818, 1418244367, 1523844708,
+    729967155, 1278783825, 151700591, 2090889273, 830830490, 1744467186, 767870587, 1554042135,
+    1921199161, 858471001, 1385045121, 799867914, 1670255518, 718939397, 1982654637, 1405320252,
+    1435890743, 2012527765, 334355197, 1242456085, 732979500, 57373766, 1437898207, 611173939,
+    1389013277, 1024318079, 1341989325, 1280492914, 1463597095, 139761916, 1526175842, 1046405962,
+    1327951344, 962012613, 182005,
+} };
+inline const NUMBER init_q_rad_to_deg_10_512 = { 1, 59, 0, 59, {
+    213267530, 1979852604, 985888541, 470227647, 1731031202, 123339597, 1823926887, 997751134,
+    2137106581, 97399424, 25190680, 1527279907, 1193544000, 1690547129, 1138769902, 497960760,
+    2049167949, 629964805, 78516889, 666020788, 980303537, 1139407169, 2144391848, 1036968956,
+    1578634290, 200756708, 1115592806, 2024852237, 978076357, 703898484, 2069998410, 1468560971,
+    1571503522, 1343457209, 336854785, 1613107892, 700664508, 626724834, 1966703507, 567153154,
+    1834750830, 1794374995, 2088576570, 906333899, 948939368, 1347942503, 1308236034, 171527508,
+    2096740499, 1957175450, 567827175, 1561967444, 1260134670, 237891341, 441439758, 404354167,
+    1486947322, 1276300382, 3176,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rad_to_grad_10_512 = { 1, 59, 0, 59, {
+    832950096, 880566817, 79010650, 535725968, 581393113, 823069162, 1768615374, 2092622388,
+    1598432364, 2129694308, 798736064, 2093822708, 982958552, 1887734200, 81892950, 956867318,
+    1313192582, 1081423160, 451666722, 7138264, 571470885, 927118177, 621389898, 500114316,
+    572465323, 1659480211, 1122993389, 1368773126, 1638972872, 1938296873, 1807626718, 772276306,
+    1180228558, 715247374, 1061720435, 2081788598, 901402287, 82993670, 55465949, 845639065,
+    1356824865, 1997532667, 848724363, 426069584, 1768858844, 1734013688, 881836791, 917691449,
+    1066129497, 2092568376, 1968317838, 1184160610, 2103437583, 632509606, 264095170, 1401282586,
+    1236892199, 591684315, 202228,
+} };
+inline const NUMBER init_q_rad_to_grad_10_512 = { 1, 59, 0, 59, {
+    213267530, 1979852604, 985888541, 470227647, 1731031202, 123339597, 1823926887, 997751134,
+    2137106581, 97399424, 25190680, 1527279907, 1193544000, 1690547129, 1138769902, 497960760,
+    2049167949, 629964805, 78516889, 666020788, 980303537, 1139407169, 2144391848, 1036968956,
+    1578634290, 200756708, 1115592806, 2024852237, 978076357, 703898484, 2069998410, 1468560971,
+    1571503522, 1343457209, 336854785, 1613107892, 700664508, 626724834, 1966703507, 567153154,
+    1834750830, 1794374995, 2088576570, 906333899, 948939368, 1347942503, 1308236034, 171527508,
+    2096740499, 1957175450, 567827175, 1561967444, 1260134670, 237891341, 441439758, 404354167,
+    1486947322, 1276300382, 3176,
+} };
+// Autogenerated by _dumpconstants in support.cpp
+inline const RATCONSTTABLE init_ratconsttable_10_512 = {
+    10,
+    512,
+    {
+        { &init_p_pi_10_512, &init_q_pi_10_512 },
+        { &init_p_two_pi_10_512, &init_q_two_pi_10_512 },
+        { &init_p_pi_over_two_10_512, &init_q_pi_over_two_10_512 },
+        { &init_p_one_pt_five_pi_10_512, &init_q_one_pt_five_pi_10_512 },
+        { &init_p_e_to_one_half_10_512, &init_q_e_to_one_half_10_512 },
+        { &init_p_rat_exp_10_512, &init_q_rat_exp_10_512 },
+        { &init_p_ln_ten_10_512, &init_q_ln_ten_10_512 },
+        { &init_p_ln_two_10_512, &init_q_ln_two_10_512 },
+        { &init_p_rad_to_deg_10_512, &init_q_rad_to_deg_10_512 },
+        { &init_p_rad_to_grad_10_512, &init_q_rad_to_grad_10_512 },
+    }
+};
+
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_pi_16_32 = { 1, 7, 0, 7, {
+    1358503228, 1246868245, 1798201471, 311572633, 2010801287, 530865666, 77808493,
+} };
+inline const NUMBER init_q_pi_16_32 = { 1, 7, 0, 7, {
+    370507393, 530173052, 1088859723, 42188320, 730030596, 1352162262, 24767212,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_two_pi_16_32 = { 1, 7, 0, 7, {
+    569522808, 346252843, 1448919295, 623145267, 1874118926, 1061731333, 155616986,
+} };
+inline const NUMBER init_q_two_pi_16_32 = { 1, 7, 0, 7, {
+    370507393, 530173052, 1088859723, 42188320, 730030596, 1352162262, 24767212,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_pi_over_two_16_32 = { 1, 7, 0, 7, {
+    1358503228, 1246868245, 1798201471, 311572633, 2010801287, 530865666, 77808493,
+} };
+inline const NUMBER init_q_pi_over_two_16_32 = { 1, 7, 0, 7, {
+    741014786, 1060346104, 30235798, 84376641, 1460061192, 556840876, 49534425,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_one_pt_five_pi_16_32 = { 1, 7, 0, 7, {
+    454331246, 953941684, 88290308, 404322154, 1515677007, 1926582795, 2692126,
+} };
+inline const NUMBER init_q_one_pt_five_pi_16_32 = { 1, 7, 0, 7, {
+    1347631680, 2082376666, 680061765, 2118193426, 565266616, 152069575, 571287,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_e_to_one_half_16_32 = { 1, 7, 0, 7, {
+    1093125840, 1622066915, 2020002465, 170636825, 1642272715, 323644390, 629,
+} };
+inline const NUMBER init_q_e_to_one_half_16_32 = { 1, 7, 0, 7, {
+    714080820, 636441742, 687204551, 1614840687, 1127157355, 1286760142, 381,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rat_exp_16_32 = { 1, 7, 0, 7, {
+    1683172894, 765630206, 1043590701, 522706668, 1012334744, 297387774, 30087,
+} };
+inline const NUMBER init_q_rat_exp_16_32 = { 1, 7, 0, 7, {
+    745461927, 2003556565, 1097298767, 621799884, 720794174, 944229654, 11068,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_ln_ten_16_32 = { 1, 7, 0, 7, {
+    915920410, 2067301983, 713174221, 1965948679, 225620169, 352175099, 395,
+} };
+inline const NUMBER init_q_ln_ten_16_32 = { 1, 7, 0, 7, {
+    1578249690, 1426166077, 1429253555, 355655175, 497830931, 1326161724, 171,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_ln_two_16_32 = { 1, 7, 0, 7, {
+    312469216, 1910428904, 372383075, 2094935184, 1297392401, 146734242, 478,
+} };
+inline const NUMBER init_q_ln_two_16_32 = { 1, 7, 0, 7, {
+    1670813292, 1527719145, 244944578, 1452603753, 192119285, 1517855766, 689,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rad_to_deg_16_32 = { 1, 8, 0, 8, {
+    119337652, 941868879, 573738216, 1151446747, 409004755, 723554997, 163130977, 2,
+} };
+inline const NUMBER init_q_rad_to_deg_16_32 = { 1, 7, 0, 7, {
+    1358503228, 1246868245, 1798201471, 311572633, 2010801287, 530865666, 77808493,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rad_to_grad_16_32 = { 1, 8, 0, 8, {
+    1087034568, 807911682, 876096201, 1995213157, 2124714787, 1996996467, 658475229, 2,
+} };
+inline const NUMBER init_q_rad_to_grad_16_32 = { 1, 7, 0, 7, {
+    1358503228, 1246868245, 1798201471, 311572633, 2010801287, 530865666, 77808493,
+} };
+// Autogenerated by _dumpconstants in support.cpp
+inline const RATCONSTTABLE init_ratconsttable_16_32 = {
+    16,
+    32,
+    {
+        { &init_p_pi_16_32, &init_q_pi_16_32 },
+        { &init_p_two_pi_16_32, &init_q_two_pi_16_32 },
+        { &init_p_pi_over_two_16_32, &init_q_pi_over_two_16_32 },
+        { &init_p_one_pt_five_pi_16_32, &init_q_one_pt_five_pi_16_32 },
+        { &init_p_e_to_one_half_16_32, &init_q_e_to_one_half_16_32 },
+        { &init_p_rat_exp_16_32, &init_q_rat_exp_16_32 },
+        { &init_p_ln_ten_16_32, &init_q_ln_ten_16_32 },
+        { &init_p_ln_two_16_32, &init_q_ln_two_16_32 },
+        { &init_p_rad_to_deg_16_32, &init_q_rad_to_deg_16_32 },
+        { &init_p_rad_to_grad_16_32, &init_q_rad_to_grad_16_32 },
+    }
+};
+
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_pi_16_64 = { 1, 12, 0, 12, {
+    152561483, 1411304453, 1450756047, 73545202, 194869106, 757017035, 1185311718, 2099211358,
+    843164834, 496386815, 810674024, 3,
+} };
+inline const NUMBER init_q_pi_16_64 = { 1, 12, 0, 12, {
+    2089275203, 1590427980, 466846452, 651637791, 1349328789, 864764638, 1647660175, 2044242550,
+    1942738387, 245816202, 161257735, 1,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_two_pi_16_64 = { 1, 12, 0, 12, {
+    305122966, 675125258, 754028447, 147090405, 389738212, 1514034070, 223139788, 2050939069,
+    1686329669, 992773630, 1621348048, 6,
+} };
+inline const NUMBER init_q_two_pi_16_64 = { 1, 12, 0, 12, {
+    2089275203, 1590427980, 466846452, 651637791, 1349328789, 864764638, 1647660175, 2044242550,
+    1942738387, 245816202, 161257735, 1,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_pi_over_two_16_64 = { 1, 12, 0, 12, {
+    152561483, 1411304453, 1450756047, 73545202, 194869106, 757017035, 1185311718, 2099211358,
+    843164834, 496386815, 810674024, 3,
+} };
+inline const NUMBER init_q_pi_over_two_16_64 = { 1, 12, 0, 12, {
+    2031066758, 1033372313, 933692905, 1303275582, 551173930, 1729529277, 1147836702, 1941001453,
+    1737993127, 491632405, 322515470, 2,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_one_pt_five_pi_16_64 = { 1, 12, 0, 12, {
+    862577268, 903259946, 485388847, 186676251, 1465491298, 2046463704, 500608136, 206726424,
+    131287973, 1185027397, 1918482188, 10,
+} };
+inline const NUMBER init_q_one_pt_five_pi_16_64 = { 1, 12, 0, 12, {
+    725414898, 1953547239, 1259332650, 20151672, 79747661, 2079706774, 82955580, 725841400,
+    2093479184, 1929694155, 669249105, 2,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_e_to_one_half_16_64 = { 1, 12, 0, 12, {
+    256779625, 1176337837, 1228273901, 2115581535, 1752329773, 527657592, 1810979952, 78268611,
+    2119417146, 112507496, 1499600921, 4040117,
+} };
+inline const NUMBER init_q_e_to_one_half_16_64 = { 1, 12, 0, 12, {
+    846869424, 476998754, 408655696, 863083951, 1080967126, 483880927, 2127596203, 1562550292,
+    1084144523, 1881147985, 543034795, 2450455,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rat_exp_16_64 = { 1, 12, 0, 12, {
+    592477838, 6193321, 1516216162, 1047681431, 993803803, 128451459, 1314789750, 55610594,
+    44269974, 46730028, 1199258960, 20155713,
+} };
+inline const NUMBER init_q_rat_exp_16_64 = { 1, 12, 0, 12, {
+    674673941, 600151984, 830864952, 1850652945, 696746845, 2021994581, 496014664, 1400355229,
+    721721215, 300351606, 1375020222, 7414872,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_ln_ten_16_64 = { 1, 12, 0, 12, {
+    808333178, 1613014512, 1182458882, 183509669, 365568635, 1437018805, 1656254329, 1376796331,
+    126520507, 1960551154, 216912519, 378,
+} };
+inline const NUMBER init_q_ln_ten_16_64 = { 1, 12, 0, 12, {
+    1909079954, 431516639, 413296540, 1552829199, 236910652, 1910217119, 1745772983, 1076581273,
+    1391200114, 676407933, 444918397, 164,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_ln_two_16_64 = { 1, 12, 0, 12, {
+    864411612, 973464930, 1455913510, 1557029555, 1968512801, 811809872, 962162978, 2141018856,
+    1100232757, 803510800, 489274226, 770000,
+} };
+inline const NUMBER init_q_ln_two_16_64 = { 1, 12, 0, 12, {
+    1512640252, 876743854, 57609550, 2133645113, 675797220, 1084905160, 321149438, 1279210557,
+    1355688752, 121422279, 1095608500, 1110875,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rad_to_deg_16_64 = { 1, 12, 0, 12, {
+    259898140, 661711391, 280499221, 1330685427, 213529850, 1038812297, 226088148, 743955330,
+    1800558855, 1297243562, 1109104896, 193,
+} };
+inline const NUMBER init_q_rad_to_deg_16_64 = { 1, 12, 0, 12, {
+    152561483, 1411304453, 1450756047, 73545202, 194869106, 757017035, 1185311718, 2099211358,
+    843164834, 496386815, 810674024, 3,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rad_to_grad_16_64 = { 1, 12, 0, 12, {
+    1243212888, 258016290, 1027493684, 1478539363, 1430301860, 1154235885, 967036936, 826617033,
+    2000620950, 1918600324, 39292302, 215,
+} };
+inline const NUMBER init_q_rad_to_grad_16_64 = { 1, 12, 0, 12, {
+    152561483, 1411304453, 1450756047, 73545202, 194869106, 757017035, 1185311718, 2099211358,
+    843164834, 496386815, 810674024, 3,
+} };
+// Autogenerated by _dumpconstants in support.cpp
+inline const RATCONSTTABLE init_ratconsttable_16_64 = {
+    16,
+    64,
+    {
+        { &init_p_pi_16_64, &init_q_pi_16_64 },
+        { &init_p_two_pi_16_64, &init_q_two_pi_16_64 },
+        { &init_p_pi_over_two_16_64, &init_q_pi_over_two_16_64 },
+        { &init_p_one_pt_five_pi_16_64, &init_q_one_pt_five_pi_16_64 },
+        { &init_p_e_to_one_half_16_64, &init_q_e_to_one_half_16_64 },
+        { &init_p_rat_exp_16_64, &init_q_rat_exp_16_64 },
+        { &init_p_ln_ten_16_64, &init_q_ln_ten_16_64 },
+        { &init_p_ln_two_16_64, &init_q_ln_two_16_64 },
+        { &init_p_rad_to_deg_16_64, &init_q_rad_to_deg_16_64 },
+        { &init_p_rad_to_grad_16_64, &init_q_rad_to_grad_16_64 },
+    }
+};
+
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_pi_16_128 = { 1, 21, 0, 21, {
+    1787431282, 1905718116, 1051826848, 135502950, 2103824391, 1199836806, 117643101, 1472873998,
+    636399219, 1847001017, 1777641483, 739111666, 1807906829, 739387386, 970082612, 1896810939,
+    1586724199, 1321784154, 1347554586, 2027209283, 83027,
+} };
+inline const NUMBER init_q_pi_16_128 = { 1, 21, 0, 21, {
+    1579853529, 2008895469, 11498121, 1870198547, 1239140100, 420099091, 1630224324, 2048400358,
+    2086231273, 1160388814, 991783544, 228259360, 672334130, 400672094, 849057552, 1781548058,
+    27769919, 1570785659, 1562937473, 1321566696, 26428,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_two_pi_16_128 = { 1, 21, 0, 21, {
+    1427378916, 1663952585, 2103653697, 271005900, 2060165134, 252189965, 235286203, 798264348,
+    1272798439, 1546518386, 1407799319, 1478223333, 1468330010, 1478774773, 1940165224, 1646138230,
+    1025964751, 496084661, 547625525, 1906934919, 166055,
+} };
+inline const NUMBER init_q_two_pi_16_128 = { 1, 21, 0, 21, {
+    1579853529, 2008895469, 11498121, 1870198547, 1239140100, 420099091, 1630224324, 2048400358,
+    2086231273, 1160388814, 991783544, 228259360, 672334130, 400672094, 849057552, 1781548058,
+    27769919, 1570785659, 1562937473, 1321566696, 26428,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_pi_over_two_16_128 = { 1, 21, 0, 21, {
+    1787431282, 1905718116, 1051826848, 135502950, 2103824391, 1199836806, 117643101, 1472873998,
+    636399219, 1847001017, 1777641483, 739111666, 1807906829, 739387386, 970082612, 1896810939,
+    1586724199, 1321784154, 1347554586, 2027209283, 83027,
+} };
+inline const NUMBER init_q_pi_over_two_16_128 = { 1, 21, 0, 21, {
+    1012223410, 1870307291, 22996243, 1592913446, 330796553, 840198183, 1112965000, 1949317069,
+    2024978899, 173293981, 1983567089, 456518720, 1344668260, 801344188, 1698115104, 1415612468,
+    55539839, 994087670, 978391299, 495649745, 52857,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_one_pt_five_pi_16_128 = { 1, 22, 0, 22, {
+    23248113, 2040435286, 535112842, 9949718, 1698393799, 1461399879, 785328748, 87984452,
+    921293890, 1170139836, 2092456602, 1925149871, 539465519, 1545446101, 765148137, 53158959,
+    627564087, 2109519012, 2099279884, 713261214, 140489854, 3,
+} };
+inline const NUMBER init_q_one_pt_five_pi_16_128 = { 1, 21, 0, 21, {
+    1843665928, 1184076500, 1461439189, 31198707, 1991176659, 117803902, 129330811, 167204516,
+    920003960, 1739027776, 1867588260, 1298351308, 1616560361, 1824257743, 720972747, 461846777,
+    2060427524, 1975528608, 419024879, 389030965, 1396943424,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_e_to_one_half_16_128 = { 1, 21, 0, 21, {
+    829698590, 1304508077, 1568922665, 813044643, 73988525, 466390325, 182399382, 377104641,
+    25078293, 256934062, 1113921326, 576671443, 937678048, 906394123, 184242277, 1010813936,
+    1630244643, 280055674, 430015909, 997334182, 9119465,
+} };
+inline const NUMBER init_q_e_to_one_half_16_128 = { 1, 21, 0, 21, {
+    1211866843, 676883790, 1901352081, 85768480, 1028836615, 467377656, 800537514, 700601772,
+    860550358, 547990386, 1065678264, 843322559, 1835959169, 90533512, 1293428709, 1000598907,
+    30609989, 762888885, 1113498077, 868359044, 5531235,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rat_exp_16_128 = { 1, 21, 0, 21, {
+    80894467, 334488187, 897222742, 1083146925, 1528955962, 1168420185, 1368711550, 1829007637,
+    219696546, 437961118, 929765161, 1980235723, 866530655, 1721795460, 197136478, 867990038,
+    1162435111, 1005637701, 1201162181, 242608027, 4899091,
+} };
+inline const NUMBER init_q_rat_exp_16_128 = { 1, 21, 0, 21, {
+    1425635222, 327946404, 1753865452, 1275899952, 997908867, 1614152671, 94045127, 1732655245,
+    464912573, 545941368, 2139851580, 636547965, 1666455240, 1448575225, 1996345291, 1677055248,
+    367487542, 1693500752, 458387197, 1934643425, 1802274,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_ln_ten_16_128 = { 1, 22, 0, 22, {
+    1376114030, 318208836, 1907991687, 133690330, 268937676, 271437644, 1603696814, 1744813845,
+    1053701828, 1251886003, 2115205688, 1015217875, 1241493412, 1845983796, 118702280, 1072698097,
+    1605676759, 224538536, 898748705, 1106947906, 2120207357, 1,
+} };
+inline const NUMBER init_q_ln_ten_16_128 = { 1, 21, 0, 21, {
+    1787367664, 1599091178, 280917031, 333927524, 1965075851, 1270035576, 1154152864, 1579870435,
+    778877023, 1484042685, 515972526, 1277716834, 203076429, 1263277392, 1749519545, 1729535961,
+    193840039, 904492637, 1515301554, 351125922, 1853434654,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_ln_two_16_128 = { 1, 21, 0, 21, {
+    1855499575, 1499067426, 1785188503, 250182518, 824432114, 576311075, 698632893, 857392872,
+    1268674155, 717335854, 227478228, 1553487940, 1535353360, 1141903985, 290523073, 246133552,
+    979501995, 2106359123, 1123269868, 849006362, 2044,
+} };
+inline const NUMBER init_q_ln_two_16_128 = { 1, 21, 0, 21, {
+    10958370, 88880002, 1159196977, 1183479235, 1746836987, 864394260, 245777326, 234933815,
+    2044423635, 2094647571, 1737366232, 374257136, 1383220448, 1503438784, 526892583, 1348741780,
+    1297978363, 840353582, 438894294, 942814448, 2949,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rad_to_deg_16_128 = { 1, 21, 0, 21, {
+    905793684, 823931688, 2069661948, 1628289372, 1854402412, 455908803, 1382602227, 1492360768,
+    1859474559, 564072838, 279895233, 284495571, 761059131, 1254016592, 359020385, 703586959,
+    703618273, 1421060734, 8387383, 1658804131, 4757150,
+} };
+inline const NUMBER init_q_rad_to_deg_16_128 = { 1, 21, 0, 21, {
+    1787431282, 1905718116, 1051826848, 135502950, 2103824391, 1199836806, 117643101, 1472873998,
+    636399219, 1847001017, 1777641483, 739111666, 1807906829, 739387386, 970082612, 1896810939,
+    1586724199, 1321784154, 1347554586, 2027209283, 83027,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rad_to_grad_16_128 = { 1, 21, 0, 21, {
+    290609544, 199651771, 152140739, 377554649, 867400654, 267956043, 1774833991, 1658178631,
+    634427078, 149529010, 788213292, 554715484, 1322839845, 677523886, 160302245, 1974809759,
+    1259016669, 624519194, 1202365786, 172850641, 5285723,
+} };
+inline const NUMBER init_q_rad_to_grad_16_128 = { 1, 21, 0, 21, {
+    1787431282, 1905718116, 1051826848, 135502950, 2103824391, 1199836806, 117643101, 1472873998,
+    636399219, 1847001017, 1777641483, 739111666, 1807906829, 739387386, 970082612, 1896810939,
+    1586724199, 1321784154, 1347554586, 2027209283, 83027,
+} };
+// Autogenerated by _dumpconstants in support.cpp
+inline const RATCONSTTABLE init_ratconsttable_16_128 = {
+    16,
+    128,
+    {
+        { &init_p_pi_16_128, &init_q_pi_16_128 },
+        { &init_p_two_pi_16_128, &init_q_two_pi_16_128 },
+        { &init_p_pi_over_two_16_128, &init_q_pi_over_two_16_128 },
+        { &init_p_one_pt_five_pi_16_128, &init_q_one_pt_five_pi_16_128 },
+        { &init_p_e_to_one_half_16_128, &init_q_e_to_one_half_16_128 },
+        { &init_p_rat_exp_16_128, &init_q_rat_exp_16_128 },
+        { &init_p_ln_ten_16_128, &init_q_ln_ten_16_128 },
+        { &init_p_ln_two_16_128, &init_q_ln_two_16_128 },
+        { &init_p_rad_to_deg_16_128, &init_q_rad_to_deg_16_128 },
+        { &init_p_rad_to_grad_16_128, &init_q_rad_to_grad_16_128 },
+    }
+};
+
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_pi_16_256 = { 1, 39, 0, 39, {
+    1654815362, 1515642898, 1940918648, 850054333, 172236419, 790675728, 379354164, 1478116897,
+    398383425, 350597942, 1282156495, 239190052, 1956975265, 1293726466, 2004005682, 1351949180,
+    476641330, 1599807226, 1639993984, 1743215325, 544829300, 17897259, 343100058, 789362274,
+    938651794, 901588748, 312612788, 470780739, 1491899775, 217198862, 1682675487, 212860094,
+    2001366378, 823513608, 1484025550, 458334662, 705342173, 138303297, 930,
+} };
+inline const NUMBER init_q_pi_16_256 = { 1, 39, 0, 39, {
+    79297674, 889871311, 203216342, 1925240312, 1755024040, 2138723523, 1978277213, 842070985,
+    1193347504, 708991296, 1741715119, 2002318943, 1329235141, 2052127156, 957599125, 1338095602,
+    1570063995, 2097910458, 528770551, 1017873694, 305004127, 431848749, 1355852811, 1676279598,
+    2116620299, 584281501, 2147272783, 1758701297, 611182912, 1786071745, 762162605, 1187198847,
+    998329407, 308980112, 570144455, 2129055515, 1960310155, 104569784, 296,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_two_pi_16_256 = { 1, 39, 0, 39, {
+    1162147076, 883802149, 1734353649, 1700108667, 344472838, 1581351456, 758708328, 808750146,
+    796766851, 701195884, 416829342, 478380105, 1766466882, 439969285, 1860527717, 556414713,
+    953282661, 1052130804, 1132504321, 1338947003, 1089658601, 35794518, 686200116, 1578724548,
+    1877303588, 1803177496, 625225576, 941561478, 836315902, 434397725, 1217867326, 425720189,
+    1855249108, 1647027217, 820567452, 916669325, 1410684346, 276606594, 1860,
+} };
+inline const NUMBER init_q_two_pi_16_256 = { 1, 39, 0, 39, {
+    79297674, 889871311, 203216342, 1925240312, 1755024040, 2138723523, 1978277213, 842070985,
+    1193347504, 708991296, 1741715119, 2002318943, 1329235141, 2052127156, 957599125, 1338095602,
+    1570063995, 2097910458, 528770551, 1017873694, 305004127, 431848749, 1355852811, 1676279598,
+    2116620299, 584281501, 2147272783, 1758701297, 611182912, 1786071745, 762162605, 1187198847,
+    998329407, 308980112, 570144455, 2129055515, 1960310155, 104569784, 296,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_pi_over_two_16_256 = { 1, 39, 0, 39, {
+    1654815362, 1515642898, 1940918648, 850054333, 172236419, 790675728, 379354164, 1478116897,
+    398383425, 350597942, 1282156495, 239190052, 1956975265, 1293726466, 2004005682, 1351949180,
+    476641330, 1599807226, 1639993984, 1743215325, 544829300, 17897259, 343100058, 789362274,
+    938651794, 901588748, 312612788, 470780739, 1491899775, 217198862, 1682675487, 212860094,
+    2001366378, 823513608, 1484025550, 458334662, 705342173, 138303297, 930,
+} };
+inline const NUMBER init_q_pi_over_two_16_256 = { 1, 39, 0, 39, {
+    158595348, 1779742622, 406432684, 1702996976, 1362564433, 2129963399, 1809070779, 1684141971,
+    239211360, 1417982593, 1335946590, 1857154239, 510986635, 1956770665, 1915198251, 528707556,
+    992644343, 2048337269, 1057541103, 2035747388, 610008254, 863697498, 564221974, 1205075549,
+    2085756951, 1168563003, 2147061918, 1369918947, 1222365825, 1424659842, 1524325211, 226914046,
+    1996658815, 617960224, 1140288910, 2110627382, 1773136663, 209139569, 592,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_one_pt_five_pi_16_256 = { 1, 39, 0, 39, {
+    424563368, 86188490, 1658927453, 258197189, 2127831219, 1182996208, 1940173820, 725057988,
+    2093209323, 957544737, 1563789965, 69534061, 2105508791, 3731171, 1398464112, 1275677674,
+    1799310138, 173740432, 1323182792, 1342725640, 49225413, 1499941477, 2100836785, 1134698736,
+    572925271, 1017395662, 1254276, 1396325888, 467596734, 1571929255, 360636265, 887430711,
+    1385265272, 1511447646, 77324864, 725616919, 1144023859, 118887534, 826033,
+} };
+inline const NUMBER init_q_one_pt_five_pi_16_256 = { 1, 39, 0, 39, {
+    1960753681, 172796809, 714336782, 1990737966, 206726414, 2038198404, 840552621, 827760108,
+    1980538556, 1462549391, 1170867936, 1637128419, 435277894, 1027018005, 264911153, 729504363,
+    905188468, 1995591330, 209737552, 1027917785, 1765435483, 2072980610, 1527808464, 709827164,
+    896944926, 1113654004, 1014361498, 87019295, 24021702, 1390217810, 259597065, 8631096,
+    2092123528, 2134442851, 1915779227, 825871993, 144864452, 1414241264, 175289,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_e_to_one_half_16_256 = { 1, 39, 0, 39, {
+    981193982, 1415908186, 2089700422, 2017074010, 1317229251, 2139031239, 780965575, 1240408536,
+    918091658, 839292487, 61649149, 1970742138, 1306577903, 1659404957, 38637572, 1491162404,
+    621353105, 1307221788, 1106729150, 1655569072, 1907899122, 1732630578, 541160356, 1539013930,
+    318538840, 153366095, 2065315757, 964444030, 510733593, 1213015798, 1296594714, 1599903491,
+    42685496, 1293880896, 367534686, 663922838, 1269163857, 103903523, 12238808,
+} };
+inline const NUMBER init_q_e_to_one_half_16_256 = { 1, 39, 0, 39, {
+    1416000181, 1466197972, 1720188068, 1750267376, 2097978168, 1348683241, 604745259, 1558596818,
+    2063163273, 1178432890, 276491494, 1601949611, 1140346798, 47628995, 418812030, 1465556812,
+    1579290108, 901643010, 667620076, 624493589, 577976388, 1914912968, 677649158, 1450276026,
+    894561331, 1095322934, 156377328, 1606601552, 798802687, 997661033, 1052407829, 1183261612,
+    1293149659, 242324911, 163495069, 2040810765, 281683862, 686513034, 7423212,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rat_exp_16_256 = { 1, 39, 0, 39, {
+    360913942, 274656253, 1686063949, 869877101, 1109306710, 1354549531, 452786339, 619485156,
+    1653347573, 1910664825, 1843387982, 1410553261, 8358117, 843947103, 619822542, 1222236075,
+    717336916, 2051126031, 1650780811, 714997790, 1264197721, 177782689, 899019671, 1019727322,
+    733919314, 1570753424, 171279789, 1702562722, 941045452, 1475142848, 628313264, 1041531158,
+    943705910, 952802123, 1199901911, 608755496, 1218468163, 468884005, 215317395,
+} };
+inline const NUMBER init_q_rat_exp_16_256 = { 1, 39, 0, 39, {
+    2071782367, 1460012038, 1524982302, 432806160, 1939800161, 2079955821, 1013874142, 2101209150,
+    1503072538, 2068932119, 2060193342, 167850731, 1462822344, 675026448, 304030239, 1010217090,
+    456656405, 961990880, 701195991, 4223519, 2130103654, 427745701, 281811456, 1640601838,
+    1721870915, 952595482, 1488796843, 1351482936, 225623544, 396343938, 357772772, 1554409094,
+    2016534531, 1385272398, 21574555, 576560968, 1850260003, 58870948, 79210843,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_ln_ten_16_256 = { 1, 39, 0, 39, {
+    691437826, 370489554, 1293873865, 373376514, 556848431, 393482950, 1040860528, 594491078,
+    1903879793, 421589366, 1210689828, 756333522, 552239726, 1800969027, 834460263, 779315558,
+    367936553, 345934050, 1981374650, 881049294, 2109082691, 901604647, 1100675012, 650126904,
+    2078139386, 742595964, 1740190605, 701328853, 985251283, 1917966239, 1834728308, 1825459677,
+    520558578, 1604324951, 567113177, 64943812, 1417341324, 1646785923, 17116,
+} };
+inline const NUMBER init_q_ln_ten_16_256 = { 1, 39, 0, 39, {
+    1306400346, 2044288027, 1724580928, 2116625727, 1116370684, 715727972, 690215070, 550155442,
+    1917029225, 242327917, 1293845248, 219422907, 1549143628, 2072918590, 1128333778, 1471776179,
+    1355692565, 1411586100, 582073536, 1235051787, 1091843610, 1339900740, 693594992, 642005978,
+    2058467172, 117967406, 914965715, 972362428, 1954702742, 2114361217, 162058689, 605124008,
+    2114556308, 843120145, 1589351325, 1662461542, 1027695132, 1540580224, 7433,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_ln_two_16_256 = { 1, 39, 0, 39, {
+    191614547, 2113150182, 598578550, 1675071174, 1082353998, 206430220, 916674601, 1463705860,
+    2064398321, 871850616, 1053463406, 736922346, 926076919, 648699803, 1984228940, 483967922,
+    638816301, 1662934839, 391129842, 1964635070, 679938648, 1161899755, 1610112802, 907447178,
+    430440105, 166733695, 802970293, 530457786, 238675133, 244005269, 1635462232, 99624794,
+    1730250955, 1030175428, 1568718589, 605641328, 1343850198, 197913383, 203062866,
+} };
+inline const NUMBER init_q_ln_two_16_256 = { 1, 39, 0, 39, {
+    1483257182, 122914347, 1452515534, 416112563, 264401372, 1095166148, 1441471401, 937949082,
+    596833888, 973374887, 2040703839, 499298898, 1209640336, 1819910397, 708309039, 498842120,
+    1570517481, 1239703545, 1048631671, 1359989399, 1783142986, 1440179459, 1123381758, 1672259676,
+    1013928963, 1697504840, 786285795, 273662387, 1196949405, 483071308, 163504526, 1973487951,
+    1665490983, 1889340948, 1847124295, 1145606516, 1319231681, 1932434075, 292957789,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rad_to_deg_16_256 = { 1, 39, 0, 39, {
+    1388679432, 1263046034, 71719618, 798388849, 224231105, 570661295, 1755096599, 1248922105,
+    54185990, 916898148, 2123592519, 1787640669, 891640619, 15700735, 569150832, 339039864,
+    1291161324, 1814244171, 689418843, 681154884, 1213651745, 423363517, 1387853792, 1082617033,
+    887048264, 2091455253, 2109527996, 886137383, 491258259, 1517850599, 1897799225, 1094911371,
+    1458150575, 1929329043, 1694270469, 977903403, 668509806, 1642692100, 53288,
+} };
+inline const NUMBER init_q_rad_to_deg_16_256 = { 1, 39, 0, 39, {
+    1654815362, 1515642898, 1940918648, 850054333, 172236419, 790675728, 379354164, 1478116897,
+    398383425, 350597942, 1282156495, 239190052, 1956975265, 1293726466, 2004005682, 1351949180,
+    476641330, 1599807226, 1639993984, 1743215325, 544829300, 17897259, 343100058, 789362274,
+    938651794, 901588748, 312612788, 470780739, 1491899775, 217198862, 1682675487, 212860094,
+    2001366378, 823513608, 1484025550, 458334662, 705342173, 138303297, 930,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rad_to_grad_16_256 = { 1, 39, 0, 39, {
+    827149264, 1880603071, 1988562818, 648489426, 964973555, 395458811, 518451567, 910472640,
+    298815950, 64338543, 450672890, 1031830234, 1706539682, 256054555, 393780519, 1331148137,
+    480186516, 822780386, 527411643, 1711275937, 871283350, 470403908, 587622592, 248470638,
+    269781300, 892183405, 2105310702, 1700424975, 1977498275, 732063488, 2108665806, 1216568190,
+    2097385894, 1666480348, 212257684, 609340749, 1220007262, 1586604150, 59209,
+} };
+inline const NUMBER init_q_rad_to_grad_16_256 = { 1, 39, 0, 39, {
+    1654815362, 1515642898, 1940918648, 850054333, 172236419, 790675728, 379354164, 1478116897,
+    398383425, 350597942, 1282156495, 239190052, 1956975265, 1293726466, 2004005682, 1351949180,
+    476641330, 1599807226, 1639993984, 1743215325, 544829300, 17897259, 343100058, 789362274,
+    938651794, 901588748, 312612788, 470780739, 1491899775, 217198862, 1682675487, 212860094,
+    2001366378, 823513608, 1484025550, 458334662, 705342173, 138303297, 930,
+} };
+// Autogenerated by _dumpconstants in support.cpp
+inline const RATCONSTTABLE init_ratconsttable_16_256 = {
+    16,
+    256,
+    {
+        { &init_p_pi_16_256, &init_q_pi_16_256 },
+        { &init_p_two_pi_16_256, &init_q_two_pi_16_256 },
+        { &init_p_pi_over_two_16_256, &init_q_pi_over_two_16_256 },
+        { &init_p_one_pt_five_pi_16_256, &init_q_one_pt_five_pi_16_256 },
+        { &init_p_e_to_one_half_16_256, &init_q_e_to_one_half_16_256 },
+        { &init_p_rat_exp_16_256, &init_q_rat_exp_16_256 },
+        { &init_p_ln_ten_16_256, &init_q_ln_ten_16_256 },
+        { &init_p_ln_two_16_256, &init_q_ln_two_16_256 },
+        { &init_p_rad_to_deg_16_256, &init_q_rad_to_deg_16_256 },
+        { &init_p_rad_to_grad_16_256, &init_q_rad_to_grad_16_256 },
+    }
+};
+
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_pi_16_512 = { 1, 76, 0, 76, {
+    18875596, 727609767, 73955946, 978167412, 871469478, 1807899890, 710460893, 916418,
+    25572635, 2119863164, 432962696, 1641530948, 1600653691, 330572809, 849690124, 707083147,
+    1097817020, 535407143, 549728642, 2048982004, 1014056274, 1449993004, 411096381, 1931033318,
+    2138699786, 100009427, 192172239, 1643450706, 1726784220, 67956778, 1917082773, 809235903,
+    952816425, 460327915, 1236107778, 1248802156, 231082006, 1510470933, 1189477698, 46410893,
+    130867466, 2108197186, 2074462265, 78399911, 836619975, 2049881987, 973651256, 2058298962,
+    91611968, 1390863225, 618567386, 1220263062, 1712048806, 498182475, 1724239377, 1311677209,
+    1263854943, 2123929962, 597736925, 2053294405, 640214074, 1281180639, 1639383199, 32154030,
+    1915082395, 2112919436, 1402704555, 199684168, 200628086, 1710524548, 1648096623, 1355840195,
+    1356397066, 2113007741, 354369233, 197,
+} };
+inline const NUMBER init_q_pi_16_512 = { 1, 76, 0, 76, {
+    438659962, 32142477, 1565316120, 164286291, 825970976, 913361462, 1750283120, 359083759,
+    1894446405, 426248320, 1236675859, 1744192919, 49706166, 458968865, 268228087, 520738790,
+    1439226751, 638966526, 335453862, 491407647, 563066757, 1872162190, 2013183190, 506015536,
+    1610790836, 1677539817, 914639342, 1594172212, 1397839502, 1843625397, 1591619030, 1842149922,
+    1583613727, 252988570, 1377869130, 1051663546, 398129337, 350200249, 625126842, 501595869,
+    1838430478, 2008693080, 881663204, 78477023, 1131840399, 586962249, 662761403, 1782464226,
+    914784999, 883601406, 1214791269, 883957512, 342481436, 1854293852, 548664035, 1910406629,
+    1118829202, 1380749877, 260713003, 527627516, 373681260, 888976776, 1197246440, 691221863,
+    1790112946, 1307424067, 833215854, 1011837295, 1289870062, 1573342896, 125050050, 865409833,
+    2088148481, 200768446, 1631172343, 62,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_two_pi_16_512 = { 1, 76, 0, 76, {
+    37751192, 1455219534, 147911892, 1956334824, 1742938956, 1468316132, 1420921787, 1832836,
+    51145270, 2092242680, 865925393, 1135578248, 1053823735, 661145619, 1699380248, 1414166294,
+    48150392, 1070814287, 1099457284, 1950480360, 2028112549, 752502360, 822192763, 1714582988,
+    2129915925, 200018855, 384344478, 1139417764, 1306084793, 135913557, 1686681898, 1618471807,
+    1905632850, 920655830, 324731908, 350120665, 462164013, 873458218, 231471749, 92821787,
+    261734932, 2068910724, 2001440883, 156799823, 1673239950, 1952280326, 1947302513, 1969114276,
+    183223937, 634242802, 1237134773, 293042476, 1276613965, 996364951, 1300995106, 475870771,
+    380226239, 2100376277, 1195473851, 1959105162, 1280428149, 414877630, 1131282751, 64308061,
+    1682681142, 2078355225, 657925463, 399368337, 401256172, 1273565448, 1148709599, 564196743,
+    565310485, 2078531835, 708738467, 394,
+} };
+inline const NUMBER init_q_two_pi_16_512 = { 1, 76, 0, 76, {
+    438659962, 32142477, 1565316120, 164286291, 825970976, 913361462, 1750283120, 359083759,
+    1894446405, 426248320, 1236675859, 1744192919, 49706166, 458968865, 268228087, 520738790,
+    1439226751, 638966526, 335453862, 491407647, 563066757, 1872162190, 2013183190, 506015536,
+    1610790836, 1677539817, 914639342, 1594172212, 1397839502, 1843625397, 1591619030, 1842149922,
+    1583613727, 252988570, 1377869130, 1051663546, 398129337, 350200249, 625126842, 501595869,
+    1838430478, 2008693080, 881663204, 78477023, 1131840399, 586962249, 662761403, 1782464226,
+    914784999, 883601406, 1214791269, 883957512, 342481436, 1854293852, 548664035, 1910406629,
+    1118829202, 1380749877, 260713003, 527627516, 373681260, 888976776, 1197246440, 691221863,
+    1790112946, 1307424067, 833215854, 1011837295, 1289870062, 1573342896, 125050050, 865409833,
+    2088148481, 200768446, 1631172343, 62,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_pi_over_two_16_512 = { 1, 76, 0, 76, {
+    18875596, 727609767, 73955946, 978167412, 871469478, 1807899890, 710460893, 916418,
+    25572635, 2119863164, 432962696, 1641530948, 1600653691, 330572809, 849690124, 707083147,
+    1097817020, 535407143, 549728642, 2048982004, 1014056274, 1449993004, 411096381, 1931033318,
+    2138699786, 100009427, 192172239, 1643450706, 1726784220, 67956778, 1917082773, 809235903,
+    952816425, 460327915, 1236107778, 1248802156, 231082006, 1510470933, 1189477698, 46410893,
+    130867466, 2108197186, 2074462265, 78399911, 836619975, 2049881987, 973651256, 2058298962,
+    91611968, 1390863225, 618567386, 1220263062, 1712048806, 498182475, 1724239377, 1311677209,
+    1263854943, 2123929962, 597736925, 2053294405, 640214074, 1281180639, 1639383199, 32154030,
+    1915082395, 2112919436, 1402704555, 199684168, 200628086, 1710524548, 1648096623, 1355840195,
+    1356397066, 2113007741, 354369233, 197,
+} };
+inline const NUMBER init_q_pi_over_two_16_512 = { 1, 76, 0, 76, {
+    877319924, 64284954, 983148592, 328572583, 1651941952, 1826722924, 1353082592, 718167519,
+    1641409162, 852496641, 325868070, 1340902191, 99412333, 917937730, 536456174, 1041477580,
+    730969854, 1277933053, 670907724, 982815294, 1126133514, 1596840732, 1878882733, 1012031073,
+    1074098024, 1207595987, 1829278685, 1040860776, 648195357, 1539767147, 1035754413, 1536816197,
+    1019743807, 505977141, 608254612, 2103327093, 796258674, 700400498, 1250253684, 1003191738,
+    1529377308, 1869902513, 1763326409, 156954046, 116197150, 1173924499, 1325522806, 1417444804,
+    1829569999, 1767202812, 282098890, 1767915025, 684962872, 1561104056, 1097328071, 1673329610,
+    90174757, 614016107, 521426007, 1055255032, 747362520, 1777953552, 247009232, 1382443727,
+    1432742244, 467364487, 1666431709, 2023674590, 432256476, 999202145, 250100101, 1730819666,
+    2028813314, 401536893, 1114861038, 125,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_one_pt_five_pi_16_512 = { 1, 76, 0, 76, {
+    1187963466, 418837577, 5299798, 1243309392, 1099083067, 1472990168, 2092348122, 2008036111,
+    720900009, 1755022231, 1551045594, 1440443604, 117186642, 171647893, 716389343, 1251600064,
+    2123927268, 954773928, 601066278, 1451352265, 204096828, 1350084579, 262786359, 1952578653,
+    177022434, 1962006171, 769013046, 1048969097, 29915753, 498330017, 303733482, 1770658470,
+    2128261661, 1723224309, 454341764, 126017205, 510154964, 327203370, 764429249, 963311772,
+    1762285469, 887364678, 735109298, 75666974, 1873407765, 1539534881, 1717697606, 1802579371,
+    1215945054, 873509451, 971416119, 437092307, 70255818, 440605938, 841494668, 138778745,
+    1272518792, 49108777, 1303728662, 511269352, 335729180, 851059724, 1815701509, 533605866,
+    1179622511, 514197725, 1602352339, 793359227, 1557289927, 1677794670, 1555474640, 1515056646,
+    1282430776, 386922109, 2098373668, 37121,
+} };
+inline const NUMBER init_q_one_pt_five_pi_16_512 = { 1, 76, 0, 76, {
+    1229457224, 727364393, 1649203945, 692972308, 729463118, 1347206444, 1964684569, 144251860,
+    652149905, 846101840, 459916477, 472311610, 853730483, 2036638184, 1863809392, 261652145,
+    2114905839, 1774963925, 2023099933, 1827719623, 1914571709, 348624532, 1746718035, 898372704,
+    1487401501, 723013390, 24923419, 1052322416, 1699402251, 355317341, 1490054693, 1820144819,
+    1699923147, 2082115037, 393636011, 638651537, 1140734371, 1176428283, 220050482, 591466714,
+    617481832, 1992986473, 867852497, 1983791875, 84043258, 430663890, 252220730, 1770728328,
+    1814280683, 532877138, 695839157, 1652130822, 433022252, 1053621075, 1987403606, 627825463,
+    247262303, 1260368205, 114814412, 558292164, 877909186, 702552075, 2113118858, 204314079,
+    1110901335, 1334045954, 1343464473, 1707600534, 1634321292, 1913955324, 827874893, 1553961910,
+    864799758, 295692798, 1134323208, 7877,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_e_to_one_half_16_512 = { 1, 76, 0, 76, {
+    1986180418, 499602533, 2046347782, 1441223742, 2139368805, 529444765, 492692131, 1042726934,
+    852981641, 642392253, 2145382372, 1989949254, 1767284169, 323689325, 1579745006, 1701553860,
+    1667994682, 387903395, 913382821, 1270077741, 1295779865, 246633861, 94766624, 1278335486,
+    1974770510, 1183768997, 540122138, 253749472, 582280671, 1124896784, 623385969, 1221124117,
+    1813342123, 140307712, 2146636350, 1098892732, 1978075924, 828798743, 1225003325, 50352728,
+    1434085992, 296598316, 1935096553, 680383222, 1369581458, 820781210, 38943158, 2084004701,
+    878327240, 1671750224, 1974253181, 1194804023, 1823209307, 60590973, 1487493536, 1569710912,
+    942765516, 807661174, 1780994422, 1460006093, 1144656875, 228731887, 110344329, 1281855790,
+    2006961620, 1469000930, 212682289, 398961385, 59411375, 856428934, 1595847621, 1124445288,
+    303631505, 663318980, 676024877, 16612838,
+} };
+inline const NUMBER init_q_e_to_one_half_16_512 = { 1, 76, 0, 76, {
+    57082107, 672072374, 1481037314, 1508181569, 2001596104, 1179778872, 1491873665, 249221011,
+    806150017, 663654683, 142176741, 1350920271, 255052584, 667794403, 662437587, 1289039624,
+    967379899, 995133811, 1839248812, 526265766, 136028336, 2055328899, 939957054, 1599232808,
+    674431043, 320032666, 27283510, 1574796411, 1302830982, 1254722024, 1256581272, 1891028691,
+    1290413387, 1983628827, 395725819, 933598252, 236814270, 1104247753, 443997220, 1835449666,
+    1890615249, 1388802531, 1910846017, 109358589, 1379810541, 1487058839, 1474418781, 992918912,
+    2043817079, 1969472479, 1167465153, 1429658514, 1731586441, 1655042360, 1525719306, 1879318125,
+    1614066483, 341894939, 1336224571, 394321890, 1232754651, 2034182105, 131518070, 1511141495,
+    2093449432, 1759163700, 917845225, 1513764958, 664100585, 613178014, 224803895, 1357170917,
+    467248500, 819462063, 1680994616, 10076195,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rat_exp_16_512 = { 1, 76, 0, 76, {
+    1373690457, 1772142970, 2111599670, 77377186, 769463260, 51951079, 1603283954, 732156313,
+    771816946, 1979622130, 771354844, 2040799816, 53718007, 1308228026, 2147314939, 770381434,
+    955654078, 935373687, 1501456751, 761763787, 1721576824, 1364610404, 1150206921, 404956184,
+    182378715, 654516099, 1494861767, 1107703487, 1111923758, 566165169, 217684958, 1579349532,
+    1609687138, 1301825503, 566731633, 1498548323, 248029451, 64534968, 1203426745, 846809407,
+    1891939078, 473984118, 356042906, 351218576, 485703081, 2070508174, 526706675, 51737518,
+    735108677, 1792525866, 1439189299, 2117468209, 2096319317, 821251125, 830961347, 701068946,
+    551080605, 829985570, 1475311338, 1252368600, 628363650, 536025513, 422378610, 66198558,
+    1083794514, 551790515, 953885987, 1503102444, 112452462, 499119707, 866286446, 26170647,
+    105874272, 838201842, 782371012, 25353037,
+} };
+inline const NUMBER init_q_rat_exp_16_512 = { 1, 76, 0, 76, {
+    893441671, 1116774034, 1351129395, 27564225, 374601428, 753912944, 1750921582, 1877208765,
+    674049198, 1204035776, 2085524775, 666473653, 1752754243, 1479648471, 1645958376, 824918924,
+    239112864, 1898269897, 1232911681, 1568272732, 679869136, 16939563, 777199733, 76703079,
+    651076017, 178376986, 495662097, 1287270885, 482279883, 981186588, 1036708293, 854105731,
+    836389406, 2028579656, 1555440057, 1819207664, 1013287722, 1186760527, 1379197157, 1548934923,
+    2131579107, 1748998123, 218254146, 281670886, 1690985546, 1546735934, 642486111, 1431227493,
+    706550759, 631655752, 660844994, 521644424, 1532480777, 1200287561, 1212722909, 2049954886,
+    610560370, 1159474455, 553359821, 557819718, 1191048442, 559627140, 740650049, 714130409,
+    1583529323, 412997742, 790252065, 832561613, 1534366498, 1686773664, 1818096225, 723032998,
+    1921968878, 739611694, 467259583, 9326861,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_ln_ten_16_512 = { 1, 76, 0, 76, {
+    275102058, 1220014391, 979310763, 1793861966, 535335435, 1729869106, 689220121, 513326566,
+    305282935, 486923733, 1801298327, 739223818, 70962152, 1501063200, 2028275584, 1520286948,
+    1622997436, 289472966, 1255519860, 187352788, 1897925922, 1079896076, 783103323, 1434782879,
+    42375194, 523666574, 1445322969, 1398627561, 1946046457, 1884846468, 2108508636, 94212400,
+    175669492, 1034898102, 1786800624, 741090509, 1360688177, 698472914, 1237249176, 357273426,
+    1571102119, 363232420, 981957823, 735592387, 1626385711, 1912836915, 344274749, 1024224106,
+    1981808034, 589414898, 1123780433, 1490196399, 1546323493, 1693528623, 1154329804, 2040056389,
+    1158583963, 2082443718, 522670161, 1515278515, 1797450666, 769414471, 933426653, 1408470234,
+    244832183, 143913220, 1356255684, 1993675202, 389128414, 1558555323, 1744099400, 1776198939,
+    1114464718, 1974753614, 1034979131, 55,
+} };
+inline const NUMBER init_q_ln_ten_16_512 = { 1, 76, 0, 76, {
+    1705043220, 1373562315, 2112850875, 2140446016, 1675003691, 403920721, 1005324492, 843893968,
+    1279662065, 1136301513, 1622576434, 783340522, 492348598, 1653508618, 523685418, 33278347,
+    769481729, 975349168, 2003196673, 488196914, 658258292, 1775051916, 1398316400, 65453323,
+    1760560107, 1116232275, 1207834173, 624043284, 1509633653, 235170305, 1294466294, 1089434734,
+    2093059276, 476383026, 1813336588, 2072340244, 659081940, 907412161, 122757926, 720154453,
+    1146970367, 235134510, 104917914, 120419739, 1402264269, 783066718, 138816945, 1303401624,
+    1346557858, 1326843222, 358423829, 1745026723, 246625138, 1671411250, 1570541734, 1028701757,
+    168726256, 853643408, 81357444, 1726140631, 1087084313, 1687126061, 1695131271, 737667143,
+    1487186281, 641009828, 1610746719, 1709002410, 732110404, 665838093, 880116932, 1636005119,
+    1895081501, 1267600244, 205094580, 24,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_ln_two_16_512 = { 1, 76, 0, 76, {
+    350613822, 413574191, 2115543592, 526768121, 1503857218, 170879800, 1337037646, 1259371235,
+    11532999, 285871409, 40457580, 1991279682, 1845939333, 1690860331, 2107519415, 1966280124,
+    733437367, 1309460549, 1997626644, 2113479256, 1102218256, 1329469852, 262162969, 378697957,
+    1678992702, 1669481931, 748332998, 360238795, 659962624, 4301432, 94771365, 391468648,
+    1056402000, 1782736370, 1572386459, 642814875, 337002163, 616409483, 1804635129, 1650584744,
+    288829057, 447313004, 285554947, 804676223, 1009246666, 913759368, 1536921251, 348470967,
+    467397190, 1382942547, 372634163, 428941305, 910376150, 479240604, 397144796, 959662234,
+    187879880, 694095943, 1436213070, 1487506351, 1495723401, 1207001985, 528912073, 347949452,
+    649095427, 1739968142, 1803062827, 1784350065, 1635475587, 835341466, 277267550, 1475441483,
+    493701617, 15731616, 216342567, 6580,
+} };
+inline const NUMBER init_q_ln_two_16_512 = { 1, 76, 0, 76, {
+    2012558612, 42579136, 936681990, 713268215, 1318420453, 213697641, 1092338941, 1316732254,
+    7179332, 1395042736, 367383896, 129281412, 334980527, 22227481, 1741740199, 392054464,
+    1473864207, 1756283614, 1448686462, 1739354929, 770068404, 759510451, 1855964567, 1687607904,
+    351725378, 92125543, 444405849, 1813299212, 15196921, 1889876362, 1006703172, 1237684469,
+    505571550, 1123300930, 137057781, 2050406451, 511414095, 1791716634, 118567540, 1273444135,
+    944755122, 628826725, 876045463, 415084797, 852472885, 414235504, 205976288, 370932332,
+    1225284982, 784624203, 1095673193, 798429508, 1681253509, 453324848, 1038473898, 1429482797,
+    298980100, 678382081, 859237958, 658006814, 2066597951, 934513121, 1101276597, 1508560465,
+    152811868, 1617047813, 1512585256, 517922002, 1666519609, 2140000353, 1964429668, 212124641,
+    1096363905, 1386925126, 169027471, 9493,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rad_to_deg_16_512 = { 1, 76, 0, 76, {
+    1649381832, 1490678600, 436543714, 1654245087, 498403981, 1196305981, 1518349068, 210567326,
+    1697936546, 1562770078, 1410838911, 422112915, 357175434, 1010017080, 1036415442, 1391185358,
+    1362777463, 1197341456, 252153069, 406546920, 420284845, 1981745159, 1595721492, 888483432,
+    32058042, 1309456475, 1426324452, 1335673052, 355523677, 1140089785, 876100370, 874504301,
+    1582629478, 440786124, 1055823901, 320877371, 796320364, 759019061, 853681893, 92943256,
+    205004290, 787501690, 1933070584, 1240962325, 1867808914, 426506162, 1185451949, 868497183,
+    1452542721, 134463204, 1766580046, 198562309, 1517116410, 912927948, 2122762295, 275809585,
+    1673277256, 1574358433, 1831184047, 483672389, 690633756, 1102029759, 755994474, 2013367504,
+    97783137, 1260614578, 1802482117, 1742086737, 248377260, 1881363500, 1034172651, 1154947294,
+    57088252, 1778582087, 1553245628, 11296,
+} };
+inline const NUMBER init_q_rad_to_deg_16_512 = { 1, 76, 0, 76, {
+    18875596, 727609767, 73955946, 978167412, 871469478, 1807899890, 710460893, 916418,
+    25572635, 2119863164, 432962696, 1641530948, 1600653691, 330572809, 849690124, 707083147,
+    1097817020, 535407143, 549728642, 2048982004, 1014056274, 1449993004, 411096381, 1931033318,
+    2138699786, 100009427, 192172239, 1643450706, 1726784220, 67956778, 1917082773, 809235903,
+    952816425, 460327915, 1236107778, 1248802156, 231082006, 1510470933, 1189477698, 46410893,
+    130867466, 2108197186, 2074462265, 78399911, 836619975, 2049881987, 973651256, 2058298962,
+    91611968, 1390863225, 618567386, 1220263062, 1712048806, 498182475, 1724239377, 1311677209,
+    1263854943, 2123929962, 597736925, 2053294405, 640214074, 1281180639, 1639383199, 32154030,
+    1915082395, 2112919436, 1402704555, 199684168, 200628086, 1710524548, 1648096623, 1355840195,
+    1356397066, 2113007741, 354369233, 197,
+} };
+// Autogenerated by _dumprawrat in support.cpp
+inline const NUMBER init_p_rad_to_grad_16_512 = { 1, 76, 0, 76, {
+    1832646480, 2133528144, 1678095042, 645003625, 1985437967, 136182396, 16789461, 949791579,
+    932158985, 1497801904, 374552319, 946232939, 1351298770, 1599459788, 2106009890, 1068542920,
+    82541416, 1091770102, 518779371, 1644765271, 944201749, 770283300, 1057195998, 271375931,
+    35620047, 500514462, 391758476, 1006862581, 395026308, 1505375722, 496226267, 1210280740,
+    1042649315, 1205590243, 695919079, 2026795472, 168972521, 1320573101, 471316848, 1534926050,
+    466391838, 159173995, 238981851, 663019146, 882296767, 1428332913, 1555778126, 10559693,
+    420889886, 626622149, 292601658, 697843377, 1924294194, 1491582975, 211141124, 1976720155,
+    427541185, 1272068560, 602993176, 298804472, 1721808017, 1701696098, 1078603154, 805419239,
+    1540303696, 1639292158, 1286930025, 503996165, 275974734, 1135966712, 1387690018, 1283274771,
+    1017868568, 1498983730, 1964437770, 12551,
+} };
+inline const NUMBER init_q_rad_to_grad_16_512 = { 1, 76, 0, 76, {
+    18875596, 727609767, 73955946, 978167412, 871469478, 1807899890, 710460893, 916418,
+    25572635, 2119863164, 432962696, 1641530948, 1600653691, 330572809, 849690124, 707083147,
+    1097817020, 535407143, 549728642, 2048982004, 1014056274, 1449993004, 411096381, 1931033318,
+    2138699786, 100009427, 192172239, 1643450706, 1726784220, 67956778, 1917082773, 809235903,
+    952816425, 460327915, 1236107778, 1248802156, 231082006, 1510470933, 1189477698, 46410893,
+    130867466, 2108197186, 2074462265, 78399911, 836619975, 2049881987, 973651256, 2058298962,
+    91611968, 1390863225, 618567386, 1220263062, 1712048806, 498182475, 1724239377, 1311677209,
+    1263854943, 2123929962, 597736925, 2053294405, 640214074, 1281180639, 1639383199, 32154030,
+    1915082395, 2112919436, 1402704555, 199684168, 200628086, 1710524548, 1648096623, 1355840195,
+    1356397066, 2113007741, 354369233, 197,
+} };
+// Autogenerated by _dumpconstants in support.cpp
+inline const RATCONSTTABLE init_ratconsttable_16_512 = {
+    16,
+    512,
+    {
+        { &init_p_pi_16_512, &init_q_pi_16_512 },
+        { &init_p_two_pi_16_512, &init_q_two_pi_16_512 },
+        { &init_p_pi_over_two_16_512, &init_q_pi_over_two_16_512 },
+        { &init_p_one_pt_five_pi_16_512, &init_q_one_pt_five_pi_16_512 },
+        { &init_p_e_to_one_half_16_512, &init_q_e_to_one_half_16_512 },
+        { &init_p_rat_exp_16_512, &init_q_rat_exp_16_512 },
+        { &init_p_ln_ten_16_512, &init_q_ln_ten_16_512 },
+        { &init_p_ln_two_16_512, &init_q_ln_two_16_512 },
+        { &init_p_rad_to_deg_16_512, &init_q_rad_to_deg_16_512 },
+        { &init_p_rad_to_grad_16_512, &init_q_rad_to_grad_16_512 },
+    }
+};
+
+// Autogenerated by ratconstgen
+inline const RATCONSTTABLE* const init_ratconsttables[] = {
+    &init_ratconsttable_2_32,
+    &init_ratconsttable_2_64,
+    &init_ratconsttable_2_128,
+    &init_ratconsttable_2_256,
+    &init_ratconsttable_2_512,
+    &init_ratconsttable_8_32,
+    &init_ratconsttable_8_64,
+    &init_ratconsttable_8_128,
+    &init_ratconsttable_8_256,
+    &init_ratconsttable_8_512,
+    &init_ratconsttable_10_32,
+    &init_ratconsttable_10_64,
+    &init_ratconsttable_10_128,
+    &init_ratconsttable_10_256,
+    &init_ratconsttable_10_512,
+    &init_ratconsttable_16_32,
+    &init_ratconsttable_16_64,
+    &init_ratconsttable_16_128,
+    &init_ratconsttable_16_256,
+    &init_ratconsttable_16_512,
+};
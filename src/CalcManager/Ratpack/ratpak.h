@@ -19,14 +19,19 @@
 
 #include <algorithm>
 #include <string>
+#include <vector>
 #include "CalcErr.h"
 #include <cstring>              // for memmove
 #include "sal_cross_platform.h" // for SAL
 
-static constexpr uint32_t BASEXPWR = 31L;     // Internal log2(BASEX)
-static constexpr uint32_t BASEX = 0x80000000; // Internal radix used in calculations, hope to raise
-                                              // this to 2^32 after solving scaling problems with
-                                              // overflow detection esp. in mul
+static constexpr uint32_t BASEXPWR = 32L;         // Internal log2(BASEX)
+static constexpr uint64_t BASEX = 0x100000000ULL; // Internal radix used in calculations, a digit
+                                                  // uses all the bits of a MANTTYPE
+
+// The ratconst tables and the Number mantissas of CalcEngine keep digits of
+// 2^31, the radix BASEX had before, see legacytonum and numtolegacy.
+static constexpr uint32_t LEGACYBASEXPWR = 31L;
+static constexpr uint32_t LEGACYBASEX = 0x80000000;
 
 typedef uint32_t MANTTYPE;
 typedef uint64_t TWO_MANTTYPE;
@@ -55,11 +60,13 @@ enum class AngleType
 #pragma warning(disable : 4200) // nonstandard extension used : zero-sized array in struct/union
 typedef struct _number
 {
-    int32_t sign;   // The sign of the mantissa, +1, or -1
-    int32_t cdigit; // The number of digits, or what passes for digits in the
-                    // radix being used.
-    int32_t exp;    // The offset of digits from the radix point
-                    // (decimal point in radix 10)
+    int32_t sign;      // The sign of the mantissa, +1, or -1
+    int32_t cdigit;    // The number of digits, or what passes for digits in the
+                       // radix being used.
+    int32_t exp;       // The offset of digits from the radix point
+                       // (decimal point in radix 10)
+    int32_t cdigitmax; // The number of digits allocated for mant, at least
+                       // cdigit, lets a number be reused for a new value.
     MANTTYPE mant[];
     // This is actually allocated as a continuation of the
     // NUMBER structure.
@@ -79,6 +86,39 @@ typedef struct _rat
     PNUMBER pq;
 } RAT, *PRAT;
 
+//-----------------------------------------------------------------------------
+//
+//  SCRATCH type holds the numbers the *_into functions build their results
+//  in. A result is swapped with the number it replaces, so a SCRATCH kept
+//  across a loop keeps recycling the same few allocations.
+//
+//-----------------------------------------------------------------------------
+
+typedef struct _scratch
+{
+    PNUMBER pnum; // Receives products and sums.
+    PNUMBER pbot; // Receives the common denominator of addrat_into.
+} SCRATCH, *PSCRATCH;
+
+//-----------------------------------------------------------------------------
+//
+//  DIGITSTREAM type is a long division of p by q, both already in the output
+//  radix, that hands out the digits of the quotient one at a time, most
+//  significant first. Only the digits asked for are ever divided out.
+//
+//-----------------------------------------------------------------------------
+
+typedef struct _digitstream
+{
+    uint32_t radix;
+    int32_t sign;                   // The sign of the quotient, +1, or -1
+    int32_t exp;                    // The radix exponent of the next digit
+    int32_t cdigit;                 // The digits left before RatToNumber stops dividing
+    PNUMBER rem;                    // What is left of p, aligned so the next digit is rem / q
+    PNUMBER scratch;                // Receives the next remainder, see addnum_into
+    std::vector<PNUMBER> multiples; // multiples[i] is i * q, for 0 <= i < radix
+} DIGITSTREAM, *PDIGITSTREAM;
+
 static constexpr uint32_t MAX_LONG_SIZE = 33; // Base 2 requires 32 'digits'
 
 //-----------------------------------------------------------------------------
@@ -130,10 +170,10 @@ extern PRAT rat_min_fact;
 extern PRAT rat_max_i32;
 extern PRAT rat_min_i32;
 
-// DUPNUM Duplicates a number taking care of allocation and internals
+// DUPNUM Duplicates a number taking care of allocation and internals,
+// the destination is reused when it is large enough.
 #define DUPNUM(a, b)                                                                                                                                           \
-    destroynum(a);                                                                                                                                             \
-    createnum(a, (b)->cdigit);                                                                                                                                 \
+    _reservenum(&(a), (b)->cdigit);                                                                                                                            \
     _dupnum(a, b);
 
 // DUPRAT Duplicates a rational taking care of allocation and internals
@@ -201,6 +241,11 @@ extern PRAT rat_min_i32;
 #define destroynum(x) _destroynum(x), (x) = nullptr
 #endif
 
+// destroyscratch frees the numbers held by a SCRATCH, it can be reused after.
+#define destroyscratch(s)                                                                                                                                      \
+    destroynum((s).pnum);                                                                                                                                      \
+    destroynum((s).pbot)
+
 //-----------------------------------------------------------------------------
 //
 //   Defines for checking when to stop taylor series expansions due to
@@ -254,7 +299,8 @@ extern PRAT rat_min_i32;
 //-----------------------------------------------------------------------------
 //
 //   Defines for setting up taylor series expansions for infinite precision
-//   functions.
+//   functions. The terms are built in a SCRATCH, so after the first few
+//   terms a whole series runs without allocating.
 //
 //-----------------------------------------------------------------------------
 
@@ -263,6 +309,7 @@ extern PRAT rat_min_i32;
     PNUMBER n2 = nullptr;                                                                                                                                      \
     PRAT pret = nullptr;                                                                                                                                       \
     PRAT thisterm = nullptr;                                                                                                                                   \
+    SCRATCH scratch = {};                                                                                                                                      \
     DUPRAT(xx, *px);                                                                                                                                           \
     mulrat(&xx, *px, precision);                                                                                                                               \
     createrat(pret);                                                                                                                                           \
@@ -273,6 +320,7 @@ extern PRAT rat_min_i32;
     destroynum(n2);                                                                                                                                            \
     destroyrat(xx);                                                                                                                                            \
     destroyrat(thisterm);                                                                                                                                      \
+    destroyscratch(scratch);                                                                                                                                   \
     destroyrat(*px);                                                                                                                                           \
     trimit(&pret, precision);                                                                                                                                  \
     *px = pret;
@@ -293,20 +341,21 @@ extern PRAT rat_min_i32;
 // MULNUM(b) is the rational equivalent of thisterm *= b where thisterm is
 // a rational and b is a number, NOTE this is a mixed type operation for
 // efficiency reasons.
-#define MULNUM(b) mulnumx(&(thisterm->pp), b);
+#define MULNUM(b) mulnumx_into(&(thisterm->pp), b, &(scratch.pnum));
 
 // DIVNUM(b) is the rational equivalent of thisterm /= b where thisterm is
 // a rational and b is a number, NOTE this is a mixed type operation for
 // efficiency reasons.
-#define DIVNUM(b) mulnumx(&(thisterm->pq), b);
+#define DIVNUM(b) mulnumx_into(&(thisterm->pq), b, &(scratch.pnum));
 
 // NEXTTERM(p,d) is the rational equivalent of
 // thisterm *= p
 // d    <d is usually an expansion of operations to get thisterm updated.>
 // pret += thisterm
+// thisterm is only kept to the digits that still reach pret, see termprecision.
 #define NEXTTERM(p, d, precision)                                                                                                                              \
-    mulrat(&thisterm, p, precision);                                                                                                                           \
-    d addrat(&pret, thisterm, precision)
+    mulrat_into(&thisterm, p, termprecision(pret, thisterm, precision), &scratch);                                                                             \
+    d addrat_into(&pret, thisterm, precision, &scratch)
 
 //-----------------------------------------------------------------------------
 //
@@ -320,6 +369,9 @@ extern bool g_ftrueinfinite; // set to true to allow infinite precision
 
 extern int32_t g_ratio; // Internally calculated ratio of internal radix
 
+extern uint32_t g_radix;    // Radix of the last ChangeConstants
+extern int32_t g_precision; // Precision of the last ChangeConstants
+
 //-----------------------------------------------------------------------------
 //
 //   External functions defined in the math package.
@@ -342,10 +394,18 @@ extern std::wstring NumberToString(_Inout_ PNUMBER& pnum, NumberFormat format, u
 extern std::wstring RatToString(_Inout_ PRAT& prat, NumberFormat format, uint32_t radix, int32_t precision);
 // converts a PRAT into a PNUMBER
 extern PNUMBER RatToNumber(_In_ PRAT prat, uint32_t radix, int32_t precision);
+// converts a PRAT into a PNUMBER holding only its leading cdigits digits
+extern PNUMBER RatToDigits(_In_ PRAT prat, uint32_t radix, int32_t precision, int32_t cdigits);
+// starts handing out the digits of a PRAT one at a time, see nextdigit
+extern PDIGITSTREAM createdigitstream(_In_ PRAT prat, uint32_t radix, int32_t precision);
+// returns the next digit of the stream, moredigits is false once RatToNumber would have stopped
+extern MANTTYPE nextdigit(_Inout_ PDIGITSTREAM pds);
+extern bool moredigits(_In_ PDIGITSTREAM pds);
+extern void destroydigitstream(_Inout_ PDIGITSTREAM& pds);
 // flattens a PRAT by converting it to a PNUMBER and back to a PRAT
 extern void flatrat(_Inout_ PRAT& prat, uint32_t radix, int32_t precision);
 
-extern int32_t numtoi32(_In_ PNUMBER pnum, uint32_t radix);
+extern int32_t numtoi32(_In_ PNUMBER pnum, uint64_t radix);
 extern int32_t rattoi32(_In_ PRAT prat, uint32_t radix, int32_t precision);
 uint64_t rattoUi64(_In_ PRAT prat, uint32_t radix, int32_t precision);
 extern PNUMBER _createnum(_In_ uint32_t size); // returns an empty number structure with size digits
@@ -362,9 +422,13 @@ StringToRat(bool mantissaIsNegative, std::wstring_view mantissa, bool exponentIs
 
 extern PNUMBER i32factnum(int32_t ini32, uint32_t radix);
 extern PNUMBER i32prodnum(int32_t start, int32_t stop, uint32_t radix);
-extern PNUMBER i32tonum(int32_t ini32, uint32_t radix);
-extern PNUMBER Ui32tonum(uint32_t ini32, uint32_t radix);
+extern PNUMBER i32tonum(int32_t ini32, uint64_t radix);
+extern PNUMBER Ui32tonum(uint32_t ini32, uint64_t radix);
 extern PNUMBER numtonRadixx(_In_ PNUMBER a, uint32_t radix);
+// converts a number in digits of LEGACYBASEX to internal radix
+extern PNUMBER legacytonum(int32_t sign, int32_t exp, _In_ const MANTTYPE* pmant, int32_t cdigit);
+// converts a number in internal radix to digits of LEGACYBASEX, returns the exponent
+extern int32_t numtolegacy(_In_ PNUMBER a, _Out_ std::vector<MANTTYPE>& mant);
 
 // creates a empty/undefined rational representation (p/q)
 extern PRAT _createrat(void);
@@ -440,15 +504,19 @@ extern void tanrat(_Inout_ PRAT* px, uint32_t radix, int32_t precision);
 extern void tananglerat(_Inout_ PRAT* px, AngleType angletype, uint32_t radix, int32_t precision);
 
 extern void _dupnum(_In_ PNUMBER dest, _In_ const NUMBER* const src);
+extern void _reservenum(_Inout_ PNUMBER* ppnum, uint32_t size);
 
 extern void _destroynum(_Frees_ptr_opt_ PNUMBER pnum);
 extern void _destroyrat(_Frees_ptr_opt_ PRAT prat);
-extern void addnum(_Inout_ PNUMBER* pa, _In_ PNUMBER b, uint32_t radix);
+extern void addnum(_Inout_ PNUMBER* pa, _In_ PNUMBER b, uint64_t radix);
+extern void addnum_into(_Inout_ PNUMBER* pa, _In_ PNUMBER b, uint64_t radix, _Inout_ PNUMBER* pscratch);
 extern void addrat(_Inout_ PRAT* pa, _In_ PRAT b, int32_t precision);
+extern void addrat_into(_Inout_ PRAT* pa, _In_ PRAT b, int32_t precision, _Inout_ PSCRATCH pscratch);
 extern void andrat(_Inout_ PRAT* pa, _In_ PRAT b, uint32_t radix, int32_t precision);
 extern void divnum(_Inout_ PNUMBER* pa, _In_ PNUMBER b, uint32_t radix, int32_t precision);
 extern void divnumx(_Inout_ PNUMBER* pa, _In_ PNUMBER b, int32_t precision);
 extern void divrat(_Inout_ PRAT* pa, _In_ PRAT b, int32_t precision);
+extern void divrat_into(_Inout_ PRAT* pa, _In_ PRAT b, int32_t precision, _Inout_ PSCRATCH pscratch);
 extern void fracrat(_Inout_ PRAT* pa, uint32_t radix, int32_t precision);
 extern void factrat(_Inout_ PRAT* pa, uint32_t radix, int32_t precision);
 extern void remrat(_Inout_ PRAT* pa, _In_ PRAT b);
@@ -457,7 +525,10 @@ extern void gcdrat(_Inout_ PRAT* pa, int32_t precision);
 extern void intrat(_Inout_ PRAT* px, uint32_t radix, int32_t precision);
 extern void mulnum(_Inout_ PNUMBER* pa, _In_ PNUMBER b, uint32_t radix);
 extern void mulnumx(_Inout_ PNUMBER* pa, _In_ PNUMBER b);
+extern void mulnumx_into(_Inout_ PNUMBER* pa, _In_ PNUMBER b, _Inout_ PNUMBER* pscratch);
+extern void _mulmantx(_In_ const MANTTYPE* pa, int32_t acdigit, _In_ const MANTTYPE* pb, int32_t bcdigit, _Inout_ MANTTYPE* pc);
 extern void mulrat(_Inout_ PRAT* pa, _In_ PRAT b, int32_t precision);
+extern void mulrat_into(_Inout_ PRAT* pa, _In_ PRAT b, int32_t precision, _Inout_ PSCRATCH pscratch);
 extern void numpowi32(_Inout_ PNUMBER* proot, int32_t power, uint32_t radix, int32_t precision);
 extern void numpowi32x(_Inout_ PNUMBER* proot, int32_t power);
 extern void orrat(_Inout_ PRAT* pa, _In_ PRAT b, uint32_t radix, int32_t precision);
@@ -465,11 +536,14 @@ extern void powrat(_Inout_ PRAT* pa, _In_ PRAT b, uint32_t radix, int32_t precis
 extern void powratNumeratorDenominator(_Inout_ PRAT* pa, _In_ PRAT b, uint32_t radix, int32_t precision);
 extern void powratcomp(_Inout_ PRAT* pa, _In_ PRAT b, uint32_t radix, int32_t precision);
 extern void ratpowi32(_Inout_ PRAT* proot, int32_t power, int32_t precision);
-extern void remnum(_Inout_ PNUMBER* pa, _In_ PNUMBER b, uint32_t radix);
+extern void remnum(_Inout_ PNUMBER* pa, _In_ PNUMBER b, uint64_t radix);
 extern void rootrat(_Inout_ PRAT* pa, _In_ PRAT b, uint32_t radix, int32_t precision);
+extern void rootrati32(_Inout_ PRAT* pa, int32_t n, uint32_t radix, int32_t precision);
+extern bool smallrootnum(_In_ PNUMBER num, _Out_ int32_t* proot);
 extern void scale2pi(_Inout_ PRAT* px, uint32_t radix, int32_t precision);
 extern void scale(_Inout_ PRAT* px, _In_ PRAT scalefact, uint32_t radix, int32_t precision);
 extern void subrat(_Inout_ PRAT* pa, _In_ PRAT b, int32_t precision);
+extern void subrat_into(_Inout_ PRAT* pa, _In_ PRAT b, int32_t precision, _Inout_ PSCRATCH pscratch);
 extern void xorrat(_Inout_ PRAT* pa, _In_ PRAT b, uint32_t radix, int32_t precision);
 extern void lshrat(_Inout_ PRAT* pa, _In_ PRAT b, uint32_t radix, int32_t precision);
 extern void rshrat(_Inout_ PRAT* pa, _In_ PRAT b, uint32_t radix, int32_t precision);
@@ -481,5 +555,7 @@ extern bool rat_lt(_In_ PRAT a, _In_ PRAT b, int32_t precision);
 extern bool rat_le(_In_ PRAT a, _In_ PRAT b, int32_t precision);
 extern void inbetween(_In_ PRAT* px, _In_ PRAT range, int32_t precision);
 extern void trimit(_Inout_ PRAT* px, int32_t precision);
+extern int32_t termprecision(_In_ PRAT pret, _In_ PRAT pterm, int32_t precision);
 extern void _dumprawrat(_In_ const wchar_t* varname, _In_ PRAT rat, std::wostream& out);
 extern void _dumprawnum(_In_ const wchar_t* varname, _In_ PNUMBER num, std::wostream& out);
+extern void _dumpconstants(uint32_t radix, int32_t precision, std::wostream& out);
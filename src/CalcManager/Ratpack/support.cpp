@@ -27,16 +27,33 @@ using namespace std;
 
 void _readconstants();
 
+// The constants that depend on the radix and the precision they were
+// calculated at, in the order they are kept in a RATCONSTTABLE.
+static constexpr int RATCONST_COUNT = 10;
+
+//----------------------------------------------------------------------------
+//
+//  RATCONSTTABLE type holds p and q of the constants ChangeConstants would
+//  calculate for one radix and precision, they are good for any precision
+//  up to the one they were calculated at.
+//
+//----------------------------------------------------------------------------
+
+typedef struct _ratconsttable
+{
+    uint32_t radix;
+    int32_t precision;
+    const NUMBER* constants[RATCONST_COUNT][2];
+} RATCONSTTABLE;
+
+#define WIDEN2(x) L##x
+#define WIDEN(x) WIDEN2(x)
+
 #if defined(GEN_CONST)
-static int cbitsofprecision = 0;
 #define READRAWRAT(v)
 #define READRAWNUM(v)
-#define DUMPRAWRAT(v) _dumprawrat(#v, v, wcout)
-#define DUMPRAWNUM(v)                                                                                                                                          \
-    fprintf(stderr, "// Autogenerated by _dumprawrat in support.cpp\n");                                                                                       \
-    fprintf(stderr, "inline const NUMBER init_" #v "= {\n");                                                                                                   \
-    _dumprawnum(v, wcout);                                                                                                                                     \
-    fprintf(stderr, "};\n")
+#define DUMPRAWRAT(v) _dumprawrat(WIDEN(#v), v, wcout)
+#define DUMPRAWNUM(v) _dumprawnum(WIDEN("init_" #v), v, wcout)
 
 #else
 
@@ -44,32 +61,38 @@ static int cbitsofprecision = 0;
 #define DUMPRAWNUM(v)
 #define READRAWRAT(v)                                                                                                                                          \
     createrat(v);                                                                                                                                              \
-    DUPNUM((v)->pp, (&(init_p_##v)));                                                                                                                          \
-    DUPNUM((v)->pq, (&(init_q_##v)));
-#define READRAWNUM(v) DUPNUM(v, (&(init_##v)))
+    (v)->pp = _readrawnum(&(init_p_##v));                                                                                                                      \
+    (v)->pq = _readrawnum(&(init_q_##v));
+#define READRAWNUM(v)                                                                                                                                          \
+    destroynum(v);                                                                                                                                             \
+    (v) = _readrawnum(&(init_##v));
+
+#include "ratconst.h"
+#include "ratconsttables.h"
+
+#endif
 
 #define INIT_AND_DUMP_RAW_NUM_IF_NULL(r, v)                                                                                                                    \
     if (r == nullptr)                                                                                                                                          \
     {                                                                                                                                                          \
         r = i32tonum(v, BASEX);                                                                                                                                \
-        DUMPRAWNUM(v);                                                                                                                                         \
+        DUMPRAWNUM(r);                                                                                                                                         \
     }
 #define INIT_AND_DUMP_RAW_RAT_IF_NULL(r, v)                                                                                                                    \
     if (r == nullptr)                                                                                                                                          \
     {                                                                                                                                                          \
         r = i32torat(v);                                                                                                                                       \
-        DUMPRAWRAT(v);                                                                                                                                         \
+        DUMPRAWRAT(r);                                                                                                                                         \
     }
 
-static constexpr int RATIO_FOR_DECIMAL = 9;
-static constexpr int DECIMAL = 10;
-static constexpr int CALC_DECIMAL_DIGITS_DEFAULT = 32;
-
-static int cbitsofprecision = RATIO_FOR_DECIMAL * DECIMAL * CALC_DECIMAL_DIGITS_DEFAULT;
+// Bits of precision the constants in use were calculated at, nothing is
+// calculated until the first ChangeConstants.
+static int cbitsofprecision = 0;
 
-#include "ratconst.h"
-
-#endif
+// Radix and precision of the last ChangeConstants, the series stop at this
+// precision. A radix of 0 until the first call.
+uint32_t g_radix = 0;
+int32_t g_precision = 0;
 
 bool g_ftrueinfinite = false; // Set to true if you don't want
                               // chopping internally
@@ -117,6 +140,148 @@ PRAT rat_min_fact = nullptr;
 PRAT rat_min_i32 = nullptr; // min signed i32
 PRAT rat_max_i32 = nullptr; // max signed i32
 
+// The constants of a RATCONSTTABLE, and their names in ratconsttables.h.
+static PRAT* const ratconsts[RATCONST_COUNT] = { &pi,     &two_pi, &pi_over_two, &one_pt_five_pi, &e_to_one_half,
+                                                 &rat_exp, &ln_ten, &ln_two,      &rad_to_deg,     &rad_to_grad };
+static const wchar_t* const ratconstnames[RATCONST_COUNT] = { L"pi",      L"two_pi", L"pi_over_two", L"one_pt_five_pi", L"e_to_one_half",
+                                                              L"rat_exp", L"ln_ten", L"ln_two",      L"rad_to_deg",     L"rad_to_grad" };
+
+//----------------------------------------------------------------------------
+//
+//  FUNCTION: _readrawnum
+//
+//  ARGUMENTS:  number of ratconst.h or ratconsttables.h.
+//
+//  RETURN: the number in internal radix, the constants are kept in digits
+//          of LEGACYBASEX so they outlive a change of BASEX.
+//
+//----------------------------------------------------------------------------
+
+static PNUMBER _readrawnum(_In_ const NUMBER* pnum)
+{
+    return legacytonum(pnum->sign, pnum->exp, pnum->mant, pnum->cdigit);
+}
+
+//----------------------------------------------------------------------------
+//
+//  FUNCTION: _findconstants
+//
+//  ARGUMENTS:  base changing to, and precision to use.
+//
+//  RETURN: The table calculated at the smallest precision at least as
+//          large as the one asked for, nullptr if no table has one.
+//
+//----------------------------------------------------------------------------
+
+static const RATCONSTTABLE* _findconstants(uint32_t radix, int32_t precision)
+{
+#if !defined(GEN_CONST)
+    // Tables are sorted by radix and then by precision.
+    for (const RATCONSTTABLE* ptable : init_ratconsttables)
+    {
+        if (ptable->radix == radix && ptable->precision >= precision)
+        {
+            return ptable;
+        }
+    }
+#endif
+    return nullptr;
+}
+
+//----------------------------------------------------------------------------
+//
+//  FUNCTION: _readtableconstants
+//
+//  ARGUMENTS:  table to read.
+//
+//  RETURN: None
+//
+//  SIDE EFFECTS: sets the constants that depend on radix and precision.
+//
+//----------------------------------------------------------------------------
+
+static void _readtableconstants(_In_ const RATCONSTTABLE* ptable)
+{
+    for (int i = 0; i < RATCONST_COUNT; i++)
+    {
+        PRAT& rat = *ratconsts[i];
+        if (rat == nullptr)
+        {
+            createrat(rat);
+        }
+        destroynum(rat->pp);
+        destroynum(rat->pq);
+        rat->pp = _readrawnum(ptable->constants[i][0]);
+        rat->pq = _readrawnum(ptable->constants[i][1]);
+    }
+}
+
+//----------------------------------------------------------------------------
+//
+//  FUNCTION: _computeconstants
+//
+//  ARGUMENTS:  base changing to, and precision to use.
+//
+//  RETURN: None
+//
+//  SIDE EFFECTS: calculates the constants that depend on radix and
+//  precision, the ones a RATCONSTTABLE holds.
+//
+//----------------------------------------------------------------------------
+
+static void _computeconstants(uint32_t radix, int32_t precision)
+{
+    cbitsofprecision = g_ratio * radix * precision;
+
+    // Apparently when dividing 180 by pi, another (internal) digit of
+    // precision is needed.
+    int32_t extraPrecision = precision + g_ratio;
+    DUPRAT(pi, rat_half);
+    asinrat(&pi, radix, extraPrecision);
+    mulrat(&pi, rat_six, extraPrecision);
+    DUMPRAWRAT(pi);
+
+    DUPRAT(two_pi, pi);
+    DUPRAT(pi_over_two, pi);
+    DUPRAT(one_pt_five_pi, pi);
+    addrat(&two_pi, pi, extraPrecision);
+    DUMPRAWRAT(two_pi);
+
+    divrat(&pi_over_two, rat_two, extraPrecision);
+    DUMPRAWRAT(pi_over_two);
+
+    addrat(&one_pt_five_pi, pi_over_two, extraPrecision);
+    DUMPRAWRAT(one_pt_five_pi);
+
+    DUPRAT(e_to_one_half, rat_half);
+    _exprat(&e_to_one_half, extraPrecision);
+    DUMPRAWRAT(e_to_one_half);
+
+    DUPRAT(rat_exp, rat_one);
+    _exprat(&rat_exp, extraPrecision);
+    DUMPRAWRAT(rat_exp);
+
+    // WARNING: remember lograt uses exponent constants calculated above...
+
+    DUPRAT(ln_ten, rat_ten);
+    lograt(&ln_ten, extraPrecision);
+    DUMPRAWRAT(ln_ten);
+
+    DUPRAT(ln_two, rat_two);
+    lograt(&ln_two, extraPrecision);
+    DUMPRAWRAT(ln_two);
+
+    destroyrat(rad_to_deg);
+    rad_to_deg = i32torat(180L);
+    divrat(&rad_to_deg, pi, extraPrecision);
+    DUMPRAWRAT(rad_to_deg);
+
+    destroyrat(rad_to_grad);
+    rad_to_grad = i32torat(200L);
+    divrat(&rad_to_grad, pi, extraPrecision);
+    DUMPRAWRAT(rad_to_grad);
+}
+
 //----------------------------------------------------------------------------
 //
 //  FUNCTION: ChangeConstants
@@ -137,12 +302,16 @@ void ChangeConstants(uint32_t radix, int32_t precision)
     // in translating from radix to BASEX and back.
 
     g_ratio = static_cast<int32_t>(ceil(BASEXPWR / log2(radix))) - 1;
+    g_radix = radix;
+    g_precision = precision;
 
     destroyrat(rat_nRadix);
     rat_nRadix = i32torat(radix);
 
-    // Check to see what we have to recalculate and what we don't
-    if (cbitsofprecision < (g_ratio * static_cast<int32_t>(radix) * precision))
+    // Check to see what we have to recalculate and what we don't, a table
+    // calculated at this precision or better is just copied.
+    const RATCONSTTABLE* ptable = _findconstants(radix, precision);
+    if (ptable == nullptr && cbitsofprecision < (g_ratio * static_cast<int32_t>(radix) * precision))
     {
         g_ftrueinfinite = false;
 
@@ -196,17 +365,17 @@ void ChangeConstants(uint32_t radix, int32_t precision)
         }
 
         DUPRAT(rat_qword, rat_two);
-        numpowi32(&(rat_qword->pp), 64, BASEX, precision);
+        numpowi32x(&(rat_qword->pp), 64);
         subrat(&rat_qword, rat_one, precision);
         DUMPRAWRAT(rat_qword);
 
         DUPRAT(rat_dword, rat_two);
-        numpowi32(&(rat_dword->pp), 32, BASEX, precision);
+        numpowi32x(&(rat_dword->pp), 32);
         subrat(&rat_dword, rat_one, precision);
         DUMPRAWRAT(rat_dword);
 
         DUPRAT(rat_max_i32, rat_two);
-        numpowi32(&(rat_max_i32->pp), 31, BASEX, precision);
+        numpowi32x(&(rat_max_i32->pp), 31);
         DUPRAT(rat_min_i32, rat_max_i32);
         subrat(&rat_max_i32, rat_one, precision); // rat_max_i32 = 2^31 -1
         DUMPRAWRAT(rat_max_i32);
@@ -218,59 +387,16 @@ void ChangeConstants(uint32_t radix, int32_t precision)
         rat_min_exp->pp->sign *= -1;
         DUMPRAWRAT(rat_min_exp);
 
-        cbitsofprecision = g_ratio * radix * precision;
-
-        // Apparently when dividing 180 by pi, another (internal) digit of
-        // precision is needed.
-        int32_t extraPrecision = precision + g_ratio;
-        DUPRAT(pi, rat_half);
-        asinrat(&pi, radix, extraPrecision);
-        mulrat(&pi, rat_six, extraPrecision);
-        DUMPRAWRAT(pi);
-
-        DUPRAT(two_pi, pi);
-        DUPRAT(pi_over_two, pi);
-        DUPRAT(one_pt_five_pi, pi);
-        addrat(&two_pi, pi, extraPrecision);
-        DUMPRAWRAT(two_pi);
-
-        divrat(&pi_over_two, rat_two, extraPrecision);
-        DUMPRAWRAT(pi_over_two);
-
-        addrat(&one_pt_five_pi, pi_over_two, extraPrecision);
-        DUMPRAWRAT(one_pt_five_pi);
-
-        DUPRAT(e_to_one_half, rat_half);
-        _exprat(&e_to_one_half, extraPrecision);
-        DUMPRAWRAT(e_to_one_half);
-
-        DUPRAT(rat_exp, rat_one);
-        _exprat(&rat_exp, extraPrecision);
-        DUMPRAWRAT(rat_exp);
-
-        // WARNING: remember lograt uses exponent constants calculated above...
-
-        DUPRAT(ln_ten, rat_ten);
-        lograt(&ln_ten, extraPrecision);
-        DUMPRAWRAT(ln_ten);
-
-        DUPRAT(ln_two, rat_two);
-        lograt(&ln_two, extraPrecision);
-        DUMPRAWRAT(ln_two);
-
-        destroyrat(rad_to_deg);
-        rad_to_deg = i32torat(180L);
-        divrat(&rad_to_deg, pi, extraPrecision);
-        DUMPRAWRAT(rad_to_deg);
-
-        destroyrat(rad_to_grad);
-        rad_to_grad = i32torat(200L);
-        divrat(&rad_to_grad, pi, extraPrecision);
-        DUMPRAWRAT(rad_to_grad);
+        _computeconstants(radix, precision);
     }
     else
     {
         _readconstants();
+        if (ptable != nullptr)
+        {
+            _readtableconstants(ptable);
+            cbitsofprecision = g_ratio * radix * ptable->precision;
+        }
 
         DUPRAT(rat_smallest, rat_nRadix);
         ratpowi32(&rat_smallest, -precision, precision);
@@ -311,6 +437,145 @@ void intrat(_Inout_ PRAT* px, uint32_t radix, int32_t precision)
     }
 }
 
+// Cross products up to this many digits are built on the stack by ratcmp,
+// larger ones fall back to subtracting the rationals.
+static constexpr int32_t RATCMPMAXDIGITS = 256;
+
+//---------------------------------------------------------------------------
+//
+//  FUNCTION: _cdigitnum
+//
+//  ARGUMENTS:  mantissa and its digit count
+//
+//  RETURN: the digit count without leading zero digits, at least 1.
+//
+//---------------------------------------------------------------------------
+
+static int32_t _cdigitnum(_In_ const MANTTYPE* pmant, int32_t cdigit)
+{
+    while (cdigit > 1 && pmant[cdigit - 1] == 0)
+    {
+        cdigit--;
+    }
+    return cdigit;
+}
+
+//---------------------------------------------------------------------------
+//
+//  FUNCTION: _cmpmant
+//
+//  ARGUMENTS:  two mantissas with their digit counts and exponents, the top
+//              digit of each is nonzero.
+//
+//  RETURN: -1, 0 or 1 as abs(a) is less than, equal to or greater than
+//          abs(b).
+//
+//---------------------------------------------------------------------------
+
+static int32_t _cmpmant(_In_ const MANTTYPE* pa, int32_t acdigit, int32_t aexp, _In_ const MANTTYPE* pb, int32_t bcdigit, int32_t bexp)
+{
+    if (acdigit + aexp != bcdigit + bexp)
+    {
+        return (acdigit + aexp < bcdigit + bexp) ? -1 : 1;
+    }
+
+    // The top digits line up, walk down until a digit differs, missing
+    // digits at the bottom of the shorter mantissa count as zeros.
+    for (int32_t ia = acdigit - 1, ib = bcdigit - 1; ia >= 0 || ib >= 0; ia--, ib--)
+    {
+        MANTTYPE da = (ia >= 0) ? pa[ia] : 0;
+        MANTTYPE db = (ib >= 0) ? pb[ib] : 0;
+        if (da != db)
+        {
+            return (da < db) ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+//---------------------------------------------------------------------------
+//
+//  FUNCTION: ratcmp
+//
+//  ARGUMENTS:  PRAT a, PRAT b and int32_t precision
+//
+//  RETURN: -1, 0 or 1 as a is less than, equal to or greater than b.
+//
+//  DESCRIPTION: Decides by the signs first, then by the LOGRAT2 magnitudes,
+//  a rational whose LOGRAT2 is at least 2 higher is always bigger in
+//  magnitude. Only when those don't tell are the cross products a.p*b.q
+//  and b.p*a.q compared, they are built in stack buffers so neither a
+//  nor b is copied or modified.
+//
+//---------------------------------------------------------------------------
+
+static int32_t ratcmp(_In_ PRAT a, _In_ PRAT b, int32_t precision)
+
+{
+    int32_t asign = zernum(a->pp) ? 0 : SIGN(a);
+    int32_t bsign = zernum(b->pp) ? 0 : SIGN(b);
+    if (asign != bsign)
+    {
+        return (asign < bsign) ? -1 : 1;
+    }
+    if (asign == 0)
+    {
+        return 0;
+    }
+
+    int32_t apcdigit = _cdigitnum(a->pp->mant, a->pp->cdigit);
+    int32_t aqcdigit = _cdigitnum(a->pq->mant, a->pq->cdigit);
+    int32_t bpcdigit = _cdigitnum(b->pp->mant, b->pp->cdigit);
+    int32_t bqcdigit = _cdigitnum(b->pq->mant, b->pq->cdigit);
+
+    // Compare magnitudes, then apply the common sign.
+    int32_t cmp;
+    int32_t logdiff = (apcdigit + a->pp->exp - aqcdigit - a->pq->exp) - (bpcdigit + b->pp->exp - bqcdigit - b->pq->exp);
+    if (logdiff >= 2 || logdiff <= -2)
+    {
+        cmp = (logdiff > 0) ? 1 : -1;
+    }
+    else if (_cmpmant(a->pq->mant, aqcdigit, a->pq->exp, b->pq->mant, bqcdigit, b->pq->exp) == 0)
+    {
+        // Same denominators, very common for integers.
+        cmp = _cmpmant(a->pp->mant, apcdigit, a->pp->exp, b->pp->mant, bpcdigit, b->pp->exp);
+    }
+    else if (apcdigit + bqcdigit <= RATCMPMAXDIGITS && bpcdigit + aqcdigit <= RATCMPMAXDIGITS)
+    {
+        MANTTYPE left[RATCMPMAXDIGITS];
+        MANTTYPE right[RATCMPMAXDIGITS];
+        memset(left, 0, sizeof(MANTTYPE) * (apcdigit + bqcdigit));
+        memset(right, 0, sizeof(MANTTYPE) * (bpcdigit + aqcdigit));
+        _mulmantx(a->pp->mant, apcdigit, b->pq->mant, bqcdigit, left);
+        _mulmantx(b->pp->mant, bpcdigit, a->pq->mant, aqcdigit, right);
+        cmp = _cmpmant(
+            left,
+            _cdigitnum(left, apcdigit + bqcdigit),
+            a->pp->exp + b->pq->exp,
+            right,
+            _cdigitnum(right, bpcdigit + aqcdigit),
+            b->pp->exp + a->pq->exp);
+    }
+    else
+    {
+        // Too big for the stack, subtract instead.
+        PRAT rattmp = nullptr;
+        DUPRAT(rattmp, a);
+        rattmp->pp->sign = 1;
+        rattmp->pq->sign = 1;
+        PRAT babs = nullptr;
+        DUPRAT(babs, b);
+        babs->pp->sign = -1;
+        babs->pq->sign = 1;
+        addrat(&rattmp, babs, precision);
+        cmp = zernum(rattmp->pp) ? 0 : SIGN(rattmp);
+        destroyrat(babs);
+        destroyrat(rattmp);
+    }
+
+    return cmp * asign;
+}
+
 //---------------------------------------------------------------------------
 //
 //  FUNCTION: rat_equ
@@ -325,13 +590,7 @@ void intrat(_Inout_ PRAT* px, uint32_t radix, int32_t precision)
 bool rat_equ(_In_ PRAT a, _In_ PRAT b, int32_t precision)
 
 {
-    PRAT rattmp = nullptr;
-    DUPRAT(rattmp, a);
-    rattmp->pp->sign *= -1;
-    addrat(&rattmp, b, precision);
-    bool bret = zernum(rattmp->pp);
-    destroyrat(rattmp);
-    return (bret);
+    return ratcmp(a, b, precision) == 0;
 }
 
 //---------------------------------------------------------------------------
@@ -348,14 +607,7 @@ bool rat_equ(_In_ PRAT a, _In_ PRAT b, int32_t precision)
 bool rat_ge(_In_ PRAT a, _In_ PRAT b, int32_t precision)
 
 {
-    PRAT rattmp = nullptr;
-    DUPRAT(rattmp, a);
-    b->pp->sign *= -1;
-    addrat(&rattmp, b, precision);
-    b->pp->sign *= -1;
-    bool bret = (zernum(rattmp->pp) || SIGN(rattmp) == 1);
-    destroyrat(rattmp);
-    return (bret);
+    return ratcmp(a, b, precision) >= 0;
 }
 
 //---------------------------------------------------------------------------
@@ -372,14 +624,7 @@ bool rat_ge(_In_ PRAT a, _In_ PRAT b, int32_t precision)
 bool rat_gt(_In_ PRAT a, _In_ PRAT b, int32_t precision)
 
 {
-    PRAT rattmp = nullptr;
-    DUPRAT(rattmp, a);
-    b->pp->sign *= -1;
-    addrat(&rattmp, b, precision);
-    b->pp->sign *= -1;
-    bool bret = (!zernum(rattmp->pp) && SIGN(rattmp) == 1);
-    destroyrat(rattmp);
-    return (bret);
+    return ratcmp(a, b, precision) > 0;
 }
 
 //---------------------------------------------------------------------------
@@ -396,14 +641,7 @@ bool rat_gt(_In_ PRAT a, _In_ PRAT b, int32_t precision)
 bool rat_le(_In_ PRAT a, _In_ PRAT b, int32_t precision)
 
 {
-    PRAT rattmp = nullptr;
-    DUPRAT(rattmp, a);
-    b->pp->sign *= -1;
-    addrat(&rattmp, b, precision);
-    b->pp->sign *= -1;
-    bool bret = (zernum(rattmp->pp) || SIGN(rattmp) == -1);
-    destroyrat(rattmp);
-    return (bret);
+    return ratcmp(a, b, precision) <= 0;
 }
 
 //---------------------------------------------------------------------------
@@ -420,14 +658,7 @@ bool rat_le(_In_ PRAT a, _In_ PRAT b, int32_t precision)
 bool rat_lt(_In_ PRAT a, _In_ PRAT b, int32_t precision)
 
 {
-    PRAT rattmp = nullptr;
-    DUPRAT(rattmp, a);
-    b->pp->sign *= -1;
-    addrat(&rattmp, b, precision);
-    b->pp->sign *= -1;
-    bool bret = (!zernum(rattmp->pp) && SIGN(rattmp) == -1);
-    destroyrat(rattmp);
-    return (bret);
+    return ratcmp(a, b, precision) < 0;
 }
 
 //---------------------------------------------------------------------------
@@ -444,13 +675,7 @@ bool rat_lt(_In_ PRAT a, _In_ PRAT b, int32_t precision)
 bool rat_neq(_In_ PRAT a, _In_ PRAT b, int32_t precision)
 
 {
-    PRAT rattmp = nullptr;
-    DUPRAT(rattmp, a);
-    rattmp->pp->sign *= -1;
-    addrat(&rattmp, b, precision);
-    bool bret = !(zernum(rattmp->pp));
-    destroyrat(rattmp);
-    return (bret);
+    return ratcmp(a, b, precision) != 0;
 }
 
 //---------------------------------------------------------------------------
@@ -565,15 +790,16 @@ void inbetween(_In_ PRAT* px, _In_ PRAT range, int32_t precision)
 //  ARGUMENTS:  const wchar *name of variable, PRAT x, output stream out
 //
 //  RETURN: none, prints the results of a dump of the internal structures
-//          of a PRAT, suitable for READRAWRAT to stderr.
+//          of a PRAT, suitable for READRAWRAT to out.
 //
 //---------------------------------------------------------------------------
 
 void _dumprawrat(_In_ const wchar_t* varname, _In_ PRAT rat, wostream& out)
 
 {
-    _dumprawnum(varname, rat->pp, out);
-    _dumprawnum(varname, rat->pq, out);
+    out << L"// Autogenerated by _dumprawrat in support.cpp\n";
+    _dumprawnum((wstring(L"init_p_") + varname).c_str(), rat->pp, out);
+    _dumprawnum((wstring(L"init_q_") + varname).c_str(), rat->pq, out);
 }
 
 //---------------------------------------------------------------------------
@@ -583,24 +809,63 @@ void _dumprawrat(_In_ const wchar_t* varname, _In_ PRAT rat, wostream& out)
 //  ARGUMENTS:  const wchar *name of variable, PNUMBER num, output stream out
 //
 //  RETURN: none, prints the results of a dump of the internal structures
-//          of a PNUMBER, suitable for READRAWNUM to stderr.
+//          of a PNUMBER in digits of LEGACYBASEX, suitable for READRAWNUM
+//          to out.
 //
 //---------------------------------------------------------------------------
 
 void _dumprawnum(_In_ const wchar_t* varname, _In_ PNUMBER num, wostream& out)
 
 {
-    out << L"NUMBER " << varname << L" = {\n";
-    out << L"\t" << num->sign << L",\n";
-    out << L"\t" << num->cdigit << L",\n";
-    out << L"\t" << num->exp << L",\n";
-    out << L"\t{ ";
+    vector<MANTTYPE> mant;
+    const int32_t exp = numtolegacy(num, mant);
+    const auto cdigit = static_cast<int32_t>(mant.size());
 
-    for (int i = 0; i < num->cdigit; i++)
+    // The second digit count is cdigitmax, the constant holds exactly its digits.
+    out << L"inline const NUMBER " << varname << L" = { " << num->sign << L", " << cdigit << L", " << exp << L", " << cdigit << L", {";
+
+    for (int i = 0; i < cdigit; i++)
     {
-        out << L" " << num->mant[i] << L",";
+        // Eight digits to a line keeps the long mantissas readable.
+        out << ((i % 8) ? L" " : L"\n    ") << mant[i] << L",";
     }
-    out << L"}\n";
+    out << L"\n} };\n";
+}
+
+//---------------------------------------------------------------------------
+//
+//  FUNCTION: _dumpconstants
+//
+//  ARGUMENTS:  radix and precision to calculate at, output stream out
+//
+//  RETURN: none, calculates the constants that depend on radix and
+//          precision and prints them, followed by the RATCONSTTABLE
+//          holding them, suitable for ratconsttables.h to out.
+//
+//---------------------------------------------------------------------------
+
+void _dumpconstants(uint32_t radix, int32_t precision, wostream& out)
+
+{
+    ChangeConstants(radix, precision);
+    _computeconstants(radix, precision);
+
+    const wstring suffix = L"_" + to_wstring(radix) + L"_" + to_wstring(precision);
+    for (int i = 0; i < RATCONST_COUNT; i++)
+    {
+        _dumprawrat((ratconstnames[i] + suffix).c_str(), *ratconsts[i], out);
+    }
+
+    out << L"// Autogenerated by _dumpconstants in support.cpp\n";
+    out << L"inline const RATCONSTTABLE init_ratconsttable" << suffix << L" = {\n";
+    out << L"    " << radix << L",\n";
+    out << L"    " << precision << L",\n";
+    out << L"    {\n";
+    for (int i = 0; i < RATCONST_COUNT; i++)
+    {
+        out << L"        { &init_p_" << ratconstnames[i] << suffix << L", &init_q_" << ratconstnames[i] << suffix << L" },\n";
+    }
+    out << L"    }\n";
     out << L"};\n";
 }
 
@@ -620,16 +885,6 @@ void _readconstants(void)
     READRAWRAT(rat_neg_one);
     READRAWRAT(rat_half);
     READRAWRAT(rat_ten);
-    READRAWRAT(pi);
-    READRAWRAT(two_pi);
-    READRAWRAT(pi_over_two);
-    READRAWRAT(one_pt_five_pi);
-    READRAWRAT(e_to_one_half);
-    READRAWRAT(rat_exp);
-    READRAWRAT(ln_ten);
-    READRAWRAT(ln_two);
-    READRAWRAT(rad_to_deg);
-    READRAWRAT(rad_to_grad);
     READRAWRAT(rat_qword);
     READRAWRAT(rat_dword);
     READRAWRAT(rat_word);
@@ -707,3 +962,40 @@ void trimit(_Inout_ PRAT* px, int32_t precision)
         pq->exp -= trim;
     }
 }
+
+// BASEX digits kept in a series term beyond the ones that reach the sum.
+static constexpr int32_t TERMGUARDDIGITS = 2;
+
+//---------------------------------------------------------------------------
+//
+//  FUNCTION: termprecision
+//
+//  ARGUMENTS:  PRAT pret, the sum of a series so far, PRAT pterm, its next
+//              term, and int32_t precision, the precision of the sum.
+//
+//  RETURN: the precision the term needs.
+//
+//  DESCRIPTION: A term k BASEX digits below the sum only changes the last
+//  precision - k*g_ratio digits of it, so the term and every smaller term
+//  computed from it can be trimmed to that many digits, plus
+//  TERMGUARDDIGITS, without changing the sum at precision. The tail of a
+//  series is mostly such terms, and they are the ones trimmit keeps at full
+//  precision for nothing.
+//
+//---------------------------------------------------------------------------
+
+int32_t termprecision(_In_ PRAT pret, _In_ PRAT pterm, int32_t precision)
+
+{
+    if (g_ftrueinfinite || zernum(pret->pp) || zernum(pterm->pp))
+    {
+        return precision;
+    }
+
+    const int32_t gap = LOGRAT2(pret) - LOGRAT2(pterm) - TERMGUARDDIGITS;
+    if (gap <= 0)
+    {
+        return precision;
+    }
+    return max(precision - gap * g_ratio, g_ratio);
+}
@@ -0,0 +1,612 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <algorithm>
+#include "ExpressionCommand.h"
+#include "StateSerializer.h"
+
+using namespace std;
+using namespace CalcEngine;
+using namespace CalculationManager;
+
+// Layout of a buffer, all the integers are little endian whatever the host is:
+//
+//   header     "CMST", uint16 major version, uint16 minor version, uint32 size of the whole buffer
+//   section    standard history, scientific history and memory, in that order
+//
+// Sections and history items are blocks, a uint32 byte count followed by the content, so a reader can step over
+// a block without decoding it and ignores the fields a newer minor version appended at the end of it.
+//
+//   history    uint32 item count, then one block per item:
+//              string expression, string result, uint32 token count, (string, int32 command index) per token,
+//              uint32 command count, (uint8 CommandType, payload) per command
+//   memory     uint32 count, rational per memory
+//   string     uint32 count of UTF-16 code units, uint16 per code unit
+//   rational   number p, number q
+//   number     int32 sign, int32 exp, uint32 limb count, uint32 per limb
+//
+// Command payloads:
+//   operand    uint8 flags, uint32 keystroke count, int32 per keystroke, rational if OPERAND_VALUE is set
+//   unary      uint32 command count, int32 per command
+//   binary     int32 command
+//   parens     int32 command
+namespace
+{
+    constexpr uint8_t MAGIC[] = { 'C', 'M', 'S', 'T' };
+    constexpr size_t HEADER_SIZE = sizeof(MAGIC) + 2 * sizeof(uint16_t) + sizeof(uint32_t);
+
+    constexpr uint8_t OPERAND_NEGATIVE = 0x1;
+    constexpr uint8_t OPERAND_DECIMAL = 0x2;
+    constexpr uint8_t OPERAND_SCIFMT = 0x4;
+    constexpr uint8_t OPERAND_VALUE = 0x8;
+
+    class StateWriter final : public ISerializeCommandVisitor
+    {
+    public:
+        vector<uint8_t>& Buffer()
+        {
+            return m_buffer;
+        }
+
+        void WriteUInt8(uint8_t value)
+        {
+            m_buffer.push_back(value);
+        }
+
+        void WriteUInt16(uint16_t value)
+        {
+            m_buffer.push_back(static_cast<uint8_t>(value));
+            m_buffer.push_back(static_cast<uint8_t>(value >> 8));
+        }
+
+        void WriteUInt32(uint32_t value)
+        {
+            for (int shift = 0; shift < 32; shift += 8)
+            {
+                m_buffer.push_back(static_cast<uint8_t>(value >> shift));
+            }
+        }
+
+        void WriteInt32(int32_t value)
+        {
+            WriteUInt32(static_cast<uint32_t>(value));
+        }
+
+        void WriteCount(size_t count)
+        {
+            WriteUInt32(static_cast<uint32_t>(count));
+        }
+
+        void WriteString(wstring_view str)
+        {
+            size_t countOffset = m_buffer.size();
+            WriteUInt32(0);
+
+            uint32_t units = 0;
+            for (wchar_t ch : str)
+            {
+                auto codePoint = static_cast<uint32_t>(ch);
+                if (codePoint > 0xFFFF)
+                {
+                    codePoint -= 0x10000;
+                    WriteUInt16(static_cast<uint16_t>(0xD800 + (codePoint >> 10)));
+                    WriteUInt16(static_cast<uint16_t>(0xDC00 + (codePoint & 0x3FF)));
+                    units += 2;
+                }
+                else
+                {
+                    WriteUInt16(static_cast<uint16_t>(codePoint));
+                    units++;
+                }
+            }
+
+            PatchUInt32(countOffset, units);
+        }
+
+        void WriteNumber(Number const& number)
+        {
+            WriteInt32(number.Sign());
+            WriteInt32(number.Exp());
+            WriteCount(number.Mantissa().size());
+            for (uint32_t limb : number.Mantissa())
+            {
+                WriteUInt32(limb);
+            }
+        }
+
+        void WriteRational(Rational const& rat)
+        {
+            WriteNumber(rat.P());
+            WriteNumber(rat.Q());
+        }
+
+        // Reserves the byte count of a block, EndBlock fills it in once the content is written
+        size_t BeginBlock()
+        {
+            size_t offset = m_buffer.size();
+            WriteUInt32(0);
+            return offset;
+        }
+
+        void EndBlock(size_t offset)
+        {
+            PatchUInt32(offset, static_cast<uint32_t>(m_buffer.size() - offset - sizeof(uint32_t)));
+        }
+
+        void PatchUInt32(size_t offset, uint32_t value)
+        {
+            for (int shift = 0; shift < 32; shift += 8)
+            {
+                m_buffer[offset++] = static_cast<uint8_t>(value >> shift);
+            }
+        }
+
+        void WriteHistory(vector<shared_ptr<HISTORYITEM>> const& history)
+        {
+            size_t section = BeginBlock();
+            WriteCount(history.size());
+
+            for (auto const& item : history)
+            {
+                size_t block = BeginBlock();
+                HISTORYITEMVECTOR& itemVector = item->historyItemVector;
+
+                WriteString(itemVector.expression);
+                WriteString(itemVector.result);
+
+                WriteCount(itemVector.spTokens->size());
+                for (auto const& token : *itemVector.spTokens)
+                {
+                    WriteString(token.first);
+                    WriteInt32(token.second);
+                }
+
+                WriteCount(itemVector.spCommands->size());
+                for (auto const& command : *itemVector.spCommands)
+                {
+                    WriteUInt8(static_cast<uint8_t>(command->GetCommandType()));
+                    command->Accept(*this);
+                }
+
+                EndBlock(block);
+            }
+
+            EndBlock(section);
+        }
+
+        void Visit(_In_ COpndCommand& opndCmd) override
+        {
+            uint8_t flags = (opndCmd.IsNegative() ? OPERAND_NEGATIVE : 0) | (opndCmd.IsDecimalPresent() ? OPERAND_DECIMAL : 0)
+                            | (opndCmd.IsSciFmt() ? OPERAND_SCIFMT : 0) | (opndCmd.HasValue() ? OPERAND_VALUE : 0);
+            WriteUInt8(flags);
+
+            const auto& commands = opndCmd.GetCommands();
+            WriteCount(commands->size());
+            for (int command : *commands)
+            {
+                WriteInt32(command);
+            }
+
+            if (opndCmd.HasValue())
+            {
+                WriteRational(opndCmd.GetValue());
+            }
+        }
+
+        void Visit(_In_ CUnaryCommand& unaryCmd) override
+        {
+            const auto& commands = unaryCmd.GetCommands();
+            WriteCount(commands->size());
+            for (int command : *commands)
+            {
+                WriteInt32(command);
+            }
+        }
+
+        void Visit(_In_ CBinaryCommand& binaryCmd) override
+        {
+            WriteInt32(binaryCmd.GetCommand());
+        }
+
+        void Visit(_In_ CParentheses& paraCmd) override
+        {
+            WriteInt32(paraCmd.GetCommand());
+        }
+
+    private:
+        vector<uint8_t> m_buffer;
+    };
+
+    // Reads straight out of the caller's bytes, every read is checked against the end of the current block
+    class StateReader
+    {
+    public:
+        StateReader(const uint8_t* begin, const uint8_t* end)
+            : m_current(begin)
+            , m_end(end)
+        {
+        }
+
+        size_t Remaining() const
+        {
+            return static_cast<size_t>(m_end - m_current);
+        }
+
+        bool ReadUInt8(uint8_t& value)
+        {
+            if (Remaining() < 1)
+            {
+                return false;
+            }
+
+            value = *m_current++;
+            return true;
+        }
+
+        bool ReadUInt16(uint16_t& value)
+        {
+            if (Remaining() < 2)
+            {
+                return false;
+            }
+
+            value = static_cast<uint16_t>(m_current[0] | (m_current[1] << 8));
+            m_current += 2;
+            return true;
+        }
+
+        bool ReadUInt32(uint32_t& value)
+        {
+            if (Remaining() < 4)
+            {
+                return false;
+            }
+
+            value = static_cast<uint32_t>(m_current[0]) | (static_cast<uint32_t>(m_current[1]) << 8) | (static_cast<uint32_t>(m_current[2]) << 16)
+                    | (static_cast<uint32_t>(m_current[3]) << 24);
+            m_current += 4;
+            return true;
+        }
+
+        bool ReadInt32(int32_t& value)
+        {
+            uint32_t bits;
+            if (!ReadUInt32(bits))
+            {
+                return false;
+            }
+
+            value = static_cast<int32_t>(bits);
+            return true;
+        }
+
+        // Reads an element count, refusing counts the rest of the block could not hold with elementSize bytes each
+        bool ReadCount(uint32_t& count, size_t elementSize)
+        {
+            return ReadUInt32(count) && count <= Remaining() / elementSize;
+        }
+
+        bool ReadString(wstring& str)
+        {
+            uint32_t units;
+            if (!ReadCount(units, sizeof(uint16_t)))
+            {
+                return false;
+            }
+
+            str.clear();
+            str.reserve(units);
+            for (uint32_t i = 0; i < units; i++)
+            {
+                uint16_t unit = 0;
+                ReadUInt16(unit);
+
+                if constexpr (sizeof(wchar_t) > sizeof(uint16_t))
+                {
+                    uint16_t low = 0;
+                    if (unit >= 0xD800 && unit < 0xDC00 && i + 1 < units && PeekUInt16(low) && low >= 0xDC00 && low < 0xE000)
+                    {
+                        ReadUInt16(low);
+                        i++;
+                        str += static_cast<wchar_t>(0x10000 + ((unit - 0xD800) << 10) + (low - 0xDC00));
+                        continue;
+                    }
+                }
+
+                str += static_cast<wchar_t>(unit);
+            }
+
+            return true;
+        }
+
+        bool ReadNumber(Number& number)
+        {
+            int32_t sign, exp;
+            uint32_t limbCount;
+            if (!ReadInt32(sign) || !ReadInt32(exp) || !ReadCount(limbCount, sizeof(uint32_t)) || (sign != 1 && sign != -1) || limbCount == 0)
+            {
+                return false;
+            }
+
+            vector<uint32_t> mantissa(limbCount);
+            for (uint32_t& limb : mantissa)
+            {
+                ReadUInt32(limb);
+                if (limb >= LEGACYBASEX)
+                {
+                    return false;
+                }
+            }
+
+            number = Number(sign, exp, mantissa);
+            return true;
+        }
+
+        bool ReadRational(Rational& rat)
+        {
+            Number p, q;
+            if (!ReadNumber(p) || !ReadNumber(q) || q.IsZero())
+            {
+                return false;
+            }
+
+            rat = Rational(p, q);
+            return true;
+        }
+
+        // Splits the next block off this reader, whatever the block reader leaves unread is skipped
+        bool ReadBlock(StateReader& block)
+        {
+            uint32_t size;
+            if (!ReadUInt32(size) || size > Remaining())
+            {
+                return false;
+            }
+
+            block = StateReader(m_current, m_current + size);
+            m_current += size;
+            return true;
+        }
+
+        bool ReadHistory(vector<shared_ptr<HISTORYITEM>>& history)
+        {
+            StateReader section(nullptr, nullptr);
+            uint32_t itemCount;
+            if (!ReadBlock(section) || !section.ReadCount(itemCount, sizeof(uint32_t)))
+            {
+                return false;
+            }
+
+            history.clear();
+            history.reserve(itemCount);
+            for (uint32_t i = 0; i < itemCount; i++)
+            {
+                StateReader block(nullptr, nullptr);
+                auto item = make_shared<HISTORYITEM>();
+                if (!section.ReadBlock(block) || !block.ReadHistoryItem(item->historyItemVector))
+                {
+                    return false;
+                }
+
+                history.push_back(move(item));
+            }
+
+            return true;
+        }
+
+        bool ReadMemory(vector<Rational>& memorizedNumbers)
+        {
+            StateReader section(nullptr, nullptr);
+            uint32_t count;
+            if (!ReadBlock(section) || !section.ReadCount(count, 2 * 4 * sizeof(uint32_t)))
+            {
+                return false;
+            }
+
+            memorizedNumbers.clear();
+            memorizedNumbers.reserve(count);
+            for (uint32_t i = 0; i < count; i++)
+            {
+                Rational rat;
+                if (!section.ReadRational(rat))
+                {
+                    return false;
+                }
+
+                memorizedNumbers.push_back(move(rat));
+            }
+
+            return true;
+        }
+
+    private:
+        bool PeekUInt16(uint16_t& value) const
+        {
+            StateReader peek(m_current, m_end);
+            return peek.ReadUInt16(value);
+        }
+
+        bool ReadHistoryItem(HISTORYITEMVECTOR& itemVector)
+        {
+            uint32_t tokenCount;
+            if (!ReadString(itemVector.expression) || !ReadString(itemVector.result) || !ReadCount(tokenCount, 2 * sizeof(uint32_t)))
+            {
+                return false;
+            }
+
+            itemVector.spTokens = make_shared<vector<pair<wstring, int>>>(tokenCount);
+            for (auto& token : *itemVector.spTokens)
+            {
+                if (!ReadString(token.first) || !ReadInt32(token.second))
+                {
+                    return false;
+                }
+            }
+
+            uint32_t commandCount;
+            if (!ReadCount(commandCount, sizeof(uint8_t) + sizeof(uint32_t)))
+            {
+                return false;
+            }
+
+            itemVector.spCommands = make_shared<vector<shared_ptr<IExpressionCommand>>>();
+            itemVector.spCommands->reserve(commandCount);
+            for (uint32_t i = 0; i < commandCount; i++)
+            {
+                shared_ptr<IExpressionCommand> command = ReadCommand();
+                if (command == nullptr)
+                {
+                    return false;
+                }
+
+                itemVector.spCommands->push_back(move(command));
+            }
+
+            return true;
+        }
+
+        shared_ptr<IExpressionCommand> ReadCommand()
+        {
+            uint8_t type;
+            if (!ReadUInt8(type))
+            {
+                return nullptr;
+            }
+
+            switch (static_cast<CommandType>(type))
+            {
+            case CommandType::OperandCommand:
+            {
+                uint8_t flags;
+                uint32_t count;
+                if (!ReadUInt8(flags) || !ReadCount(count, sizeof(int32_t)))
+                {
+                    return nullptr;
+                }
+
+                CPackedCommands commands;
+                for (uint32_t i = 0; i < count; i++)
+                {
+                    int32_t command = 0;
+                    ReadInt32(command);
+                    commands.push_back(command);
+                }
+
+                auto operand = make_shared<COpndCommand>(
+                    move(commands), (flags & OPERAND_NEGATIVE) != 0, (flags & OPERAND_DECIMAL) != 0, (flags & OPERAND_SCIFMT) != 0);
+                if ((flags & OPERAND_VALUE) != 0)
+                {
+                    Rational value;
+                    if (!ReadRational(value))
+                    {
+                        return nullptr;
+                    }
+
+                    operand->Initialize(value);
+                }
+
+                return operand;
+            }
+
+            case CommandType::UnaryCommand:
+            {
+                uint32_t count;
+                int32_t command1, command2;
+                if (!ReadCount(count, sizeof(int32_t)) || !ReadInt32(command1))
+                {
+                    return nullptr;
+                }
+
+                if (count == 1)
+                {
+                    return make_shared<CUnaryCommand>(command1);
+                }
+
+                if (count == 2 && ReadInt32(command2))
+                {
+                    return make_shared<CUnaryCommand>(command1, command2);
+                }
+
+                return nullptr;
+            }
+
+            case CommandType::BinaryCommand:
+            {
+                int32_t command;
+                return ReadInt32(command) ? make_shared<CBinaryCommand>(command) : nullptr;
+            }
+
+            case CommandType::Parentheses:
+            {
+                int32_t command;
+                return ReadInt32(command) ? make_shared<CParentheses>(command) : nullptr;
+            }
+
+            default:
+                return nullptr;
+            }
+        }
+
+        const uint8_t* m_current;
+        const uint8_t* m_end;
+    };
+}
+
+vector<uint8_t> StateSerializer::Serialize(CalculatorState const& state)
+{
+    StateWriter writer;
+
+    for (uint8_t ch : MAGIC)
+    {
+        writer.WriteUInt8(ch);
+    }
+    writer.WriteUInt16(MAJOR_VERSION);
+    writer.WriteUInt16(MINOR_VERSION);
+    writer.WriteUInt32(0);
+
+    writer.WriteHistory(state.standardHistory);
+    writer.WriteHistory(state.scientificHistory);
+
+    size_t memory = writer.BeginBlock();
+    writer.WriteCount(state.memorizedNumbers.size());
+    for (auto const& rat : state.memorizedNumbers)
+    {
+        writer.WriteRational(rat);
+    }
+    writer.EndBlock(memory);
+
+    vector<uint8_t>& buffer = writer.Buffer();
+    writer.PatchUInt32(HEADER_SIZE - sizeof(uint32_t), static_cast<uint32_t>(buffer.size()));
+    return move(buffer);
+}
+
+bool StateSerializer::Deserialize(_In_ const uint8_t* data, size_t size, _Inout_ CalculatorState& state)
+{
+    if (data == nullptr || size < HEADER_SIZE || !equal(begin(MAGIC), end(MAGIC), data))
+    {
+        return false;
+    }
+
+    StateReader header(data + sizeof(MAGIC), data + HEADER_SIZE);
+    uint16_t majorVersion, minorVersion;
+    uint32_t totalSize;
+    header.ReadUInt16(majorVersion);
+    header.ReadUInt16(minorVersion);
+    header.ReadUInt32(totalSize);
+    if (majorVersion != MAJOR_VERSION || totalSize < HEADER_SIZE || totalSize > size)
+    {
+        return false;
+    }
+
+    // A mapped file can be longer than the buffer it holds, only the bytes the header accounts for are read
+    StateReader reader(data + HEADER_SIZE, data + totalSize);
+    CalculatorState restored;
+    if (!reader.ReadHistory(restored.standardHistory) || !reader.ReadHistory(restored.scientificHistory)
+        || !reader.ReadMemory(restored.memorizedNumbers))
+    {
+        return false;
+    }
+
+    state = move(restored);
+    return true;
+}
@@ -0,0 +1,34 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstdint>
+#include "CalculatorHistory.h"
+#include "Header Files/Rational.h"
+
+namespace CalculationManager
+{
+    // History of both modes and the memory list, the part of the calculator state that outlives a session.
+    struct CalculatorState
+    {
+        std::vector<std::shared_ptr<HISTORYITEM>> standardHistory;
+        std::vector<std::shared_ptr<HISTORYITEM>> scientificHistory;
+        std::vector<CalcEngine::Rational> memorizedNumbers;
+    };
+
+    namespace StateSerializer
+    {
+        // Buffers with another major version are refused, a minor version only appends fields that older readers skip.
+        inline constexpr uint16_t MAJOR_VERSION = 1;
+        inline constexpr uint16_t MINOR_VERSION = 0;
+
+        // Writes the state into one self contained little endian buffer. Rationals are stored as their mantissa limbs and
+        // operands keep their value, so nothing has to be evaluated again when the buffer is read back.
+        std::vector<uint8_t> Serialize(CalculatorState const& state);
+
+        // Reads a buffer written by Serialize in place, data can point straight into a mapped file. Returns false and leaves
+        // state untouched when the buffer is truncated, corrupt, or was written with another major version.
+        bool Deserialize(_In_ const uint8_t* data, size_t size, _Inout_ CalculatorState& state);
+    }
+}
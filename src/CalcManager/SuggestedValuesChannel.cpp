@@ -0,0 +1,69 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "SuggestedValuesChannel.h"
+
+using namespace std;
+using namespace UnitConversionManager;
+
+SuggestedValuesChannel::SuggestedValuesChannel(Clock::duration debounceInterval)
+    : m_debounceInterval(debounceInterval)
+    , m_pending(nullptr)
+    , m_lastPublished(0)
+{
+}
+
+SuggestedValuesChannel::~SuggestedValuesChannel()
+{
+    delete m_pending.exchange(nullptr);
+}
+
+/// <summary>
+/// Replaces the pending snapshot with the given suggested values, a snapshot the consumer has not taken yet is dropped.
+/// </summary>
+/// <param name="suggestedValues">suggested values to publish, moved into the channel</param>
+/// <param name="now">time of the publication, the debounce interval is measured from it</param>
+/// <returns>true if no snapshot was pending, the consumer has to be scheduled to take the new one</returns>
+bool SuggestedValuesChannel::Publish(Snapshot&& suggestedValues, Clock::time_point now)
+{
+    auto snapshot = make_unique<Snapshot>(move(suggestedValues));
+
+    // The time is stored first so that a consumer seeing the new snapshot also sees when it was published
+    m_lastPublished.store(now.time_since_epoch().count(), memory_order_release);
+    unique_ptr<Snapshot> previous{ m_pending.exchange(snapshot.release(), memory_order_acq_rel) };
+    return previous == nullptr;
+}
+
+/// <summary>
+/// Takes the pending snapshot if nothing was published during the last debounce interval.
+/// </summary>
+/// <param name="now">current time</param>
+/// <param name="remaining">receives how long to wait before trying again, zero when there is nothing to wait for</param>
+/// <returns>the snapshot, or nullptr when there is none or it is still too recent</returns>
+unique_ptr<const SuggestedValuesChannel::Snapshot> SuggestedValuesChannel::TryTake(Clock::time_point now, _Out_ Clock::duration& remaining)
+{
+    remaining = Clock::duration::zero();
+    if (m_pending.load(memory_order_acquire) == nullptr)
+    {
+        return nullptr;
+    }
+
+    const Clock::time_point lastPublished{ Clock::duration{ m_lastPublished.load(memory_order_acquire) } };
+    const Clock::duration elapsed = now - lastPublished;
+    if (elapsed < m_debounceInterval)
+    {
+        remaining = m_debounceInterval - elapsed;
+        return nullptr;
+    }
+
+    return Take();
+}
+
+/// <summary>
+/// Takes the pending snapshot immediately, ignoring the debounce interval.
+/// </summary>
+/// <returns>the snapshot, or nullptr when there is none</returns>
+unique_ptr<const SuggestedValuesChannel::Snapshot> SuggestedValuesChannel::Take()
+{
+    return unique_ptr<const Snapshot>{ m_pending.exchange(nullptr, memory_order_acq_rel) };
+}
@@ -0,0 +1,39 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include "UnitConverter.h"
+
+namespace UnitConversionManager
+{
+    // Hands the suggested values computed by the converter to the UI without locks.
+    // The producer publishes whole snapshots, only the most recent one is kept, and the consumer
+    // takes ownership of it once no newer snapshot has been published for the debounce interval.
+    // Ownership of a snapshot moves with the pointer exchanged out of the channel, so a snapshot
+    // is never read and freed concurrently.
+    class SuggestedValuesChannel
+    {
+    public:
+        using Snapshot = std::vector<std::tuple<std::wstring, Unit>>;
+        using Clock = std::chrono::steady_clock;
+
+        explicit SuggestedValuesChannel(Clock::duration debounceInterval);
+        ~SuggestedValuesChannel();
+
+        SuggestedValuesChannel(const SuggestedValuesChannel&) = delete;
+        SuggestedValuesChannel& operator=(const SuggestedValuesChannel&) = delete;
+
+        bool Publish(Snapshot&& suggestedValues, Clock::time_point now = Clock::now());
+        std::unique_ptr<const Snapshot> TryTake(Clock::time_point now, _Out_ Clock::duration& remaining);
+        std::unique_ptr<const Snapshot> Take();
+
+    private:
+        const Clock::duration m_debounceInterval;
+        std::atomic<Snapshot*> m_pending;
+        std::atomic<Clock::rep> m_lastPublished;
+    };
+}
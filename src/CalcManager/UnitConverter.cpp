@@ -1,15 +1,20 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+#include <array>
 #include <cassert>
 #include <cmath>
 #include <sstream>
-#include <algorithm> // for std::sort
+#include <algorithm> // for std::partial_sort
+#include <iomanip>   // for std::setprecision
 #include "Command.h"
 #include "UnitConverter.h"
 #include "NumberFormattingUtils.h"
+#include "BatchConversion.h"
+#include "Header Files/RationalMath.h"
 
 using namespace std;
+using namespace CalcEngine;
 using namespace UnitConversionManager;
 using namespace UnitConversionManager::NumberFormattingUtils;
 
@@ -20,16 +25,142 @@ static constexpr uint32_t EXPECTEDMAPCOMPONENTTOKENCOUNT = 2U;
 
 static constexpr uint32_t MAXIMUMDIGITSALLOWED = 15U;
 static constexpr uint32_t OPTIMALDIGITSALLOWED = 7U;
+static constexpr uint32_t MAXIMUMEXACTMANTISSADIGITS = 19U;  // the largest mantissa that always fits in a uint64_t
+static constexpr uint32_t MAXIMUMEXACTEXPONENTDIGITS = 4U;
+static constexpr int32_t SCIENTIFICMANTISSADECIMALS = 6;      // matches the default precision used by ToScientificNumber
+static constexpr uint32_t MAXIMUMSUGGESTEDVALUES = 10U;
 
 static constexpr wchar_t LEFTESCAPECHAR = L'{';
 static constexpr wchar_t RIGHTESCAPECHAR = L'}';
 
 static const double OPTIMALDECIMALALLOWED = 1e-6;  // pow(10, -1 * (OPTIMALDIGITSALLOWED - 1));
 static const double MINIMUMDECIMALALLOWED = 1e-14; // pow(10, -1 * (MAXIMUMDIGITSALLOWED - 1));
+static const double SUGGESTEDVALUEZEROLIMIT = 0.005; // suggested values below it are rounded to 0.00
 
 unordered_map<wchar_t, wstring> quoteConversions;
 unordered_map<wstring, wchar_t> unquoteConversions;
 
+namespace
+{
+    Rational PowerOfTen(int32_t exponent)
+    {
+        Rational result{ 1 };
+        Rational base{ 10 };
+        for (uint32_t remaining = static_cast<uint32_t>(abs(exponent)); remaining != 0; remaining >>= 1)
+        {
+            if (remaining & 1)
+            {
+                result *= base;
+            }
+
+            if (remaining > 1)
+            {
+                base *= base;
+            }
+        }
+
+        return exponent < 0 ? RationalMath::Invert(result) : result;
+    }
+
+    // Formats value rounded to the given number of decimals into display, reusing the storage display already has
+    void AssignRoundedValue(wstring& display, double value, unsigned int decimals)
+    {
+        array<wchar_t, FORMATTEDNUMBERBUFFERSIZE> buffer;
+        if (const size_t length = RoundSignificantDigits(value, decimals, buffer.data(), buffer.size()); length != 0)
+        {
+            display.assign(buffer.data(), length);
+        }
+        else
+        {
+            display = RoundSignificantDigits(value, decimals);
+        }
+    }
+
+    // Formats value in scientific notation into display, reusing the storage display already has
+    void AssignScientificValue(wstring& display, double value)
+    {
+        array<wchar_t, FORMATTEDNUMBERBUFFERSIZE> buffer;
+        if (const size_t length = ToScientificNumber(value, buffer.data(), buffer.size()); length != 0)
+        {
+            display.assign(buffer.data(), length);
+        }
+        else
+        {
+            display = ToScientificNumber(value);
+        }
+    }
+
+    // Rounds a suggested value to two decimals below 100, one below 1000 and none above that, without trailing zeros
+    wstring FormatSuggestedValue(double value)
+    {
+        wstring roundedString;
+        if (abs(value) < 100)
+        {
+            roundedString = RoundSignificantDigits(value, 2U);
+        }
+        else if (abs(value) < 1000)
+        {
+            roundedString = RoundSignificantDigits(value, 1U);
+        }
+        else
+        {
+            roundedString = RoundSignificantDigits(value, 0U);
+        }
+
+        TrimTrailingZeros(roundedString);
+        return roundedString;
+    }
+
+    // Rounds a non-negative rational to the nearest integer, halfway cases are rounded up.
+    // The double approximation of the value is used as a first guess that is then corrected with exact
+    // comparisons, which is much cheaper than extracting the integer part of the rational.
+    uint64_t RoundToUInt64(Rational const& value, double approximation)
+    {
+        static constexpr int MAXIMUMCORRECTIONS = 4;
+        const Rational shifted = value + Rational{ 1 } / Rational{ 2 };
+
+        uint64_t result = approximation > 0 && approximation < 1e18 ? static_cast<uint64_t>(approximation + 0.5) : 0;
+        for (int i = 0; i < MAXIMUMCORRECTIONS; i++)
+        {
+            if (result > 0 && Rational{ result } > shifted)
+            {
+                result--;
+            }
+            else if (Rational{ result + 1 } <= shifted)
+            {
+                result++;
+            }
+            else
+            {
+                return result;
+            }
+        }
+
+        // The approximation was too far off, fall back to the integer part of the rational
+        return RationalMath::Integer(shifted).ToUInt64_t();
+    }
+}
+
+/// <summary>
+/// Returns the ratios of LoadOrderedRatios as exact rationals, each double is replaced
+/// by the shortest decimal that converts back to it.
+/// </summary>
+/// <param name="u">Unit to load the ratios for</param>
+unordered_map<Unit, ExactConversionData, UnitHash> IConverterDataLoader::LoadOrderedExactRatios(const Unit& u)
+{
+    unordered_map<Unit, ExactConversionData, UnitHash> exactRatios;
+    for (const auto& [unit, conversionData] : LoadOrderedRatios(u))
+    {
+        exactRatios.emplace(
+            unit,
+            ExactConversionData{ UnitConverter::DoubleToExactDecimal(conversionData.ratio),
+                                 UnitConverter::DoubleToExactDecimal(conversionData.offset),
+                                 conversionData.offsetFirst });
+    }
+
+    return exactRatios;
+}
+
 /// <summary>
 /// Constructor, sets up all the variables and requires a configLoader
 /// </summary>
@@ -48,6 +179,7 @@ UnitConverter::UnitConverter(_In_ const shared_ptr<IConverterDataLoader>& dataLo
 {
     m_dataLoader = dataLoader;
     m_currencyDataLoader = currencyDataLoader;
+    m_exactConversionMode = false;
     // declaring the delimiter character conversion map
     quoteConversions[L'|'] = L"{p}";
     quoteConversions[L'['] = L"{lc}";
@@ -605,114 +737,470 @@ double UnitConverter::Convert(double value, const ConversionData& conversionData
 }
 
 /// <summary>
-/// Calculates the suggested values for the current display value and returns them as a vector
+/// Converts an exact value into another unit type
 /// </summary>
-vector<tuple<wstring, Unit>> UnitConverter::CalculateSuggested()
+/// <param name="value">rational input value to convert</param>
+/// <param name="conversionData">exact offset and ratio to use</param>
+Rational UnitConverter::Convert(const Rational& value, const ExactConversionData& conversionData)
 {
-    if (m_currencyDataLoader != nullptr && m_currencyDataLoader->SupportsCategory(m_currentCategory))
+    if (conversionData.offsetFirst)
     {
-        return vector<tuple<wstring, Unit>>();
+        return (value + conversionData.offset) * conversionData.ratio;
     }
+    else
+    {
+        return (value * conversionData.ratio) + conversionData.offset;
+    }
+}
 
-    vector<tuple<wstring, Unit>> returnVector;
-    vector<SuggestedValueIntermediate> intermediateVector;
-    vector<SuggestedValueIntermediate> intermediateWhimsicalVector;
-    unordered_map<Unit, ConversionData, UnitHash> ratios = m_ratioMap[m_fromType];
-    // Calculate converted values for every other unit type in this category, along with their magnitude
-    for (const auto& cur : ratios)
-    {
-        if (cur.first != m_fromType && cur.first != m_toType)
-        {
-            double convertedValue = Convert(stod(m_currentDisplay), cur.second);
-            SuggestedValueIntermediate newEntry;
-            newEntry.magnitude = log10(convertedValue);
-            newEntry.value = convertedValue;
-            newEntry.type = cur.first;
-            if (newEntry.type.isWhimsical)
-                intermediateWhimsicalVector.push_back(newEntry);
-            else
-                intermediateVector.push_back(newEntry);
+/// <summary>
+/// Enables or disables the exact conversion mode. In exact mode the result is converted and
+/// rounded on rationals instead of doubles, so it is not subject to binary rounding errors.
+/// Currency conversions always use the double path.
+/// </summary>
+/// <param name="isExactConversionMode">whether the exact conversion mode should be used</param>
+void UnitConverter::SetExactConversionMode(bool isExactConversionMode)
+{
+    // Ratpak constants are normally initialized by the calculator engine,
+    // the converter can be used before any engine has been created.
+    // Once an engine has initialized them they are left alone: the exact path only adds, multiplies,
+    // divides, compares and truncates rationals, and the integer constants it needs are the same for
+    // every radix and precision. The radix of the engine only moves where trimit cuts a rational of
+    // RATIONAL_PRECISION digits, far past the digits of a converted value. Calling ChangeConstants
+    // again would change the radix and precision under an engine in programmer mode.
+    if (isExactConversionMode && rat_one == nullptr)
+    {
+        ChangeConstants(RATIONAL_BASE, RATIONAL_PRECISION);
+    }
+
+    m_exactConversionMode = isExactConversionMode;
+    m_exactResultKey.clear();
+}
+
+bool UnitConverter::IsExactConversionMode() const
+{
+    return m_exactConversionMode;
+}
+
+/// <summary>
+/// Converts a batch of values between two units of the same category, independently of the display state.
+/// Returns false if there is no conversion data between the two units.
+/// </summary>
+/// <param name="values">values to convert</param>
+/// <param name="count">number of values</param>
+/// <param name="fromType">unit of the input values</param>
+/// <param name="toType">unit to convert the values to</param>
+/// <param name="results">receives the count converted values</param>
+bool UnitConverter::ConvertMany(_In_ const double* values, size_t count, const Unit& fromType, const Unit& toType, _Out_ double* results)
+{
+    auto fromItr = m_ratioMap.find(fromType);
+    if (fromItr == m_ratioMap.end())
+    {
+        return false;
+    }
+
+    auto conversionData = fromItr->second.find(toType);
+    if (conversionData == fromItr->second.end())
+    {
+        return false;
+    }
+
+    BatchConversion::Convert(values, count, conversionData->second, results);
+    return true;
+}
+
+/// <summary>
+/// Converts a batch of values to every unit the source unit can be converted to.
+/// </summary>
+/// <param name="values">values to convert</param>
+/// <param name="count">number of values</param>
+/// <param name="fromType">unit of the input values</param>
+unordered_map<Unit, vector<double>, UnitHash> UnitConverter::ConvertManyToAllUnits(_In_ const double* values, size_t count, const Unit& fromType)
+{
+    unordered_map<Unit, vector<double>, UnitHash> results;
+    auto fromItr = m_ratioMap.find(fromType);
+    if (fromItr == m_ratioMap.end())
+    {
+        return results;
+    }
+
+    vector<ConversionData> conversions;
+    vector<double*> outputs;
+    conversions.reserve(fromItr->second.size());
+    outputs.reserve(fromItr->second.size());
+    for (const auto& [unit, conversionData] : fromItr->second)
+    {
+        vector<double>& output = results[unit];
+        output.resize(count);
+        conversions.push_back(conversionData);
+        outputs.push_back(output.data());
+    }
+
+    BatchConversion::ConvertToMany(values, count, conversions.data(), conversions.size(), outputs.data());
+    return results;
+}
+
+/// <summary>
+/// Parses a decimal number of the form [-]ddd.ddd[e[+|-]ddd] into an exact rational.
+/// Returns false if the string is not such a number or has too many significant digits.
+/// </summary>
+/// <param name="s">the string to parse</param>
+/// <param name="value">receives the parsed value</param>
+bool UnitConverter::TryParseExactDecimal(wstring_view s, Rational& value)
+{
+    size_t i = 0;
+    bool isNegative = false;
+    if (i < s.size() && (s[i] == L'-' || s[i] == L'+'))
+    {
+        isNegative = s[i] == L'-';
+        i++;
+    }
+
+    uint64_t mantissa = 0;
+    uint32_t mantissaDigits = 0;
+    int32_t exponent = 0;
+    bool hasDigits = false;
+    bool hasDecimal = false;
+    for (; i < s.size() && s[i] != L'e' && s[i] != L'E'; i++)
+    {
+        if (s[i] == L'.')
+        {
+            if (hasDecimal)
+            {
+                return false;
+            }
+
+            hasDecimal = true;
+            continue;
+        }
+
+        if (s[i] < L'0' || s[i] > L'9')
+        {
+            return false;
+        }
+
+        hasDigits = true;
+        if (mantissa != 0 || s[i] != L'0')
+        {
+            if (++mantissaDigits > MAXIMUMEXACTMANTISSADIGITS)
+            {
+                return false;
+            }
+
+            mantissa = mantissa * 10 + (s[i] - L'0');
+        }
+
+        if (hasDecimal)
+        {
+            exponent--;
         }
     }
 
-    // Sort the resulting list by absolute magnitude, breaking ties by choosing the positive value
-    sort(intermediateVector.begin(), intermediateVector.end(), [](SuggestedValueIntermediate first, SuggestedValueIntermediate second) {
-        if (abs(first.magnitude) == abs(second.magnitude))
+    if (!hasDigits)
+    {
+        return false;
+    }
+
+    if (i < s.size())
+    {
+        // Skip the 'e' and read the exponent
+        i++;
+        bool isExponentNegative = false;
+        if (i < s.size() && (s[i] == L'-' || s[i] == L'+'))
         {
-            return first.magnitude > second.magnitude;
+            isExponentNegative = s[i] == L'-';
+            i++;
         }
-        else
+
+        if (i == s.size() || s.size() - i > MAXIMUMEXACTEXPONENTDIGITS)
         {
-            return abs(first.magnitude) < abs(second.magnitude);
+            return false;
+        }
+
+        int32_t exponentValue = 0;
+        for (; i < s.size(); i++)
+        {
+            if (s[i] < L'0' || s[i] > L'9')
+            {
+                return false;
+            }
+
+            exponentValue = exponentValue * 10 + (s[i] - L'0');
         }
-    });
 
-    // Now that the list is sorted, iterate over it and populate the return vector with properly rounded and formatted return strings
-    for (const auto& entry : intermediateVector)
+        exponent += isExponentNegative ? -exponentValue : exponentValue;
+    }
+
+    Rational result{ mantissa };
+    if (mantissa != 0)
     {
-        wstring roundedString;
-        if (abs(entry.value) < 100)
+        result *= PowerOfTen(exponent);
+        if (isNegative)
         {
-            roundedString = RoundSignificantDigits(entry.value, 2U);
+            result = -result;
         }
-        else if (abs(entry.value) < 1000)
+    }
+
+    value = result;
+    return true;
+}
+
+/// <summary>
+/// Returns the shortest decimal that converts back to the given double. For ratios that were
+/// written as decimal constants this recovers the constant itself.
+/// </summary>
+/// <param name="value">the double to convert</param>
+Rational UnitConverter::DoubleToExactDecimal(double value)
+{
+    // 17 significant digits are always enough to round-trip a double
+    for (int precision = 0; precision < 17; precision++)
+    {
+        wstringstream out(wstringstream::out);
+        out << scientific << setprecision(precision) << value;
+        wstring decimal = out.str();
+
+        Rational result;
+        if (stod(decimal) == value && TryParseExactDecimal(decimal, result))
         {
-            roundedString = RoundSignificantDigits(entry.value, 1U);
+            return result;
         }
-        else
+    }
+
+    return Rational{};
+}
+
+/// <summary>
+/// Returns the exact conversion data between two units, loading the exact ratios of the source unit on first use.
+/// </summary>
+const ExactConversionData* UnitConverter::GetExactConversionData(const Unit& fromType, const Unit& toType)
+{
+    auto itr = m_exactRatioMap.find(fromType);
+    if (itr == m_exactRatioMap.end())
+    {
+        shared_ptr<IConverterDataLoader> activeDataLoader = GetDataLoaderForCategory(m_currentCategory);
+        if (activeDataLoader == nullptr)
         {
-            roundedString = RoundSignificantDigits(entry.value, 0U);
+            return nullptr;
         }
-        if (stod(roundedString) != 0.0 || m_currentCategory.supportsNegative)
+
+        itr = m_exactRatioMap.emplace(fromType, activeDataLoader->LoadOrderedExactRatios(fromType)).first;
+    }
+
+    auto conversionData = itr->second.find(toType);
+    return conversionData == itr->second.end() ? nullptr : &conversionData->second;
+}
+
+/// <summary>
+/// Calculates the return display with exact arithmetic.
+/// Returns false if the current display can't be handled exactly, in which case the double path is used.
+/// </summary>
+/// <param name="approximateValue">the result of the double conversion, only used as a starting point</param>
+/// <param name="returnDisplay">receives the formatted result</param>
+bool UnitConverter::TryCalculateExact(double approximateValue, wstring& returnDisplay)
+{
+    wstring resultKey = to_wstring(m_fromType.id);
+    resultKey.append(1, L';').append(to_wstring(m_toType.id)).append(1, L';').append(m_currentDisplay);
+    if (resultKey == m_exactResultKey)
+    {
+        returnDisplay = m_exactResultDisplay;
+        return true;
+    }
+
+    const ExactConversionData* conversionData = GetExactConversionData(m_fromType, m_toType);
+    if (conversionData == nullptr)
+    {
+        return false;
+    }
+
+    try
+    {
+        if (m_currentDisplay != m_exactInputDisplay)
         {
-            TrimTrailingZeros(roundedString);
-            returnVector.emplace_back(roundedString, entry.type);
+            if (!TryParseExactDecimal(m_currentDisplay, m_exactInputValue))
+            {
+                return false;
+            }
+
+            m_exactInputDisplay = m_currentDisplay;
         }
+
+        returnDisplay = FormatExact(Convert(m_exactInputValue, *conversionData), approximateValue);
+    }
+    catch (uint32_t)
+    {
+        return false;
     }
 
-    // The Whimsicals are determined differently
-    // Sort the resulting list by absolute magnitude, breaking ties by choosing the positive value
-    sort(intermediateWhimsicalVector.begin(), intermediateWhimsicalVector.end(), [](SuggestedValueIntermediate first, SuggestedValueIntermediate second) {
-        if (abs(first.magnitude) == abs(second.magnitude))
+    m_exactResultKey = move(resultKey);
+    m_exactResultDisplay = returnDisplay;
+    return true;
+}
+
+/// <summary>
+/// Formats an exact result following the same rules as the double path of Calculate,
+/// with the magnitude checks and the rounding done on the exact value.
+/// </summary>
+/// <param name="value">the exact result</param>
+/// <param name="approximateValue">the double approximation of value, used to guess its decimal exponent</param>
+wstring UnitConverter::FormatExact(const Rational& value, double approximateValue)
+{
+    const Rational zero{};
+    if (value == zero)
+    {
+        return L"0";
+    }
+
+    const bool isNegative = value < zero;
+    const Rational magnitude = isNegative ? -value : value;
+
+    // Find the decimal exponent of the leading digit, starting from the one of the double
+    int32_t exponent = 0;
+    if (approximateValue != 0 && isfinite(approximateValue))
+    {
+        exponent = static_cast<int32_t>(floor(log10(abs(approximateValue))));
+    }
+
+    while (magnitude >= PowerOfTen(exponent + 1))
+    {
+        exponent++;
+    }
+
+    while (magnitude < PowerOfTen(exponent))
+    {
+        exponent--;
+    }
+
+    wstring returnDisplay;
+    const unsigned int numPreDecimal = exponent < 0 ? 1u : static_cast<unsigned int>(exponent) + 1;
+    if (numPreDecimal > MAXIMUMDIGITSALLOWED || exponent < -static_cast<int32_t>(MAXIMUMDIGITSALLOWED - 1))
+    {
+        const int32_t scale = SCIENTIFICMANTISSADECIMALS - exponent;
+        uint64_t mantissa = RoundToUInt64(magnitude * PowerOfTen(scale), abs(approximateValue) * pow(10.0, scale));
+        if (to_wstring(mantissa).size() > static_cast<size_t>(SCIENTIFICMANTISSADECIMALS) + 1)
+        {
+            // Rounding carried into a new digit, e.g. 9.9999996 -> 10.00000
+            mantissa /= 10;
+            exponent++;
+        }
+
+        wstring digits = to_wstring(mantissa);
+        returnDisplay = digits.substr(0, 1);
+        returnDisplay.append(1, L'.').append(digits.substr(1)).append(1, L'e').append(1, exponent < 0 ? L'-' : L'+');
+        if (abs(exponent) < 10)
         {
-            return first.magnitude > second.magnitude;
+            returnDisplay.append(1, L'0');
+        }
+
+        returnDisplay.append(to_wstring(abs(exponent)));
+    }
+    else
+    {
+        unsigned int precision;
+        if (exponent < -static_cast<int32_t>(OPTIMALDIGITSALLOWED - 1))
+        {
+            precision = MAXIMUMDIGITSALLOWED;
         }
         else
         {
-            return abs(first.magnitude) < abs(second.magnitude);
+            auto numberDigits = max(OPTIMALDIGITSALLOWED, min(MAXIMUMDIGITSALLOWED, GetNumberDigits(m_currentDisplay)));
+            precision = numberDigits > numPreDecimal ? numberDigits - numPreDecimal : 0;
         }
-    });
 
-    // Now that the list is sorted, iterate over it and populate the return vector with properly rounded and formatted return strings
-    vector<tuple<wstring, Unit>> whimsicalReturnVector;
+        const int32_t scale = static_cast<int32_t>(precision);
+        returnDisplay = to_wstring(RoundToUInt64(magnitude * PowerOfTen(scale), abs(approximateValue) * pow(10.0, scale)));
+        if (returnDisplay.size() <= precision)
+        {
+            returnDisplay.insert(0, precision + 1 - returnDisplay.size(), L'0');
+        }
 
-    for (const auto& entry : intermediateWhimsicalVector)
-    {
-        wstring roundedString;
-        if (abs(entry.value) < 100)
+        if (precision > 0)
         {
-            roundedString = RoundSignificantDigits(entry.value, 2U);
+            returnDisplay.insert(returnDisplay.size() - precision, 1, L'.');
         }
-        else if (abs(entry.value) < 1000)
+
+        TrimTrailingZeros(returnDisplay);
+    }
+
+    if (isNegative && returnDisplay != L"0")
+    {
+        returnDisplay.insert(0, 1, L'-');
+    }
+
+    return returnDisplay;
+}
+
+/// <summary>
+/// Calculates the suggested values for the current display value and returns them as a vector
+/// </summary>
+vector<tuple<wstring, Unit>> UnitConverter::CalculateSuggested()
+{
+    if (m_currencyDataLoader != nullptr && m_currencyDataLoader->SupportsCategory(m_currentCategory))
+    {
+        return vector<tuple<wstring, Unit>>();
+    }
+
+    vector<tuple<wstring, Unit>> returnVector;
+    auto ratios = m_ratioMap.find(m_fromType);
+    if (ratios == m_ratioMap.end())
+    {
+        return returnVector;
+    }
+
+    // Order by magnitude, breaking ties by choosing the value above one
+    const auto isCloserToOne = [](const SuggestedValueIntermediate& first, const SuggestedValueIntermediate& second) {
+        if (first.magnitude == second.magnitude)
         {
-            roundedString = RoundSignificantDigits(entry.value, 1U);
+            return abs(first.value) > abs(second.value);
         }
         else
         {
-            roundedString = RoundSignificantDigits(entry.value, 0U);
+            return first.magnitude < second.magnitude;
         }
+    };
 
-        // How to work out which is the best whimsical value to add to the vector?
-        if (stod(roundedString) != 0.0)
+    // Calculate converted values for every other unit type in this category, along with their magnitude.
+    // Values that would be displayed as zero are dropped here rather than after formatting them,
+    // and only the best whimsical value is kept.
+    const double currentValue = stod(m_currentDisplay);
+    vector<SuggestedValueIntermediate> intermediateVector;
+    intermediateVector.reserve(ratios->second.size());
+    SuggestedValueIntermediate bestWhimsical{ 0.0, 0.0, nullptr };
+    for (const auto& [unit, conversionData] : ratios->second)
+    {
+        if (unit != m_fromType && unit != m_toType)
         {
-            TrimTrailingZeros(roundedString);
-            whimsicalReturnVector.emplace_back(roundedString, entry.type);
+            const double convertedValue = Convert(currentValue, conversionData);
+            const double absoluteValue = abs(convertedValue);
+            const SuggestedValueIntermediate newEntry{ absoluteValue < 1.0 ? 1.0 / absoluteValue : absoluteValue, convertedValue, &unit };
+            const bool isZero = absoluteValue < SUGGESTEDVALUEZEROLIMIT;
+            if (unit.isWhimsical)
+            {
+                if (!isZero && (bestWhimsical.type == nullptr || isCloserToOne(newEntry, bestWhimsical)))
+                {
+                    bestWhimsical = newEntry;
+                }
+            }
+            else if (!isZero || m_currentCategory.supportsNegative)
+            {
+                intermediateVector.push_back(newEntry);
+            }
         }
     }
-    // Pickup the 'best' whimsical value - currently the first one
-    if (!whimsicalReturnVector.empty())
+
+    // Only the values closest to one are returned, select them without sorting the whole list
+    const size_t suggestedValueCount = min(intermediateVector.size(), static_cast<size_t>(MAXIMUMSUGGESTEDVALUES));
+    partial_sort(intermediateVector.begin(), intermediateVector.begin() + suggestedValueCount, intermediateVector.end(), isCloserToOne);
+
+    returnVector.reserve(suggestedValueCount + 1);
+    for (size_t i = 0; i < suggestedValueCount; i++)
+    {
+        returnVector.emplace_back(FormatSuggestedValue(intermediateVector[i].value), *intermediateVector[i].type);
+    }
+
+    // The Whimsicals are determined differently, pickup the 'best' whimsical value - currently the one closest to one
+    if (bestWhimsical.type != nullptr)
     {
-        returnVector.push_back(whimsicalReturnVector.front());
+        returnVector.emplace_back(FormatSuggestedValue(bestWhimsical.value), *bestWhimsical.type);
     }
 
     return returnVector;
@@ -734,6 +1222,8 @@ void UnitConverter::ResetCategoriesAndRatios()
 
     m_categoryToUnits.clear();
     m_ratioMap.clear();
+    m_exactRatioMap.clear();
+    m_exactResultKey.clear();
     bool readyCategoryFound = false;
     for (const Category& category : m_categories)
     {
@@ -891,15 +1381,19 @@ void UnitConverter::Calculate()
         if (isCurrencyConverter)
         {
             // We don't need to trim the value when it's a currency.
-            m_returnDisplay = RoundSignificantDigits(returnValue, MAXIMUMDIGITSALLOWED);
+            AssignRoundedValue(m_returnDisplay, returnValue, MAXIMUMDIGITSALLOWED);
             TrimTrailingZeros(m_returnDisplay);
         }
+        else if (m_exactConversionMode && TryCalculateExact(returnValue, m_returnDisplay))
+        {
+            m_returnHasDecimal = (m_returnDisplay.find(L'.') != wstring::npos);
+        }
         else
         {
             const unsigned int numPreDecimal = GetNumberDigitsWholeNumberPart(returnValue);
             if (numPreDecimal > MAXIMUMDIGITSALLOWED || (returnValue != 0 && abs(returnValue) < MINIMUMDECIMALALLOWED))
             {
-                m_returnDisplay = ToScientificNumber(returnValue);
+                AssignScientificValue(m_returnDisplay, returnValue);
             }
             else
             {
@@ -917,7 +1411,7 @@ void UnitConverter::Calculate()
                     precision = numberDigits > numPreDecimal ? numberDigits - numPreDecimal : 0;
                 }
 
-                m_returnDisplay = RoundSignificantDigits(returnValue, precision);
+                AssignRoundedValue(m_returnDisplay, returnValue, precision);
                 TrimTrailingZeros(m_returnDisplay);
             }
             m_returnHasDecimal = (m_returnDisplay.find(L'.') != wstring::npos);
@@ -8,6 +8,7 @@
 #include <future>
 #include "sal_cross_platform.h" // for SAL
 #include <memory>               // for std::shared_ptr
+#include "Header Files/Rational.h"
 
 namespace UnitConversionManager
 {
@@ -118,9 +119,9 @@ namespace UnitConversionManager
 
     struct SuggestedValueIntermediate
     {
-        double magnitude;
+        double magnitude; // how far the value is from one, the larger of |value| and 1 / |value|
         double value;
-        Unit type;
+        const Unit* type;
     };
 
     struct ConversionData
@@ -140,6 +141,25 @@ namespace UnitConversionManager
         bool offsetFirst;
     };
 
+    // Exact counterpart of ConversionData, used when the converter runs in exact conversion mode.
+    struct ExactConversionData
+    {
+        ExactConversionData()
+            : offsetFirst(false)
+        {
+        }
+        ExactConversionData(CalcEngine::Rational ratio, CalcEngine::Rational offset, bool offsetFirst)
+            : ratio(std::move(ratio))
+            , offset(std::move(offset))
+            , offsetFirst(offsetFirst)
+        {
+        }
+
+        CalcEngine::Rational ratio;
+        CalcEngine::Rational offset;
+        bool offsetFirst;
+    };
+
     struct CurrencyStaticData
     {
         std::wstring countryCode;
@@ -161,6 +181,10 @@ namespace UnitConversionManager
         UnitConversionManager::Unit,
         std::unordered_map<UnitConversionManager::Unit, UnitConversionManager::ConversionData, UnitConversionManager::UnitHash>,
         UnitConversionManager::UnitHash>;
+    using UnitToUnitToExactConversionDataMap = std::unordered_map<
+        UnitConversionManager::Unit,
+        std::unordered_map<UnitConversionManager::Unit, UnitConversionManager::ExactConversionData, UnitConversionManager::UnitHash>,
+        UnitConversionManager::UnitHash>;
     using CategoryToUnitVectorMap = std::unordered_map<int, std::vector<UnitConversionManager::Unit>>;
 
     class IViewModelCurrencyCallback
@@ -183,6 +207,10 @@ namespace UnitConversionManager
         virtual std::vector<Unit> GetOrderedUnits(const Category& c) = 0;
         virtual std::unordered_map<Unit, ConversionData, UnitHash> LoadOrderedRatios(const Unit& u) = 0;
         virtual bool SupportsCategory(const Category& target) = 0;
+
+        // Returns the ratios of LoadOrderedRatios as exact rationals. The default implementation recovers them from the
+        // doubles, loaders that know the decimal constants their ratios are built from should override it.
+        virtual std::unordered_map<Unit, ExactConversionData, UnitHash> LoadOrderedExactRatios(const Unit& u);
     };
 
     class ICurrencyConverterDataLoader
@@ -205,7 +233,7 @@ namespace UnitConversionManager
     public:
         virtual ~IUnitConverterVMCallback(){};
         virtual void DisplayCallback(const std::wstring& from, const std::wstring& to) = 0;
-        virtual void SuggestedValueCallback(const std::vector<std::tuple<std::wstring, Unit>>& suggestedValues) = 0;
+        virtual void SuggestedValueCallback(std::vector<std::tuple<std::wstring, Unit>> suggestedValues) = 0;
         virtual void MaxDigitsReached() = 0;
     };
 
@@ -230,6 +258,10 @@ namespace UnitConversionManager
         virtual std::future<std::pair<bool, std::wstring>> RefreshCurrencyRatios() = 0;
         virtual void Calculate() = 0;
         virtual void ResetCategoriesAndRatios() = 0;
+        virtual void SetExactConversionMode(bool isExactConversionMode) = 0;
+        virtual bool IsExactConversionMode() const = 0;
+        virtual bool ConvertMany(_In_ const double* values, size_t count, const Unit& fromType, const Unit& toType, _Out_ double* results) = 0;
+        virtual std::unordered_map<Unit, std::vector<double>, UnitHash> ConvertManyToAllUnits(_In_ const double* values, size_t count, const Unit& fromType) = 0;
     };
 
     class UnitConverter : public IUnitConverter, public std::enable_shared_from_this<UnitConverter>
@@ -254,15 +286,25 @@ namespace UnitConversionManager
         std::future<std::pair<bool, std::wstring>> RefreshCurrencyRatios() override;
         void Calculate() override;
         void ResetCategoriesAndRatios() override;
+        void SetExactConversionMode(bool isExactConversionMode) override;
+        bool IsExactConversionMode() const override;
+        bool ConvertMany(_In_ const double* values, size_t count, const Unit& fromType, const Unit& toType, _Out_ double* results) override;
+        std::unordered_map<Unit, std::vector<double>, UnitHash> ConvertManyToAllUnits(_In_ const double* values, size_t count, const Unit& fromType) override;
         // IUnitConverter
 
         static std::vector<std::wstring> StringToVector(std::wstring_view w, std::wstring_view delimiter, bool addRemainder = false);
         static std::wstring Quote(std::wstring_view s);
         static std::wstring Unquote(std::wstring_view s);
+        static bool TryParseExactDecimal(std::wstring_view s, CalcEngine::Rational& value);
+        static CalcEngine::Rational DoubleToExactDecimal(double value);
 
     private:
         bool CheckLoad();
         double Convert(double value, const ConversionData& conversionData);
+        CalcEngine::Rational Convert(const CalcEngine::Rational& value, const ExactConversionData& conversionData);
+        bool TryCalculateExact(double approximateValue, std::wstring& returnDisplay);
+        std::wstring FormatExact(const CalcEngine::Rational& value, double approximateValue);
+        const ExactConversionData* GetExactConversionData(const Unit& fromType, const Unit& toType);
         std::vector<std::tuple<std::wstring, Unit>> CalculateSuggested();
         void ClearValues();
         void InitializeSelectedUnits();
@@ -292,5 +334,14 @@ namespace UnitConversionManager
         bool m_currentHasDecimal;
         bool m_returnHasDecimal;
         bool m_switchedActive;
+
+        bool m_exactConversionMode;
+        UnitToUnitToExactConversionDataMap m_exactRatioMap;
+        // The exact path caches the last parsed input and the last formatted result,
+        // the display is recalculated several times for the same value and unit pair.
+        std::wstring m_exactInputDisplay;
+        CalcEngine::Rational m_exactInputValue;
+        std::wstring m_exactResultKey;
+        std::wstring m_exactResultDisplay;
     };
 }
@@ -10,7 +10,10 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <chrono>
 #include <cassert>
+#include <charconv>
 #include <intsafe.h>
 #include <list>
 #include <future>
@@ -24,3 +27,4 @@
 #include <cmath>
 #include <random>
 #include <iomanip>
+#include <thread>
@@ -12,6 +12,7 @@
 #define _Out_opt_
 #define _In_
 #define _Out_
+#define _Out_writes_(size)
 #define _Inout_
 #define __in_opt
 #define _Frees_ptr_opt_
@@ -98,6 +98,39 @@ namespace CalculatorApp::ViewModel::Common
         }
     }
 
+    void CalculatorDisplay::OnMemorizedNumberInserted(_In_ unsigned int indexOfMemory, _In_ const wstring& memorizedNumber)
+    {
+        if (m_callbackReference != nullptr)
+        {
+            if (auto calcVM = m_callbackReference.Resolve<ViewModel::StandardCalculatorViewModel>())
+            {
+                calcVM->OnMemorizedNumberInserted(indexOfMemory, memorizedNumber);
+            }
+        }
+    }
+
+    void CalculatorDisplay::OnMemorizedNumberUpdated(_In_ unsigned int indexOfMemory, _In_ const wstring& memorizedNumber)
+    {
+        if (m_callbackReference != nullptr)
+        {
+            if (auto calcVM = m_callbackReference.Resolve<ViewModel::StandardCalculatorViewModel>())
+            {
+                calcVM->OnMemorizedNumberUpdated(indexOfMemory, memorizedNumber);
+            }
+        }
+    }
+
+    void CalculatorDisplay::OnMemorizedNumberRemoved(_In_ unsigned int indexOfMemory)
+    {
+        if (m_callbackReference != nullptr)
+        {
+            if (auto calcVM = m_callbackReference.Resolve<ViewModel::StandardCalculatorViewModel>())
+            {
+                calcVM->OnMemorizedNumberRemoved(indexOfMemory);
+            }
+        }
+    }
+
     void CalculatorDisplay::OnHistoryItemAdded(_In_ unsigned int addedItemIndex)
     {
         if (m_historyCallbackReference != nullptr)
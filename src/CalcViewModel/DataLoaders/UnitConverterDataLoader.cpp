@@ -4,6 +4,7 @@
 #include "pch.h"
 #include "Common/AppResourceProvider.h"
 #include "UnitConverterDataLoader.h"
+#include "CalcManager/Header Files/RationalMath.h"
 #include "UnitConverterDataConstants.h"
 #include "CurrencyDataLoader.h"
 
@@ -41,6 +42,52 @@ unordered_map<UCM::Unit, UCM::ConversionData, UCM::UnitHash> UnitConverterDataLo
     return m_ratioMap->at(unit);
 }
 
+unordered_map<UCM::Unit, UCM::ExactConversionData, UCM::UnitHash> UnitConverterDataLoader::LoadOrderedExactRatios(const UCM::Unit& unit)
+{
+    unordered_map<UCM::Unit, UCM::ExactConversionData, UCM::UnitHash> exactRatios;
+    auto unitFactorItr = m_unitIdToConversionFactor.find(unit.id);
+    for (const auto& [targetUnit, conversionData] : m_ratioMap->at(unit))
+    {
+        auto targetFactorItr = m_unitIdToConversionFactor.find(targetUnit.id);
+        if (unitFactorItr != m_unitIdToConversionFactor.end() && targetFactorItr != m_unitIdToConversionFactor.end())
+        {
+            // Divide the decimal factors exactly instead of recovering the ratio from their double quotient
+            exactRatios.emplace(
+                targetUnit,
+                UCM::ExactConversionData{ UCM::UnitConverter::DoubleToExactDecimal(unitFactorItr->second)
+                                              / UCM::UnitConverter::DoubleToExactDecimal(targetFactorItr->second),
+                                          CalcEngine::Rational{},
+                                          false });
+            continue;
+        }
+
+        // Explicit ratios that apply the offset first, such as 5/9 for Fahrenheit to Celsius, aren't decimal constants,
+        // they are the inverse of the reverse conversion.
+        auto reverseConversions = m_ratioMap->find(targetUnit);
+        if (conversionData.offsetFirst && reverseConversions != m_ratioMap->end())
+        {
+            auto reverseItr = reverseConversions->second.find(unit);
+            if (reverseItr != reverseConversions->second.end() && !reverseItr->second.offsetFirst)
+            {
+                exactRatios.emplace(
+                    targetUnit,
+                    UCM::ExactConversionData{ CalcEngine::RationalMath::Invert(UCM::UnitConverter::DoubleToExactDecimal(reverseItr->second.ratio)),
+                                              -UCM::UnitConverter::DoubleToExactDecimal(reverseItr->second.offset),
+                                              true });
+                continue;
+            }
+        }
+
+        exactRatios.emplace(
+            targetUnit,
+            UCM::ExactConversionData{ UCM::UnitConverter::DoubleToExactDecimal(conversionData.ratio),
+                                      UCM::UnitConverter::DoubleToExactDecimal(conversionData.offset),
+                                      conversionData.offsetFirst });
+    }
+
+    return exactRatios;
+}
+
 bool UnitConverterDataLoader::SupportsCategory(const UCM::Category& target)
 {
     shared_ptr<vector<UCM::Category>> supportedCategories = nullptr;
@@ -77,6 +124,7 @@ void UnitConverterDataLoader::LoadData()
 
     this->m_categoryIDToUnitsMap->clear();
     this->m_ratioMap->clear();
+    this->m_unitIdToConversionFactor.clear();
     for (UCM::Category objectCategory : *m_categoryList)
     {
         ViewMode categoryViewMode = NavCategoryStates::Deserialize(objectCategory.id);
@@ -115,6 +163,7 @@ void UnitConverterDataLoader::LoadData()
                 // Get the associated units for a category id
                 unordered_map<int, double> unitConversions = categoryToUnitConversionDataMap.at(categoryViewMode);
                 double unitFactor = unitConversions[unit.id];
+                m_unitIdToConversionFactor[unit.id] = unitFactor;
 
                 for (const auto& [id, conversionFactor] : unitConversions)
                 {
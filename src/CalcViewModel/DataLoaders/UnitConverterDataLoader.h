@@ -76,6 +76,8 @@ namespace CalculatorApp
             std::unordered_map<UnitConversionManager::Unit, UnitConversionManager::ConversionData, UnitConversionManager::UnitHash>
             LoadOrderedRatios(const UnitConversionManager::Unit& unit) override;
             bool SupportsCategory(const UnitConversionManager::Category& target) override;
+            std::unordered_map<UnitConversionManager::Unit, UnitConversionManager::ExactConversionData, UnitConversionManager::UnitHash>
+            LoadOrderedExactRatios(const UnitConversionManager::Unit& unit) override;
             // IConverterDataLoader
 
             void GetCategories(_In_ std::shared_ptr<std::vector<UnitConversionManager::Category>> categoriesList);
@@ -88,6 +90,7 @@ namespace CalculatorApp
             std::shared_ptr<std::vector<UnitConversionManager::Category>> m_categoryList;
             std::shared_ptr<UnitConversionManager::CategoryToUnitVectorMap> m_categoryIDToUnitsMap;
             std::shared_ptr<UnitConversionManager::UnitToUnitToConversionDataMap> m_ratioMap;
+            std::unordered_map<int, double> m_unitIdToConversionFactor;
             Platform::String ^ m_currentRegionCode;
         };
     }
@@ -494,6 +494,69 @@ void StandardCalculatorViewModel::SetMemorizedNumbers(const vector<wstring>& new
     }
 }
 
+void StandardCalculatorViewModel::OnMemorizedNumberInserted(unsigned int indexOfMemory, const wstring& memorizedNumber)
+{
+    if (indexOfMemory > MemorizedNumbers->Size)
+    {
+        return;
+    }
+
+    auto stringValue = memorizedNumber;
+    LocalizationSettings::GetInstance()->LocalizeDisplayValue(&stringValue);
+
+    MemoryItemViewModel ^ memorySlot = ref new MemoryItemViewModel(this);
+    memorySlot->Position = indexOfMemory;
+    memorySlot->Value = ref new String(stringValue.c_str());
+
+    MemorizedNumbers->InsertAt(indexOfMemory, memorySlot);
+    IsMemoryEmpty = IsAlwaysOnTop;
+
+    // Update the slot position for the slots after the new one
+    for (unsigned int i = indexOfMemory + 1; i < MemorizedNumbers->Size; i++)
+    {
+        MemorizedNumbers->GetAt(i)->Position++;
+    }
+}
+
+void StandardCalculatorViewModel::OnMemorizedNumberUpdated(unsigned int indexOfMemory, const wstring& memorizedNumber)
+{
+    if (indexOfMemory >= MemorizedNumbers->Size)
+    {
+        return;
+    }
+
+    auto newStringValue = memorizedNumber;
+    LocalizationSettings::GetInstance()->LocalizeDisplayValue(&newStringValue);
+
+    // If the value is different, update the value
+    MemoryItemViewModel ^ memorySlot = MemorizedNumbers->GetAt(indexOfMemory);
+    if (memorySlot->Value != StringReference(newStringValue.c_str()))
+    {
+        memorySlot->Value = ref new String(newStringValue.c_str());
+    }
+}
+
+void StandardCalculatorViewModel::OnMemorizedNumberRemoved(unsigned int indexOfMemory)
+{
+    if (indexOfMemory >= MemorizedNumbers->Size)
+    {
+        return;
+    }
+
+    MemorizedNumbers->RemoveAt(indexOfMemory);
+
+    // Update the slot position for the slots after the removed one
+    for (unsigned int i = indexOfMemory; i < MemorizedNumbers->Size; i++)
+    {
+        MemorizedNumbers->GetAt(i)->Position--;
+    }
+
+    if (MemorizedNumbers->Size == 0)
+    {
+        IsMemoryEmpty = true;
+    }
+}
+
 void StandardCalculatorViewModel::FtoEButtonToggled()
 {
     OnButtonPressed(NumbersAndOperatorsEnum::FToE);
@@ -1160,16 +1223,6 @@ void StandardCalculatorViewModel::OnMemoryClear(_In_ Object ^ memoryItemPosition
             unsigned int unsignedPosition = safe_cast<unsigned int>(boxedPosition->Value);
             m_standardCalculatorManager.MemorizedNumberClear(unsignedPosition);
 
-            MemorizedNumbers->RemoveAt(unsignedPosition);
-            for (unsigned int i = 0; i < MemorizedNumbers->Size; i++)
-            {
-                MemorizedNumbers->GetAt(i)->Position = i;
-            }
-
-            if (MemorizedNumbers->Size == 0)
-            {
-                IsMemoryEmpty = true;
-            }
             TraceLogger::GetInstance()->UpdateButtonUsage(NumbersAndOperatorsEnum::MemoryClear, GetCalculatorMode());
 
             wstring localizedIndex = to_wstring(boxedPosition->Value + 1);
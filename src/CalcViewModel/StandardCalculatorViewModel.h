@@ -325,6 +325,9 @@ namespace CalculatorApp
             
         private:
             void SetMemorizedNumbers(const std::vector<std::wstring>& memorizedNumbers);
+            void OnMemorizedNumberInserted(unsigned int indexOfMemory, const std::wstring& memorizedNumber);
+            void OnMemorizedNumberUpdated(unsigned int indexOfMemory, const std::wstring& memorizedNumber);
+            void OnMemorizedNumberRemoved(unsigned int indexOfMemory);
             void UpdateProgrammerPanelDisplay();
             void HandleUpdatedOperandData(CalculationManager::Command cmdenum);
             void SetPrimaryDisplay(_In_ Platform::String ^ displayStringValue, _In_ bool isError);
@@ -46,6 +46,9 @@ constexpr unsigned int TIMER_INTERVAL_IN_MS = 10000;
 
 const TimeSpan SUPPLEMENTARY_VALUES_INTERVAL = { 10 * TIMER_INTERVAL_IN_MS };
 
+// std::chrono equivalent of TimeSpan
+using TimeSpanDuration = chrono::duration<long long, ratio<1, 10'000'000>>;
+
 static Unit ^ EMPTY_UNIT = ref new Unit(UCM::EMPTY_UNIT);
 
 constexpr size_t UNIT_LIST = 0;
@@ -92,7 +95,7 @@ namespace CalculatorApp::ViewModel::DataLoaders::UnitConverterResourceKeys
 
 UnitConverterViewModel::UnitConverterViewModel(const shared_ptr<UCM::IUnitConverter>& model)
     : m_model(model)
-    , m_resettingTimer(false)
+    , m_suggestedValues(TimeSpanDuration{ SUPPLEMENTARY_VALUES_INTERVAL.Duration })
     , m_value1cp(ConversionParameter::Source)
     , m_Value1Active(true)
     , m_Value2Active(false)
@@ -233,8 +236,14 @@ void UnitConverterViewModel::OnUnitChanged(Object ^ parameter)
 
     if (m_supplementaryResultsTimer != nullptr)
     {
-        // End timer to show results immediately
         m_supplementaryResultsTimer->Cancel();
+        m_supplementaryResultsTimer = nullptr;
+    }
+
+    // Show the results for the new units immediately
+    if (auto suggestedValues = m_suggestedValues.Take())
+    {
+        RefreshSupplementaryResults(*suggestedValues);
     }
 
     SaveUserPreferences();
@@ -467,25 +476,20 @@ void UnitConverterViewModel::UpdateDisplay(const wstring& from, const wstring& t
     }
 }
 
-void UnitConverterViewModel::UpdateSupplementaryResults(const std::vector<std::tuple<std::wstring, UnitConversionManager::Unit>>& suggestedValues)
+void UnitConverterViewModel::UpdateSupplementaryResults(std::vector<std::tuple<std::wstring, UnitConversionManager::Unit>> suggestedValues)
 {
-    m_cacheMutex.lock();
-    m_cachedSuggestedValues = suggestedValues;
-    m_cacheMutex.unlock();
-
-    // If we're already "ticking", reset the timer
-    if (m_supplementaryResultsTimer != nullptr)
+    // The timer only needs to be scheduled when no results were pending, otherwise the pending tick
+    // sees the newer results and waits until they are SUPPLEMENTARY_VALUES_INTERVAL old.
+    if (m_suggestedValues.Publish(move(suggestedValues)))
     {
-        m_resettingTimer = true;
-        m_supplementaryResultsTimer->Cancel();
-        m_resettingTimer = false;
+        ScheduleSupplementaryResultsTimer(SUPPLEMENTARY_VALUES_INTERVAL);
     }
+}
 
-    // Schedule the timer
+void UnitConverterViewModel::ScheduleSupplementaryResultsTimer(TimeSpan delay)
+{
     m_supplementaryResultsTimer = ThreadPoolTimer::CreateTimer(
-        ref new TimerElapsedHandler(this, &UnitConverterViewModel::SupplementaryResultsTimerTick, TIMER_CALLBACK_CONTEXT),
-        SUPPLEMENTARY_VALUES_INTERVAL,
-        ref new TimerDestroyedHandler(this, &UnitConverterViewModel::SupplementaryResultsTimerCancel, TIMER_CALLBACK_CONTEXT));
+        ref new TimerElapsedHandler(this, &UnitConverterViewModel::SupplementaryResultsTimerTick, TIMER_CALLBACK_CONTEXT), delay);
 }
 
 void UnitConverterViewModel::OnValueActivated(IActivatable ^ control)
@@ -765,27 +769,27 @@ UnitConversionManager::Command UnitConverterViewModel::CommandFromButtonId(Numbe
     return command;
 }
 
-void UnitConverterViewModel::SupplementaryResultsTimerTick(ThreadPoolTimer ^ timer)
+void UnitConverterViewModel::SupplementaryResultsTimerTick(ThreadPoolTimer ^ /*timer*/)
 {
-    timer->Cancel();
-}
-
-void UnitConverterViewModel::SupplementaryResultsTimerCancel(ThreadPoolTimer ^ timer)
-{
-    if (!m_resettingTimer)
+    UCM::SuggestedValuesChannel::Clock::duration remaining;
+    if (auto suggestedValues = m_suggestedValues.TryTake(UCM::SuggestedValuesChannel::Clock::now(), remaining))
+    {
+        RefreshSupplementaryResults(*suggestedValues);
+    }
+    else if (remaining > UCM::SuggestedValuesChannel::Clock::duration::zero())
     {
-        RefreshSupplementaryResults();
+        // Newer results were published while the timer was running, wait until they are old enough
+        ScheduleSupplementaryResultsTimer(TimeSpan{ chrono::ceil<TimeSpanDuration>(remaining).count() });
     }
 }
 
-void UnitConverterViewModel::RefreshSupplementaryResults()
+void UnitConverterViewModel::RefreshSupplementaryResults(const UCM::SuggestedValuesChannel::Snapshot& suggestedValues)
 {
-    m_cacheMutex.lock();
     m_SupplementaryResults->Clear();
 
     vector<SupplementaryResult ^> whimsicals;
 
-    for (tuple<wstring, UCM::Unit> suggestedValue : m_cachedSuggestedValues)
+    for (const tuple<wstring, UCM::Unit>& suggestedValue : suggestedValues)
     {
         SupplementaryResult ^ result = ref new SupplementaryResult(
             this->ConvertToLocalizedString(get<0>(suggestedValue), false, CurrencyFormatterParameter::Default), ref new Unit(get<1>(suggestedValue)));
@@ -804,7 +808,6 @@ void UnitConverterViewModel::RefreshSupplementaryResults()
         m_SupplementaryResults->Append(whimsicals[0]);
     }
 
-    m_cacheMutex.unlock();
     RaisePropertyChanged(SupplementaryResultsPropertyName);
     // EventWriteConverterSupplementaryResultsUpdated();
 }
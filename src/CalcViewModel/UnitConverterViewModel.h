@@ -4,6 +4,7 @@
 #pragma once
 
 #include "CalcManager/UnitConverter.h"
+#include "CalcManager/SuggestedValuesChannel.h"
 #include "Common/Utils.h"
 #include "Common/NetworkManager.h"
 #include "Common/Automation/NarratorAnnouncement.h"
@@ -288,7 +289,7 @@ namespace CalculatorApp
 
             // used by UnitConverterVMCallback
             void UpdateDisplay(const std::wstring& from, const std::wstring& to);
-            void UpdateSupplementaryResults(const std::vector<std::tuple<std::wstring, UnitConversionManager::Unit>>& suggestedValues);
+            void UpdateSupplementaryResults(std::vector<std::tuple<std::wstring, UnitConversionManager::Unit>> suggestedValues);
             void OnMaxDigitsReached();
 
             void BuildUnitList(const std::vector<UnitConversionManager::Unit>& modelUnitList);
@@ -302,9 +303,9 @@ namespace CalculatorApp
             void OnUnitChanged(Platform::Object ^ unused);
             void OnSwitchActive(Platform::Object ^ unused);
             UnitConversionManager::Command CommandFromButtonId(CalculatorApp::ViewModel::Common::NumbersAndOperatorsEnum button);
+            void ScheduleSupplementaryResultsTimer(Windows::Foundation::TimeSpan delay);
             void SupplementaryResultsTimerTick(Windows::System::Threading::ThreadPoolTimer ^ timer);
-            void SupplementaryResultsTimerCancel(Windows::System::Threading::ThreadPoolTimer ^ timer);
-            void RefreshSupplementaryResults();
+            void RefreshSupplementaryResults(const UnitConversionManager::SuggestedValuesChannel::Snapshot& suggestedValues);
             void UpdateInputBlocked(_In_ const std::wstring& currencyInput);
             void UpdateCurrencyFormatter();
             void UpdateIsDecimalEnabled();
@@ -378,9 +379,7 @@ namespace CalculatorApp
         private:
             bool m_isInputBlocked;
             Windows::System::Threading::ThreadPoolTimer ^ m_supplementaryResultsTimer;
-            bool m_resettingTimer;
-            std::vector<std::tuple<std::wstring, UnitConversionManager::Unit>> m_cachedSuggestedValues;
-            std::mutex m_cacheMutex;
+            UnitConversionManager::SuggestedValuesChannel m_suggestedValues;
             Windows::Globalization::NumberFormatting::DecimalFormatter ^ m_decimalFormatter;
             Windows::Globalization::NumberFormatting::CurrencyFormatter ^ m_currencyFormatter;
             Windows::Globalization::NumberFormatting::CurrencyFormatter ^ m_currencyFormatter1;
@@ -418,9 +417,9 @@ namespace CalculatorApp
                 m_viewModel->UpdateDisplay(from, to);
             }
 
-            void SuggestedValueCallback(const std::vector<std::tuple<std::wstring, UnitConversionManager::Unit>>& suggestedValues) override
+            void SuggestedValueCallback(std::vector<std::tuple<std::wstring, UnitConversionManager::Unit>> suggestedValues) override
             {
-                m_viewModel->UpdateSupplementaryResults(suggestedValues);
+                m_viewModel->UpdateSupplementaryResults(std::move(suggestedValues));
             }
 
             void MaxDigitsReached()
@@ -235,6 +235,72 @@ namespace CalculatorEngineTests
                 L"Verify expanded form multigroup non-repeating grouping.");
         }
 
+        TEST_METHOD(TestOpCodeToString)
+        {
+            VERIFY_ARE_EQUAL(
+                m_resourceProvider->GetCEngineString(SIDS_SIND),
+                wstring{ CCalcEngine::OpCodeToUnaryString(IDC_SIN, false, AngleType::Degrees) },
+                L"Verify numeric resource key lookup.");
+            VERIFY_ARE_EQUAL(
+                m_resourceProvider->GetCEngineString(SIDS_ASECG),
+                wstring{ CCalcEngine::OpCodeToUnaryString(IDC_SEC, true, AngleType::Gradians) },
+                L"Verify named resource key lookup.");
+            VERIFY_ARE_EQUAL(
+                m_resourceProvider->GetCEngineString(SIDS_ASINH),
+                wstring{ CCalcEngine::OpCodeToUnaryString(IDC_SINH, true, AngleType::Radians) },
+                L"Verify operators without angle strings ignore the angle type.");
+            VERIFY_ARE_EQUAL(
+                wstring{ CCalcEngine::OpCodeToString(IDC_CHOP) },
+                wstring{ CCalcEngine::OpCodeToUnaryString(IDC_CHOP, false, AngleType::Degrees) },
+                L"Verify fallback to the op code string.");
+            VERIFY_ARE_EQUAL(
+                m_resourceProvider->GetCEngineString(SIDS_PROGRAMMER_MOD),
+                wstring{ CCalcEngine::OpCodeToBinaryString(IDC_MOD, true) },
+                L"Verify programmer mode string.");
+            VERIFY_ARE_EQUAL(
+                m_resourceProvider->GetCEngineString(SIDS_PLUS),
+                wstring{ CCalcEngine::OpCodeToBinaryString(IDC_ADD, false) },
+                L"Verify binary operator string.");
+            VERIFY_IS_TRUE(CCalcEngine::OpCodeToString(IDC_BINPOS63).empty(), L"Verify op codes outside of the string table.");
+        }
+
+        TEST_METHOD(TestGetStringUnmappedId)
+        {
+            VERIFY_ARE_EQUAL(
+                m_resourceProvider->GetCEngineString(SIDS_SIND),
+                wstring{ CCalcEngine::GetString(EngineStringIndex(SIDS_SIND)) },
+                L"Verify numeric id lookup.");
+            VERIFY_IS_TRUE(CCalcEngine::GetString(-1).empty(), L"Verify negative id.");
+            VERIFY_IS_TRUE(CCalcEngine::GetString(SIDS_NUMERIC_COUNT).empty(), L"Verify first id past the numeric resource keys.");
+            VERIFY_IS_TRUE(
+                CCalcEngine::GetString(EngineStringIndex(SIDS_ASECG)).empty(), L"Verify ids don't reach the named resource keys.");
+        }
+
+        TEST_METHOD(TestPackedCommands)
+        {
+            vector<int> decimalCommands{ IDC_1, IDC_2, IDC_PNT, IDC_5, IDC_EXP, IDC_SIGN, IDC_3 };
+            CPackedCommands packed(decimalCommands);
+            VERIFY_ARE_EQUAL(decimalCommands.size(), packed.size(), L"Verify size of packed commands.");
+            VERIFY_IS_TRUE(decimalCommands == packed.ToVector(), L"Verify packed commands round trip.");
+
+            packed.pop_back();
+            VERIFY_ARE_EQUAL(IDC_SIGN, packed.back(), L"Verify removing the last packed command.");
+
+            // Keystrokes that have no 4 bit code are kept as they are
+            vector<int> hexCommands{ IDC_1, IDC_A, IDC_F, 0 };
+            VERIFY_IS_TRUE(hexCommands == CPackedCommands(hexCommands).ToVector(), L"Verify commands without a 4 bit code round trip.");
+
+            vector<int> longCommands(100, IDC_7);
+            VERIFY_IS_TRUE(longCommands == CPackedCommands(longCommands).ToVector(), L"Verify commands longer than the inline buffer round trip.");
+
+            COpndCommand operand(make_shared<vector<int>>(decimalCommands), true, true, false);
+            VERIFY_ARE_EQUAL(wstring(L"-12.5e-3"), operand.GetToken(L'.'), L"Verify operand token.");
+            VERIFY_ARE_EQUAL(wstring(L"-12,5e-3"), operand.GetToken(L','), L"Verify operand token after a decimal symbol change.");
+            operand.ToggleSign();
+            VERIFY_ARE_EQUAL(wstring(L"12,5e-3"), operand.GetToken(L','), L"Verify operand token after a sign change.");
+            VERIFY_IS_TRUE(decimalCommands == *operand.GetCommands(), L"Verify operand commands.");
+        }
+
     private:
         unique_ptr<CCalcEngine> m_calcEngine;
         shared_ptr<IResourceProvider> m_resourceProvider;
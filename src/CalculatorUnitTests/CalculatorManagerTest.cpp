@@ -4,6 +4,8 @@
 #include "pch.h"
 
 #include <CppUnitTest.h>
+#include <chrono>
+#include <random>
 
 #include "CalcManager/CalculatorHistory.h"
 #include "CalcViewModel/Common/EngineResourceProvider.h"
@@ -32,6 +34,8 @@ namespace CalculatorManagerTest
             m_isError = false;
             m_maxDigitsCalledCount = 0;
             m_binaryOperatorReceivedCallCount = 0;
+            m_setMemorizedNumbersCallCount = 0;
+            m_memorizedNumberUpdatedCallCount = 0;
         }
 
         void SetPrimaryDisplay(const wstring& text, bool isError) override
@@ -57,6 +61,20 @@ namespace CalculatorManagerTest
         void SetMemorizedNumbers(const vector<wstring>& numbers) override
         {
             m_memorizedNumberStrings = numbers;
+            m_setMemorizedNumbersCallCount++;
+        }
+        void OnMemorizedNumberInserted(unsigned int indexOfMemory, const wstring& number) override
+        {
+            m_memorizedNumberStrings.insert(m_memorizedNumberStrings.begin() + indexOfMemory, number);
+        }
+        void OnMemorizedNumberUpdated(unsigned int indexOfMemory, const wstring& number) override
+        {
+            m_memorizedNumberStrings.at(indexOfMemory) = number;
+            m_memorizedNumberUpdatedCallCount++;
+        }
+        void OnMemorizedNumberRemoved(unsigned int indexOfMemory) override
+        {
+            m_memorizedNumberStrings.erase(m_memorizedNumberStrings.begin() + indexOfMemory);
         }
 
         void SetParenthesisNumber(unsigned int parenthesisCount) override
@@ -118,6 +136,16 @@ namespace CalculatorManagerTest
             return m_binaryOperatorReceivedCallCount;
         }
 
+        int GetSetMemorizedNumbersCallCount()
+        {
+            return m_setMemorizedNumbersCallCount;
+        }
+
+        int GetMemorizedNumberUpdatedCallCount()
+        {
+            return m_memorizedNumberUpdatedCallCount;
+        }
+
     private:
         wstring m_primaryDisplay;
         wstring m_expression;
@@ -126,6 +154,8 @@ namespace CalculatorManagerTest
         vector<wstring> m_memorizedNumberStrings;
         int m_maxDigitsCalledCount;
         int m_binaryOperatorReceivedCallCount;
+        int m_setMemorizedNumbersCallCount;
+        int m_memorizedNumberUpdatedCallCount;
     };
 
     class TestDriver
@@ -186,6 +216,8 @@ namespace CalculatorManagerTest
         TEST_METHOD(CalculatorManagerTestModeChange);
 
         TEST_METHOD(CalculatorManagerTestMemory);
+        TEST_METHOD(CalculatorManagerTestMemoryUpdates);
+        TEST_METHOD(CalculatorManagerTestSaveLoadState);
 
         TEST_METHOD(CalculatorManagerTestMaxDigitsReached);
         TEST_METHOD(CalculatorManagerTestMaxDigitsReached_LeadingDecimal);
@@ -196,6 +228,13 @@ namespace CalculatorManagerTest
         TEST_METHOD(UnitConversionManagerNumberFormattingUtils_GetNumberDigitsWholeNumberPart);
         TEST_METHOD(UnitConversionManagerNumberFormattingUtils_RoundSignificantDigits);
         TEST_METHOD(UnitConversionManagerNumberFormattingUtils_ToScientificNumber);
+        TEST_METHOD(UnitConversionManagerNumberFormattingUtils_BufferFormattingMatchesStreams);
+        // Timing only, kept out of the default run. Remove TEST_IGNORE locally to measure.
+        BEGIN_TEST_METHOD_ATTRIBUTE(UnitConversionManagerNumberFormattingUtils_FormattingBenchmark)
+            TEST_METHOD_ATTRIBUTE(L"TestCategory", L"Benchmark")
+            TEST_IGNORE()
+        END_TEST_METHOD_ATTRIBUTE()
+        TEST_METHOD(UnitConversionManagerNumberFormattingUtils_FormattingBenchmark);
 
         TEST_METHOD(CalculatorManagerTestBinaryOperatorReceived);
         TEST_METHOD(CalculatorManagerTestBinaryOperatorReceived_Multiple);
@@ -901,6 +940,130 @@ namespace CalculatorManagerTest
         m_calculatorManager->MemorizeNumber();
     }
 
+    void CalculatorManagerTest::CalculatorManagerTestMemoryUpdates()
+    {
+        CalculatorManagerDisplayTester* pCalculatorDisplay = (CalculatorManagerDisplayTester*)m_calculatorDisplayTester.get();
+
+        Cleanup();
+        m_calculatorManager->SendCommand(Command::Command1);
+        m_calculatorManager->MemorizeNumber();
+        m_calculatorManager->SendCommand(Command::Command2);
+        m_calculatorManager->MemorizeNumber();
+        m_calculatorManager->SendCommand(Command::Command3);
+        m_calculatorManager->MemorizeNumber();
+
+        // Memory operations only send the slots they touch
+        m_calculatorManager->MemorizedNumberAdd(1);
+        m_calculatorManager->MemorizedNumberClear(2);
+        VERIFY_ARE_EQUAL(0, pCalculatorDisplay->GetSetMemorizedNumbersCallCount());
+        VERIFY_ARE_EQUAL(1, pCalculatorDisplay->GetMemorizedNumberUpdatedCallCount());
+
+        vector<wstring> memorizedNumbers = pCalculatorDisplay->GetMemorizedNumbers();
+        VERIFY_ARE_EQUAL((size_t)2, memorizedNumbers.size());
+        VERIFY_ARE_EQUAL(wstring(L"3"), memorizedNumbers.at(0));
+        VERIFY_ARE_EQUAL(wstring(L"5"), memorizedNumbers.at(1));
+
+        // Changing the radix renders all the slots again
+        m_calculatorManager->SendCommand(Command::ModeProgrammer);
+        m_calculatorManager->SetRadix(RadixType::Binary);
+        VERIFY_ARE_EQUAL(1, pCalculatorDisplay->GetSetMemorizedNumbersCallCount());
+
+        memorizedNumbers = pCalculatorDisplay->GetMemorizedNumbers();
+        VERIFY_ARE_EQUAL((size_t)2, memorizedNumbers.size());
+        VERIFY_ARE_EQUAL(wstring(L"11"), memorizedNumbers.at(0));
+        VERIFY_ARE_EQUAL(wstring(L"101"), memorizedNumbers.at(1));
+
+        // Only a precision change renders all the slots again
+        m_calculatorManager->SetPrecision(64);
+        VERIFY_ARE_EQUAL(1, pCalculatorDisplay->GetSetMemorizedNumbersCallCount());
+        m_calculatorManager->SetPrecision(32);
+        VERIFY_ARE_EQUAL(2, pCalculatorDisplay->GetSetMemorizedNumbersCallCount());
+        m_calculatorManager->SetPrecision(64);
+        VERIFY_ARE_EQUAL(3, pCalculatorDisplay->GetSetMemorizedNumbersCallCount());
+
+        memorizedNumbers = pCalculatorDisplay->GetMemorizedNumbers();
+        VERIFY_ARE_EQUAL((size_t)2, memorizedNumbers.size());
+        VERIFY_ARE_EQUAL(wstring(L"11"), memorizedNumbers.at(0));
+
+        // When the memory is full the oldest slot is dropped
+        Cleanup();
+        for (int i = 0; i < 100; i++)
+        {
+            m_calculatorManager->SendCommand(Command::Command1);
+            m_calculatorManager->MemorizeNumber();
+        }
+        m_calculatorManager->SendCommand(Command::Command2);
+        m_calculatorManager->MemorizeNumber();
+
+        memorizedNumbers = pCalculatorDisplay->GetMemorizedNumbers();
+        VERIFY_ARE_EQUAL((size_t)100, memorizedNumbers.size());
+        VERIFY_ARE_EQUAL(wstring(L"2"), memorizedNumbers.at(0));
+        VERIFY_ARE_EQUAL(wstring(L"1"), memorizedNumbers.at(99));
+        VERIFY_ARE_EQUAL(0, pCalculatorDisplay->GetSetMemorizedNumbersCallCount());
+    }
+
+    void CalculatorManagerTest::CalculatorManagerTestSaveLoadState()
+    {
+        CalculatorManagerDisplayTester sourceDisplay;
+        CalculatorManager source(&sourceDisplay, m_resourceProvider.get());
+        source.SetStandardMode();
+
+        Command standardCommands[] = { Command::Command1, Command::CommandPNT, Command::Command5, Command::CommandADD, Command::Command2,
+                                       Command::CommandEQU,  Command::Command9,   Command::CommandSQRT, Command::CommandEQU, Command::CommandNULL };
+        for (Command* command = standardCommands; *command != Command::CommandNULL; command++)
+        {
+            source.SendCommand(*command);
+        }
+        source.MemorizeNumber();
+
+        source.SetScientificMode();
+        Command scientificCommands[] = { Command::Command1, Command::CommandDIV, Command::Command3, Command::CommandEQU, Command::CommandNULL };
+        for (Command* command = scientificCommands; *command != Command::CommandNULL; command++)
+        {
+            source.SendCommand(*command);
+        }
+        source.MemorizeNumber();
+
+        vector<uint8_t> state = source.SaveState();
+
+        CalculatorManagerDisplayTester targetDisplay;
+        CalculatorManager target(&targetDisplay, m_resourceProvider.get());
+        target.SetScientificMode();
+        VERIFY_IS_TRUE(target.LoadState(state.data(), state.size()));
+
+        for (CalculatorMode mode : { CalculatorMode::Standard, CalculatorMode::Scientific })
+        {
+            auto const& sourceItems = source.GetHistoryItems(mode);
+            auto const& targetItems = target.GetHistoryItems(mode);
+            VERIFY_ARE_EQUAL(sourceItems.size(), targetItems.size());
+            for (size_t i = 0; i < sourceItems.size(); i++)
+            {
+                VERIFY_ARE_EQUAL(sourceItems[i]->historyItemVector.expression, targetItems[i]->historyItemVector.expression);
+                VERIFY_ARE_EQUAL(sourceItems[i]->historyItemVector.result, targetItems[i]->historyItemVector.result);
+                VERIFY_ARE_EQUAL(sourceItems[i]->historyItemVector.spCommands->size(), targetItems[i]->historyItemVector.spCommands->size());
+            }
+        }
+        VERIFY_ARE_EQUAL((size_t)2, source.GetHistoryItems(CalculatorMode::Standard).size());
+
+        vector<wstring> memorizedNumbers = targetDisplay.GetMemorizedNumbers();
+        VERIFY_ARE_EQUAL((size_t)2, memorizedNumbers.size());
+        VERIFY_ARE_EQUAL(sourceDisplay.GetMemorizedNumbers().at(0), memorizedNumbers.at(0));
+        VERIFY_ARE_EQUAL(wstring(L"5"), memorizedNumbers.at(1));
+
+        // Memories keep their full precision, 1/3 recalled and multiplied by 3 gives 1 again
+        target.MemorizedNumberLoad(0);
+        target.SendCommand(Command::CommandMUL);
+        target.SendCommand(Command::Command3);
+        target.SendCommand(Command::CommandEQU);
+        VERIFY_ARE_EQUAL(wstring(L"1"), targetDisplay.GetPrimaryDisplay());
+
+        // A truncated or unknown buffer is refused and leaves the state alone
+        VERIFY_IS_FALSE(target.LoadState(state.data(), state.size() - 1));
+        state[4] = 0xFF;
+        VERIFY_IS_FALSE(target.LoadState(state.data(), state.size()));
+        VERIFY_ARE_EQUAL((size_t)2, targetDisplay.GetMemorizedNumbers().size());
+    }
+
     // Send 12345678910111213 and verify MaxDigitsReached
     void CalculatorManagerTest::CalculatorManagerTestMaxDigitsReached()
     {
@@ -1017,6 +1180,96 @@ namespace CalculatorManagerTest
         VERIFY_ARE_EQUAL(result, L"-3.432432e-09");
     }
 
+    // The formatting used before the std::to_chars based implementation, kept as the reference for its output
+    static wstring StreamRoundSignificantDigits(double num, unsigned int numSignificant)
+    {
+        wstringstream out(wstringstream::out);
+        out << fixed;
+        out.precision(numSignificant);
+        out << num;
+        return out.str();
+    }
+
+    static wstring StreamToScientificNumber(double number)
+    {
+        wstringstream out(wstringstream::out);
+        out << scientific << number;
+        return out.str();
+    }
+
+    void CalculatorManagerTest::UnitConversionManagerNumberFormattingUtils_BufferFormattingMatchesStreams()
+    {
+        wchar_t buffer[FORMATTEDNUMBERBUFFERSIZE];
+        size_t length = RoundSignificantDigits(-2312.1244243346454345, 5, buffer, FORMATTEDNUMBERBUFFERSIZE);
+        VERIFY_ARE_EQUAL(wstring(L"-2312.12442"), wstring(buffer, length));
+        length = ToScientificNumber(0.0232, buffer, FORMATTEDNUMBERBUFFERSIZE);
+        VERIFY_ARE_EQUAL(wstring(L"2.320000e-02"), wstring(buffer, length));
+
+        // Results that don't fit and values that aren't finite are reported with a length of 0
+        VERIFY_ARE_EQUAL(size_t{ 0 }, RoundSignificantDigits(12.5, 3, buffer, 5));
+        VERIFY_ARE_EQUAL(size_t{ 0 }, ToScientificNumber(numeric_limits<double>::infinity(), buffer, FORMATTEDNUMBERBUFFERSIZE));
+        VERIFY_ARE_EQUAL(StreamToScientificNumber(numeric_limits<double>::infinity()), ToScientificNumber(numeric_limits<double>::infinity()));
+
+        mt19937 generator(42);
+        uniform_real_distribution<double> mantissas(-10.0, 10.0);
+        uniform_int_distribution<int> exponents(-20, 20);
+        uniform_int_distribution<unsigned int> precisions(0, 15);
+        for (int i = 0; i < 10000; i++)
+        {
+            const double value = mantissas(generator) * pow(10.0, exponents(generator));
+            const unsigned int precision = precisions(generator);
+            VERIFY_ARE_EQUAL(StreamRoundSignificantDigits(value, precision), RoundSignificantDigits(value, precision));
+            VERIFY_ARE_EQUAL(StreamToScientificNumber(value), ToScientificNumber(value));
+        }
+
+        // Halfway cases are rounded from the exact binary value, like the streams do
+        VERIFY_ARE_EQUAL(StreamRoundSignificantDigits(0.125, 2), RoundSignificantDigits(0.125, 2));
+        VERIFY_ARE_EQUAL(StreamRoundSignificantDigits(2.5, 0), RoundSignificantDigits(2.5, 0));
+        VERIFY_ARE_EQUAL(StreamRoundSignificantDigits(-0.4, 0), RoundSignificantDigits(-0.4, 0));
+    }
+
+    // Reports the cost of formatting a value with the streams and with the std::to_chars based functions
+    void CalculatorManagerTest::UnitConversionManagerNumberFormattingUtils_FormattingBenchmark()
+    {
+        constexpr int iterations = 100000;
+        mt19937 generator(42);
+        uniform_real_distribution<double> distribution(-1000000.0, 1000000.0);
+        vector<double> values(iterations);
+        for (double& value : values)
+        {
+            value = distribution(generator);
+        }
+
+        size_t totalLength = 0;
+        auto start = chrono::steady_clock::now();
+        for (double value : values)
+        {
+            totalLength += StreamRoundSignificantDigits(value, 6).size() + StreamToScientificNumber(value).size();
+        }
+        const chrono::duration<double, nano> streamElapsed = chrono::steady_clock::now() - start;
+
+        start = chrono::steady_clock::now();
+        for (double value : values)
+        {
+            totalLength += RoundSignificantDigits(value, 6).size() + ToScientificNumber(value).size();
+        }
+        const chrono::duration<double, nano> stringElapsed = chrono::steady_clock::now() - start;
+
+        wchar_t buffer[FORMATTEDNUMBERBUFFERSIZE];
+        start = chrono::steady_clock::now();
+        for (double value : values)
+        {
+            totalLength += RoundSignificantDigits(value, 6, buffer, FORMATTEDNUMBERBUFFERSIZE) + ToScientificNumber(value, buffer, FORMATTEDNUMBERBUFFERSIZE);
+        }
+        const chrono::duration<double, nano> bufferElapsed = chrono::steady_clock::now() - start;
+
+        VERIFY_IS_TRUE(totalLength > 0);
+        wstring message = L"Formatting a value, streams: " + to_wstring(streamElapsed.count() / (2 * iterations)) + L" ns, strings: "
+                          + to_wstring(stringElapsed.count() / (2 * iterations)) + L" ns, buffers: " + to_wstring(bufferElapsed.count() / (2 * iterations))
+                          + L" ns";
+        Logger::WriteMessage(message.c_str());
+    }
+
     void CalculatorManagerTest::CalculatorManagerTestBinaryOperatorReceived()
     {
         CalculatorManagerDisplayTester* pCalculatorDisplay = (CalculatorManagerDisplayTester*)m_calculatorDisplayTester.get();
@@ -0,0 +1,1047 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "pch.h"
+
+#include <CppUnitTest.h>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include "GraphingImpl/Native/BatchEvaluator.h"
+#include "GraphingImpl/Native/CurveCache.h"
+#include "GraphingImpl/Native/ExpressionParser.h"
+#include "GraphingImpl/Native/Graph.h"
+#include "GraphingImpl/Native/GraphRenderer.h"
+#include "GraphingImpl/Native/GraphingErrors.h"
+#include "GraphingImpl/Native/MathSolver.h"
+#include "GraphingImpl/Native/Rasterizer.h"
+#include "GraphingImpl/Native/SegmentIndex.h"
+#include <random>
+
+using namespace NativeGraphingImpl;
+using namespace std;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace GraphingEngineUnitTests
+{
+    Program CompileFunctionOfX(const wstring& expression)
+    {
+        ExpressionParser parser(L'.', L',');
+        auto equations = parser.Parse(expression);
+        return Program::Compile(*equations[0].left, { L"x", L"y", L"a" }, Graphing::EvalTrigUnitMode::Radians);
+    }
+
+    vector<double> Linspace(double first, double last, size_t count)
+    {
+        vector<double> values(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            values[i] = first + (last - first) * i / (count - 1);
+        }
+        return values;
+    }
+
+    bool IsCloseTo(double actual, double expected)
+    {
+        if (isnan(expected))
+        {
+            return isnan(actual);
+        }
+        if (isinf(expected))
+        {
+            return actual == expected;
+        }
+        return fabs(actual - expected) <= 1e-13 * max(fabs(expected), 1e-300);
+    }
+
+    // [-5, 5] on both axes, 100 pixels per unit
+    const SampleWindow s_sampleWindow{ -5, 5, -5, 5, 1000, 1000 };
+
+    void SampleFunctionOfX(const Program& program, SampledCurve& curve)
+    {
+        const double arguments[] = { 0, 0, 0 };
+        CurveSampler sampler(program, 0);
+        sampler.Sample(arguments, s_sampleWindow, curve);
+    }
+
+    // Largest distance in pixels between the visible parts of the curve and the polylines, checked between the points
+    double MaxSampleError(const Program& program, const SampledCurve& curve, const SampleWindow& window = s_sampleWindow)
+    {
+        const double sweepScale = window.sweepPixels / (window.sweepMax - window.sweepMin);
+        const double valueScale = window.valuePixels / (window.valueMax - window.valueMin);
+        double worst = 0;
+        for (size_t i = 0; i < curve.polylineStarts.size(); i++)
+        {
+            const size_t end = i + 1 < curve.polylineStarts.size() ? curve.polylineStarts[i + 1] : curve.points.size();
+            for (size_t j = curve.polylineStarts[i] + 1; j < end; j++)
+            {
+                const CurvePoint& first = curve.points[j - 1];
+                const CurvePoint& last = curve.points[j];
+                for (int k = 1; k < 4; k++)
+                {
+                    double arguments[] = { first.x + (last.x - first.x) * k / 4, 0, 0 };
+                    const double y = program.Evaluate(arguments);
+                    if (!(y >= window.valueMin && y <= window.valueMax))
+                    {
+                        continue;
+                    }
+
+                    const double segmentX = (last.x - first.x) * sweepScale;
+                    const double segmentY = (last.y - first.y) * valueScale;
+                    const double toX = (arguments[0] - first.x) * sweepScale;
+                    const double toY = (y - first.y) * valueScale;
+                    const double t = min(1.0, max(0.0, (toX * segmentX + toY * segmentY) / (segmentX * segmentX + segmentY * segmentY)));
+                    worst = max(worst, hypot(toX - t * segmentX, toY - t * segmentY));
+                }
+            }
+        }
+        return worst;
+    }
+
+    void SampleCachedFrame(CurveCache& cache, CurveSampler& sampler, const SampleWindow& window, SampledCurve& curve, double a = 0)
+    {
+        cache.ResetStatistics();
+        cache.BeginFrame();
+        cache.Sample(0, sampler, { 0, 0, a }, window, curve);
+        cache.EndFrame();
+    }
+
+    unique_ptr<Graphing::IMathSolver> CreateLinearInputSolver()
+    {
+        auto solver = Graphing::IMathSolver::CreateMathSolver();
+        solver->ParsingOptions().SetFormatType(Graphing::FormatType::LinearInput);
+        solver->FormatOptions().SetFormatType(Graphing::FormatType::LinearInput);
+        return solver;
+    }
+
+    // Draws on white in black, the blue channel of a pixel then goes from 255 to 0 with the coverage
+    const Graphing::Color s_white{ 255, 255, 255 };
+    const Graphing::Color s_black{ 0, 0, 0 };
+
+    uint8_t Brightness(const Rasterizer& rasterizer, unsigned int x, unsigned int y)
+    {
+        return static_cast<uint8_t>(rasterizer.GetPixels()[static_cast<size_t>(y) * rasterizer.GetWidth() + x]);
+    }
+
+    void DrawTestImage(Rasterizer& rasterizer)
+    {
+        rasterizer.Clear(300, 200, s_white);
+        rasterizer.SetStroke(Graphing::Color(255, 0, 0), 1, Graphing::Renderer::LineStyle::Solid);
+        for (int i = 0; i < 50; i++)
+        {
+            rasterizer.BeginFigure(150, 100);
+            rasterizer.AddLine(150 + 400 * cos(i * 0.1), 100 + 400 * sin(i * 0.1));
+        }
+        rasterizer.SetStroke(Graphing::Color(0, 0, 255, 128), 3, Graphing::Renderer::LineStyle::DashDot);
+        rasterizer.BeginFigure(-10, 190);
+        for (int x = 0; x <= 310; x += 5)
+        {
+            rasterizer.AddLine(x, 100 + 80 * sin(x * 0.05));
+        }
+    }
+
+    TEST_CLASS(GraphingEngineTests)
+    {
+    public:
+        TEST_METHOD(BatchEvaluatorMatchesProgram);
+        TEST_METHOD(BatchEvaluatorFlagsDiscontinuities);
+        TEST_METHOD(BatchEvaluatorReusesHoistedValues);
+        // Timing only, kept out of the default run. Remove TEST_IGNORE locally to measure.
+        BEGIN_TEST_METHOD_ATTRIBUTE(BatchEvaluatorBenchmark)
+            TEST_METHOD_ATTRIBUTE(L"TestCategory", L"Benchmark")
+            TEST_IGNORE()
+        END_TEST_METHOD_ATTRIBUTE()
+        TEST_METHOD(BatchEvaluatorBenchmark);
+        TEST_METHOD(IntervalEvaluatorBoundsValues);
+        TEST_METHOD(CurveSamplerFollowsCurves);
+        TEST_METHOD(CurveSamplerSplitsAtPoles);
+        TEST_METHOD(CurveSamplerSplitsAtStepsAndDomainEdges);
+        TEST_METHOD(CurveCacheReusesStripsWhenPanning);
+        TEST_METHOD(CurveCacheShowsNearestLevelWhileZooming);
+        TEST_METHOD(CurveCacheStaysWithinItsSize);
+        TEST_METHOD(SegmentIndexFindsNearestSegment);
+        TEST_METHOD(ThreadPoolRunsEveryIteration);
+        TEST_METHOD(RasterizerDrawsLines);
+        TEST_METHOD(RasterizerDoesNotDependOnThreads);
+        TEST_METHOD(MathSolverRoundTripsLinearInput);
+        TEST_METHOD(MathSolverReportsSyntaxErrors);
+        TEST_METHOD(MathSolverParsesGraphControlRequests);
+        TEST_METHOD(GraphClassifiesEquations);
+        TEST_METHOD(GraphKeepsVariableValues);
+        TEST_METHOD(GraphRendererSamplesOnlyChangedEquations);
+        TEST_METHOD(GraphRendererTracesNearestCurve);
+    };
+
+    // Every function and the special values the approximations hand to the scalar functions
+    void GraphingEngineTests::BatchEvaluatorMatchesProgram()
+    {
+        const wchar_t* expressions[] = { L"x^3-2x+1", L"sin(x)",      L"cos(x)",        L"tan(x)",  L"e^x",          L"ln(x)",
+                                         L"log(x)",   L"x^2.5",       L"x^(1/3)",       L"x^(2/3)", L"2^x",          L"x^y",
+                                         L"floor(x)", L"ceil(x)",     L"round(x)",      L"sign(x)", L"max(x,ln(x))", L"min(ln(x),x)",
+                                         L"sqrt(x)",  L"asin(x/100)", L"sin(1000000x)", L"x!",      L"a x+y" };
+
+        vector<double> samples = Linspace(-75, 75, 4001);
+        const double specialValues[] = { 0.0,  -0.0,  1e-320, -1e-320, 1e300, -1e300, INFINITY, -INFINITY, NAN, 1e5, 1.5e5,
+                                         -3e6, 709.8, 710,    -745,    -750,  0.5,    -0.5,     2.5,       -2.5 };
+        samples.insert(samples.end(), begin(specialValues), end(specialValues));
+
+        double arguments[] = { 0, -3, 0.7 };
+        vector<double> results(samples.size());
+        vector<uint8_t> flags(samples.size());
+        for (const wchar_t* expression : expressions)
+        {
+            Program program = CompileFunctionOfX(expression);
+            BatchEvaluator evaluator(program);
+            evaluator.Evaluate(arguments, 0, samples.data(), samples.size(), results.data(), flags.data());
+
+            for (size_t i = 0; i < samples.size(); i++)
+            {
+                arguments[0] = samples[i];
+                const double expected = program.Evaluate(arguments);
+                VERIFY_IS_TRUE(IsCloseTo(results[i], expected), expression);
+                VERIFY_ARE_EQUAL(!isfinite(expected), ((flags[i] & SampleFlags::Undefined) != 0), expression);
+            }
+        }
+    }
+
+    void GraphingEngineTests::BatchEvaluatorFlagsDiscontinuities()
+    {
+        const double arguments[] = { 0, 0, 0 };
+        auto jumps = [&](const wchar_t* expression, const vector<double>& samples) {
+            Program program = CompileFunctionOfX(expression);
+            BatchEvaluator evaluator(program);
+            vector<double> results(samples.size());
+            vector<uint8_t> flags(samples.size());
+            evaluator.Evaluate(arguments, 0, samples.data(), samples.size(), results.data(), flags.data());
+
+            vector<double> positions;
+            for (size_t i = 0; i < samples.size(); i++)
+            {
+                if ((flags[i] & SampleFlags::Discontinuity) != 0)
+                {
+                    positions.push_back((samples[i - 1] + samples[i]) / 2);
+                }
+            }
+            return positions;
+        };
+
+        // The poles of tan at odd multiples of pi/2, spread across several blocks
+        auto tanJumps = jumps(L"tan(x)", Linspace(-5, 5, 1001));
+        VERIFY_ARE_EQUAL(size_t{ 4 }, tanJumps.size());
+        const double halfPi = 1.5707963267948966;
+        VERIFY_IS_LESS_THAN(fabs(tanJumps[0] + 3 * halfPi), 0.01);
+        VERIFY_IS_LESS_THAN(fabs(tanJumps[1] + halfPi), 0.01);
+        VERIFY_IS_LESS_THAN(fabs(tanJumps[2] - halfPi), 0.01);
+        VERIFY_IS_LESS_THAN(fabs(tanJumps[3] - 3 * halfPi), 0.01);
+
+        auto reciprocalJumps = jumps(L"1/x", Linspace(-1, 1, 1000));
+        VERIFY_ARE_EQUAL(size_t{ 1 }, reciprocalJumps.size());
+        VERIFY_IS_LESS_THAN(fabs(reciprocalJumps[0]), 0.01);
+
+        VERIFY_ARE_EQUAL(size_t{ 4 }, jumps(L"floor(x)", Linspace(-2, 2, 999)).size());
+        VERIFY_ARE_EQUAL(size_t{ 1 }, jumps(L"x^-3", Linspace(-1, 1, 1000)).size());
+
+        // Poles without a sign change and continuous functions are not reported
+        VERIFY_ARE_EQUAL(size_t{ 0 }, jumps(L"1/x^2", Linspace(-1, 1, 1000)).size());
+        VERIFY_ARE_EQUAL(size_t{ 0 }, jumps(L"sin(x)+x^3", Linspace(-10, 10, 1000)).size());
+    }
+
+    // Evaluating the same samples again after a variable changed gives what a new evaluator gives, flags included
+    void GraphingEngineTests::BatchEvaluatorReusesHoistedValues()
+    {
+        const wchar_t* expressions[] = { L"a sin(x)^2+e^(x/5)", L"tan(x)a+floor(x)", L"1/(x-a)+tan(x/2)", L"ln(x)^a", L"sin(a x)", L"x^3+a" };
+        const vector<double> firstSamples = Linspace(-10, 10, 300);
+        const vector<double> secondSamples = Linspace(-3, 7, 33);
+
+        for (const wchar_t* expression : expressions)
+        {
+            Program program = CompileFunctionOfX(expression);
+            BatchEvaluator evaluator(program);
+            for (double a : { 0.7, 1.3, -2.1, 1.3 })
+            {
+                for (const vector<double>* samples : { &firstSamples, &secondSamples })
+                {
+                    const double arguments[] = { 0, 0, a };
+                    BatchEvaluator newEvaluator(program);
+                    vector<double> expected(samples->size());
+                    vector<uint8_t> expectedFlags(samples->size());
+                    newEvaluator.Evaluate(arguments, 0, samples->data(), samples->size(), expected.data(), expectedFlags.data());
+
+                    // The first values are kept without their keys, the flags then need them
+                    vector<double> results(samples->size());
+                    vector<uint8_t> flags(samples->size());
+                    evaluator.Evaluate(arguments, 0, samples->data(), samples->size(), results.data(), a == 0.7 ? nullptr : flags.data());
+                    for (size_t i = 0; i < samples->size(); i++)
+                    {
+                        VERIFY_IS_TRUE(results[i] == expected[i] || (isnan(results[i]) && isnan(expected[i])), expression);
+                        if (a != 0.7)
+                        {
+                            VERIFY_ARE_EQUAL(expectedFlags[i], flags[i], expression);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // Reports the throughput of the batch evaluator next to evaluating one sample at a time
+    void GraphingEngineTests::BatchEvaluatorBenchmark()
+    {
+        const wchar_t* mixes[] = { L"x^3-2x+1", L"sin(x)*cos(2x)+tan(x/3)", L"e^(-x^2)+ln(|x|+1)", L"x^2.5+2^x" };
+        constexpr int iterations = 50;
+        const vector<double> samples = Linspace(-10, 10, 1 << 16);
+        vector<double> results(samples.size());
+        vector<uint8_t> flags(samples.size());
+        double arguments[] = { 0, 0, 0 };
+
+        Logger::WriteMessage((wstring(L"Batch evaluator lanes: ") + BatchEvaluator::InstructionSetName()).c_str());
+        for (const wchar_t* mix : mixes)
+        {
+            Program program = CompileFunctionOfX(mix);
+            BatchEvaluator evaluator(program);
+
+            auto start = chrono::steady_clock::now();
+            for (int i = 0; i < iterations; i++)
+            {
+                evaluator.Evaluate(arguments, 0, samples.data(), samples.size(), results.data(), flags.data());
+            }
+            chrono::duration<double> batchElapsed = chrono::steady_clock::now() - start;
+
+            vector<double> registers(program.RegisterCount());
+            program.InitializeRegisters(registers.data());
+            start = chrono::steady_clock::now();
+            for (int i = 0; i < iterations; i++)
+            {
+                for (size_t j = 0; j < samples.size(); j++)
+                {
+                    arguments[0] = samples[j];
+                    results[j] = program.Evaluate(arguments, registers.data());
+                }
+            }
+            chrono::duration<double> scalarElapsed = chrono::steady_clock::now() - start;
+
+            const double sampleCount = static_cast<double>(samples.size()) * iterations;
+            wstring message = wstring(mix) + L": " + to_wstring(static_cast<uint64_t>(sampleCount / batchElapsed.count()))
+                              + L" samples per second in batches, " + to_wstring(static_cast<uint64_t>(sampleCount / scalarElapsed.count()))
+                              + L" one at a time";
+            Logger::WriteMessage(message.c_str());
+        }
+    }
+
+    // The bounds over a range hold every value inside it, and the bounds of the derivative hold every difference quotient
+    void GraphingEngineTests::IntervalEvaluatorBoundsValues()
+    {
+        const wchar_t* expressions[] = { L"x^3-2x+1", L"sin(3x)*cos(x)", L"tan(x)",  L"e^x/(x^2+1)", L"ln(x)",   L"sqrt(x)", L"x^(1/3)",
+                                         L"x^(2/3)",  L"x^-2",           L"floor(x)", L"|x|-x",       L"atan(x)", L"cosh(x)", L"max(x,x^2)",
+                                         L"x!",       L"2^x",            L"x^x",      L"asin(x/4)",   L"1/x" };
+        const double ranges[][2] = { { -4, -3.9 }, { -1, 1 }, { -0.01, 0.02 }, { 0.5, 0.6 }, { 1.5, 1.6 }, { 2, 5 }, { -3.5, -3.2 }, { 0, 0.1 } };
+        const double arguments[] = { 0, 0, 0 };
+
+        for (const wchar_t* expression : expressions)
+        {
+            Program program = CompileFunctionOfX(expression);
+            IntervalEvaluator evaluator(program);
+            for (const auto& range : ranges)
+            {
+                Interval slope;
+                const Interval bounds = evaluator.Evaluate(arguments, 0, range[0], range[1], slope);
+                const vector<double> samples = Linspace(range[0], range[1], 257);
+                double previous = NAN;
+                for (size_t i = 0; i < samples.size(); i++)
+                {
+                    double sampleArguments[] = { samples[i], 0, 0 };
+                    const double value = program.Evaluate(sampleArguments);
+                    if (!isfinite(value))
+                    {
+                        VERIFY_IS_TRUE(bounds.mayBeUndefined || bounds.mayJump, expression);
+                    }
+                    else
+                    {
+                        const double tolerance = 1e-12 * max(1.0, fabs(value));
+                        VERIFY_IS_TRUE(value >= bounds.low - tolerance && value <= bounds.high + tolerance, expression);
+                    }
+
+                    if (!bounds.mayJump && !bounds.mayBeUndefined && isfinite(previous) && isfinite(value))
+                    {
+                        const double quotient = (value - previous) / (samples[i] - samples[i - 1]);
+                        const double tolerance = 1e-6 * max(1.0, fabs(quotient));
+                        VERIFY_IS_TRUE(quotient >= slope.low - tolerance && quotient <= slope.high + tolerance, expression);
+                    }
+                    previous = value;
+                }
+            }
+        }
+    }
+
+    // The polylines stay within a pixel of smooth curves with fewer evaluations than one per pixel where the curve is simple
+    void GraphingEngineTests::CurveSamplerFollowsCurves()
+    {
+        struct
+        {
+            const wchar_t* expression;
+            size_t maxEvaluations;
+        } curves[] = { { L"x", 300 },        { L"x^3-2x+1", 500 }, { L"sin(x)", 500 },         { L"e^x", 500 },
+                       { L"sin(40x)", 4000 }, { L"|x|", 500 },      { L"1/(x^2+0.0001)", 500 },  { L"x^x", 2000 } };
+
+        SampledCurve curve;
+        for (const auto& test : curves)
+        {
+            Program program = CompileFunctionOfX(test.expression);
+            SampleFunctionOfX(program, curve);
+
+            VERIFY_IS_FALSE(curve.hasMissingData, test.expression);
+            VERIFY_IS_TRUE(curve.asymptotes.empty(), test.expression);
+            VERIFY_IS_LESS_THAN_OR_EQUAL(curve.evaluationCount, test.maxEvaluations, test.expression);
+            VERIFY_IS_LESS_THAN(MaxSampleError(program, curve), 1.0, test.expression);
+        }
+    }
+
+    void GraphingEngineTests::CurveSamplerSplitsAtPoles()
+    {
+        const double halfPi = 1.5707963267948966;
+        SampledCurve curve;
+
+        // One polyline per branch of tan, none of them crosses a pole
+        Program tangent = CompileFunctionOfX(L"tan(x)");
+        SampleFunctionOfX(tangent, curve);
+        VERIFY_ARE_EQUAL(size_t{ 4 }, curve.asymptotes.size());
+        VERIFY_ARE_EQUAL(size_t{ 5 }, curve.polylineStarts.size());
+        const double poles[] = { -3 * halfPi, -halfPi, halfPi, 3 * halfPi };
+        for (size_t i = 0; i < 4; i++)
+        {
+            VERIFY_IS_LESS_THAN(fabs(curve.asymptotes[i] - poles[i]), 1e-4);
+            const CurvePoint& beforePole = curve.points[curve.polylineStarts[i + 1] - 1];
+            const CurvePoint& afterPole = curve.points[curve.polylineStarts[i + 1]];
+            VERIFY_IS_TRUE(beforePole.x < poles[i] && beforePole.y > s_sampleWindow.valueMax);
+            VERIFY_IS_TRUE(afterPole.x > poles[i] && afterPole.y < s_sampleWindow.valueMin);
+        }
+        VERIFY_IS_LESS_THAN(curve.evaluationCount, size_t{ 1000 });
+        VERIFY_IS_LESS_THAN(MaxSampleError(tangent, curve), 1.0);
+
+        Program reciprocal = CompileFunctionOfX(L"1/x");
+        SampleFunctionOfX(reciprocal, curve);
+        VERIFY_ARE_EQUAL(size_t{ 1 }, curve.asymptotes.size());
+        VERIFY_IS_LESS_THAN(fabs(curve.asymptotes[0]), 1e-4);
+        VERIFY_ARE_EQUAL(size_t{ 2 }, curve.polylineStarts.size());
+        VERIFY_IS_LESS_THAN(curve.points[curve.polylineStarts[1] - 1].y, s_sampleWindow.valueMin);
+        VERIFY_IS_GREATER_THAN(curve.points[curve.polylineStarts[1]].y, s_sampleWindow.valueMax);
+        VERIFY_IS_LESS_THAN(curve.evaluationCount, size_t{ 1000 });
+
+        // A pole without a sign change, and poles of gamma where the value is NaN
+        Program square = CompileFunctionOfX(L"1/x^2");
+        SampleFunctionOfX(square, curve);
+        VERIFY_ARE_EQUAL(size_t{ 1 }, curve.asymptotes.size());
+        VERIFY_ARE_EQUAL(size_t{ 2 }, curve.polylineStarts.size());
+
+        Program factorial = CompileFunctionOfX(L"x!");
+        SampleFunctionOfX(factorial, curve);
+        VERIFY_ARE_EQUAL(size_t{ 5 }, curve.asymptotes.size());
+        VERIFY_IS_LESS_THAN(MaxSampleError(factorial, curve), 1.0);
+    }
+
+    void GraphingEngineTests::CurveSamplerSplitsAtStepsAndDomainEdges()
+    {
+        SampledCurve curve;
+
+        Program floor = CompileFunctionOfX(L"floor(x)");
+        SampleFunctionOfX(floor, curve);
+        VERIFY_ARE_EQUAL(size_t{ 11 }, curve.polylineStarts.size());
+        VERIFY_IS_TRUE(curve.asymptotes.empty());
+        VERIFY_IS_LESS_THAN(MaxSampleError(floor, curve), 1e-6);
+
+        // The curve starts within a fraction of a pixel of the edge of the domain
+        Program root = CompileFunctionOfX(L"sqrt(x)");
+        SampleFunctionOfX(root, curve);
+        VERIFY_ARE_EQUAL(size_t{ 1 }, curve.polylineStarts.size());
+        VERIFY_IS_TRUE(curve.points[0].x >= 0 && curve.points[0].x < 0.0005);
+        VERIFY_IS_LESS_THAN(MaxSampleError(root, curve), 1.0);
+
+        Program circle = CompileFunctionOfX(L"sqrt(4-x^2)");
+        SampleFunctionOfX(circle, curve);
+        VERIFY_ARE_EQUAL(size_t{ 1 }, curve.polylineStarts.size());
+        VERIFY_IS_LESS_THAN(fabs(curve.points.front().x + 2), 0.0005);
+        VERIFY_IS_LESS_THAN(fabs(curve.points.back().x - 2), 0.0005);
+
+        // The edge of the domain of ln is not an asymptote, nor is the hole of x/x
+        Program logarithm = CompileFunctionOfX(L"ln(x)");
+        SampleFunctionOfX(logarithm, curve);
+        VERIFY_IS_TRUE(curve.asymptotes.empty());
+
+        Program hole = CompileFunctionOfX(L"x/x");
+        SampleFunctionOfX(hole, curve);
+        VERIFY_IS_TRUE(curve.asymptotes.empty());
+        VERIFY_ARE_EQUAL(size_t{ 2 }, curve.polylineStarts.size());
+    }
+
+    // At 100 pixels per unit the strips are 2 units wide and start at even numbers
+    void GraphingEngineTests::CurveCacheReusesStripsWhenPanning()
+    {
+        Program program = CompileFunctionOfX(L"sin(3x)+a");
+        CurveSampler sampler(program, 0);
+        CurveCache cache;
+        SampledCurve curve;
+
+        SampleCachedFrame(cache, sampler, s_sampleWindow, curve);
+        VERIFY_ARE_EQUAL(size_t{ 0 }, cache.GetStatistics().hits);
+        VERIFY_ARE_EQUAL(size_t{ 6 }, cache.GetStatistics().misses);
+        VERIFY_ARE_EQUAL(size_t{ 1 }, curve.polylineStarts.size());
+        VERIFY_IS_LESS_THAN(MaxSampleError(program, curve), 1.0);
+
+        const SampleWindow panned{ -4, 6, -4.5, 5.5, 1000, 1000 };
+        SampleCachedFrame(cache, sampler, panned, curve);
+        VERIFY_ARE_EQUAL(size_t{ 5 }, cache.GetStatistics().hits);
+        VERIFY_ARE_EQUAL(size_t{ 0 }, cache.GetStatistics().misses);
+        VERIFY_ARE_EQUAL(size_t{ 0 }, curve.evaluationCount);
+        VERIFY_ARE_EQUAL(size_t{ 1 }, curve.polylineStarts.size());
+        VERIFY_IS_LESS_THAN(MaxSampleError(program, curve, panned), 1.0);
+
+        const SampleWindow pannedFurther{ -2.5, 7.5, -5, 5, 1000, 1000 };
+        SampleCachedFrame(cache, sampler, pannedFurther, curve);
+        VERIFY_ARE_EQUAL(size_t{ 5 }, cache.GetStatistics().hits);
+        VERIFY_ARE_EQUAL(size_t{ 1 }, cache.GetStatistics().misses);
+        VERIFY_IS_LESS_THAN(MaxSampleError(program, curve, pannedFurther), 1.0);
+
+        // Every value of a variable has its own strips
+        SampleCachedFrame(cache, sampler, s_sampleWindow, curve, 1);
+        VERIFY_ARE_EQUAL(size_t{ 6 }, cache.GetStatistics().misses);
+        SampleCachedFrame(cache, sampler, s_sampleWindow, curve, 0);
+        VERIFY_ARE_EQUAL(size_t{ 6 }, cache.GetStatistics().hits);
+        VERIFY_IS_LESS_THAN(MaxSampleError(program, curve), 1.0);
+    }
+
+    void GraphingEngineTests::CurveCacheShowsNearestLevelWhileZooming()
+    {
+        Program program = CompileFunctionOfX(L"sin(3x)+a");
+        CurveSampler sampler(program, 0);
+        CurveCache cache;
+        SampledCurve curve;
+
+        // Each frame samples one new strip, the strips it leaves use the cached level
+        cache.SetFrameEvaluationBudget(0);
+        SampleCachedFrame(cache, sampler, s_sampleWindow, curve);
+        VERIFY_ARE_EQUAL(size_t{ 6 }, cache.GetStatistics().misses);
+        VERIFY_IS_FALSE(curve.hasMissingData);
+
+        const SampleWindow zoomedIn{ -2.5, 2.5, -2.5, 2.5, 1000, 1000 };
+        SampleCachedFrame(cache, sampler, zoomedIn, curve);
+        VERIFY_ARE_EQUAL(size_t{ 1 }, cache.GetStatistics().misses);
+        VERIFY_ARE_EQUAL(size_t{ 5 }, cache.GetStatistics().placeholders);
+        VERIFY_IS_TRUE(curve.hasMissingData);
+        VERIFY_IS_LESS_THAN(MaxSampleError(program, curve, zoomedIn), 2.0);
+
+        int frameCount = 1;
+        while (curve.hasMissingData && frameCount < 10)
+        {
+            SampleCachedFrame(cache, sampler, zoomedIn, curve);
+            frameCount++;
+        }
+        VERIFY_ARE_EQUAL(6, frameCount);
+        VERIFY_ARE_EQUAL(size_t{ 5 }, cache.GetStatistics().hits);
+        VERIFY_IS_LESS_THAN(MaxSampleError(program, curve, zoomedIn), 1.0);
+
+        // Widening x, the middle strips are made of two cached ones each
+        const SampleWindow zoomedOut{ -10, 10, -5, 5, 1000, 1000 };
+        SampleCachedFrame(cache, sampler, zoomedOut, curve);
+        VERIFY_ARE_EQUAL(size_t{ 2 }, cache.GetStatistics().placeholders);
+        VERIFY_ARE_EQUAL(size_t{ 4 }, cache.GetStatistics().misses);
+        VERIFY_IS_LESS_THAN(MaxSampleError(program, curve, zoomedOut), 1.0);
+    }
+
+    void GraphingEngineTests::CurveCacheStaysWithinItsSize()
+    {
+        Program program = CompileFunctionOfX(L"sin(3x)+a");
+        CurveSampler sampler(program, 0);
+        CurveCache cache;
+        SampledCurve curve;
+
+        const size_t maxByteCount = 64 * 1024;
+        cache.SetMaxByteCount(maxByteCount);
+        for (int i = 0; i < 20; i++)
+        {
+            const SampleWindow window{ -5.0 + 20 * i, 5.0 + 20 * i, -5, 5, 1000, 1000 };
+            SampleCachedFrame(cache, sampler, window, curve);
+            VERIFY_ARE_EQUAL(size_t{ 6 }, cache.GetStatistics().misses);
+            VERIFY_IS_LESS_THAN_OR_EQUAL(cache.GetStatistics().byteCount, maxByteCount);
+            VERIFY_IS_GREATER_THAN(cache.GetStatistics().stripCount, size_t{ 5 });
+        }
+
+        // The strips of the first frames were dropped, those of the last one are kept
+        SampleCachedFrame(cache, sampler, s_sampleWindow, curve);
+        VERIFY_ARE_EQUAL(size_t{ 6 }, cache.GetStatistics().misses);
+        const SampleWindow last{ 375, 385, -5, 5, 1000, 1000 };
+        SampleCachedFrame(cache, sampler, last, curve);
+        VERIFY_ARE_EQUAL(size_t{ 6 }, cache.GetStatistics().hits);
+
+        cache.SetMaxByteCount(0);
+        VERIFY_ARE_EQUAL(size_t{ 6 }, cache.GetStatistics().stripCount);
+        cache.Clear();
+        VERIFY_ARE_EQUAL(size_t{ 0 }, cache.GetStatistics().byteCount);
+    }
+
+    // Matches a search through every segment, for polylines and points on screen and far off it
+    void GraphingEngineTests::SegmentIndexFindsNearestSegment()
+    {
+        struct
+        {
+            size_t curve;
+            double x0;
+            double y0;
+            double x1;
+            double y1;
+        } segments[1000];
+        mt19937 random(42);
+        uniform_real_distribution<double> position(-100, 900);
+        for (size_t i = 0; i < size(segments); i++)
+        {
+            const size_t curve = i % 7;
+            const double x0 = i % 50 == 0 ? position(random) : i > 0 ? segments[i - 1].x1 : 0;
+            const double y0 = i % 50 == 0 ? position(random) : i > 0 ? segments[i - 1].y1 : 0;
+            const double length = i % 100 == 1 ? 1e6 : i % 10 == 0 ? 0 : 20;
+            const double angle = position(random);
+            segments[i] = { curve, x0, y0, x0 + length * cos(angle), y0 + length * sin(angle) };
+        }
+
+        SegmentIndex index;
+        index.Clear(800, 600, 20);
+        for (const auto& segment : segments)
+        {
+            index.AddSegment(segment.curve, segment.x0, segment.y0, segment.x1, segment.y1);
+        }
+        index.Build();
+
+        uniform_real_distribution<double> query(0, 800);
+        int foundCount = 0;
+        for (int i = 0; i < 2000; i++)
+        {
+            const double x = query(random);
+            const double y = query(random) * 0.75;
+            double bestDistance = 20;
+            for (const auto& segment : segments)
+            {
+                const double dx = segment.x1 - segment.x0;
+                const double dy = segment.y1 - segment.y0;
+                const double lengthSquared = dx * dx + dy * dy;
+                const double t = lengthSquared > 0 ? min(1.0, max(0.0, ((x - segment.x0) * dx + (y - segment.y0) * dy) / lengthSquared)) : 0;
+                bestDistance = min(bestDistance, hypot(segment.x0 + t * dx - x, segment.y0 + t * dy - y));
+            }
+
+            // The segments are kept in single precision
+            if (fabs(bestDistance - 20) < 1e-3)
+            {
+                continue;
+            }
+
+            SegmentHit hit;
+            const bool found = index.FindNearest(x, y, 20, hit);
+            VERIFY_ARE_EQUAL((bestDistance < 20), found);
+            if (found)
+            {
+                foundCount++;
+                VERIFY_IS_LESS_THAN(fabs(hit.distance - bestDistance), 1e-3);
+                VERIFY_IS_LESS_THAN(fabs(hypot(hit.x - x, hit.y - y) - hit.distance), 1e-9);
+                VERIFY_IS_LESS_THAN(hit.curve, size_t{ 7 });
+            }
+        }
+        VERIFY_IS_GREATER_THAN(foundCount, 200);
+    }
+
+    // Iterations of very different lengths, so that the threads have to steal them
+    void GraphingEngineTests::ThreadPoolRunsEveryIteration()
+    {
+        for (size_t threadCount : { 1, 2, 3, 8 })
+        {
+            ThreadPool pool(threadCount);
+            VERIFY_ARE_EQUAL(threadCount, pool.GetThreadCount());
+            vector<atomic<int>> runs(1000);
+            for (int repeat = 0; repeat < 20; repeat++)
+            {
+                pool.ParallelFor(runs.size(), [&runs](size_t i) {
+                    double sum = 0;
+                    for (size_t j = 0; j < (i % 100 == 0 ? 100000 : 10); j++)
+                    {
+                        sum += sqrt(static_cast<double>(j));
+                    }
+                    runs[i] += sum >= 0 ? 1 : 2;
+                });
+            }
+            for (const auto& count : runs)
+            {
+                VERIFY_ARE_EQUAL(20, count.load());
+            }
+        }
+    }
+
+    void GraphingEngineTests::RasterizerDrawsLines()
+    {
+        Rasterizer rasterizer(2);
+        rasterizer.Clear(200, 100, s_white);
+
+        // Two pixels wide along a row boundary, and half of a pixel on each side of a column boundary
+        rasterizer.SetStroke(s_black, 2, Graphing::Renderer::LineStyle::Solid);
+        rasterizer.BeginFigure(10, 20);
+        rasterizer.AddLine(190, 20);
+        rasterizer.SetStroke(s_black, 1, Graphing::Renderer::LineStyle::Solid);
+        rasterizer.BeginFigure(100, 40);
+        rasterizer.AddLine(100, 90);
+
+        // Dashes four line widths long across the segments of a figure
+        rasterizer.SetStroke(s_black, 2, Graphing::Renderer::LineStyle::Dash);
+        rasterizer.BeginFigure(0, 60);
+        rasterizer.AddLine(37, 60);
+        rasterizer.AddLine(90, 60);
+        rasterizer.Render();
+
+        VERIFY_ARE_EQUAL(255, Brightness(rasterizer, 50, 18));
+        VERIFY_ARE_EQUAL(0, Brightness(rasterizer, 50, 19));
+        VERIFY_ARE_EQUAL(0, Brightness(rasterizer, 50, 20));
+        VERIFY_ARE_EQUAL(255, Brightness(rasterizer, 50, 21));
+        VERIFY_ARE_EQUAL(255, Brightness(rasterizer, 5, 19));
+
+        VERIFY_ARE_EQUAL(128, Brightness(rasterizer, 99, 60));
+        VERIFY_ARE_EQUAL(128, Brightness(rasterizer, 100, 60));
+        VERIFY_ARE_EQUAL(255, Brightness(rasterizer, 101, 60));
+
+        // Pixels 0 to 7 on, 8 to 11 off and so on, with the soft ends at the boundaries
+        for (unsigned int x = 0; x < 90; x++)
+        {
+            const unsigned int phase = x % 12;
+            if (phase < 7 && phase > 0)
+            {
+                VERIFY_ARE_EQUAL(0, Brightness(rasterizer, x, 59));
+            }
+            else if (phase > 8 && phase < 11)
+            {
+                VERIFY_ARE_EQUAL(255, Brightness(rasterizer, x, 59));
+            }
+        }
+
+        // The image is kept in the same buffer when drawn again at the same size
+        const uint32_t* pixels = rasterizer.GetPixels().data();
+        rasterizer.Clear(200, 100, s_black);
+        rasterizer.Render();
+        VERIFY_ARE_EQUAL(pixels, rasterizer.GetPixels().data());
+        VERIFY_ARE_EQUAL(0, Brightness(rasterizer, 50, 19));
+    }
+
+    // Lines crossing many tiles blend the same way whichever thread renders them
+    void GraphingEngineTests::RasterizerDoesNotDependOnThreads()
+    {
+        Rasterizer single(1);
+        DrawTestImage(single);
+        single.Render();
+        Rasterizer several(4);
+        DrawTestImage(several);
+        several.Render();
+        VERIFY_IS_TRUE(single.GetPixels() == several.GetPixels());
+
+        vector<BYTE> bitmap;
+        several.EncodeBitmap(96, 96, bitmap);
+        VERIFY_ARE_EQUAL(size_t{ 54 + 300 * 200 * 4 }, bitmap.size());
+        VERIFY_IS_TRUE(bitmap[0] == 'B' && bitmap[1] == 'M');
+        const auto readInteger = [&bitmap](size_t offset) {
+            return static_cast<int32_t>(bitmap[offset] | bitmap[offset + 1] << 8 | bitmap[offset + 2] << 16 | bitmap[offset + 3] << 24);
+        };
+        VERIFY_ARE_EQUAL(54, readInteger(10));
+        VERIFY_ARE_EQUAL(300, readInteger(18));
+        VERIFY_ARE_EQUAL(-200, readInteger(22));
+        VERIFY_ARE_EQUAL(several.GetPixels()[0], static_cast<uint32_t>(readInteger(54)));
+    }
+
+    // Serializing gives input that parses back to the same expression
+    void GraphingEngineTests::MathSolverRoundTripsLinearInput()
+    {
+        auto solver = CreateLinearInputSolver();
+        const pair<const wchar_t*, const wchar_t*> inputs[] = {
+            { L"y=x^2", L"y=x^2" },
+            { L"y=2x+1", L"y=2*x+1" },
+            { L"y=sin^2 x + cos^2 x", L"y=sin(x)^2+cos(x)^2" },
+            { L"y=|x|", L"y=abs(x)" },
+            { L"y=2^-x", L"y=2^-x" },
+            { L"y=log_2(x)", L"y=ln(x)/ln(2)" },
+            { L"y=sin^-1 x", L"y=asin(x)" },
+            { L"y=(x+1)(x-1)", L"y=(x+1)*(x-1)" },
+            { L"y=x/2/3", L"y=x/2/3" },
+            { L"y=2-(3-x)", L"y=2-(3-x)" },
+            { L"y=x^(1/3)", L"y=x^(1/3)" },
+            { L"y=\x221Ax", L"y=sqrt(x)" },
+            { L"x^2+y^2=4", L"x^2+y^2=4" },
+            { L"y>=x", L"y>=x" },
+            { L"y=a x+b, x=y^2", L"y=a*x+b,x=y^2" },
+        };
+
+        for (const auto& [input, expected] : inputs)
+        {
+            int errorCode = 0;
+            int errorType = 0;
+            auto expression = solver->ParseInput(input, errorCode, errorType);
+            VERIFY_IS_NOT_NULL(expression.get(), input);
+            const wstring serialized = solver->Serialize(expression.get());
+            VERIFY_ARE_EQUAL(wstring(expected), serialized, input);
+
+            auto reparsed = solver->ParseInput(serialized, errorCode, errorType);
+            VERIFY_IS_NOT_NULL(reparsed.get(), input);
+            VERIFY_ARE_EQUAL(serialized, solver->Serialize(reparsed.get()), input);
+        }
+    }
+
+    // The codes are the ones GraphControl maps to its error messages
+    void GraphingEngineTests::MathSolverReportsSyntaxErrors()
+    {
+        auto solver = CreateLinearInputSolver();
+        const pair<const wchar_t*, int> inputs[] = {
+            { L"", SyntaxErrorCode::EmptyExpression },
+            { L"x)", SyntaxErrorCode::ParenthesisMismatch },
+            { L"(x", SyntaxErrorCode::UnmatchedParenthesis },
+            { L"1.2.3", SyntaxErrorCode::TooManyDecimalPoints },
+            { L".", SyntaxErrorCode::DecimalPointWithoutDigits },
+            { L"x+", SyntaxErrorCode::UnexpectedEndOfExpression },
+            { L"x+*2", SyntaxErrorCode::UnexpectedToken },
+            { L"x2", SyntaxErrorCode::UnexpectedToken },
+            { L"x$", SyntaxErrorCode::InvalidToken },
+            { L"y=x=2", SyntaxErrorCode::TooManyEquals },
+            { L"=x", SyntaxErrorCode::InvalidEquationSyntax },
+            { L"max(1)", SyntaxErrorCode::IncorrectNumParameter },
+        };
+
+        for (const auto& [input, code] : inputs)
+        {
+            int errorCode = 0;
+            int errorType = 0;
+            auto expression = solver->ParseInput(input, errorCode, errorType);
+            VERIFY_IS_NULL(expression.get(), input);
+            VERIFY_ARE_EQUAL(code, errorCode, input);
+            VERIFY_ARE_EQUAL(static_cast<int>(ErrorType::Syntax), errorType, input);
+        }
+    }
+
+    // The request Grapher builds, a show2d list of plot2d and plotIneq2D requests around the MathML of each equation
+    void GraphingEngineTests::MathSolverParsesGraphControlRequests()
+    {
+        auto solver = CreateLinearInputSolver();
+        solver->ParsingOptions().SetFormatType(Graphing::FormatType::MathML);
+        const wstring request =
+            L"<math xmlns=\"http://www.w3.org/1998/Math/MathML\"><mrow><mi>show2d</mi><mfenced separators=\"\">"
+            L"<mrow><mi>plot2d</mi><mfenced separators=\"\"><math xmlns=\"http://www.w3.org/1998/Math/MathML\"><mi>y</mi><mo>=</mo>"
+            L"<msup><mi>x</mi><mn>2</mn></msup><mo>&#x2212;</mo><mfrac><mn>1</mn><mi>x</mi></mfrac></math></mfenced></mrow><mo>,</mo>"
+            L"<mrow><mi>plotIneq2D</mi><mfenced separators=\"\"><math xmlns=\"http://www.w3.org/1998/Math/MathML\"><mi>y</mi><mo>&lt;</mo>"
+            L"<msqrt><mi>x</mi></msqrt></math></mfenced></mrow><mo>,</mo>"
+            L"<mrow><mi>plot2d</mi><mfenced separators=\"\"><math xmlns=\"http://www.w3.org/1998/Math/MathML\"><mi>y</mi><mo>=</mo>"
+            L"<msup><mi>sin</mi><mn>2</mn></msup><mo>&#x2061;</mo><mi>x</mi><mo>+</mo><mroot><mi>x</mi><mn>3</mn></mroot></math></mfenced></mrow>"
+            L"</mfenced></mrow></math>";
+
+        int errorCode = 0;
+        int errorType = 0;
+        auto expression = solver->ParseInput(request, errorCode, errorType);
+        VERIFY_IS_NOT_NULL(expression.get());
+        VERIFY_ARE_EQUAL(wstring(L"y=x^2-1/x,y<sqrt(x),y=sin(x)^2+x^(1/3)"), solver->Serialize(expression.get()));
+
+        // The MathML the solver writes parses back to the same equations
+        solver->FormatOptions().SetFormatType(Graphing::FormatType::MathML);
+        auto reparsed = solver->ParseInput(solver->Serialize(expression.get()), errorCode, errorType);
+        VERIFY_IS_NOT_NULL(reparsed.get());
+        solver->FormatOptions().SetFormatType(Graphing::FormatType::LinearInput);
+        VERIFY_ARE_EQUAL(solver->Serialize(expression.get()), solver->Serialize(reparsed.get()));
+
+        auto graph = solver->CreateGrapher();
+        auto equations = graph->TryInitialize(expression.get());
+        VERIFY_IS_TRUE(equations.has_value());
+        VERIFY_ARE_EQUAL(size_t{ 3 }, equations->size());
+
+        const auto& graphed = static_cast<Graph&>(*graph).GetEquations();
+        vector<double> arguments = static_cast<Graph&>(*graph).GetArgumentValues();
+        arguments[Graph::XSlot] = -8;
+        VERIFY_IS_LESS_THAN(fabs(graphed[2].program.Evaluate(arguments.data()) - (pow(sin(-8.0), 2) - 2)), 1e-12);
+    }
+
+    void GraphingEngineTests::GraphClassifiesEquations()
+    {
+        auto solver = CreateLinearInputSolver();
+        auto graph = solver->CreateGrapher();
+        int errorCode = 0;
+        int errorType = 0;
+        auto expression = solver->ParseInput(L"y=x^2+1, x=sin(y), x^2+y^2=4, x>y, x y=1, x^3", errorCode, errorType);
+        VERIFY_IS_NOT_NULL(expression.get());
+        auto equations = graph->TryInitialize(expression.get());
+        VERIFY_IS_TRUE(equations.has_value());
+        VERIFY_ARE_EQUAL(S_OK, graph->GetInitializationError());
+
+        const auto& graphed = static_cast<Graph&>(*graph).GetEquations();
+        VERIFY_ARE_EQUAL(size_t{ 6 }, graphed.size());
+        VERIFY_IS_TRUE(graphed[0].kind == PlotKind::FunctionOfX);
+        VERIFY_IS_TRUE(graphed[1].kind == PlotKind::FunctionOfY);
+        VERIFY_IS_TRUE(graphed[2].kind == PlotKind::Implicit);
+        VERIFY_IS_TRUE(graphed[5].kind == PlotKind::FunctionOfX);
+
+        // y on the right is still a function of x, with the relation turned around
+        VERIFY_IS_TRUE(graphed[3].kind == PlotKind::FunctionOfX);
+        VERIFY_IS_TRUE(graphed[3].relation == Relation::Less);
+        VERIFY_IS_TRUE(graphed[4].kind == PlotKind::Implicit);
+        VERIFY_IS_TRUE(graphed[4].relation == Relation::Equal);
+
+        // An equation without x or y has nothing to draw
+        expression = solver->ParseInput(L"1=2", errorCode, errorType);
+        VERIFY_IS_NOT_NULL(expression.get());
+        VERIFY_IS_FALSE(graph->TryInitialize(expression.get()).has_value());
+        VERIFY_IS_TRUE(graph->GetVariables().empty());
+        solver->HRErrorToErrorInfo(graph->GetInitializationError(), errorCode, errorType);
+        VERIFY_ARE_EQUAL(SyntaxErrorCode::EqualWithoutGraphVariable, errorCode);
+        VERIFY_ARE_EQUAL(static_cast<int>(ErrorType::Syntax), errorType);
+
+        // Failures that do not come from the engine are general evaluation errors
+        solver->HRErrorToErrorInfo(E_FAIL, errorCode, errorType);
+        VERIFY_ARE_EQUAL(EvaluationErrorCode::GeneralError, errorCode);
+        VERIFY_ARE_EQUAL(static_cast<int>(ErrorType::Evaluation), errorType);
+    }
+
+    // Variables are listed in order of appearance, and a value set for one is kept when the equations are replaced
+    void GraphingEngineTests::GraphKeepsVariableValues()
+    {
+        auto solver = CreateLinearInputSolver();
+        auto graph = solver->CreateGrapher();
+        const auto& native = static_cast<Graph&>(*graph);
+        int errorCode = 0;
+        int errorType = 0;
+        auto expression = solver->ParseInput(L"y=a x^2+b, x^2+y^2=r", errorCode, errorType);
+        VERIFY_IS_TRUE(graph->TryInitialize(expression.get()).has_value());
+
+        auto variables = graph->GetVariables();
+        VERIFY_ARE_EQUAL(size_t{ 3 }, variables.size());
+        VERIFY_ARE_EQUAL(wstring(L"a"), variables[0]->GetVariableName());
+        VERIFY_ARE_EQUAL(wstring(L"b"), variables[1]->GetVariableName());
+        VERIFY_ARE_EQUAL(wstring(L"r"), variables[2]->GetVariableName());
+
+        graph->SetArgValue(L"a", 2);
+        graph->SetArgValue(L"b", 3);
+        vector<double> arguments = native.GetArgumentValues();
+        arguments[Graph::XSlot] = 2;
+        VERIFY_ARE_EQUAL(11.0, native.GetEquations()[0].program.Evaluate(arguments.data()));
+
+        // b keeps its value and moves to another slot, c is new and starts at 1
+        expression = solver->ParseInput(L"y=c x+b", errorCode, errorType);
+        VERIFY_IS_TRUE(graph->TryInitialize(expression.get()).has_value());
+        variables = graph->GetVariables();
+        VERIFY_ARE_EQUAL(size_t{ 2 }, variables.size());
+        VERIFY_ARE_EQUAL(wstring(L"c"), variables[0]->GetVariableName());
+        VERIFY_ARE_EQUAL(wstring(L"b"), variables[1]->GetVariableName());
+        arguments = native.GetArgumentValues();
+        arguments[Graph::XSlot] = 2;
+        VERIFY_ARE_EQUAL(5.0, native.GetEquations()[0].program.Evaluate(arguments.data()));
+
+        // a was dropped with the first expression, so it starts over
+        expression = solver->ParseInput(L"y=a x", errorCode, errorType);
+        VERIFY_IS_TRUE(graph->TryInitialize(expression.get()).has_value());
+        arguments = native.GetArgumentValues();
+        arguments[Graph::XSlot] = 2;
+        VERIFY_ARE_EQUAL(2.0, native.GetEquations()[0].program.Evaluate(arguments.data()));
+    }
+
+    // A variable only sends the equations that read it back to the cache, and moving it back finds their strips
+    void GraphingEngineTests::GraphRendererSamplesOnlyChangedEquations()
+    {
+        auto solver = CreateLinearInputSolver();
+        auto graph = solver->CreateGrapher();
+        int errorCode = 0;
+        int errorType = 0;
+        auto expression = solver->ParseInput(L"y=a sin(x)+e^(x/5), y=sin(b x), y=tan(x)+b", errorCode, errorType);
+        VERIFY_IS_TRUE(graph->TryInitialize(expression.get()).has_value());
+
+        auto renderer = graph->GetRenderer();
+        renderer->SetGraphSize(1000, 1000);
+        CurveCache& cache = static_cast<GraphRenderer&>(*renderer).GetCurveCache();
+        const auto draw = [&renderer, &cache]() {
+            cache.ResetStatistics();
+            bool hasSomeMissingData = true;
+            VERIFY_ARE_EQUAL(S_OK, renderer->DrawD2D1(nullptr, nullptr, hasSomeMissingData));
+            VERIFY_IS_FALSE(hasSomeMissingData);
+            return cache.GetStatistics();
+        };
+
+        // Each curve takes 6 strips of the default view
+        auto statistics = draw();
+        VERIFY_ARE_EQUAL(size_t{ 0 }, statistics.hits);
+        VERIFY_ARE_EQUAL(size_t{ 18 }, statistics.misses);
+
+        graph->SetArgValue(L"a", 2);
+        statistics = draw();
+        VERIFY_ARE_EQUAL(size_t{ 0 }, statistics.hits);
+        VERIFY_ARE_EQUAL(size_t{ 6 }, statistics.misses);
+
+        graph->SetArgValue(L"a", 2);
+        statistics = draw();
+        VERIFY_ARE_EQUAL(size_t{ 0 }, statistics.hits);
+        VERIFY_ARE_EQUAL(size_t{ 0 }, statistics.misses);
+
+        graph->SetArgValue(L"a", 1);
+        statistics = draw();
+        VERIFY_ARE_EQUAL(size_t{ 6 }, statistics.hits);
+        VERIFY_ARE_EQUAL(size_t{ 0 }, statistics.misses);
+
+        // b is read by the other two equations
+        graph->SetArgValue(L"b", 3);
+        statistics = draw();
+        VERIFY_ARE_EQUAL(size_t{ 0 }, statistics.hits);
+        VERIFY_ARE_EQUAL(size_t{ 12 }, statistics.misses);
+
+        graph->SetArgValue(L"b", 1);
+        statistics = draw();
+        VERIFY_ARE_EQUAL(size_t{ 12 }, statistics.hits);
+        VERIFY_ARE_EQUAL(size_t{ 0 }, statistics.misses);
+    }
+
+    // The default view is [-10, 10] on both axes, at 200 by 200 a unit is 10 screen units
+    void GraphingEngineTests::GraphRendererTracesNearestCurve()
+    {
+        auto solver = CreateLinearInputSolver();
+        auto graph = solver->CreateGrapher();
+        int errorCode = 0;
+        int errorType = 0;
+        auto expression = solver->ParseInput(L"x^2+y^2=4, y=x+a", errorCode, errorType);
+        VERIFY_IS_TRUE(graph->TryInitialize(expression.get()).has_value());
+        graph->SetArgValue(L"a", 0);
+
+        auto renderer = graph->GetRenderer();
+        int formulaId = -1;
+        float xScreen = 0;
+        float yScreen = 0;
+        double x = 0;
+        double y = 0;
+        double rho = 0;
+        double theta = 0;
+        double t = 0;
+        VERIFY_ARE_EQUAL(E_FAIL, renderer->GetClosePointData(0, 0, 0.01, formulaId, xScreen, yScreen, x, y, rho, theta, t));
+
+        // Tracing before the first frame samples the curves. Implicit equations are not traced but keep their formula id.
+        renderer->SetGraphSize(200, 200);
+        VERIFY_ARE_EQUAL(S_OK, renderer->GetClosePointData(113, 85, 0.01, formulaId, xScreen, yScreen, x, y, rho, theta, t));
+        VERIFY_ARE_EQUAL(1, formulaId);
+        VERIFY_IS_LESS_THAN(fabs(x - 1.4), 1e-12);
+        VERIFY_IS_LESS_THAN(fabs(y - 1.4), 1e-12);
+        VERIFY_IS_LESS_THAN(fabs(rho - hypot(1.4, 1.4)), 1e-12);
+
+        // The swept coordinate is rounded to the precision and the other one computed from it
+        VERIFY_ARE_EQUAL(S_OK, renderer->GetClosePointData(113, 85, 0.25, formulaId, xScreen, yScreen, x, y, rho, theta, t));
+        VERIFY_ARE_EQUAL(1.5, x);
+        VERIFY_ARE_EQUAL(1.5, y);
+        VERIFY_ARE_EQUAL(115.0f, xScreen);
+        VERIFY_ARE_EQUAL(85.0f, yScreen);
+        VERIFY_ARE_EQUAL(S_OK, renderer->GetClosePointData(113, 85, 1, formulaId, xScreen, yScreen, x, y, rho, theta, t));
+        VERIFY_ARE_EQUAL(1.0, x);
+        VERIFY_ARE_EQUAL(1.0, y);
+
+        // Moving the line 3 units up leaves the pointer just over 20 screen units away, beyond the tracing distance
+        graph->SetArgValue(L"a", 3);
+        VERIFY_ARE_EQUAL(S_FALSE, renderer->GetClosePointData(110, 89, 0.01, formulaId, xScreen, yScreen, x, y, rho, theta, t));
+        VERIFY_ARE_EQUAL(S_OK, renderer->GetClosePointData(110, 60, 0.01, formulaId, xScreen, yScreen, x, y, rho, theta, t));
+        VERIFY_ARE_EQUAL(1, formulaId);
+        VERIFY_IS_LESS_THAN(fabs(x - 1), 1e-12);
+        VERIFY_IS_LESS_THAN(fabs(y - 4), 1e-12);
+
+        // After a pan the same point of the line is 100 screen units to the left
+        VERIFY_ARE_EQUAL(S_OK, renderer->SetDisplayRanges(0, 20, -10, 10));
+        VERIFY_ARE_EQUAL(S_FALSE, renderer->GetClosePointData(110, 60, 0.01, formulaId, xScreen, yScreen, x, y, rho, theta, t));
+        VERIFY_ARE_EQUAL(S_OK, renderer->GetClosePointData(10, 60, 0.01, formulaId, xScreen, yScreen, x, y, rho, theta, t));
+        VERIFY_IS_LESS_THAN(fabs(x - 1), 1e-12);
+        VERIFY_IS_LESS_THAN(fabs(y - 4), 1e-12);
+        VERIFY_IS_LESS_THAN(fabs(xScreen - 10), 1e-4);
+    }
+}
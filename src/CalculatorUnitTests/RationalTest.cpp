@@ -216,6 +216,182 @@ TEST_METHOD(TestRemainderRational)
     res = Rational(-834345) % Rational(Number(1, 0, { 103 }), Number(1, 0, { 100 }));
     VERIFY_ARE_EQUAL(res.ToString(10, NumberFormat::Float, 8), L"-0.71");
 }
+
+TEST_METHOD(TestComparison)
+{
+    // Same value with different numerators and denominators
+    Rational oneThird(Number(1, 0, { 1 }), Number(1, 0, { 3 }));
+    Rational twoSixths(Number(1, 0, { 2 }), Number(1, 0, { 6 }));
+    VERIFY_IS_TRUE(oneThird == twoSixths);
+    VERIFY_IS_FALSE(oneThird < twoSixths);
+    VERIFY_IS_TRUE(oneThird <= twoSixths);
+    VERIFY_IS_TRUE(oneThird >= twoSixths);
+
+    // The sign can be carried by the denominator
+    Rational minusHalf(Number(1, 0, { 1 }), Number(-1, 0, { 2 }));
+    VERIFY_IS_TRUE(minusHalf == Rational(Number(-1, 0, { 1 }), Number(1, 0, { 2 })));
+    VERIFY_IS_TRUE(minusHalf < 0);
+    VERIFY_IS_TRUE(minusHalf > -1);
+
+    // Negative zero is zero
+    VERIFY_IS_TRUE(Rational(Number(-1, 0, { 0 }), Number(1, 0, { 1 })) == 0);
+
+    // Values with very different magnitudes, and values only the last digit tells apart
+    Rational huge(Number(1, 5, { 1 }), Number(1, 0, { 3 }));
+    VERIFY_IS_TRUE(huge > Rational(1000000));
+    VERIFY_IS_TRUE(-huge < Rational(-1000000));
+    Rational third(Number(1, 0, { 1000000 }), Number(1, 0, { 3 }));
+    VERIFY_IS_TRUE(third > Rational(333333));
+    VERIFY_IS_TRUE(third < Rational(333334));
+    VERIFY_IS_TRUE(Rational(Number(1, 0, { 1000001 }), Number(1, 0, { 3 })) > third);
+}
+
+TEST_METHOD(TestAddition)
+{
+    // Carries run past the end of the shorter operand
+    Rational maxDigits(Number(1, 0, { 0x7FFFFFFF, 0x7FFFFFFF }), Number(1, 0, { 1 }));
+    VERIFY_IS_TRUE(maxDigits + 1 == Rational(Number(1, 2, { 1 }), Number(1, 0, { 1 })));
+
+    // Borrows run past the end of the shorter operand
+    VERIFY_IS_TRUE(Rational(Number(1, 2, { 1 }), Number(1, 0, { 1 })) - 1 == maxDigits);
+
+    // Operands with different exponents and signs
+    Rational big(Number(-1, 3, { 5 }), Number(1, 0, { 1 }));
+    Rational small(Number(1, -1, { 7 }), Number(1, 0, { 1 }));
+    VERIFY_IS_TRUE((big + small) - big == small);
+    VERIFY_IS_TRUE((small + big) - small == big);
+
+    // x + -x is a positive zero
+    Rational zero = big + (-big);
+    VERIFY_IS_TRUE(zero == 0);
+    VERIFY_ARE_EQUAL(zero.P().Sign(), 1);
+}
+
+TEST_METHOD(TestRoot)
+{
+    // Perfect powers have exact roots
+    VERIFY_IS_TRUE(RationalMath::Root(27, 3) == 3);
+    VERIFY_IS_TRUE(RationalMath::Root(16, 2) == 4);
+    VERIFY_IS_TRUE(RationalMath::Root(-27, 3) == -3);
+    Rational twoThirds(Number(1, 0, { 2 }), Number(1, 0, { 3 }));
+    Rational eightTwentySevenths(Number(1, 0, { 8 }), Number(1, 0, { 27 }));
+    VERIFY_IS_TRUE(RationalMath::Root(eightTwentySevenths, 3) == twoThirds);
+    VERIFY_IS_TRUE(RationalMath::Pow(eightTwentySevenths, Rational(Number(1, 0, { 2 }), Number(1, 0, { 3 }))) == twoThirds * twoThirds);
+    VERIFY_IS_TRUE(RationalMath::Root(RationalMath::Pow(twoThirds, 7), 7) == twoThirds);
+
+    // Other roots are correct to the precision
+    Rational sqrtTwo = RationalMath::Root(2, 2);
+    VERIFY_IS_TRUE(RationalMath::Abs(sqrtTwo * sqrtTwo - 2) < 1 / RationalMath::Pow(10, 100));
+    VERIFY_ARE_EQUAL(
+        sqrtTwo.ToString(10, NumberFormat::Float, 32),
+        L"1.4142135623730950488016887242097");
+
+    // Negative numbers only have odd roots
+    uint32_t error = 0;
+    try
+    {
+        RationalMath::Root(-4, 2);
+    }
+    catch (uint32_t e)
+    {
+        error = e;
+    }
+    VERIFY_ARE_EQUAL(error, CALC_E_DOMAIN);
+}
+
+TEST_METHOD(TestFastPath)
+{
+    // The fast path only certifies the precision of scientific mode
+    ChangeConstants(10, 32);
+    ResetFastPathStatistics();
+
+    // Certified results round to the digits of the series
+    VERIFY_ARE_EQUAL(Exp(-1).ToString(10, NumberFormat::Float, 32), L"0.36787944117144232159552377016146");
+    VERIFY_ARE_EQUAL(Log(10).ToString(10, NumberFormat::Float, 32), L"2.3025850929940456840179914546844");
+    VERIFY_ARE_EQUAL(Sin(1, AngleType::Degrees).ToString(10, NumberFormat::Float, 32), L"0.01745240643728351281941897851632");
+    VERIFY_ARE_EQUAL(Tan(1, AngleType::Degrees).ToString(10, NumberFormat::Float, 32), L"0.01745506492821758576512889521973");
+    VERIFY_IS_TRUE(Cos(400, AngleType::Gradians) == 1);
+    VERIFY_IS_TRUE(GetFastPathStatistics().hits == 5);
+    VERIFY_IS_TRUE(GetFastPathStatistics().misses == 0);
+
+    // Results next to zero are left to the series, which rounds them to zero
+    VERIFY_IS_TRUE(Sin(180, AngleType::Degrees) == 0);
+    VERIFY_IS_TRUE(Log(1) == 0);
+    VERIFY_IS_TRUE(GetFastPathStatistics().misses == 2);
+
+    // So are the arguments outside of the domain
+    uint32_t error = 0;
+    try
+    {
+        Tan(90, AngleType::Degrees);
+    }
+    catch (uint32_t e)
+    {
+        error = e;
+    }
+    VERIFY_ARE_EQUAL(error, CALC_E_DOMAIN);
+    VERIFY_IS_TRUE(GetFastPathStatistics().misses == 3);
+
+    ChangeConstants(10, 128);
+}
+
+TEST_METHOD(TestFastPathBeyondCertifiedDigits)
+{
+    // Beyond the certified digits the series gives every digit, here compared to the correctly rounded values
+    ChangeConstants(10, 64);
+    ResetFastPathStatistics();
+    Rational x = Rational(473189) / Rational(3340000);
+    VERIFY_ARE_EQUAL(Exp(x).ToString(10, NumberFormat::Float, 64), L"1.152200224652829495345977828328992852401344493374473490047878646");
+    VERIFY_ARE_EQUAL(Log(x).ToString(10, NumberFormat::Float, 64), L"-1.954231200121490926550714495716740952024174241908252189220909528");
+    VERIFY_ARE_EQUAL(
+        Sin(x, AngleType::Radians).ToString(10, NumberFormat::Float, 64), L"0.1411998997013241771859089043194187106632206599917982702869326856");
+    VERIFY_IS_TRUE(GetFastPathStatistics().hits == 0);
+
+    ChangeConstants(10, 128);
+    VERIFY_ARE_EQUAL(
+        Exp(x).ToString(10, NumberFormat::Float, 128),
+        L"1.1522002246528294953459778283289928524013444933744734900478786461277643406530502306865030818404668867408765518465115608229486404");
+    VERIFY_IS_TRUE(GetFastPathStatistics().hits == 0);
+
+    // Nor does it count digits in other radices
+    ChangeConstants(16, 32);
+    Exp(x);
+    VERIFY_IS_TRUE(GetFastPathStatistics().hits == 0);
+
+    ChangeConstants(10, 128);
+}
+
+TEST_METHOD(TestToString)
+{
+    Rational twoThirds(Number(1, 0, { 2 }), Number(1, 0, { 3 }));
+    Rational oneThirtyThousandth(Number(1, 0, { 1 }), Number(1, 0, { 30000 }));
+
+    // Only the digits the output rounds on are divided out
+    VERIFY_ARE_EQUAL(twoThirds.ToString(10, NumberFormat::Float, 8), L"0.66666667");
+    VERIFY_ARE_EQUAL((-twoThirds).ToString(16, NumberFormat::Float, 32), L"-0.AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAB");
+    VERIFY_ARE_EQUAL(oneThirtyThousandth.ToString(10, NumberFormat::Engineering, 16), L"33.3333333333e-6");
+    VERIFY_ARE_EQUAL((RationalMath::Pow(10, 40) / 3).ToString(10, NumberFormat::Float, 32), L"3.3333333333333333333333333333333e+39");
+    VERIFY_ARE_EQUAL((1 / RationalMath::Pow(10, 40)).ToString(10, NumberFormat::Float, 32), L"1.e-40");
+
+    // Scientific notation of small numbers keeps fewer digits, as it always has
+    VERIFY_ARE_EQUAL(oneThirtyThousandth.ToString(2, NumberFormat::Scientific, 32), L"1.0001011110011111^-1111");
+}
+
+TEST_METHOD(TestChangeConstants)
+{
+    // Going back up to a precision keeps the constants at that precision
+    ChangeConstants(10, 32);
+    ChangeConstants(10, 128);
+    VERIFY_ARE_EQUAL(
+        Rational{ pi }.ToString(10, NumberFormat::Float, 100),
+        L"3.141592653589793238462643383279502884197169399375105820974944592307816406286208998628034825342117068");
+
+    // Other radices have their own constants
+    ChangeConstants(16, 17);
+    VERIFY_ARE_EQUAL(Rational{ pi }.ToString(16, NumberFormat::Float, 17), L"3.243F6A8885A308D3");
+
+    ChangeConstants(10, 128);
+}
 }
 ;
 }
@@ -4,6 +4,8 @@
 #include "pch.h"
 
 #include <CppUnitTest.h>
+#include <chrono>
+#include "CalcManager/SuggestedValuesChannel.h"
 
 using namespace UnitConversionManager;
 using namespace std;
@@ -141,9 +143,9 @@ namespace UnitConverterUnitTests
             m_lastTo = to;
         }
 
-        void SuggestedValueCallback(const vector<tuple<wstring, Unit>>& suggestedValues) override
+        void SuggestedValueCallback(vector<tuple<wstring, Unit>> suggestedValues) override
         {
-            m_lastSuggested = suggestedValues;
+            m_lastSuggested = move(suggestedValues);
         }
 
         void MaxDigitsReached() override
@@ -210,6 +212,17 @@ namespace UnitConverterUnitTests
         TEST_METHOD(UnitConverterTestMaxDigitsReached_LeadingDecimal);
         TEST_METHOD(UnitConverterTestMaxDigitsReached_TrailingDecimal);
         TEST_METHOD(UnitConverterTestMaxDigitsReached_MultipleTimes);
+        TEST_METHOD(UnitConverterTestExactConversionMode);
+        TEST_METHOD(UnitConverterTestConvertMany);
+
+        // Timing only, kept out of the default run. Remove TEST_IGNORE locally to measure.
+        BEGIN_TEST_METHOD_ATTRIBUTE(UnitConverterTestConvertManyBenchmark)
+            TEST_METHOD_ATTRIBUTE(L"TestCategory", L"Benchmark")
+            TEST_IGNORE()
+        END_TEST_METHOD_ATTRIBUTE()
+        TEST_METHOD(UnitConverterTestConvertManyBenchmark);
+
+        TEST_METHOD(UnitConverterTestSuggestedValuesChannel);
 
     private:
         static void ExecuteCommands(vector<Command> commands);
@@ -254,6 +267,7 @@ namespace UnitConverterUnitTests
     void UnitConverterTest::Cleanup()
     {
         s_unitConverter->SendCommand(Command::Reset);
+        s_unitConverter->SetExactConversionMode(false);
         s_testVMCallback->Reset();
     }
 
@@ -599,4 +613,118 @@ namespace UnitConverterUnitTests
             VERIFY_ARE_EQUAL(count, s_testVMCallback->GetMaxDigitsReachedCallCount(), to_wstring(count).c_str());
         }
     }
+
+    // Verify that the exact conversion mode rounds the exact result rather than its double approximation
+    void UnitConverterTest::UnitConverterTestExactConversionMode()
+    {
+        VERIFY_IS_FALSE(s_unitConverter->IsExactConversionMode());
+        s_unitConverter->SetExactConversionMode(true);
+        VERIFY_IS_TRUE(s_unitConverter->IsExactConversionMode());
+
+        s_unitConverter->SetCurrentCategory(s_testWeight);
+        s_unitConverter->SetCurrentUnitTypes(s_testKilograms, s_testPounds);
+
+        // 0.025 * 2.20462 = 0.0551155 exactly, its double approximation is slightly below the halfway point
+        ExecuteCommands({ Command::Decimal, Command::Zero, Command::Two, Command::Five });
+        VERIFY_IS_TRUE(s_testVMCallback->CheckDisplayValues(wstring(L"0.025"), wstring(L"0.055116")));
+
+        s_unitConverter->SendCommand(Command::Clear);
+        ExecuteCommands({ Command::One, Command::Two, Command::Three, Command::Four, Command::Five, Command::Six, Command::Seven });
+        VERIFY_IS_TRUE(s_testVMCallback->CheckDisplayValues(wstring(L"1234567"), wstring(L"2721751")));
+
+        s_unitConverter->SetExactConversionMode(false);
+        VERIFY_IS_FALSE(s_unitConverter->IsExactConversionMode());
+    }
+
+    // Verify that batch conversions match the per value conversion, including the parallel path for large inputs
+    void UnitConverterTest::UnitConverterTestConvertMany()
+    {
+        vector<double> values(1000003);
+        for (size_t i = 0; i < values.size(); i++)
+        {
+            values[i] = static_cast<double>(i) * 0.25 - 1000.0;
+        }
+
+        vector<double> results(values.size());
+        VERIFY_IS_TRUE(s_unitConverter->ConvertMany(values.data(), values.size(), s_testPounds, s_testKilograms, results.data()));
+        for (size_t i = 0; i < values.size(); i++)
+        {
+            VERIFY_ARE_EQUAL(values[i] * 0.453592, results[i]);
+        }
+
+        // Odd sizes exercise the scalar tail of the vectorized loops
+        VERIFY_IS_TRUE(s_unitConverter->ConvertMany(values.data(), 3, s_testInches, s_testFeet, results.data()));
+        VERIFY_ARE_EQUAL(values[2] * 0.08333333333333333333333333333333, results[2]);
+
+        // Units from different categories can't be converted
+        VERIFY_IS_FALSE(s_unitConverter->ConvertMany(values.data(), values.size(), s_testPounds, s_testInches, results.data()));
+
+        auto allResults = s_unitConverter->ConvertManyToAllUnits(values.data(), 7, s_testKilograms);
+        VERIFY_ARE_EQUAL(size_t{ 2 }, allResults.size());
+        VERIFY_ARE_EQUAL(size_t{ 7 }, allResults[s_testPounds].size());
+        for (size_t i = 0; i < 7; i++)
+        {
+            VERIFY_ARE_EQUAL(values[i] * 2.20462, allResults[s_testPounds][i]);
+            VERIFY_ARE_EQUAL(values[i], allResults[s_testKilograms][i]);
+        }
+    }
+
+    // Reports the throughput of the batch conversion API
+    void UnitConverterTest::UnitConverterTestConvertManyBenchmark()
+    {
+        constexpr size_t valueCount = 1 << 20;
+        constexpr int iterations = 20;
+        vector<double> values(valueCount, 12.5);
+        vector<double> results(valueCount);
+
+        auto start = chrono::steady_clock::now();
+        for (int i = 0; i < iterations; i++)
+        {
+            VERIFY_IS_TRUE(s_unitConverter->ConvertMany(values.data(), values.size(), s_testPounds, s_testKilograms, results.data()));
+        }
+        chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+        wstring message = L"ConvertMany: " + to_wstring(static_cast<uint64_t>(valueCount * iterations / elapsed.count())) + L" values per second";
+        Logger::WriteMessage(message.c_str());
+
+        start = chrono::steady_clock::now();
+        for (int i = 0; i < iterations; i++)
+        {
+            VERIFY_ARE_EQUAL(size_t{ 2 }, s_unitConverter->ConvertManyToAllUnits(values.data(), values.size(), s_testPounds).size());
+        }
+        elapsed = chrono::steady_clock::now() - start;
+        message = L"ConvertManyToAllUnits: " + to_wstring(static_cast<uint64_t>(valueCount * iterations / elapsed.count())) + L" input values per second";
+        Logger::WriteMessage(message.c_str());
+    }
+
+    // Verifies the debounce and ownership rules of the suggested values channel
+    void UnitConverterTest::UnitConverterTestSuggestedValuesChannel()
+    {
+        using Clock = SuggestedValuesChannel::Clock;
+        const Clock::duration debounceInterval = chrono::milliseconds(10);
+        SuggestedValuesChannel channel(debounceInterval);
+        const Clock::time_point start = Clock::now();
+        Clock::duration remaining;
+
+        VERIFY_IS_NULL(channel.TryTake(start, remaining).get());
+        VERIFY_IS_TRUE(remaining == Clock::duration::zero());
+
+        // Only the first publication needs to wake the consumer, later ones replace the pending snapshot
+        VERIFY_IS_TRUE(channel.Publish({ { L"1", s_testInches } }, start));
+        VERIFY_IS_FALSE(channel.Publish({ { L"2", s_testFeet }, { L"3", s_testInches } }, start + chrono::milliseconds(4)));
+
+        VERIFY_IS_NULL(channel.TryTake(start + chrono::milliseconds(10), remaining).get());
+        VERIFY_IS_TRUE(remaining == chrono::milliseconds(4));
+
+        auto snapshot = channel.TryTake(start + chrono::milliseconds(14), remaining);
+        VERIFY_IS_NOT_NULL(snapshot.get());
+        VERIFY_ARE_EQUAL(size_t{ 2 }, snapshot->size());
+        VERIFY_ARE_EQUAL(wstring(L"2"), get<0>(snapshot->at(0)));
+        VERIFY_IS_NULL(channel.Take().get());
+
+        // Take ignores the debounce interval
+        VERIFY_IS_TRUE(channel.Publish({ { L"4", s_testFeet } }, start + chrono::milliseconds(20)));
+        snapshot = channel.Take();
+        VERIFY_IS_NOT_NULL(snapshot.get());
+        VERIFY_ARE_EQUAL(wstring(L"4"), get<0>(snapshot->at(0)));
+    }
 }
@@ -53,6 +53,22 @@ namespace CalculatorUnitTests
         void ResetCategoriesAndRatios() override
         {
         }
+        void SetExactConversionMode(bool /*isExactConversionMode*/) override
+        {
+        }
+        bool IsExactConversionMode() const override
+        {
+            return false;
+        }
+        bool ConvertMany(_In_ const double* /*values*/, size_t /*count*/, const UCM::Unit& /*fromType*/, const UCM::Unit& /*toType*/, _Out_ double* /*results*/) override
+        {
+            return false;
+        }
+        std::unordered_map<UCM::Unit, std::vector<double>, UCM::UnitHash>
+        ConvertManyToAllUnits(_In_ const double* /*values*/, size_t /*count*/, const UCM::Unit& /*fromType*/) override
+        {
+            return {};
+        }
         std::future<std::pair<bool, std::wstring>> RefreshCurrencyRatios() override
         {
             co_return std::make_pair(true, L"");
@@ -7,14 +7,6 @@
 
 using namespace std;
 
-namespace Graphing
-{
-    unique_ptr<IMathSolver> IMathSolver::CreateMathSolver()
-    {
-        return make_unique<MockGraphingImpl::MathSolver>();
-    }
-}
-
 shared_ptr<Graphing::IGraph> MockGraphingImpl::MathSolver::CreateGrapher()
 {
     return make_shared<MockGraphingImpl::Graph>();
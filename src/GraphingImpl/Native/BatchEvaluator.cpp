@@ -0,0 +1,1044 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "BatchEvaluator.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+// MSVC accepts every intrinsic whatever the target architecture, so both lane widths are built and the CPU picks one at
+// run time. Other compilers only get the lanes their flags enable.
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#define BATCH_EVALUATOR_SSE41 1
+#define BATCH_EVALUATOR_AVX2 1
+#define BATCH_EVALUATOR_CPUID 1
+#include <intrin.h>
+#else
+#if defined(__SSE4_1__)
+#define BATCH_EVALUATOR_SSE41 1
+#endif
+#if defined(__AVX2__)
+#define BATCH_EVALUATOR_AVX2 1
+#endif
+#endif
+
+#if defined(BATCH_EVALUATOR_SSE41) || defined(BATCH_EVALUATOR_AVX2)
+#define BATCH_EVALUATOR_LANES 1
+#include <immintrin.h>
+#endif
+
+using namespace std;
+using namespace NativeGraphingImpl;
+
+namespace
+{
+    constexpr double s_pi = 3.14159265358979323846;
+
+    // Without vector lanes the scalar functions are faster than the approximations would be one value at a time
+    void ExecuteScalar(const Instruction& instruction, double* registers, size_t laneCount)
+    {
+        double* target = registers + instruction.target * BatchEvaluator::BlockSize;
+        const double* left = registers + instruction.left * BatchEvaluator::BlockSize;
+        const double* right = registers + instruction.right * BatchEvaluator::BlockSize;
+        for (size_t i = 0; i < laneCount; i++)
+        {
+            target[i] = Apply(instruction.op, left[i], right[i]);
+        }
+    }
+
+#if defined(BATCH_EVALUATOR_LANES)
+    constexpr uint64_t s_signBits = 0x8000000000000000;
+    constexpr uint64_t s_mantissaBits = 0x000FFFFFFFFFFFFF;
+    constexpr uint64_t s_oneBits = 0x3FF0000000000000;
+    constexpr double s_twoPow52 = 4503599627370496.0;
+    constexpr double s_twoPow54 = 18014398509481984.0;
+    constexpr double s_smallestNormal = 2.2250738585072014e-308;
+    constexpr double s_infinity = numeric_limits<double>::infinity();
+
+    // Adding this to an integer n in [-1022, 1023] leaves n + 1023 in the low mantissa bits
+    constexpr double s_exponentBias = s_twoPow52 + 1023.0;
+
+    // ln(2) and pi/2 split so that multiplying the leading parts by the small integers of the range reductions is exact
+    constexpr double s_log2e = 1.44269504088896338700;
+    constexpr double s_ln2High = 6.93147180369123816490e-01;
+    constexpr double s_ln2Low = 1.90821492927058770002e-10;
+    constexpr double s_twoOverPi = 6.36619772367581382433e-01;
+    constexpr double s_halfPi1 = 1.57079632673412561417e+00;
+    constexpr double s_halfPi2 = 6.07710050630396597660e-11;
+    constexpr double s_halfPi3 = 2.02226624871116645580e-21;
+    constexpr double s_sqrt2 = 1.41421356237309504880;
+    constexpr double s_inverseLn10 = 0.43429448190325182765;
+
+    // Beyond this the reduction by multiples of pi/2 loses bits, larger arguments go through the scalar functions
+    constexpr double s_maxTrigArgument = 1e5;
+
+    // Taylor series, highest degree first. exp on |r| <= ln(2)/2, sin and cos on |r| <= pi/4 and the atanh series of ln
+    // on |s| <= 0.172 are all well below half an ulp when truncated here.
+    constexpr double s_expCoefficients[] = { 1.0 / 479001600.0, 1.0 / 39916800.0, 1.0 / 3628800.0, 1.0 / 362880.0, 1.0 / 40320.0,
+                                             1.0 / 5040.0,      1.0 / 720.0,      1.0 / 120.0,     1.0 / 24.0,     1.0 / 6.0,
+                                             0.5,               1.0,              1.0 };
+    constexpr double s_sinCoefficients[] = { 1.0 / 355687428096000.0, -1.0 / 1307674368000.0, 1.0 / 6227020800.0, -1.0 / 39916800.0,
+                                             1.0 / 362880.0,          -1.0 / 5040.0,          1.0 / 120.0,        -1.0 / 6.0 };
+    constexpr double s_cosCoefficients[] = { -1.0 / 6402373705728000.0, 1.0 / 20922789888000.0, -1.0 / 87178291200.0, 1.0 / 479001600.0, -1.0 / 3628800.0,
+                                             1.0 / 40320.0,             -1.0 / 720.0,           1.0 / 24.0,           -0.5 };
+    constexpr double s_lnCoefficients[] = { 1.0 / 23.0, 1.0 / 21.0, 1.0 / 19.0, 1.0 / 17.0, 1.0 / 15.0, 1.0 / 13.0,
+                                            1.0 / 11.0, 1.0 / 9.0,  1.0 / 7.0,  1.0 / 5.0,  1.0 / 3.0 };
+
+    double FromBits(uint64_t bits)
+    {
+        double value;
+        memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+#if defined(BATCH_EVALUATOR_SSE41)
+    // Every lane type has the same members. Min and Max return b when either value is NaN, like the SSE instructions.
+    // PowerOfTwo takes an integer in [-1022, 1023]. ExponentField and Mantissa split a positive normal number into its
+    // biased exponent and a value in [1, 2).
+    struct Sse41Lanes
+    {
+        using Vector = __m128d;
+        using Mask = __m128d;
+        static constexpr size_t Width = 2;
+
+        static Vector Load(const double* source)
+        {
+            return _mm_loadu_pd(source);
+        }
+        static void Store(double* target, Vector value)
+        {
+            _mm_storeu_pd(target, value);
+        }
+        static Vector Broadcast(double value)
+        {
+            return _mm_set1_pd(value);
+        }
+        static Vector Add(Vector a, Vector b)
+        {
+            return _mm_add_pd(a, b);
+        }
+        static Vector Subtract(Vector a, Vector b)
+        {
+            return _mm_sub_pd(a, b);
+        }
+        static Vector Multiply(Vector a, Vector b)
+        {
+            return _mm_mul_pd(a, b);
+        }
+        static Vector Divide(Vector a, Vector b)
+        {
+            return _mm_div_pd(a, b);
+        }
+        static Vector Sqrt(Vector a)
+        {
+            return _mm_sqrt_pd(a);
+        }
+        static Vector Floor(Vector a)
+        {
+            return _mm_floor_pd(a);
+        }
+        static Vector Ceiling(Vector a)
+        {
+            return _mm_ceil_pd(a);
+        }
+        static Vector Truncate(Vector a)
+        {
+            return _mm_round_pd(a, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+        }
+        static Vector Abs(Vector a)
+        {
+            return _mm_andnot_pd(Broadcast(FromBits(s_signBits)), a);
+        }
+        static Vector Negate(Vector a)
+        {
+            return _mm_xor_pd(a, Broadcast(FromBits(s_signBits)));
+        }
+        static Vector CopySign(Vector magnitude, Vector sign)
+        {
+            const Vector signBits = Broadcast(FromBits(s_signBits));
+            return _mm_or_pd(_mm_andnot_pd(signBits, magnitude), _mm_and_pd(signBits, sign));
+        }
+        static Vector Min(Vector a, Vector b)
+        {
+            return _mm_min_pd(a, b);
+        }
+        static Vector Max(Vector a, Vector b)
+        {
+            return _mm_max_pd(a, b);
+        }
+        static Mask Less(Vector a, Vector b)
+        {
+            return _mm_cmplt_pd(a, b);
+        }
+        static Mask LessEqual(Vector a, Vector b)
+        {
+            return _mm_cmple_pd(a, b);
+        }
+        static Mask Greater(Vector a, Vector b)
+        {
+            return _mm_cmpgt_pd(a, b);
+        }
+        static Mask GreaterEqual(Vector a, Vector b)
+        {
+            return _mm_cmpge_pd(a, b);
+        }
+        static Mask Equal(Vector a, Vector b)
+        {
+            return _mm_cmpeq_pd(a, b);
+        }
+        static Mask IsNaN(Vector a)
+        {
+            return _mm_cmpunord_pd(a, a);
+        }
+        static Mask None()
+        {
+            return _mm_setzero_pd();
+        }
+        static Mask Or(Mask a, Mask b)
+        {
+            return _mm_or_pd(a, b);
+        }
+        static Vector Select(Mask mask, Vector ifTrue, Vector ifFalse)
+        {
+            return _mm_blendv_pd(ifFalse, ifTrue, mask);
+        }
+        static int Lanes(Mask mask)
+        {
+            return _mm_movemask_pd(mask);
+        }
+        static Vector PowerOfTwo(Vector n)
+        {
+            return _mm_castsi128_pd(_mm_slli_epi64(_mm_castpd_si128(Add(n, Broadcast(s_exponentBias))), 52));
+        }
+        static Vector ExponentField(Vector x)
+        {
+            const __m128i exponent = _mm_srli_epi64(_mm_castpd_si128(x), 52);
+            return Subtract(_mm_or_pd(_mm_castsi128_pd(exponent), Broadcast(s_twoPow52)), Broadcast(s_twoPow52));
+        }
+        static Vector Mantissa(Vector x)
+        {
+            return _mm_or_pd(_mm_and_pd(x, Broadcast(FromBits(s_mantissaBits))), Broadcast(FromBits(s_oneBits)));
+        }
+    };
+#endif
+
+#if defined(BATCH_EVALUATOR_AVX2)
+    struct Avx2Lanes
+    {
+        using Vector = __m256d;
+        using Mask = __m256d;
+        static constexpr size_t Width = 4;
+
+        static Vector Load(const double* source)
+        {
+            return _mm256_loadu_pd(source);
+        }
+        static void Store(double* target, Vector value)
+        {
+            _mm256_storeu_pd(target, value);
+        }
+        static Vector Broadcast(double value)
+        {
+            return _mm256_set1_pd(value);
+        }
+        static Vector Add(Vector a, Vector b)
+        {
+            return _mm256_add_pd(a, b);
+        }
+        static Vector Subtract(Vector a, Vector b)
+        {
+            return _mm256_sub_pd(a, b);
+        }
+        static Vector Multiply(Vector a, Vector b)
+        {
+            return _mm256_mul_pd(a, b);
+        }
+        static Vector Divide(Vector a, Vector b)
+        {
+            return _mm256_div_pd(a, b);
+        }
+        static Vector Sqrt(Vector a)
+        {
+            return _mm256_sqrt_pd(a);
+        }
+        static Vector Floor(Vector a)
+        {
+            return _mm256_floor_pd(a);
+        }
+        static Vector Ceiling(Vector a)
+        {
+            return _mm256_ceil_pd(a);
+        }
+        static Vector Truncate(Vector a)
+        {
+            return _mm256_round_pd(a, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+        }
+        static Vector Abs(Vector a)
+        {
+            return _mm256_andnot_pd(Broadcast(FromBits(s_signBits)), a);
+        }
+        static Vector Negate(Vector a)
+        {
+            return _mm256_xor_pd(a, Broadcast(FromBits(s_signBits)));
+        }
+        static Vector CopySign(Vector magnitude, Vector sign)
+        {
+            const Vector signBits = Broadcast(FromBits(s_signBits));
+            return _mm256_or_pd(_mm256_andnot_pd(signBits, magnitude), _mm256_and_pd(signBits, sign));
+        }
+        static Vector Min(Vector a, Vector b)
+        {
+            return _mm256_min_pd(a, b);
+        }
+        static Vector Max(Vector a, Vector b)
+        {
+            return _mm256_max_pd(a, b);
+        }
+        static Mask Less(Vector a, Vector b)
+        {
+            return _mm256_cmp_pd(a, b, _CMP_LT_OQ);
+        }
+        static Mask LessEqual(Vector a, Vector b)
+        {
+            return _mm256_cmp_pd(a, b, _CMP_LE_OQ);
+        }
+        static Mask Greater(Vector a, Vector b)
+        {
+            return _mm256_cmp_pd(a, b, _CMP_GT_OQ);
+        }
+        static Mask GreaterEqual(Vector a, Vector b)
+        {
+            return _mm256_cmp_pd(a, b, _CMP_GE_OQ);
+        }
+        static Mask Equal(Vector a, Vector b)
+        {
+            return _mm256_cmp_pd(a, b, _CMP_EQ_OQ);
+        }
+        static Mask IsNaN(Vector a)
+        {
+            return _mm256_cmp_pd(a, a, _CMP_UNORD_Q);
+        }
+        static Mask None()
+        {
+            return _mm256_setzero_pd();
+        }
+        static Mask Or(Mask a, Mask b)
+        {
+            return _mm256_or_pd(a, b);
+        }
+        static Vector Select(Mask mask, Vector ifTrue, Vector ifFalse)
+        {
+            return _mm256_blendv_pd(ifFalse, ifTrue, mask);
+        }
+        static int Lanes(Mask mask)
+        {
+            return _mm256_movemask_pd(mask);
+        }
+        static Vector PowerOfTwo(Vector n)
+        {
+            return _mm256_castsi256_pd(_mm256_slli_epi64(_mm256_castpd_si256(Add(n, Broadcast(s_exponentBias))), 52));
+        }
+        static Vector ExponentField(Vector x)
+        {
+            const __m256i exponent = _mm256_srli_epi64(_mm256_castpd_si256(x), 52);
+            return Subtract(_mm256_or_pd(_mm256_castsi256_pd(exponent), Broadcast(s_twoPow52)), Broadcast(s_twoPow52));
+        }
+        static Vector Mantissa(Vector x)
+        {
+            return _mm256_or_pd(_mm256_and_pd(x, Broadcast(FromBits(s_mantissaBits))), Broadcast(FromBits(s_oneBits)));
+        }
+    };
+#endif
+
+    template <typename L, size_t N>
+    typename L::Vector Polynomial(typename L::Vector x, const double (&coefficients)[N])
+    {
+        typename L::Vector result = L::Broadcast(coefficients[0]);
+        for (size_t i = 1; i < N; i++)
+        {
+            result = L::Add(L::Multiply(result, x), L::Broadcast(coefficients[i]));
+        }
+        return result;
+    }
+
+    // e^x = 2^k e^r with r = x - k ln(2)
+    template <typename L>
+    typename L::Vector Exp(typename L::Vector x)
+    {
+        using Vector = typename L::Vector;
+
+        // Past these bounds the result is already 0 or infinite. Clamping keeps k in range, NaN passes through.
+        const Vector clamped = L::Min(L::Broadcast(750.0), L::Max(L::Broadcast(-750.0), x));
+        const Vector k = L::Floor(L::Add(L::Multiply(clamped, L::Broadcast(s_log2e)), L::Broadcast(0.5)));
+        const Vector r = L::Subtract(L::Subtract(clamped, L::Multiply(k, L::Broadcast(s_ln2High))), L::Multiply(k, L::Broadcast(s_ln2Low)));
+        const Vector p = Polynomial<L>(r, s_expCoefficients);
+
+        // Scaling in two halves lets results close to overflow or in the subnormal range come out right
+        const Vector half = L::Floor(L::Multiply(k, L::Broadcast(0.5)));
+        return L::Multiply(L::Multiply(p, L::PowerOfTwo(half)), L::PowerOfTwo(L::Subtract(k, half)));
+    }
+
+    // ln(x) = e ln(2) + ln(m) with m in [sqrt(1/2), sqrt(2)), and ln(m) = 2 atanh(s) with s = (m - 1) / (m + 1)
+    template <typename L>
+    typename L::Vector Ln(typename L::Vector x)
+    {
+        using Vector = typename L::Vector;
+        using Mask = typename L::Mask;
+
+        const Mask subnormal = L::Less(x, L::Broadcast(s_smallestNormal));
+        const Vector scaled = L::Select(subnormal, L::Multiply(x, L::Broadcast(s_twoPow54)), x);
+        Vector exponent = L::Subtract(L::ExponentField(scaled), L::Select(subnormal, L::Broadcast(1023.0 + 54.0), L::Broadcast(1023.0)));
+        Vector m = L::Mantissa(scaled);
+
+        const Mask aboveSqrt2 = L::Greater(m, L::Broadcast(s_sqrt2));
+        m = L::Select(aboveSqrt2, L::Multiply(m, L::Broadcast(0.5)), m);
+        exponent = L::Add(exponent, L::Select(aboveSqrt2, L::Broadcast(1.0), L::Broadcast(0.0)));
+
+        const Vector f = L::Subtract(m, L::Broadcast(1.0));
+        const Vector s = L::Divide(f, L::Add(f, L::Broadcast(2.0)));
+        const Vector z = L::Multiply(s, s);
+        const Vector twoS = L::Add(s, s);
+        const Vector lnM = L::Add(twoS, L::Multiply(twoS, L::Multiply(z, Polynomial<L>(z, s_lnCoefficients))));
+        Vector result = L::Add(L::Multiply(exponent, L::Broadcast(s_ln2High)), L::Add(lnM, L::Multiply(exponent, L::Broadcast(s_ln2Low))));
+
+        result = L::Select(L::Equal(x, L::Broadcast(0.0)), L::Broadcast(-s_infinity), result);
+        result = L::Select(L::Less(x, L::Broadcast(0.0)), L::Broadcast(numeric_limits<double>::quiet_NaN()), result);
+        result = L::Select(L::Equal(x, L::Broadcast(s_infinity)), x, result);
+        return L::Select(L::IsNaN(x), x, result);
+    }
+
+    // x = r + k pi/2 with |r| <= pi/4, the quadrant k mod 4 picks which of sin(r) and cos(r) is the result and its sign.
+    // Lanes too large to reduce accurately are added to scalarLanes.
+    template <typename L>
+    void SinCos(typename L::Vector x, typename L::Vector& sine, typename L::Vector& cosine, typename L::Mask& scalarLanes)
+    {
+        using Vector = typename L::Vector;
+        using Mask = typename L::Mask;
+
+        scalarLanes = L::Or(scalarLanes, L::Or(L::Greater(L::Abs(x), L::Broadcast(s_maxTrigArgument)), L::IsNaN(x)));
+
+        const Vector k = L::Floor(L::Add(L::Multiply(x, L::Broadcast(s_twoOverPi)), L::Broadcast(0.5)));
+        Vector r = L::Subtract(x, L::Multiply(k, L::Broadcast(s_halfPi1)));
+        r = L::Subtract(r, L::Multiply(k, L::Broadcast(s_halfPi2)));
+        r = L::Subtract(r, L::Multiply(k, L::Broadcast(s_halfPi3)));
+
+        const Vector z = L::Multiply(r, r);
+        const Vector s = L::Add(r, L::Multiply(L::Multiply(r, z), Polynomial<L>(z, s_sinCoefficients)));
+        const Vector c = L::Add(L::Broadcast(1.0), L::Multiply(z, Polynomial<L>(z, s_cosCoefficients)));
+
+        const Vector quadrant = L::Subtract(k, L::Multiply(L::Broadcast(4.0), L::Floor(L::Multiply(k, L::Broadcast(0.25)))));
+        const Mask isQuadrant1 = L::Equal(quadrant, L::Broadcast(1.0));
+        const Mask isQuadrant2 = L::Equal(quadrant, L::Broadcast(2.0));
+        const Mask isQuadrant3 = L::Equal(quadrant, L::Broadcast(3.0));
+        const Mask isOdd = L::Or(isQuadrant1, isQuadrant3);
+
+        const Vector sineBase = L::Select(isOdd, c, s);
+        const Vector cosineBase = L::Select(isOdd, s, c);
+        sine = L::Select(L::Or(isQuadrant2, isQuadrant3), L::Negate(sineBase), sineBase);
+        cosine = L::Select(L::Or(isQuadrant1, isQuadrant2), L::Negate(cosineBase), cosineBase);
+    }
+
+    // |base|^exponent for lanes where |base| is positive and finite and the exponent is finite, other lanes are added to
+    // scalarLanes
+    template <typename L>
+    typename L::Vector AbsPower(typename L::Vector base, typename L::Vector exponent, typename L::Mask& scalarLanes)
+    {
+        using Vector = typename L::Vector;
+
+        const Vector magnitude = L::Abs(base);
+        scalarLanes = L::Or(scalarLanes, L::Or(L::Equal(magnitude, L::Broadcast(0.0)), L::Equal(magnitude, L::Broadcast(s_infinity))));
+        scalarLanes = L::Or(scalarLanes, L::Or(L::IsNaN(base), L::IsNaN(exponent)));
+        scalarLanes = L::Or(scalarLanes, L::Equal(L::Abs(exponent), L::Broadcast(s_infinity)));
+        return Exp<L>(L::Multiply(exponent, Ln<L>(magnitude)));
+    }
+
+    // Runs operation over the lanes of one instruction. Lanes the operation adds to its scalarLanes mask are computed
+    // again with Apply before the group is stored, since the target can be one of the operand registers.
+    template <typename L, typename TOperation>
+    void ForEachLaneGroup(const Instruction& instruction, double* registers, size_t laneCount, const TOperation& operation)
+    {
+        using Vector = typename L::Vector;
+
+        double* target = registers + instruction.target * BatchEvaluator::BlockSize;
+        const double* left = registers + instruction.left * BatchEvaluator::BlockSize;
+        const double* right = registers + instruction.right * BatchEvaluator::BlockSize;
+        for (size_t i = 0; i < laneCount; i += L::Width)
+        {
+            typename L::Mask scalarLanes = L::None();
+            Vector result = operation(L::Load(left + i), L::Load(right + i), scalarLanes);
+
+            const int lanes = L::Lanes(scalarLanes);
+            if (lanes != 0)
+            {
+                double values[L::Width];
+                L::Store(values, result);
+                for (size_t lane = 0; lane < L::Width; lane++)
+                {
+                    if ((lanes & (1 << lane)) != 0)
+                    {
+                        values[lane] = Apply(instruction.op, left[i + lane], right[i + lane]);
+                    }
+                }
+                result = L::Load(values);
+            }
+
+            L::Store(target + i, result);
+        }
+    }
+
+    template <typename L>
+    void ExecuteInstruction(const Instruction& instruction, double* registers, size_t laneCount)
+    {
+        using Vector = typename L::Vector;
+        using Mask = typename L::Mask;
+
+        switch (instruction.op)
+        {
+        case OpCode::Add:
+            ForEachLaneGroup<L>(instruction, registers, laneCount, [](Vector a, Vector b, Mask&) { return L::Add(a, b); });
+            break;
+        case OpCode::Subtract:
+            ForEachLaneGroup<L>(instruction, registers, laneCount, [](Vector a, Vector b, Mask&) { return L::Subtract(a, b); });
+            break;
+        case OpCode::Multiply:
+            ForEachLaneGroup<L>(instruction, registers, laneCount, [](Vector a, Vector b, Mask&) { return L::Multiply(a, b); });
+            break;
+        case OpCode::Divide:
+            ForEachLaneGroup<L>(instruction, registers, laneCount, [](Vector a, Vector b, Mask&) { return L::Divide(a, b); });
+            break;
+        case OpCode::Negate:
+            ForEachLaneGroup<L>(instruction, registers, laneCount, [](Vector a, Vector, Mask&) { return L::Negate(a); });
+            break;
+        case OpCode::Sqrt:
+            ForEachLaneGroup<L>(instruction, registers, laneCount, [](Vector a, Vector, Mask&) { return L::Sqrt(a); });
+            break;
+        case OpCode::Abs:
+            ForEachLaneGroup<L>(instruction, registers, laneCount, [](Vector a, Vector, Mask&) { return L::Abs(a); });
+            break;
+        case OpCode::Sign:
+            ForEachLaneGroup<L>(instruction, registers, laneCount, [](Vector a, Vector, Mask&) {
+                const Vector zero = L::Broadcast(0.0);
+                return L::Select(L::Greater(a, zero), L::Broadcast(1.0), L::Select(L::Less(a, zero), L::Broadcast(-1.0), a));
+            });
+            break;
+        case OpCode::Floor:
+            ForEachLaneGroup<L>(instruction, registers, laneCount, [](Vector a, Vector, Mask&) { return L::Floor(a); });
+            break;
+        case OpCode::Ceiling:
+            ForEachLaneGroup<L>(instruction, registers, laneCount, [](Vector a, Vector, Mask&) { return L::Ceiling(a); });
+            break;
+        case OpCode::Round:
+            // Halfway cases round away from zero like round()
+            ForEachLaneGroup<L>(instruction, registers, laneCount, [](Vector a, Vector, Mask&) {
+                const Vector truncated = L::Truncate(a);
+                const Vector fraction = L::Subtract(a, truncated);
+                const Vector one = L::Broadcast(1.0);
+                return L::Select(
+                    L::GreaterEqual(fraction, L::Broadcast(0.5)),
+                    L::Add(truncated, one),
+                    L::Select(L::LessEqual(fraction, L::Broadcast(-0.5)), L::Subtract(truncated, one), truncated));
+            });
+            break;
+        case OpCode::Min:
+            // fmin ignores a NaN operand
+            ForEachLaneGroup<L>(instruction, registers, laneCount, [](Vector a, Vector b, Mask&) { return L::Select(L::IsNaN(a), b, L::Min(b, a)); });
+            break;
+        case OpCode::Max:
+            ForEachLaneGroup<L>(instruction, registers, laneCount, [](Vector a, Vector b, Mask&) { return L::Select(L::IsNaN(a), b, L::Max(b, a)); });
+            break;
+        case OpCode::Exp:
+            ForEachLaneGroup<L>(instruction, registers, laneCount, [](Vector a, Vector, Mask&) { return Exp<L>(a); });
+            break;
+        case OpCode::Ln:
+            ForEachLaneGroup<L>(instruction, registers, laneCount, [](Vector a, Vector, Mask&) { return Ln<L>(a); });
+            break;
+        case OpCode::Log10:
+            ForEachLaneGroup<L>(instruction, registers, laneCount, [](Vector a, Vector, Mask&) {
+                return L::Multiply(Ln<L>(a), L::Broadcast(s_inverseLn10));
+            });
+            break;
+        case OpCode::Sin:
+            ForEachLaneGroup<L>(instruction, registers, laneCount, [](Vector a, Vector, Mask& scalarLanes) {
+                Vector sine, cosine;
+                SinCos<L>(a, sine, cosine, scalarLanes);
+                return sine;
+            });
+            break;
+        case OpCode::Cos:
+            ForEachLaneGroup<L>(instruction, registers, laneCount, [](Vector a, Vector, Mask& scalarLanes) {
+                Vector sine, cosine;
+                SinCos<L>(a, sine, cosine, scalarLanes);
+                return cosine;
+            });
+            break;
+        case OpCode::Tan:
+            ForEachLaneGroup<L>(instruction, registers, laneCount, [](Vector a, Vector, Mask& scalarLanes) {
+                Vector sine, cosine;
+                SinCos<L>(a, sine, cosine, scalarLanes);
+                return L::Divide(sine, cosine);
+            });
+            break;
+        case OpCode::Power:
+            // A negative base has a real power only for an integer exponent, negative when the exponent is odd
+            ForEachLaneGroup<L>(instruction, registers, laneCount, [](Vector a, Vector b, Mask& scalarLanes) {
+                const Vector magnitude = AbsPower<L>(a, b, scalarLanes);
+                const Vector half = L::Multiply(b, L::Broadcast(0.5));
+                const Mask isInteger = L::Equal(L::Floor(b), b);
+                const Mask isOdd = L::Less(L::Floor(half), half);
+                const Vector negativeBase = L::Select(
+                    isInteger, L::Select(isOdd, L::Negate(magnitude), magnitude), L::Broadcast(numeric_limits<double>::quiet_NaN()));
+                return L::Select(L::Less(a, L::Broadcast(0.0)), negativeBase, magnitude);
+            });
+            break;
+        case OpCode::SignedPower:
+            ForEachLaneGroup<L>(instruction, registers, laneCount, [](Vector a, Vector b, Mask& scalarLanes) {
+                return L::CopySign(AbsPower<L>(a, b, scalarLanes), a);
+            });
+            break;
+        case OpCode::AbsPower:
+            ForEachLaneGroup<L>(instruction, registers, laneCount, [](Vector a, Vector b, Mask& scalarLanes) { return AbsPower<L>(a, b, scalarLanes); });
+            break;
+        default:
+            // Inverse trigonometric, hyperbolic and gamma functions have no approximation here
+            ExecuteScalar(instruction, registers, laneCount);
+            break;
+        }
+    }
+#endif
+
+    using InstructionKernel = void (*)(const Instruction&, double*, size_t);
+
+    struct LaneKernel
+    {
+        InstructionKernel execute;
+        const wchar_t* name;
+    };
+
+#if defined(BATCH_EVALUATOR_CPUID)
+    bool IsSse41Supported()
+    {
+        int cpuInfo[4];
+        __cpuid(cpuInfo, 1);
+        return (cpuInfo[2] & (1 << 19)) != 0;
+    }
+
+    bool IsAvx2Supported()
+    {
+        // AVX2 needs both the CPU feature and the OS saving the YMM registers on context switches
+        int cpuInfo[4];
+        __cpuid(cpuInfo, 1);
+        const bool hasOsxsave = (cpuInfo[2] & (1 << 27)) != 0;
+        const bool hasAvx = (cpuInfo[2] & (1 << 28)) != 0;
+        if (!hasOsxsave || !hasAvx || (_xgetbv(0) & 0x6) != 0x6)
+        {
+            return false;
+        }
+
+        __cpuidex(cpuInfo, 7, 0);
+        return (cpuInfo[1] & (1 << 5)) != 0;
+    }
+#endif
+
+    const LaneKernel& GetLaneKernel()
+    {
+        static const LaneKernel kernel = [] {
+#if defined(BATCH_EVALUATOR_CPUID)
+            if (IsAvx2Supported())
+            {
+                return LaneKernel{ &ExecuteInstruction<Avx2Lanes>, L"AVX2" };
+            }
+            if (IsSse41Supported())
+            {
+                return LaneKernel{ &ExecuteInstruction<Sse41Lanes>, L"SSE4.1" };
+            }
+            return LaneKernel{ &ExecuteScalar, L"Scalar" };
+#elif defined(BATCH_EVALUATOR_AVX2)
+            return LaneKernel{ &ExecuteInstruction<Avx2Lanes>, L"AVX2" };
+#elif defined(BATCH_EVALUATOR_SSE41)
+            return LaneKernel{ &ExecuteInstruction<Sse41Lanes>, L"SSE4.1" };
+#else
+            return LaneKernel{ &ExecuteScalar, L"Scalar" };
+#endif
+        }();
+
+        return kernel;
+    }
+
+    // Lanes are run in groups of the widest vector, samples past the end of a block are padding
+    constexpr size_t s_laneGroup = 4;
+    static_assert(BatchEvaluator::BlockSize % s_laneGroup == 0, "a block must be a whole number of lane groups");
+
+    size_t PaddedLaneCount(size_t laneCount)
+    {
+        return (laneCount + s_laneGroup - 1) / s_laneGroup * s_laneGroup;
+    }
+
+    double SignOf(double value)
+    {
+        return value > 0 ? 1.0 : value < 0 ? -1.0 : 0.0;
+    }
+
+    bool IsKeyFromResult(OpCode op)
+    {
+        return op == OpCode::Floor || op == OpCode::Ceiling || op == OpCode::Round || op == OpCode::Sign;
+    }
+
+    bool CanJump(const Instruction& instruction, const vector<double>& constants)
+    {
+        switch (instruction.op)
+        {
+        case OpCode::Divide:
+        case OpCode::Tan:
+        case OpCode::Gamma:
+            return true;
+        case OpCode::Power:
+        case OpCode::SignedPower:
+            // Only a negative exponent has a pole, a constant exponent tells up front
+            return instruction.right >= constants.size() || constants[instruction.right] < 0;
+        default:
+            return IsKeyFromResult(instruction.op);
+        }
+    }
+
+    // Where the key changes the operation has a pole with a sign change or a step
+    double OperandKey(OpCode op, double left, double right)
+    {
+        switch (op)
+        {
+        case OpCode::Divide:
+            return SignOf(right);
+        case OpCode::Tan:
+            return floor(left / s_pi + 0.5);
+        case OpCode::Gamma:
+            return left > 0 ? 0.0 : floor(left);
+        default:
+            // Powers with a negative exponent, x^-3 or x^(-1/3)
+            return right < 0 ? SignOf(left) : 0.0;
+        }
+    }
+
+    bool KeysDiffer(double a, double b)
+    {
+        return a != b && !(isnan(a) && isnan(b));
+    }
+
+    // How many sets of samples the hoisted instructions keep values for, about the uniform passes of the strips of a few views,
+    // and how many values they can keep over all of them
+    constexpr size_t s_maxHoistedSampleSets = 32;
+    constexpr size_t s_maxHoistedValueCount = 1 << 16;
+}
+
+BatchEvaluator::BatchEvaluator(const Program& program)
+    : m_program(program)
+    , m_sweepSlot(numeric_limits<size_t>::max())
+    , m_valueRowCount(0)
+    , m_keyRowCount(0)
+    , m_isHoisting(false)
+    , m_hoistedValueCount(0)
+    , m_hoistedUse(0)
+    , m_registers(program.RegisterCount() * BlockSize, 0.0)
+{
+    const auto& constants = program.Constants();
+    for (size_t i = 0; i < constants.size(); i++)
+    {
+        fill_n(m_registers.begin() + i * BlockSize, BlockSize, constants[i]);
+    }
+
+    const auto& instructions = program.Instructions();
+    for (size_t i = 0; i < instructions.size(); i++)
+    {
+        if (CanJump(instructions[i], constants))
+        {
+            m_discontinuities.push_back(i);
+        }
+    }
+    m_keys.resize(m_discontinuities.size() * BlockSize);
+    m_previousKeys.resize(m_discontinuities.size());
+}
+
+void BatchEvaluator::Evaluate(const double* arguments, size_t sweepSlot, const double* samples, size_t count, double* results, uint8_t* flags)
+{
+    if (sweepSlot != m_sweepSlot)
+    {
+        Classify(sweepSlot);
+    }
+
+    double* sweepRow = nullptr;
+    for (const auto& argument : m_program.ArgumentRegisters())
+    {
+        double* row = m_registers.data() + argument.second * BlockSize;
+        if (argument.first == sweepSlot)
+        {
+            sweepRow = row;
+        }
+        else
+        {
+            fill_n(row, BlockSize, arguments[argument.first]);
+        }
+    }
+
+    bool isReused = false;
+    HoistedSamples* hoisted = m_isHoisting && count > 0 ? FindHoistedSamples(samples, count, flags != nullptr, isReused) : nullptr;
+
+    const double* resultRow = m_registers.data() + m_program.ResultRegister() * BlockSize;
+    for (size_t begin = 0; begin < count; begin += BlockSize)
+    {
+        const size_t laneCount = min(BlockSize, count - begin);
+        if (sweepRow != nullptr)
+        {
+            copy_n(samples + begin, laneCount, sweepRow);
+            fill(sweepRow + laneCount, sweepRow + PaddedLaneCount(laneCount), samples[begin + laneCount - 1]);
+        }
+
+        EvaluateBlock(laneCount, flags != nullptr ? flags + begin : nullptr, begin == 0, hoisted, begin, isReused);
+        copy_n(resultRow, laneCount, results + begin);
+    }
+}
+
+// Sorts the instructions by what they depend on, and which hoisted values are worth keeping
+void BatchEvaluator::Classify(size_t sweepSlot)
+{
+    const auto& instructions = m_program.Instructions();
+    const vector<bool> isUsingSweep = m_program.InstructionsUsing(sweepSlot);
+    vector<bool> isUsingOthers(instructions.size(), false);
+    for (const auto& argument : m_program.ArgumentRegisters())
+    {
+        if (argument.first != sweepSlot)
+        {
+            const vector<bool> isUsing = m_program.InstructionsUsing(argument.first);
+            for (size_t i = 0; i < instructions.size(); i++)
+            {
+                isUsingOthers[i] = isUsingOthers[i] || isUsing[i];
+            }
+        }
+    }
+
+    m_kinds.resize(instructions.size());
+    bool hasVarying = false;
+    for (size_t i = 0; i < instructions.size(); i++)
+    {
+        m_kinds[i] = !isUsingSweep[i] ? InstructionKind::Uniform : isUsingOthers[i] ? InstructionKind::Varying : InstructionKind::Hoisted;
+        hasVarying = hasVarying || m_kinds[i] == InstructionKind::Varying;
+    }
+
+    // A hoisted value is kept when a varying instruction or the result reads it before its register is written again
+    vector<size_t> writers(m_program.RegisterCount(), instructions.size());
+    auto keep = [this, &writers, &instructions](uint16_t reg) {
+        if (writers[reg] < instructions.size() && m_kinds[writers[reg]] == InstructionKind::Hoisted)
+        {
+            m_kinds[writers[reg]] = InstructionKind::KeptHoisted;
+        }
+    };
+    for (size_t i = 0; i < instructions.size(); i++)
+    {
+        if (m_kinds[i] == InstructionKind::Varying)
+        {
+            keep(instructions[i].left);
+            keep(instructions[i].right);
+        }
+        writers[instructions[i].target] = i;
+    }
+    keep(m_program.ResultRegister());
+
+    m_valueRows.assign(instructions.size(), 0);
+    m_valueRowCount = 0;
+    for (size_t i = 0; i < instructions.size(); i++)
+    {
+        if (m_kinds[i] == InstructionKind::KeptHoisted)
+        {
+            m_valueRows[i] = m_valueRowCount++;
+        }
+    }
+    m_keyRows.assign(m_discontinuities.size(), 0);
+    m_keyRowCount = 0;
+    for (size_t i = 0; i < m_discontinuities.size(); i++)
+    {
+        if (m_kinds[m_discontinuities[i]] >= InstructionKind::Hoisted)
+        {
+            m_keyRows[i] = m_keyRowCount++;
+        }
+    }
+
+    m_sweepSlot = sweepSlot;
+    m_isHoisting = hasVarying && m_valueRowCount > 0;
+    m_hoistedSamples.clear();
+    m_hoistedValueCount = 0;
+}
+
+// The kept values of a previous call with the same samples, or room for those of this call. isReused tells which
+BatchEvaluator::HoistedSamples* BatchEvaluator::FindHoistedSamples(const double* samples, size_t count, bool needsKeys, bool& isReused)
+{
+    m_hoistedUse++;
+    for (HoistedSamples& hoisted : m_hoistedSamples)
+    {
+        if (hoisted.samples.size() == count && equal(samples, samples + count, hoisted.samples.begin()))
+        {
+            // Keys are only taken when flags are asked for, a call that asks for them the first time takes them again
+            isReused = hoisted.hasKeys || !needsKeys;
+            hoisted.hasKeys = hoisted.hasKeys || needsKeys;
+            hoisted.lastUse = m_hoistedUse;
+            return &hoisted;
+        }
+    }
+
+    const size_t rowCount = 1 + m_valueRowCount + m_keyRowCount;
+    if (count * rowCount > s_maxHoistedValueCount)
+    {
+        return nullptr;
+    }
+
+    // The least recently used samples make room, the buffers of the last of them are reused
+    HoistedSamples* hoisted = nullptr;
+    while (hoisted == nullptr)
+    {
+        if (m_hoistedSamples.size() < s_maxHoistedSampleSets && m_hoistedValueCount + count * rowCount <= s_maxHoistedValueCount)
+        {
+            hoisted = &m_hoistedSamples.emplace_back();
+            break;
+        }
+
+        auto oldest = min_element(m_hoistedSamples.begin(), m_hoistedSamples.end(), [](const HoistedSamples& left, const HoistedSamples& right) {
+            return left.lastUse < right.lastUse;
+        });
+        m_hoistedValueCount -= oldest->samples.size() * rowCount;
+        if (m_hoistedValueCount + count * rowCount <= s_maxHoistedValueCount)
+        {
+            hoisted = &*oldest;
+        }
+        else
+        {
+            m_hoistedSamples.erase(oldest);
+        }
+    }
+
+    hoisted->samples.assign(samples, samples + count);
+    hoisted->values.resize(count * m_valueRowCount);
+    hoisted->keys.resize(count * m_keyRowCount);
+    hoisted->hasKeys = needsKeys;
+    hoisted->lastUse = m_hoistedUse;
+    m_hoistedValueCount += count * rowCount;
+    isReused = false;
+    return hoisted;
+}
+
+// hoisted receives the kept values of the samples from begin on, or gives them when isReused
+void BatchEvaluator::EvaluateBlock(size_t laneCount, uint8_t* flags, bool isFirstBlock, HoistedSamples* hoisted, size_t begin, bool isReused)
+{
+    const InstructionKernel execute = GetLaneKernel().execute;
+    const size_t paddedLaneCount = PaddedLaneCount(laneCount);
+    const auto& instructions = m_program.Instructions();
+    const size_t sampleCount = hoisted != nullptr ? hoisted->samples.size() : 0;
+    const bool isKeeping = hoisted != nullptr && !isReused;
+
+    size_t discontinuity = 0;
+    for (size_t i = 0; i < instructions.size(); i++)
+    {
+        // Keys are only needed for the flags. Keys read from operands are taken before the target, which may share a
+        // register with an operand, is written
+        const bool hasKey = flags != nullptr && discontinuity < m_discontinuities.size() && m_discontinuities[discontinuity] == i;
+        const InstructionKind kind = m_kinds[i];
+        double* target = m_registers.data() + instructions[i].target * BlockSize;
+        double* keys = m_keys.data() + discontinuity * BlockSize;
+
+        if (isReused && kind >= InstructionKind::Hoisted)
+        {
+            if (kind == InstructionKind::KeptHoisted)
+            {
+                const double* values = hoisted->values.data() + m_valueRows[i] * sampleCount + begin;
+                copy_n(values, laneCount, target);
+                fill(target + laneCount, target + paddedLaneCount, values[laneCount - 1]);
+            }
+            if (hasKey)
+            {
+                copy_n(hoisted->keys.data() + m_keyRows[discontinuity] * sampleCount + begin, laneCount, keys);
+                discontinuity++;
+            }
+            continue;
+        }
+
+        if (hasKey && !IsKeyFromResult(instructions[i].op))
+        {
+            ComputeDiscontinuityKeys(discontinuity, laneCount);
+        }
+
+        if (kind == InstructionKind::Uniform)
+        {
+            execute(instructions[i], m_registers.data(), s_laneGroup);
+            fill(target + s_laneGroup, target + paddedLaneCount, target[0]);
+        }
+        else
+        {
+            execute(instructions[i], m_registers.data(), paddedLaneCount);
+        }
+
+        if (hasKey)
+        {
+            if (IsKeyFromResult(instructions[i].op))
+            {
+                ComputeDiscontinuityKeys(discontinuity, laneCount);
+            }
+            if (isKeeping && kind >= InstructionKind::Hoisted)
+            {
+                copy_n(keys, laneCount, hoisted->keys.data() + m_keyRows[discontinuity] * sampleCount + begin);
+            }
+            discontinuity++;
+        }
+        if (isKeeping && kind == InstructionKind::KeptHoisted)
+        {
+            copy_n(target, laneCount, hoisted->values.data() + m_valueRows[i] * sampleCount + begin);
+        }
+    }
+
+    if (flags == nullptr)
+    {
+        return;
+    }
+
+    const double* resultRow = m_registers.data() + m_program.ResultRegister() * BlockSize;
+    for (size_t lane = 0; lane < laneCount; lane++)
+    {
+        flags[lane] = isfinite(resultRow[lane]) ? uint8_t{ 0 } : SampleFlags::Undefined;
+    }
+
+    for (size_t i = 0; i < m_discontinuities.size(); i++)
+    {
+        const double* keys = m_keys.data() + i * BlockSize;
+        if (!isFirstBlock && KeysDiffer(m_previousKeys[i], keys[0]))
+        {
+            flags[0] |= SampleFlags::Discontinuity;
+        }
+        for (size_t lane = 1; lane < laneCount; lane++)
+        {
+            if (KeysDiffer(keys[lane - 1], keys[lane]))
+            {
+                flags[lane] |= SampleFlags::Discontinuity;
+            }
+        }
+        m_previousKeys[i] = keys[laneCount - 1];
+    }
+}
+
+void BatchEvaluator::ComputeDiscontinuityKeys(size_t discontinuity, size_t laneCount)
+{
+    const Instruction& instruction = m_program.Instructions()[m_discontinuities[discontinuity]];
+    double* keys = m_keys.data() + discontinuity * BlockSize;
+    if (IsKeyFromResult(instruction.op))
+    {
+        copy_n(m_registers.data() + instruction.target * BlockSize, laneCount, keys);
+        return;
+    }
+
+    const double* left = m_registers.data() + instruction.left * BlockSize;
+    const double* right = m_registers.data() + instruction.right * BlockSize;
+    for (size_t lane = 0; lane < laneCount; lane++)
+    {
+        keys[lane] = OperandKey(instruction.op, left[lane], right[lane]);
+    }
+}
+
+const wchar_t* BatchEvaluator::InstructionSetName()
+{
+    return GetLaneKernel().name;
+}
@@ -0,0 +1,104 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "Program.h"
+
+namespace NativeGraphingImpl
+{
+    namespace SampleFlags
+    {
+        // The value is NaN or infinite
+        constexpr uint8_t Undefined = 1;
+
+        // The function may jump between the previous sample and this one: a denominator or the argument of tan changes
+        // branch, or floor, ceiling, round or sign changes value
+        constexpr uint8_t Discontinuity = 2;
+    }
+
+    // Evaluates a program at many values of one argument at once. Samples are run through the instructions a block at a
+    // time, with every register holding one value per sample, so each instruction becomes a loop over SIMD lanes.
+    //
+    // The lanes are AVX2 or SSE4.1 on x86 and x64, picked from the CPU when built with MSVC and from the compiler
+    // flags otherwise. Other targets apply the scalar functions to each sample. Sin, cos, tan, exp, ln, log10 and the
+    // powers use polynomial approximations accurate to a few units in the last place. Lanes the approximations do not
+    // cover (such as the sine of a huge argument or a power of a negative number) and the other functions go through
+    // the scalar Apply, so results match Program::Evaluate.
+    //
+    // Instructions that do not depend on the sampled argument have the same value in every lane and run on one group of
+    // lanes. Those that depend on it alone are hoisted: their values at the samples of recent calls are kept, and a call
+    // with the same samples, such as the uniform pass of a strip sampled again after a variable changed, copies the ones
+    // later instructions read instead of running them.
+    class BatchEvaluator
+    {
+    public:
+        static constexpr size_t BlockSize = 128;
+
+        // program must outlive the evaluator
+        explicit BatchEvaluator(const Program& program);
+
+        // arguments is indexed by slot as for Program::Evaluate, the value in sweepSlot is replaced by each of the count
+        // samples. flags can be null, else it receives a combination of SampleFlags for each sample. A discontinuity
+        // is only reported between samples of the same call.
+        void Evaluate(const double* arguments, size_t sweepSlot, const double* samples, size_t count, double* results, uint8_t* flags = nullptr);
+
+        // Name of the lanes in use, such as "AVX2"
+        static const wchar_t* InstructionSetName();
+
+    private:
+        enum class InstructionKind : uint8_t
+        {
+            Uniform,     // does not depend on the sampled argument
+            Varying,     // depends on the sampled argument and others
+            Hoisted,     // depends on the sampled argument alone
+            KeptHoisted, // hoisted, and read by a varying instruction or the result
+        };
+
+        // The values of the kept instructions at a set of samples, and the keys of the hoisted ones that can jump
+        struct HoistedSamples
+        {
+            std::vector<double> samples;
+
+            // Row k of n samples starts at k * n, in the order of the instructions
+            std::vector<double> values;
+            std::vector<double> keys;
+
+            bool hasKeys = false;
+            size_t lastUse = 0;
+        };
+
+        void Classify(size_t sweepSlot);
+        HoistedSamples* FindHoistedSamples(const double* samples, size_t count, bool needsKeys, bool& isReused);
+        void EvaluateBlock(size_t laneCount, uint8_t* flags, bool isFirstBlock, HoistedSamples* hoisted, size_t begin, bool isReused);
+        void ComputeDiscontinuityKeys(size_t discontinuity, size_t laneCount);
+
+        const Program& m_program;
+
+        // The kind of each instruction, for the sweep slot of the last call
+        size_t m_sweepSlot;
+        std::vector<InstructionKind> m_kinds;
+
+        // Row in HoistedSamples::values of each kept instruction, and in HoistedSamples::keys of each hoisted discontinuity
+        std::vector<size_t> m_valueRows;
+        std::vector<size_t> m_keyRows;
+        size_t m_valueRowCount;
+        size_t m_keyRowCount;
+
+        // The samples of recent calls, the least recently used are dropped first. Only kept when some instruction is
+        // hoisted and read by a varying one
+        bool m_isHoisting;
+        std::vector<HoistedSamples> m_hoistedSamples;
+        size_t m_hoistedValueCount;
+        size_t m_hoistedUse;
+
+        // Register r of sample i is at m_registers[r * BlockSize + i]
+        std::vector<double> m_registers;
+
+        // Instructions that can jump, with one key per sample. A key summarizes the branch the instruction is on, two
+        // adjacent samples with different keys have a discontinuity between them
+        std::vector<size_t> m_discontinuities;
+        std::vector<double> m_keys;
+        std::vector<double> m_previousKeys;
+    };
+}
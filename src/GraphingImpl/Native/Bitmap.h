@@ -0,0 +1,34 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "GraphingInterfaces/IBitmap.h"
+
+namespace NativeGraphingImpl
+{
+    class Bitmap : public Graphing::IBitmap
+    {
+    public:
+        Bitmap() = default;
+
+        explicit Bitmap(std::vector<BYTE> data)
+            : m_data(std::move(data))
+        {
+        }
+
+        const std::vector<BYTE>& GetData() const override
+        {
+            return m_data;
+        }
+
+        // Lets the renderer encode the next image in place while no one else holds the bitmap
+        std::vector<BYTE>& GetBuffer()
+        {
+            return m_data;
+        }
+
+    private:
+        std::vector<BYTE> m_data;
+    };
+}
@@ -0,0 +1,328 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "CurveCache.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <tuple>
+
+using namespace std;
+using namespace NativeGraphingImpl;
+
+namespace
+{
+    // Width in pixels of a strip at its level, and the margin in strip widths of a band of values beyond the view
+    constexpr double s_stripPixels = 256;
+    constexpr double s_valueBandMargin = 1;
+
+    // How many levels away a placeholder can be
+    constexpr int s_maxPlaceholderDistance = 4;
+
+    constexpr size_t s_defaultMaxByteCount = 32 * 1024 * 1024;
+    constexpr double s_defaultFrameEvaluationsPerPixel = 16;
+
+    // The level whose units per pixel are the power of 2 at or below the given ones
+    int Level(double unitsPerPixel)
+    {
+        return static_cast<int>(floor(log2(unitsPerPixel)));
+    }
+
+    int64_t FloorDivide(int64_t value, int64_t divisor)
+    {
+        return value >= 0 ? value / divisor : -((-value - 1) / divisor) - 1;
+    }
+
+    // FNV-1a over the bits of the values
+    uint64_t Hash(const vector<double>& values)
+    {
+        uint64_t hash = 14695981039346656037ull;
+        for (double value : values)
+        {
+            uint64_t bits;
+            memcpy(&bits, &value, sizeof(bits));
+            for (int i = 0; i < 8; i++)
+            {
+                hash = (hash ^ ((bits >> (8 * i)) & 0xFF)) * 1099511628211ull;
+            }
+        }
+        return hash;
+    }
+
+    // What a strip costs, counting a few pointers for its node in the map
+    size_t ByteCount(size_t stripSize, const vector<double>& arguments, const SampledCurve& curve)
+    {
+        return stripSize + 4 * sizeof(void*) + arguments.capacity() * sizeof(double) + curve.points.capacity() * sizeof(CurvePoint)
+               + curve.polylineStarts.capacity() * sizeof(size_t) + curve.asymptotes.capacity() * sizeof(double);
+    }
+}
+
+bool CurveCache::StripKey::operator<(const StripKey& other) const
+{
+    return tie(curveId, argumentsHash, sweepLevel, strip, valueLevel, valueBand)
+           < tie(other.curveId, other.argumentsHash, other.sweepLevel, other.strip, other.valueLevel, other.valueBand);
+}
+
+CurveCache::CurveCache()
+    : m_maxByteCount(s_defaultMaxByteCount)
+    , m_frameEvaluationsPerPixel(s_defaultFrameEvaluationsPerPixel)
+    , m_frame(0)
+    , m_lastPlaceholder(nullptr)
+    , m_minAsymptoteSpacing(0)
+{
+}
+
+void CurveCache::SetMaxByteCount(size_t byteCount)
+{
+    m_maxByteCount = byteCount;
+    Evict();
+}
+
+void CurveCache::SetFrameEvaluationBudget(double evaluationsPerPixel)
+{
+    m_frameEvaluationsPerPixel = max(0.0, evaluationsPerPixel);
+}
+
+void CurveCache::ResetStatistics()
+{
+    m_statistics.hits = 0;
+    m_statistics.misses = 0;
+    m_statistics.placeholders = 0;
+}
+
+void CurveCache::Clear()
+{
+    m_strips.clear();
+    m_statistics.stripCount = 0;
+    m_statistics.byteCount = 0;
+}
+
+void CurveCache::BeginFrame()
+{
+    m_frame++;
+}
+
+void CurveCache::EndFrame()
+{
+    Evict();
+}
+
+void CurveCache::Sample(size_t curveId, CurveSampler& sampler, const vector<double>& arguments, const SampleWindow& window, SampledCurve& curve)
+{
+    curve.Clear();
+    const double sweepUnitsPerPixel = (window.sweepMax - window.sweepMin) / window.sweepPixels;
+    const double valueUnitsPerPixel = (window.valueMax - window.valueMin) / window.valuePixels;
+    if (!(sweepUnitsPerPixel > 0) || !(valueUnitsPerPixel > 0) || !isfinite(sweepUnitsPerPixel) || !isfinite(valueUnitsPerPixel))
+    {
+        return;
+    }
+
+    StripKey key{ curveId, Hash(arguments), Level(sweepUnitsPerPixel), 0, Level(valueUnitsPerPixel), 0 };
+    const double stripWidth = ldexp(s_stripPixels, key.sweepLevel);
+    const double bandHeight = ldexp(s_stripPixels, key.valueLevel);
+    const int64_t firstStrip = static_cast<int64_t>(floor(window.sweepMin / stripWidth));
+    const int64_t lastStrip = max(firstStrip, static_cast<int64_t>(ceil(window.sweepMax / stripWidth)) - 1);
+    const double budget = m_frameEvaluationsPerPixel * window.sweepPixels;
+    size_t evaluationCount = 0;
+    m_lastPlaceholder = nullptr;
+    m_minAsymptoteSpacing = sweepUnitsPerPixel;
+
+    for (key.strip = firstStrip; key.strip <= lastStrip; key.strip++)
+    {
+        if (Strip* strip = Find(key, arguments, window))
+        {
+            m_statistics.hits++;
+            Append(*strip, curve);
+            continue;
+        }
+
+        // The first new strip is always sampled, so that every frame makes progress
+        if (evaluationCount > 0 && evaluationCount >= budget && AppendPlaceholder(key, arguments, window, curve))
+        {
+            m_statistics.placeholders++;
+            curve.hasMissingData = true;
+            continue;
+        }
+
+        const double bandLow = floor(window.valueMin / bandHeight) - s_valueBandMargin;
+        const double bandHigh = ceil(window.valueMax / bandHeight) + s_valueBandMargin;
+        key.valueBand = static_cast<int64_t>(bandLow);
+
+        // Replaces a strip of the same key only when its arguments have the same hash
+        Strip& strip = m_strips[key];
+        m_statistics.byteCount -= strip.byteCount;
+        strip.arguments = arguments;
+        strip.valueMin = bandLow * bandHeight;
+        strip.valueMax = bandHigh * bandHeight;
+        const double stripStart = key.strip * stripWidth;
+        const SampleWindow stripWindow{ stripStart, stripStart + stripWidth, strip.valueMin, strip.valueMax, s_stripPixels, (bandHigh - bandLow) * s_stripPixels };
+        sampler.Sample(arguments.data(), stripWindow, strip.curve);
+        strip.byteCount = ByteCount(sizeof(StripMap::value_type), strip.arguments, strip.curve);
+        m_statistics.byteCount += strip.byteCount;
+        m_statistics.stripCount = m_strips.size();
+        m_statistics.misses++;
+
+        evaluationCount += strip.curve.evaluationCount;
+        Append(strip, curve);
+    }
+    curve.evaluationCount = evaluationCount;
+}
+
+// A strip of the level of the key, over a band of values at the level of the key that covers the view
+CurveCache::Strip* CurveCache::Find(const StripKey& key, const vector<double>& arguments, const SampleWindow& window)
+{
+    StripKey first = key;
+    first.valueBand = numeric_limits<int64_t>::min();
+    for (auto it = m_strips.lower_bound(first); it != m_strips.end(); ++it)
+    {
+        const StripKey& found = it->first;
+        if (found.curveId != key.curveId || found.argumentsHash != key.argumentsHash || found.sweepLevel != key.sweepLevel || found.strip != key.strip
+            || found.valueLevel != key.valueLevel)
+        {
+            break;
+        }
+
+        Strip& strip = it->second;
+        if (strip.valueMin <= window.valueMin && strip.valueMax >= window.valueMax && strip.arguments == arguments)
+        {
+            return &strip;
+        }
+    }
+    return nullptr;
+}
+
+// A strip of the level of the key over a band of values that covers the view, at the nearest level of the value axis
+CurveCache::Strip* CurveCache::FindAnyValueLevel(const StripKey& key, const vector<double>& arguments, const SampleWindow& window)
+{
+    StripKey first = key;
+    first.valueLevel = numeric_limits<int>::min();
+    first.valueBand = numeric_limits<int64_t>::min();
+    Strip* best = nullptr;
+    int bestDistance = numeric_limits<int>::max();
+    for (auto it = m_strips.lower_bound(first); it != m_strips.end(); ++it)
+    {
+        const StripKey& found = it->first;
+        if (found.curveId != key.curveId || found.argumentsHash != key.argumentsHash || found.sweepLevel != key.sweepLevel || found.strip != key.strip)
+        {
+            break;
+        }
+
+        Strip& strip = it->second;
+        const int distance = abs(found.valueLevel - key.valueLevel);
+        if (distance < bestDistance && strip.valueMin <= window.valueMin && strip.valueMax >= window.valueMax && strip.arguments == arguments)
+        {
+            best = &strip;
+            bestDistance = distance;
+        }
+    }
+    return best;
+}
+
+// Stands in for the strip of the key with the strips of the nearest level that cover it, finer ones first
+bool CurveCache::AppendPlaceholder(const StripKey& key, const vector<double>& arguments, const SampleWindow& window, SampledCurve& curve)
+{
+    for (int distance = 1; distance <= s_maxPlaceholderDistance; distance++)
+    {
+        const int64_t ratio = int64_t{ 1 } << distance;
+
+        StripKey finer = key;
+        finer.sweepLevel -= distance;
+        Strip* finerStrips[int64_t{ 1 } << s_maxPlaceholderDistance];
+        bool isFinerCached = true;
+        for (int64_t i = 0; i < ratio && isFinerCached; i++)
+        {
+            finer.strip = key.strip * ratio + i;
+            finerStrips[i] = FindAnyValueLevel(finer, arguments, window);
+            isFinerCached = finerStrips[i] != nullptr;
+        }
+        if (isFinerCached)
+        {
+            for (int64_t i = 0; i < ratio; i++)
+            {
+                Append(*finerStrips[i], curve);
+            }
+            m_lastPlaceholder = finerStrips[ratio - 1];
+            return true;
+        }
+
+        StripKey coarser = key;
+        coarser.sweepLevel += distance;
+        coarser.strip = FloorDivide(key.strip, ratio);
+        if (Strip* strip = FindAnyValueLevel(coarser, arguments, window))
+        {
+            if (strip != m_lastPlaceholder)
+            {
+                Append(*strip, curve);
+                m_lastPlaceholder = strip;
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+// Continues the last polyline of the curve when the strip starts where it ends
+void CurveCache::Append(Strip& strip, SampledCurve& curve)
+{
+    strip.lastFrame = m_frame;
+    const SampledCurve& source = strip.curve;
+    for (size_t i = 0; i < source.polylineStarts.size(); i++)
+    {
+        size_t start = source.polylineStarts[i];
+        const size_t end = i + 1 < source.polylineStarts.size() ? source.polylineStarts[i + 1] : source.points.size();
+        const CurvePoint& first = source.points[start];
+        if (i == 0 && !curve.points.empty() && curve.points.back().x == first.x && curve.points.back().y == first.y)
+        {
+            start++;
+        }
+        else
+        {
+            curve.polylineStarts.push_back(curve.points.size());
+        }
+        curve.points.insert(curve.points.end(), source.points.begin() + start, source.points.begin() + end);
+    }
+
+    // A pole at the edge of a strip is found by both strips
+    for (double asymptote : source.asymptotes)
+    {
+        if (curve.asymptotes.empty() || asymptote - curve.asymptotes.back() >= m_minAsymptoteSpacing)
+        {
+            curve.asymptotes.push_back(asymptote);
+        }
+    }
+    curve.hasMissingData = curve.hasMissingData || source.hasMissingData;
+}
+
+// Drops the least recently used strips, but none of the current frame, until the cache fits its size
+void CurveCache::Evict()
+{
+    if (m_statistics.byteCount <= m_maxByteCount)
+    {
+        return;
+    }
+
+    m_evictionOrder.clear();
+    for (auto it = m_strips.begin(); it != m_strips.end(); ++it)
+    {
+        if (it->second.lastFrame != m_frame)
+        {
+            m_evictionOrder.push_back(it);
+        }
+    }
+    sort(m_evictionOrder.begin(), m_evictionOrder.end(), [](const auto& left, const auto& right) {
+        return left->second.lastFrame < right->second.lastFrame;
+    });
+
+    for (const auto& it : m_evictionOrder)
+    {
+        if (m_statistics.byteCount <= m_maxByteCount)
+        {
+            break;
+        }
+        m_statistics.byteCount -= it->second.byteCount;
+        m_strips.erase(it);
+    }
+    m_statistics.stripCount = m_strips.size();
+}
@@ -0,0 +1,112 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <map>
+#include "CurveSampler.h"
+
+namespace NativeGraphingImpl
+{
+    struct CurveCacheStatistics
+    {
+        // Strips found at the resolution of the view, strips sampled, and strips of another resolution shown instead
+        size_t hits = 0;
+        size_t misses = 0;
+        size_t placeholders = 0;
+
+        size_t stripCount = 0;
+        size_t byteCount = 0;
+    };
+
+    // Keeps sampled curves between frames so that panning and zooming only sample what the view did not show before.
+    //
+    // A curve is sampled in strips along its sweep argument. The strips of a level of resolution are a fixed number of
+    // pixels wide at a power of 2 of units per pixel, the level at or just finer than the view, and start at multiples of
+    // their width, so a pan reuses every strip still in view. A strip is sampled over a band of values wider than the
+    // view, a multiple of the same size at the level of the value axis, and serves any view inside its band.
+    //
+    // Sampling new strips of a curve stops once the frame has used its budget of evaluations, the strips left use a cached
+    // level nearby as a placeholder and the curve reports missing data until a later frame samples them. The least recently
+    // used strips are dropped when the cache grows past its size.
+    class CurveCache
+    {
+    public:
+        CurveCache();
+
+        void SetMaxByteCount(size_t byteCount);
+        size_t GetMaxByteCount() const
+        {
+            return m_maxByteCount;
+        }
+
+        // How many evaluations a curve can spend on new strips in one frame, per pixel of the sweep
+        void SetFrameEvaluationBudget(double evaluationsPerPixel);
+        double GetFrameEvaluationBudget() const
+        {
+            return m_frameEvaluationsPerPixel;
+        }
+
+        const CurveCacheStatistics& GetStatistics() const
+        {
+            return m_statistics;
+        }
+        void ResetStatistics();
+
+        void Clear();
+
+        // The strips used between BeginFrame and EndFrame are not dropped, EndFrame drops strips past the size
+        void BeginFrame();
+        void EndFrame();
+
+        // Fills curve with the strips covering window. curveId tells the curves apart, sampler samples the curve and
+        // arguments are its argument values, the cache keeps strips for every set of values it has seen.
+        void Sample(size_t curveId, CurveSampler& sampler, const std::vector<double>& arguments, const SampleWindow& window, SampledCurve& curve);
+
+    private:
+        struct StripKey
+        {
+            size_t curveId;
+            uint64_t argumentsHash;
+            int sweepLevel;
+            int64_t strip;
+            int valueLevel;
+            int64_t valueBand;
+
+            bool operator<(const StripKey& other) const;
+        };
+
+        struct Strip
+        {
+            std::vector<double> arguments;
+            double valueMin = 0;
+            double valueMax = 0;
+            SampledCurve curve;
+            size_t lastFrame = 0;
+            size_t byteCount = 0;
+        };
+
+        using StripMap = std::map<StripKey, Strip>;
+
+        Strip* Find(const StripKey& key, const std::vector<double>& arguments, const SampleWindow& window);
+        Strip* FindAnyValueLevel(const StripKey& key, const std::vector<double>& arguments, const SampleWindow& window);
+        bool AppendPlaceholder(const StripKey& key, const std::vector<double>& arguments, const SampleWindow& window, SampledCurve& curve);
+        void Append(Strip& strip, SampledCurve& curve);
+        void Evict();
+
+        StripMap m_strips;
+        size_t m_maxByteCount;
+        double m_frameEvaluationsPerPixel;
+        CurveCacheStatistics m_statistics;
+        size_t m_frame;
+
+        // The placeholder appended last, a coarser strip covers several strips of the view
+        const Strip* m_lastPlaceholder;
+
+        // Two asymptotes closer than a pixel of the view are one
+        double m_minAsymptoteSpacing;
+
+        // Oldest first, reused by Evict
+        std::vector<StripMap::iterator> m_evictionOrder;
+    };
+}
@@ -0,0 +1,336 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "CurveSampler.h"
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
+using namespace NativeGraphingImpl;
+
+namespace
+{
+    // Spacing in pixels of the uniform pass
+    constexpr double s_initialSpacing = 8;
+    constexpr size_t s_maxInitialCells = 4096;
+
+    // How far in pixels the polyline can be from the curve, and the sharpest turn it can take unless the segments are shorter
+    constexpr double s_tolerance = 0.25;
+    constexpr double s_minTurnCosine = 0.97;
+
+    // How far in pixels the bounds of the derivative can let the curve stray from the polyline
+    constexpr double s_deviationTolerance = 0.5;
+
+    // Without bounds of the derivative, a spike can hide in a cell where the bounds of the function reach this many pixels
+    // further than the samples
+    constexpr double s_spikeTolerance = 1;
+
+    // Cells where the bounds of the function suspect a spike or a hole in the domain, and undefined cells that may hide an
+    // island of it, are split down to this width in pixels
+    constexpr double s_minSuspectCellWidth = 1;
+
+    // Widths in pixels below which cells are no longer split: a smooth part, the edge of the domain and a jump
+    constexpr double s_minCellWidth = 1.0 / 8;
+    constexpr double s_edgeCellWidth = 1.0 / 64;
+    constexpr double s_jumpCellWidth = 1.0 / 1024;
+    constexpr int s_maxDepth = 48;
+
+    // Evaluations allowed per pixel of the sweep, a curve that needs more reports missing data
+    constexpr double s_evaluationsPerPixel = 64;
+    constexpr size_t s_minEvaluationBudget = 4096;
+
+    // Two poles closer than this in pixels are marked with one asymptote
+    constexpr double s_minAsymptoteSpacing = 1;
+
+    // By the mean value theorem the function stays within the bounds of its derivative from the values at the ends
+    void Tighten(Interval& bounds, const Interval& slope, const CurvePoint& first, const CurvePoint& last)
+    {
+        if (bounds.mayBeUndefined || !slope.IsBounded())
+        {
+            return;
+        }
+
+        const double width = last.x - first.x;
+        bounds.low = max({ bounds.low, first.y + min(0.0, slope.low * width), last.y - max(0.0, slope.high * width) });
+        bounds.high = min({ bounds.high, first.y + max(0.0, slope.high * width), last.y - min(0.0, slope.low * width) });
+    }
+}
+
+void SampledCurve::Clear()
+{
+    points.clear();
+    polylineStarts.clear();
+    asymptotes.clear();
+    evaluationCount = 0;
+    hasMissingData = false;
+}
+
+CurveSampler::CurveSampler(const Program& program, size_t sweepSlot)
+    : m_program(program)
+    , m_sweepSlot(sweepSlot)
+    , m_batchEvaluator(program)
+    , m_intervalEvaluator(program)
+    , m_registers(program.RegisterCount())
+    , m_curve(nullptr)
+    , m_window{}
+    , m_sweepScale(0)
+    , m_valueScale(0)
+    , m_evaluationBudget(0)
+    , m_isPolylineOpen(false)
+{
+    size_t argumentCount = sweepSlot + 1;
+    for (const auto& [slot, reg] : program.ArgumentRegisters())
+    {
+        argumentCount = max<size_t>(argumentCount, slot + 1);
+    }
+    m_arguments.resize(argumentCount);
+    program.InitializeRegisters(m_registers.data());
+}
+
+void CurveSampler::Sample(const double* arguments, const SampleWindow& window, SampledCurve& curve)
+{
+    curve.Clear();
+    m_sweepScale = window.sweepPixels / (window.sweepMax - window.sweepMin);
+    m_valueScale = window.valuePixels / (window.valueMax - window.valueMin);
+    if (!(m_sweepScale > 0) || !(m_valueScale > 0) || !isfinite(m_sweepScale) || !isfinite(m_valueScale))
+    {
+        return;
+    }
+
+    m_curve = &curve;
+    m_window = window;
+    m_arguments.assign(arguments, arguments + m_arguments.size());
+    m_evaluationBudget = max(s_minEvaluationBudget, static_cast<size_t>(s_evaluationsPerPixel * window.sweepPixels));
+    m_isPolylineOpen = false;
+
+    const size_t cellCount = min(s_maxInitialCells, max<size_t>(1, static_cast<size_t>(ceil(window.sweepPixels / s_initialSpacing))));
+    m_samples.resize(cellCount + 1);
+    m_values.resize(cellCount + 1);
+    for (size_t i = 0; i < cellCount; i++)
+    {
+        m_samples[i] = window.sweepMin + (window.sweepMax - window.sweepMin) * i / cellCount;
+    }
+    m_samples[cellCount] = window.sweepMax;
+    m_batchEvaluator.Evaluate(m_arguments.data(), m_sweepSlot, m_samples.data(), m_samples.size(), m_values.data());
+    curve.evaluationCount = m_samples.size();
+
+    AddPoint({ m_samples[0], m_values[0] });
+    for (size_t i = 0; i < cellCount; i++)
+    {
+        Refine({ m_samples[i], m_values[i] }, { m_samples[i + 1], m_values[i + 1] }, 0);
+    }
+    m_curve = nullptr;
+}
+
+void CurveSampler::Refine(const CurvePoint& first, const CurvePoint& last, int depth)
+{
+    if (m_curve->evaluationCount >= m_evaluationBudget)
+    {
+        m_curve->hasMissingData = true;
+        AddPoint(last);
+        return;
+    }
+
+    const double width = (last.x - first.x) * m_sweepScale;
+    Interval slope;
+    Interval bounds = m_intervalEvaluator.Evaluate(m_arguments.data(), m_sweepSlot, first.x, last.x, slope);
+    if (bounds.IsEmpty())
+    {
+        AddPoint(last);
+        return;
+    }
+
+    // Look for an island of the domain narrower than the uniform pass between undefined samples
+    const bool isFirstDefined = isfinite(first.y);
+    const bool isLastDefined = isfinite(last.y);
+    if (!isFirstDefined && !isLastDefined)
+    {
+        if (width <= s_minSuspectCellWidth || !TrySplit(first, last, depth))
+        {
+            AddPoint(last);
+        }
+        return;
+    }
+
+    if (bounds.mayJump)
+    {
+        if (width <= s_jumpCellWidth || !TrySplit(first, last, depth))
+        {
+            AddJump(first, last, bounds);
+        }
+        return;
+    }
+
+    // Narrow down the edge of the domain
+    if (!isFirstDefined || !isLastDefined)
+    {
+        if (width <= s_edgeCellWidth || !TrySplit(first, last, depth))
+        {
+            AddPoint(last);
+        }
+        return;
+    }
+
+    Tighten(bounds, slope, first, last);
+    if (bounds.low > m_window.valueMax || bounds.high < m_window.valueMin || width <= s_minCellWidth || depth >= s_maxDepth)
+    {
+        AddPoint(last);
+        return;
+    }
+
+    const double x = first.x + (last.x - first.x) / 2;
+    if (x <= first.x || x >= last.x)
+    {
+        AddPoint(last);
+        return;
+    }
+
+    const CurvePoint middle{ x, Evaluate(x) };
+    if (NeedsSplit(first, middle, last, bounds, slope))
+    {
+        Refine(first, middle, depth + 1);
+        Refine(middle, last, depth + 1);
+    }
+    else
+    {
+        AddPoint(middle);
+        AddPoint(last);
+    }
+}
+
+bool CurveSampler::TrySplit(const CurvePoint& first, const CurvePoint& last, int depth)
+{
+    const double x = first.x + (last.x - first.x) / 2;
+    if (depth >= s_maxDepth || x <= first.x || x >= last.x)
+    {
+        return false;
+    }
+
+    const CurvePoint middle{ x, Evaluate(x) };
+    Refine(first, middle, depth + 1);
+    Refine(middle, last, depth + 1);
+    return true;
+}
+
+bool CurveSampler::NeedsSplit(const CurvePoint& first, const CurvePoint& middle, const CurvePoint& last, const Interval& bounds, const Interval& slope) const
+{
+    if (!isfinite(middle.y))
+    {
+        return true;
+    }
+
+    // Distance of the middle from the chord, in pixels
+    const double chordX = (last.x - first.x) * m_sweepScale;
+    const double chordY = (last.y - first.y) * m_valueScale;
+    const double toMiddleX = (middle.x - first.x) * m_sweepScale;
+    const double toMiddleY = (middle.y - first.y) * m_valueScale;
+    const double chordLength = hypot(chordX, chordY);
+    const double error = fabs(chordX * toMiddleY - chordY * toMiddleX) / chordLength;
+    if (!(error <= s_tolerance))
+    {
+        return true;
+    }
+
+    const double fromMiddleX = chordX - toMiddleX;
+    const double fromMiddleY = chordY - toMiddleY;
+    const double toMiddleLength = hypot(toMiddleX, toMiddleY);
+    const double fromMiddleLength = hypot(fromMiddleX, fromMiddleY);
+    if (toMiddleLength > s_tolerance && fromMiddleLength > s_tolerance
+        && toMiddleX * fromMiddleX + toMiddleY * fromMiddleY < s_minTurnCosine * toMiddleLength * fromMiddleLength)
+    {
+        return true;
+    }
+
+    if (!bounds.mayBeUndefined && slope.IsBounded())
+    {
+        return MaxDeviation(first, middle, slope) > s_deviationTolerance || MaxDeviation(middle, last, slope) > s_deviationTolerance;
+    }
+
+    // Without a derivative look for a visible part of the curve beyond the samples
+    if (chordX <= s_minSuspectCellWidth)
+    {
+        return false;
+    }
+    if (bounds.mayBeUndefined)
+    {
+        return true;
+    }
+    const double low = min({ first.y, middle.y, last.y });
+    const double high = max({ first.y, middle.y, last.y });
+    const double below = min(low, m_window.valueMax) - max(bounds.low, m_window.valueMin);
+    const double above = min(bounds.high, m_window.valueMax) - max(high, m_window.valueMin);
+    return max(below, above) * m_valueScale > s_spikeTolerance;
+}
+
+// How far in pixels the curve between two samples can be from the segment joining them. The curve leaves the segment at
+// most at the steepest slope above the segment's and comes back at the steepest one below it.
+double CurveSampler::MaxDeviation(const CurvePoint& first, const CurvePoint& last, const Interval& slope) const
+{
+    const double width = last.x - first.x;
+    const double chordSlope = (last.y - first.y) / width;
+    const double above = max(0.0, slope.high - chordSlope);
+    const double below = max(0.0, chordSlope - slope.low);
+    if (!(above + below > 0))
+    {
+        return 0;
+    }
+
+    // Measured across the segment rather than vertically
+    const double deviation = above * below / (above + below) * width * m_valueScale;
+    return deviation * m_sweepScale / hypot(m_sweepScale, chordSlope * m_valueScale);
+}
+
+// The jump is inside a cell a fraction of a pixel wide
+void CurveSampler::AddJump(const CurvePoint& first, const CurvePoint& last, const Interval& bounds)
+{
+    // The bounds can report a jump the function does not make, such as x/x at 0
+    if (isfinite(first.y) && isfinite(last.y) && fabs(last.y - first.y) * m_valueScale <= s_tolerance)
+    {
+        AddPoint(last);
+        return;
+    }
+
+    // A pole, as opposed to a step or the edge of the domain. The value at the pole itself can be NaN, as for gamma.
+    m_isPolylineOpen = false;
+    const bool isPole = isnan(first.y) ? IsBeyondView(last.y) : isnan(last.y) ? IsBeyondView(first.y) : true;
+    if (!bounds.IsBounded() && isPole)
+    {
+        const double x = first.x + (last.x - first.x) / 2;
+        auto& asymptotes = m_curve->asymptotes;
+        if (asymptotes.empty() || (x - asymptotes.back()) * m_sweepScale >= s_minAsymptoteSpacing)
+        {
+            asymptotes.push_back(x);
+        }
+    }
+    AddPoint(last);
+}
+
+void CurveSampler::AddPoint(const CurvePoint& point)
+{
+    if (!isfinite(point.y))
+    {
+        m_isPolylineOpen = false;
+        return;
+    }
+
+    if (!m_isPolylineOpen)
+    {
+        m_curve->polylineStarts.push_back(m_curve->points.size());
+        m_isPolylineOpen = true;
+    }
+    m_curve->points.push_back(point);
+}
+
+// Infinite values are beyond the view, NaN is nowhere
+bool CurveSampler::IsBeyondView(double value) const
+{
+    return value < m_window.valueMin || value > m_window.valueMax;
+}
+
+double CurveSampler::Evaluate(double x)
+{
+    m_curve->evaluationCount++;
+    m_arguments[m_sweepSlot] = x;
+    return m_program.Evaluate(m_arguments.data(), m_registers.data());
+}
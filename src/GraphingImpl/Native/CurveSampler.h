@@ -0,0 +1,95 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "BatchEvaluator.h"
+#include "IntervalEvaluator.h"
+
+namespace NativeGraphingImpl
+{
+    // x is the argument the curve is swept along and y the value of the function, a function of y has them swapped on screen
+    struct CurvePoint
+    {
+        double x;
+        double y;
+    };
+
+    // The polylines of one curve, kept between frames so sampling again does not allocate
+    struct SampledCurve
+    {
+        void Clear();
+
+        // The points of every polyline back to back
+        std::vector<CurvePoint> points;
+
+        // Index in points of the first point of each polyline, a polyline runs until the next one starts
+        std::vector<size_t> polylineStarts;
+
+        // Sweep values of the vertical asymptotes, in increasing order
+        std::vector<double> asymptotes;
+
+        size_t evaluationCount = 0;
+
+        // The evaluation budget ran out before the curve was resolved everywhere
+        bool hasMissingData = false;
+    };
+
+    // The part of the plane to sample, with its size on screen
+    struct SampleWindow
+    {
+        double sweepMin;
+        double sweepMax;
+        double valueMin;
+        double valueMax;
+        double sweepPixels;
+        double valuePixels;
+    };
+
+    // Samples a function of one argument into polylines that stay within a fraction of a pixel of the curve.
+    //
+    // A uniform pass a few pixels apart is evaluated in batches, then each cell is split where the midpoint is too far from
+    // the chord or the curve turns too sharply. Interval bounds of the function and its derivative over a cell tell whether
+    // the curve can stray from the samples, whether the cell is entirely off screen or undefined, and whether the
+    // function can jump. A jump is narrowed down by bisection to a tiny fraction of a pixel, where the polyline is split
+    // and a pole is recorded as a vertical asymptote. Flat and off screen parts cost one evaluation every few pixels.
+    class CurveSampler
+    {
+    public:
+        // program must outlive the sampler
+        CurveSampler(const Program& program, size_t sweepSlot);
+
+        // arguments is indexed by slot as for Program::Evaluate, the value in the sweep slot is ignored
+        void Sample(const double* arguments, const SampleWindow& window, SampledCurve& curve);
+
+    private:
+        // first has been added to the curve already, Refine adds the points up to last
+        void Refine(const CurvePoint& first, const CurvePoint& last, int depth);
+        bool TrySplit(const CurvePoint& first, const CurvePoint& last, int depth);
+        bool NeedsSplit(const CurvePoint& first, const CurvePoint& middle, const CurvePoint& last, const Interval& bounds, const Interval& slope) const;
+        double MaxDeviation(const CurvePoint& first, const CurvePoint& last, const Interval& slope) const;
+        void AddJump(const CurvePoint& first, const CurvePoint& last, const Interval& bounds);
+        void AddPoint(const CurvePoint& point);
+        bool IsBeyondView(double value) const;
+        double Evaluate(double x);
+
+        const Program& m_program;
+        size_t m_sweepSlot;
+        BatchEvaluator m_batchEvaluator;
+        IntervalEvaluator m_intervalEvaluator;
+        std::vector<double> m_arguments;
+        std::vector<double> m_registers;
+
+        // Uniform pass
+        std::vector<double> m_samples;
+        std::vector<double> m_values;
+
+        // State of the call to Sample
+        SampledCurve* m_curve;
+        SampleWindow m_window;
+        double m_sweepScale;
+        double m_valueScale;
+        size_t m_evaluationBudget;
+        bool m_isPolylineOpen;
+    };
+}
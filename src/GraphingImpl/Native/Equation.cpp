@@ -0,0 +1,65 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "Equation.h"
+
+using namespace std;
+using namespace Graphing;
+using namespace NativeGraphingImpl;
+
+namespace
+{
+    constexpr Color s_defaultGraphColor{ 0, 0, 0 };
+    constexpr float s_defaultLineWidth = 2.0f;
+    constexpr float s_defaultSelectedEquationLineWidth = 3.0f;
+    constexpr float s_defaultPointRadius = 3.0f;
+    constexpr float s_defaultSelectedEquationPointRadius = 4.0f;
+}
+
+EquationOptions::EquationOptions()
+    : m_graphColor(s_defaultGraphColor)
+    , m_lineStyle(Renderer::LineStyle::Solid)
+    , m_lineWidth(s_defaultLineWidth)
+    , m_selectedEquationLineWidth(s_defaultSelectedEquationLineWidth)
+    , m_pointRadius(s_defaultPointRadius)
+    , m_selectedEquationPointRadius(s_defaultSelectedEquationPointRadius)
+{
+}
+
+void EquationOptions::ResetGraphColor()
+{
+    m_graphColor = s_defaultGraphColor;
+}
+
+void EquationOptions::ResetLineStyle()
+{
+    m_lineStyle = Renderer::LineStyle::Solid;
+}
+
+void EquationOptions::ResetLineWidth()
+{
+    m_lineWidth = s_defaultLineWidth;
+}
+
+void EquationOptions::ResetSelectedEquationLineWidth()
+{
+    m_selectedEquationLineWidth = s_defaultSelectedEquationLineWidth;
+}
+
+void EquationOptions::ResetPointRadius()
+{
+    m_pointRadius = s_defaultPointRadius;
+}
+
+void EquationOptions::ResetSelectedEquationPointRadius()
+{
+    m_selectedEquationPointRadius = s_defaultSelectedEquationPointRadius;
+}
+
+Equation::Equation(unsigned int id)
+    : m_options(make_shared<EquationOptions>())
+    , m_id(id)
+    , m_isSelected(false)
+{
+}
@@ -0,0 +1,125 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "GraphingInterfaces/IEquation.h"
+
+namespace NativeGraphingImpl
+{
+    class EquationOptions : public Graphing::IEquationOptions
+    {
+    public:
+        EquationOptions();
+
+        Graphing::Color GetGraphColor() const override
+        {
+            return m_graphColor;
+        }
+        void SetGraphColor(const Graphing::Color& color) override
+        {
+            m_graphColor = color;
+        }
+        void ResetGraphColor() override;
+
+        Graphing::Renderer::LineStyle GetLineStyle() const override
+        {
+            return m_lineStyle;
+        }
+        void SetLineStyle(Graphing::Renderer::LineStyle value) override
+        {
+            m_lineStyle = value;
+        }
+        void ResetLineStyle() override;
+
+        float GetLineWidth() const override
+        {
+            return m_lineWidth;
+        }
+        void SetLineWidth(float value) override
+        {
+            m_lineWidth = value;
+        }
+        void ResetLineWidth() override;
+
+        float GetSelectedEquationLineWidth() const override
+        {
+            return m_selectedEquationLineWidth;
+        }
+        void SetSelectedEquationLineWidth(float value) override
+        {
+            m_selectedEquationLineWidth = value;
+        }
+        void ResetSelectedEquationLineWidth() override;
+
+        float GetPointRadius() const override
+        {
+            return m_pointRadius;
+        }
+        void SetPointRadius(float value) override
+        {
+            m_pointRadius = value;
+        }
+        void ResetPointRadius() override;
+
+        float GetSelectedEquationPointRadius() const override
+        {
+            return m_selectedEquationPointRadius;
+        }
+        void SetSelectedEquationPointRadius(float value) override
+        {
+            m_selectedEquationPointRadius = value;
+        }
+        void ResetSelectedEquationPointRadius() override;
+
+    private:
+        Graphing::Color m_graphColor;
+        Graphing::Renderer::LineStyle m_lineStyle;
+        float m_lineWidth;
+        float m_selectedEquationLineWidth;
+        float m_pointRadius;
+        float m_selectedEquationPointRadius;
+    };
+
+    class Equation : public Graphing::IEquation
+    {
+    public:
+        explicit Equation(unsigned int id);
+
+        std::shared_ptr<Graphing::IEquationOptions> GetGraphEquationOptions() const override
+        {
+            return m_options;
+        }
+
+        unsigned int GetGraphEquationID() const override
+        {
+            return m_id;
+        }
+
+        bool TrySelectEquation() override
+        {
+            m_isSelected = true;
+            return true;
+        }
+
+        bool IsEquationSelected() const override
+        {
+            return m_isSelected;
+        }
+
+        void ResetSelection()
+        {
+            m_isSelected = false;
+        }
+
+        const EquationOptions& GetOptions() const
+        {
+            return *m_options;
+        }
+
+    private:
+        std::shared_ptr<EquationOptions> m_options;
+        unsigned int m_id;
+        bool m_isSelected;
+    };
+}
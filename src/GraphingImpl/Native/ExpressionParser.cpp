@@ -0,0 +1,666 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "ExpressionParser.h"
+#include "GraphingErrors.h"
+#include <cwchar>
+#include <cwctype>
+
+using namespace std;
+using namespace NativeGraphingImpl;
+
+namespace
+{
+    constexpr wchar_t LessEqualSign = L'\x2264';
+    constexpr wchar_t GreaterEqualSign = L'\x2265';
+    constexpr wchar_t SquareRootSign = L'\x221A';
+    constexpr wchar_t PiSign = L'\x3C0';
+    constexpr double Pi = 3.14159265358979323846;
+    constexpr double E = 2.71828182845904523536;
+
+    struct NamedFunction
+    {
+        const wchar_t* name;
+        Function function;
+    };
+
+    // Every spelling the parser accepts, the identifier lexer picks the longest one that matches
+    constexpr NamedFunction s_functionNames[] = {
+        { L"sin", Function::Sin },       { L"cos", Function::Cos },        { L"tan", Function::Tan },        { L"sec", Function::Sec },
+        { L"csc", Function::Csc },       { L"cot", Function::Cot },        { L"asin", Function::Asin },      { L"acos", Function::Acos },
+        { L"atan", Function::Atan },     { L"arcsin", Function::Asin },    { L"arccos", Function::Acos },    { L"arctan", Function::Atan },
+        { L"sinh", Function::Sinh },     { L"cosh", Function::Cosh },      { L"tanh", Function::Tanh },      { L"asinh", Function::Asinh },
+        { L"acosh", Function::Acosh },   { L"atanh", Function::Atanh },    { L"arsinh", Function::Asinh },   { L"arcosh", Function::Acosh },
+        { L"artanh", Function::Atanh },  { L"arcsinh", Function::Asinh },  { L"arccosh", Function::Acosh },  { L"arctanh", Function::Atanh },
+        { L"exp", Function::Exp },       { L"ln", Function::Ln },          { L"log", Function::Log },        { L"sqrt", Function::Sqrt },
+        { L"abs", Function::Abs },       { L"floor", Function::Floor },    { L"ceil", Function::Ceiling },   { L"ceiling", Function::Ceiling },
+        { L"round", Function::Round },   { L"sign", Function::Sign },      { L"sgn", Function::Sign },       { L"min", Function::Min },
+        { L"max", Function::Max },
+    };
+
+    // Commands GraphControl wraps the equations in. They only group the items, the graph decides how to plot each one.
+    constexpr const wchar_t* s_commandNames[] = { L"show2d", L"plot2d", L"plotEq2d", L"plotIneq2D" };
+
+    bool IsLetter(wchar_t ch)
+    {
+        return iswalpha(ch) && ch != PiSign;
+    }
+
+    bool IsSpace(wchar_t ch)
+    {
+        // U+2061 is the invisible function application operator MathML editors put between a function name and its argument
+        return iswspace(ch) || ch == L'\xA0' || ch == L'\x2061';
+    }
+
+    bool StartsWith(const wstring& text, size_t position, const wchar_t* prefix)
+    {
+        size_t length = wcslen(prefix);
+        return text.compare(position, length, prefix) == 0;
+    }
+
+    Function GetInverse(Function function, bool& hasInverse)
+    {
+        hasInverse = true;
+        switch (function)
+        {
+        case Function::Sin:
+            return Function::Asin;
+        case Function::Cos:
+            return Function::Acos;
+        case Function::Tan:
+            return Function::Atan;
+        case Function::Sinh:
+            return Function::Asinh;
+        case Function::Cosh:
+            return Function::Acosh;
+        case Function::Tanh:
+            return Function::Atanh;
+        default:
+            hasInverse = false;
+            return function;
+        }
+    }
+}
+
+ExpressionParser::ExpressionParser(wchar_t decimalSeparator, wchar_t listSeparator)
+    : m_decimalSeparator(decimalSeparator)
+    , m_listSeparator(listSeparator)
+    , m_position(0)
+    , m_hasPeeked(false)
+    , m_peeked{}
+    , m_parenthesisDepth(0)
+    , m_absDepth(0)
+{
+}
+
+vector<ParsedEquation> ExpressionParser::Parse(const wstring& input)
+{
+    m_input = input;
+    m_position = 0;
+    m_hasPeeked = false;
+    m_parenthesisDepth = 0;
+    m_absDepth = 0;
+
+    if (Peek().type == TokenType::End)
+    {
+        throw SyntaxError(SyntaxErrorCode::EmptyExpression);
+    }
+
+    vector<ParsedEquation> equations;
+    ParseList(equations);
+
+    if (Peek().type != TokenType::End)
+    {
+        throw SyntaxError(PeekOperator(L')') ? SyntaxErrorCode::ParenthesisMismatch : SyntaxErrorCode::UnexpectedToken);
+    }
+
+    return equations;
+}
+
+const ExpressionParser::Token& ExpressionParser::Peek()
+{
+    if (!m_hasPeeked)
+    {
+        m_peeked = ReadToken(m_position);
+        m_hasPeeked = true;
+    }
+    return m_peeked;
+}
+
+ExpressionParser::Token ExpressionParser::Next()
+{
+    Token token = Peek();
+    m_position = token.end;
+    m_hasPeeked = false;
+    return token;
+}
+
+bool ExpressionParser::PeekOperator(wchar_t op)
+{
+    const Token& token = Peek();
+    return token.type == TokenType::Operator && token.op == op;
+}
+
+bool ExpressionParser::AcceptOperator(wchar_t op)
+{
+    if (PeekOperator(op))
+    {
+        Next();
+        return true;
+    }
+    return false;
+}
+
+void ExpressionParser::ExpectClose(wchar_t op)
+{
+    if (!AcceptOperator(op))
+    {
+        throw SyntaxError(Peek().type == TokenType::End ? SyntaxErrorCode::UnmatchedParenthesis : SyntaxErrorCode::UnexpectedToken);
+    }
+}
+
+bool ExpressionParser::IsRelation(wchar_t op)
+{
+    return op == L'=' || op == L'<' || op == L'>' || op == LessEqualSign || op == GreaterEqualSign;
+}
+
+ExpressionParser::Token ExpressionParser::ReadToken(size_t position)
+{
+    while (position < m_input.size() && IsSpace(m_input[position]))
+    {
+        position++;
+    }
+
+    Token token{};
+    token.end = position + 1;
+    if (position >= m_input.size())
+    {
+        token.type = TokenType::End;
+        token.end = position;
+        return token;
+    }
+
+    wchar_t ch = m_input[position];
+    if (iswdigit(ch) || ch == m_decimalSeparator)
+    {
+        return ReadNumber(position);
+    }
+    if (ch == PiSign)
+    {
+        token.type = TokenType::Constant;
+        token.value = Pi;
+        token.text = L"pi";
+        return token;
+    }
+    if (IsLetter(ch))
+    {
+        return ReadIdentifier(position);
+    }
+
+    token.type = TokenType::Operator;
+    switch (ch)
+    {
+    case L'+':
+    case L'-':
+    case L'*':
+    case L'/':
+    case L'^':
+    case L'!':
+    case L'(':
+    case L')':
+    case L'|':
+    case L'=':
+    case L'_':
+    case LessEqualSign:
+    case GreaterEqualSign:
+    case SquareRootSign:
+        token.op = ch;
+        break;
+    case L'<':
+    case L'>':
+        token.op = ch;
+        if (position + 1 < m_input.size() && m_input[position + 1] == L'=')
+        {
+            token.op = ch == L'<' ? LessEqualSign : GreaterEqualSign;
+            token.end++;
+        }
+        break;
+    case L'\x2212': // minus sign
+        token.op = L'-';
+        break;
+    case L'\xD7':   // multiplication sign
+    case L'\xB7':   // middle dot
+    case L'\x2062': // invisible times
+    case L'\x2217': // asterisk operator
+    case L'\x22C5': // dot operator
+        token.op = L'*';
+        break;
+    case L'\xF7':   // division sign
+    case L'\x2215': // division slash
+        token.op = L'/';
+        break;
+    default:
+        if (ch != m_listSeparator)
+        {
+            throw SyntaxError(SyntaxErrorCode::InvalidToken);
+        }
+        token.op = ch;
+        break;
+    }
+    return token;
+}
+
+ExpressionParser::Token ExpressionParser::ReadNumber(size_t position)
+{
+    Token token{};
+    token.type = TokenType::Number;
+
+    bool hasDigits = false;
+    bool hasSeparator = false;
+    size_t end = position;
+    for (; end < m_input.size(); end++)
+    {
+        wchar_t ch = m_input[end];
+        if (iswdigit(ch))
+        {
+            token.text += ch;
+            hasDigits = true;
+        }
+        else if (ch == m_decimalSeparator)
+        {
+            if (hasSeparator)
+            {
+                throw SyntaxError(SyntaxErrorCode::TooManyDecimalPoints);
+            }
+            token.text += L'.';
+            hasSeparator = true;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    if (!hasDigits)
+    {
+        throw SyntaxError(SyntaxErrorCode::DecimalPointWithoutDigits);
+    }
+
+    token.value = wcstod(token.text.c_str(), nullptr);
+    token.end = end;
+    return token;
+}
+
+ExpressionParser::Token ExpressionParser::ReadIdentifier(size_t position)
+{
+    Token token{};
+
+    for (const wchar_t* command : s_commandNames)
+    {
+        if (StartsWith(m_input, position, command))
+        {
+            token.type = TokenType::Command;
+            token.text = command;
+            token.end = position + wcslen(command);
+            return token;
+        }
+    }
+
+    size_t longest = 0;
+    for (const auto& entry : s_functionNames)
+    {
+        size_t length = wcslen(entry.name);
+        if (length > longest && StartsWith(m_input, position, entry.name))
+        {
+            longest = length;
+            token.type = TokenType::Function;
+            token.function = entry.function;
+        }
+    }
+    if (StartsWith(m_input, position, L"pi") && longest < 2)
+    {
+        longest = 2;
+        token.type = TokenType::Constant;
+        token.value = Pi;
+        token.text = L"pi";
+    }
+    if (longest > 0)
+    {
+        token.end = position + longest;
+        return token;
+    }
+
+    if (m_input[position] == L'e')
+    {
+        token.type = TokenType::Constant;
+        token.value = E;
+        token.text = L"e";
+        token.end = position + 1;
+        return token;
+    }
+
+    // Any other letter is a variable of its own, so "xy" is x times y. A subscript keeps letters and digits together.
+    token.type = TokenType::Variable;
+    token.text = m_input[position];
+    size_t end = position + 1;
+    if (end < m_input.size() && m_input[end] == L'_')
+    {
+        size_t subscriptEnd = end + 1;
+        while (subscriptEnd < m_input.size() && iswalnum(m_input[subscriptEnd]))
+        {
+            subscriptEnd++;
+        }
+        if (subscriptEnd == end + 1)
+        {
+            throw SyntaxError(SyntaxErrorCode::InvalidVariableNameFormat);
+        }
+        token.text.append(m_input, end, subscriptEnd - end);
+        end = subscriptEnd;
+    }
+    token.end = end;
+    return token;
+}
+
+void ExpressionParser::ParseList(vector<ParsedEquation>& equations)
+{
+    do
+    {
+        ParseItem(equations);
+    } while (AcceptOperator(m_listSeparator));
+}
+
+void ExpressionParser::ParseItem(vector<ParsedEquation>& equations)
+{
+    if (Peek().type != TokenType::Command)
+    {
+        equations.push_back(ParseEquation());
+        return;
+    }
+
+    wstring command = Next().text;
+    if (!AcceptOperator(L'('))
+    {
+        throw SyntaxError(Peek().type == TokenType::End ? SyntaxErrorCode::UnexpectedEndOfExpression : SyntaxErrorCode::UnexpectedToken);
+    }
+    if (PeekOperator(L')'))
+    {
+        throw SyntaxError(SyntaxErrorCode::EmptyExpression);
+    }
+
+    m_parenthesisDepth++;
+    size_t first = equations.size();
+    ParseList(equations);
+    ExpectClose(L')');
+    m_parenthesisDepth--;
+
+    bool needsRelation = command == L"plotEq2d" || command == L"plotIneq2D";
+    for (size_t i = first; needsRelation && i < equations.size(); i++)
+    {
+        if (equations[i].relation == Relation::None)
+        {
+            throw SyntaxError(SyntaxErrorCode::InvalidEquationSyntax);
+        }
+    }
+}
+
+ParsedEquation ExpressionParser::ParseEquation()
+{
+    const Token& first = Peek();
+    if (first.type == TokenType::Operator && IsRelation(first.op))
+    {
+        throw SyntaxError(SyntaxErrorCode::InvalidEquationSyntax);
+    }
+
+    ParsedEquation equation{ ParseExpression(), Relation::None, nullptr };
+
+    const Token& next = Peek();
+    if (next.type == TokenType::Operator && IsRelation(next.op))
+    {
+        switch (Next().op)
+        {
+        case L'=':
+            equation.relation = Relation::Equal;
+            break;
+        case L'<':
+            equation.relation = Relation::Less;
+            break;
+        case L'>':
+            equation.relation = Relation::Greater;
+            break;
+        case LessEqualSign:
+            equation.relation = Relation::LessEqual;
+            break;
+        default:
+            equation.relation = Relation::GreaterEqual;
+            break;
+        }
+
+        equation.right = ParseExpression();
+
+        const Token& after = Peek();
+        if (after.type == TokenType::Operator && IsRelation(after.op))
+        {
+            throw SyntaxError(SyntaxErrorCode::TooManyEquals);
+        }
+    }
+
+    return equation;
+}
+
+ExpressionNodePtr ExpressionParser::ParseExpression()
+{
+    ExpressionNodePtr result = ParseTerm();
+    while (true)
+    {
+        if (AcceptOperator(L'+'))
+        {
+            result = MakeOperation(NodeKind::Add, { result, ParseTerm() });
+        }
+        else if (AcceptOperator(L'-'))
+        {
+            result = MakeOperation(NodeKind::Subtract, { result, ParseTerm() });
+        }
+        else
+        {
+            return result;
+        }
+    }
+}
+
+ExpressionNodePtr ExpressionParser::ParseTerm()
+{
+    ExpressionNodePtr result = ParseUnary();
+    while (true)
+    {
+        if (AcceptOperator(L'*'))
+        {
+            result = MakeOperation(NodeKind::Multiply, { result, ParseUnary() });
+        }
+        else if (AcceptOperator(L'/'))
+        {
+            result = MakeOperation(NodeKind::Divide, { result, ParseUnary() });
+        }
+        else if (IsImplicitFactorStart(true))
+        {
+            result = MakeOperation(NodeKind::Multiply, { result, ParsePower() });
+        }
+        else
+        {
+            return result;
+        }
+    }
+}
+
+ExpressionNodePtr ExpressionParser::ParseUnary()
+{
+    if (AcceptOperator(L'-'))
+    {
+        return MakeOperation(NodeKind::Negate, { ParseUnary() });
+    }
+    if (AcceptOperator(L'+'))
+    {
+        return ParseUnary();
+    }
+    return ParsePower();
+}
+
+ExpressionNodePtr ExpressionParser::ParsePower()
+{
+    ExpressionNodePtr base = ParsePostfix();
+    if (AcceptOperator(L'^'))
+    {
+        return MakeOperation(NodeKind::Power, { base, ParseUnary() });
+    }
+    return base;
+}
+
+ExpressionNodePtr ExpressionParser::ParsePostfix()
+{
+    ExpressionNodePtr result = ParsePrimary();
+    while (AcceptOperator(L'!'))
+    {
+        result = MakeOperation(NodeKind::Factorial, { result });
+    }
+    return result;
+}
+
+ExpressionNodePtr ExpressionParser::ParsePrimary()
+{
+    Token token = Next();
+    switch (token.type)
+    {
+    case TokenType::End:
+        throw SyntaxError(SyntaxErrorCode::UnexpectedEndOfExpression);
+    case TokenType::Number:
+        return MakeNumber(token.value, move(token.text));
+    case TokenType::Constant:
+        return MakeConstant(token.value, move(token.text));
+    case TokenType::Variable:
+        return MakeVariable(move(token.text));
+    case TokenType::Function:
+        return ParseFunctionCall(token.function);
+    case TokenType::Operator:
+        break;
+    default:
+        throw SyntaxError(SyntaxErrorCode::UnexpectedToken);
+    }
+
+    switch (token.op)
+    {
+    case L'(':
+    {
+        m_parenthesisDepth++;
+        ExpressionNodePtr result = ParseExpression();
+        ExpectClose(L')');
+        m_parenthesisDepth--;
+        return result;
+    }
+    case L'|':
+    {
+        m_absDepth++;
+        ExpressionNodePtr result = ParseExpression();
+        ExpectClose(L'|');
+        m_absDepth--;
+        return MakeFunction(Function::Abs, { result });
+    }
+    case SquareRootSign:
+        return MakeFunction(Function::Sqrt, { ParsePostfix() });
+    case L')':
+        throw SyntaxError(m_parenthesisDepth == 0 ? SyntaxErrorCode::ParenthesisMismatch : SyntaxErrorCode::UnexpectedToken);
+    default:
+        throw SyntaxError(SyntaxErrorCode::UnexpectedToken);
+    }
+}
+
+ExpressionNodePtr ExpressionParser::ParseFunctionCall(Function function)
+{
+    ExpressionNodePtr logBase;
+    if (AcceptOperator(L'_'))
+    {
+        if (function != Function::Log)
+        {
+            throw SyntaxError(SyntaxErrorCode::UnexpectedToken);
+        }
+        logBase = ParsePostfix();
+    }
+
+    // sin^-1 x is the inverse function, any other power applies to the result
+    ExpressionNodePtr power;
+    if (AcceptOperator(L'^'))
+    {
+        power = ParseUnary();
+
+        bool hasInverse = false;
+        Function inverse = GetInverse(function, hasInverse);
+        if (hasInverse && power->kind == NodeKind::Negate && power->operands[0]->kind == NodeKind::Number && power->operands[0]->value == 1)
+        {
+            function = inverse;
+            power = nullptr;
+        }
+    }
+
+    const FunctionInfo& info = GetFunctionInfo(function);
+    vector<ExpressionNodePtr> arguments;
+    if (AcceptOperator(L'('))
+    {
+        m_parenthesisDepth++;
+        do
+        {
+            arguments.push_back(ParseExpression());
+        } while (AcceptOperator(m_listSeparator));
+        ExpectClose(L')');
+        m_parenthesisDepth--;
+    }
+    else
+    {
+        // Without parentheses the argument is the implicit product that follows, so "sin 2x" is sin(2x) and
+        // "sin x cos x" is sin(x)cos(x)
+        ExpressionNodePtr argument = ParsePower();
+        while (IsImplicitFactorStart(false))
+        {
+            argument = MakeOperation(NodeKind::Multiply, { argument, ParsePower() });
+        }
+        arguments.push_back(argument);
+    }
+
+    if (arguments.size() != info.arity)
+    {
+        throw SyntaxError(SyntaxErrorCode::IncorrectNumParameter);
+    }
+
+    ExpressionNodePtr result;
+    if (logBase != nullptr)
+    {
+        result = MakeOperation(
+            NodeKind::Divide, { MakeFunction(Function::Ln, move(arguments)), MakeFunction(Function::Ln, { logBase }) });
+    }
+    else
+    {
+        result = MakeFunction(function, move(arguments));
+    }
+
+    if (power != nullptr)
+    {
+        result = MakeOperation(NodeKind::Power, { result, power });
+    }
+    return result;
+}
+
+bool ExpressionParser::IsImplicitFactorStart(bool allowFunctions)
+{
+    const Token& token = Peek();
+    switch (token.type)
+    {
+    case TokenType::Constant:
+    case TokenType::Variable:
+        return true;
+    case TokenType::Function:
+        return allowFunctions;
+    case TokenType::Operator:
+        // Inside |...| a bar closes the absolute value instead of starting a new one
+        return token.op == L'(' || token.op == SquareRootSign || (token.op == L'|' && m_absDepth == 0);
+    default:
+        return false;
+    }
+}
@@ -0,0 +1,73 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "ExpressionTree.h"
+
+namespace NativeGraphingImpl
+{
+    // Recursive descent parser for linear syntax, for example "y=2x^2-sin(x)" or "show2d(y=x, x^2+y^2=4)".
+    // Multiplication may be implicit, functions of one argument may omit the parentheses ("sin 2x") and take a power
+    // ("sin^2 x"). Input that is not valid throws a syntax GraphingError.
+    class ExpressionParser
+    {
+    public:
+        ExpressionParser(wchar_t decimalSeparator, wchar_t listSeparator);
+
+        std::vector<ParsedEquation> Parse(const std::wstring& input);
+
+    private:
+        enum class TokenType
+        {
+            End,
+            Number,
+            Constant,
+            Variable,
+            Function,
+            Command,
+            Operator
+        };
+
+        struct Token
+        {
+            TokenType type;
+            wchar_t op;
+            Function function;
+            double value;
+            std::wstring text;
+            size_t end;
+        };
+
+        const Token& Peek();
+        Token Next();
+        bool PeekOperator(wchar_t op);
+        bool AcceptOperator(wchar_t op);
+        void ExpectClose(wchar_t op);
+        Token ReadToken(size_t position);
+        Token ReadNumber(size_t position);
+        Token ReadIdentifier(size_t position);
+
+        void ParseList(std::vector<ParsedEquation>& equations);
+        void ParseItem(std::vector<ParsedEquation>& equations);
+        ParsedEquation ParseEquation();
+        ExpressionNodePtr ParseExpression();
+        ExpressionNodePtr ParseTerm();
+        ExpressionNodePtr ParseUnary();
+        ExpressionNodePtr ParsePower();
+        ExpressionNodePtr ParsePostfix();
+        ExpressionNodePtr ParsePrimary();
+        ExpressionNodePtr ParseFunctionCall(Function function);
+        bool IsImplicitFactorStart(bool allowFunctions);
+        static bool IsRelation(wchar_t op);
+
+        wchar_t m_decimalSeparator;
+        wchar_t m_listSeparator;
+        std::wstring m_input;
+        size_t m_position;
+        bool m_hasPeeked;
+        Token m_peeked;
+        int m_parenthesisDepth;
+        int m_absDepth;
+    };
+}
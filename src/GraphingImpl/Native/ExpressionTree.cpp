@@ -0,0 +1,448 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "ExpressionTree.h"
+#include <algorithm>
+
+using namespace std;
+using namespace Graphing;
+using namespace NativeGraphingImpl;
+
+namespace
+{
+    constexpr FunctionInfo s_functions[] = {
+        { Function::Sin, L"sin", 1 },     { Function::Cos, L"cos", 1 },     { Function::Tan, L"tan", 1 },         { Function::Sec, L"sec", 1 },
+        { Function::Csc, L"csc", 1 },     { Function::Cot, L"cot", 1 },     { Function::Asin, L"asin", 1 },       { Function::Acos, L"acos", 1 },
+        { Function::Atan, L"atan", 1 },   { Function::Sinh, L"sinh", 1 },   { Function::Cosh, L"cosh", 1 },       { Function::Tanh, L"tanh", 1 },
+        { Function::Asinh, L"asinh", 1 }, { Function::Acosh, L"acosh", 1 }, { Function::Atanh, L"atanh", 1 },     { Function::Exp, L"exp", 1 },
+        { Function::Ln, L"ln", 1 },       { Function::Log, L"log", 1 },     { Function::Sqrt, L"sqrt", 1 },       { Function::Abs, L"abs", 1 },
+        { Function::Floor, L"floor", 1 }, { Function::Ceiling, L"ceil", 1 }, { Function::Round, L"round", 1 },     { Function::Sign, L"sign", 1 },
+        { Function::Min, L"min", 2 },     { Function::Max, L"max", 2 },
+    };
+
+    // Binding strength of a node, an operand is put in parentheses when it binds less than its position requires
+    enum Precedence
+    {
+        PrecedenceSum = 1,
+        PrecedenceProduct = 2,
+        PrecedenceNegate = 3,
+        PrecedencePower = 4,
+        PrecedencePostfix = 5,
+        PrecedencePrimary = 6
+    };
+
+    int GetPrecedence(const ExpressionNode& node)
+    {
+        switch (node.kind)
+        {
+        case NodeKind::Add:
+        case NodeKind::Subtract:
+            return PrecedenceSum;
+        case NodeKind::Multiply:
+        case NodeKind::Divide:
+            return PrecedenceProduct;
+        case NodeKind::Negate:
+            return PrecedenceNegate;
+        case NodeKind::Power:
+            return PrecedencePower;
+        case NodeKind::Factorial:
+            return PrecedencePostfix;
+        default:
+            return PrecedencePrimary;
+        }
+    }
+
+    const wchar_t* GetRelationText(Relation relation, bool asciiOnly)
+    {
+        switch (relation)
+        {
+        case Relation::Equal:
+            return L"=";
+        case Relation::Less:
+            return L"<";
+        case Relation::LessEqual:
+            return asciiOnly ? L"<=" : L"\x2264";
+        case Relation::Greater:
+            return L">";
+        case Relation::GreaterEqual:
+            return asciiOnly ? L">=" : L"\x2265";
+        default:
+            return L"";
+        }
+    }
+
+    wstring FormatNumber(const wstring& text, wchar_t decimalSeparator)
+    {
+        wstring result = text;
+        for (wchar_t& ch : result)
+        {
+            if (ch == L'.')
+            {
+                ch = decimalSeparator;
+            }
+        }
+        return result;
+    }
+
+    class LinearWriter
+    {
+    public:
+        LinearWriter(bool asciiOnly, wchar_t decimalSeparator, wchar_t listSeparator)
+            : m_asciiOnly(asciiOnly)
+            , m_decimalSeparator(decimalSeparator)
+            , m_listSeparator(listSeparator)
+        {
+        }
+
+        void Write(const ExpressionNode& node, int minPrecedence)
+        {
+            bool parenthesize = GetPrecedence(node) < minPrecedence;
+            if (parenthesize)
+            {
+                m_text += L'(';
+            }
+
+            switch (node.kind)
+            {
+            case NodeKind::Number:
+                m_text += FormatNumber(node.name, m_decimalSeparator);
+                break;
+            case NodeKind::Constant:
+                m_text += (m_asciiOnly || node.name != L"pi") ? node.name : L"\x3C0";
+                break;
+            case NodeKind::Variable:
+                m_text += node.name;
+                break;
+            case NodeKind::Negate:
+                m_text += L'-';
+                Write(*node.operands[0], PrecedenceNegate);
+                break;
+            case NodeKind::Add:
+                WriteBinary(node, L"+", PrecedenceSum);
+                break;
+            case NodeKind::Subtract:
+                WriteBinary(node, L"-", PrecedenceSum);
+                break;
+            case NodeKind::Multiply:
+                WriteBinary(node, L"*", PrecedenceProduct);
+                break;
+            case NodeKind::Divide:
+                WriteBinary(node, L"/", PrecedenceProduct);
+                break;
+            case NodeKind::Power:
+                Write(*node.operands[0], PrecedencePostfix);
+                m_text += L'^';
+                Write(*node.operands[1], PrecedenceNegate);
+                break;
+            case NodeKind::Factorial:
+                Write(*node.operands[0], PrecedencePrimary);
+                m_text += L'!';
+                break;
+            case NodeKind::Function:
+                m_text += GetFunctionInfo(node.function).name;
+                m_text += L'(';
+                for (size_t i = 0; i < node.operands.size(); i++)
+                {
+                    if (i > 0)
+                    {
+                        m_text += m_listSeparator;
+                    }
+                    Write(*node.operands[i], 0);
+                }
+                m_text += L')';
+                break;
+            }
+
+            if (parenthesize)
+            {
+                m_text += L')';
+            }
+        }
+
+        void WriteEquations(const vector<ParsedEquation>& equations)
+        {
+            for (size_t i = 0; i < equations.size(); i++)
+            {
+                if (i > 0)
+                {
+                    m_text += m_listSeparator;
+                }
+
+                Write(*equations[i].left, 0);
+                if (equations[i].right != nullptr)
+                {
+                    m_text += GetRelationText(equations[i].relation, m_asciiOnly);
+                    Write(*equations[i].right, 0);
+                }
+            }
+        }
+
+        wstring& Text()
+        {
+            return m_text;
+        }
+
+    private:
+        // Operators are left associative, the right operand needs parentheses at the same precedence to keep the tree shape
+        void WriteBinary(const ExpressionNode& node, const wchar_t* op, int precedence)
+        {
+            Write(*node.operands[0], precedence);
+            m_text += op;
+            Write(*node.operands[1], precedence + 1);
+        }
+
+        bool m_asciiOnly;
+        wchar_t m_decimalSeparator;
+        wchar_t m_listSeparator;
+        wstring m_text;
+    };
+
+    class MathMLWriter
+    {
+    public:
+        MathMLWriter(const wstring& prefix, wchar_t decimalSeparator, wchar_t listSeparator)
+            : m_prefix(prefix.empty() ? prefix : prefix + L':')
+            , m_decimalSeparator(decimalSeparator)
+            , m_listSeparator(listSeparator)
+        {
+        }
+
+        void Write(const ExpressionNode& node, int minPrecedence)
+        {
+            bool parenthesize = GetPrecedence(node) < minPrecedence;
+            if (parenthesize)
+            {
+                Element(L"mo", L"(");
+            }
+
+            switch (node.kind)
+            {
+            case NodeKind::Number:
+                Element(L"mn", FormatNumber(node.name, m_decimalSeparator));
+                break;
+            case NodeKind::Constant:
+                Element(L"mi", node.name == L"pi" ? L"\x3C0" : node.name);
+                break;
+            case NodeKind::Variable:
+                Element(L"mi", node.name);
+                break;
+            case NodeKind::Negate:
+                Element(L"mo", L"-");
+                Write(*node.operands[0], PrecedenceNegate);
+                break;
+            case NodeKind::Add:
+            case NodeKind::Subtract:
+            case NodeKind::Multiply:
+            {
+                int precedence = GetPrecedence(node);
+                Write(*node.operands[0], precedence);
+                Element(L"mo", node.kind == NodeKind::Add ? L"+" : node.kind == NodeKind::Subtract ? L"-" : L"\xB7");
+                Write(*node.operands[1], precedence + 1);
+                break;
+            }
+            case NodeKind::Divide:
+                Open(L"mfrac");
+                Row(*node.operands[0]);
+                Row(*node.operands[1]);
+                Close(L"mfrac");
+                break;
+            case NodeKind::Power:
+                Open(L"msup");
+                Open(L"mrow");
+                Write(*node.operands[0], PrecedencePrimary);
+                Close(L"mrow");
+                Row(*node.operands[1]);
+                Close(L"msup");
+                break;
+            case NodeKind::Factorial:
+                Write(*node.operands[0], PrecedencePrimary);
+                Element(L"mo", L"!");
+                break;
+            case NodeKind::Function:
+                if (node.function == Function::Sqrt)
+                {
+                    Open(L"msqrt");
+                    Write(*node.operands[0], 0);
+                    Close(L"msqrt");
+                }
+                else if (node.function == Function::Abs)
+                {
+                    Element(L"mo", L"|");
+                    Write(*node.operands[0], 0);
+                    Element(L"mo", L"|");
+                }
+                else
+                {
+                    Element(L"mi", GetFunctionInfo(node.function).name);
+                    Element(L"mo", L"(");
+                    for (size_t i = 0; i < node.operands.size(); i++)
+                    {
+                        if (i > 0)
+                        {
+                            Element(L"mo", wstring(1, m_listSeparator));
+                        }
+                        Write(*node.operands[i], 0);
+                    }
+                    Element(L"mo", L")");
+                }
+                break;
+            }
+
+            if (parenthesize)
+            {
+                Element(L"mo", L")");
+            }
+        }
+
+        void WriteEquations(const vector<ParsedEquation>& equations, bool includeRoot)
+        {
+            if (!includeRoot)
+            {
+                WriteList(equations);
+                return;
+            }
+
+            m_text += L'<' + m_prefix + L"math xmlns" + (m_prefix.empty() ? L"" : L":" + m_prefix.substr(0, m_prefix.size() - 1))
+                      + L"=\"http://www.w3.org/1998/Math/MathML\">";
+            Open(L"mrow");
+            WriteList(equations);
+            Close(L"mrow");
+            Close(L"math");
+        }
+
+        wstring& Text()
+        {
+            return m_text;
+        }
+
+    private:
+        void WriteList(const vector<ParsedEquation>& equations)
+        {
+            for (size_t i = 0; i < equations.size(); i++)
+            {
+                if (i > 0)
+                {
+                    Element(L"mo", wstring(1, m_listSeparator));
+                }
+
+                Write(*equations[i].left, 0);
+                if (equations[i].right != nullptr)
+                {
+                    Element(L"mo", GetRelationText(equations[i].relation, false));
+                    Write(*equations[i].right, 0);
+                }
+            }
+        }
+
+        void Open(const wchar_t* tag)
+        {
+            m_text += L'<' + m_prefix + tag + L'>';
+        }
+
+        void Close(const wchar_t* tag)
+        {
+            m_text += L"</" + m_prefix + tag + L'>';
+        }
+
+        void Row(const ExpressionNode& node)
+        {
+            Open(L"mrow");
+            Write(node, 0);
+            Close(L"mrow");
+        }
+
+        void Element(const wchar_t* tag, const wstring& content)
+        {
+            Open(tag);
+            for (wchar_t ch : content)
+            {
+                switch (ch)
+                {
+                case L'<':
+                    m_text += L"&lt;";
+                    break;
+                case L'>':
+                    m_text += L"&gt;";
+                    break;
+                case L'&':
+                    m_text += L"&amp;";
+                    break;
+                default:
+                    m_text += ch;
+                    break;
+                }
+            }
+            Close(tag);
+        }
+
+        wstring m_prefix;
+        wchar_t m_decimalSeparator;
+        wchar_t m_listSeparator;
+        wstring m_text;
+    };
+}
+
+namespace NativeGraphingImpl
+{
+    const FunctionInfo& GetFunctionInfo(Function function)
+    {
+        return s_functions[static_cast<size_t>(function)];
+    }
+
+    ExpressionNodePtr MakeNumber(double value, wstring text)
+    {
+        return make_shared<const ExpressionNode>(ExpressionNode{ NodeKind::Number, Function::Sin, value, move(text), {} });
+    }
+
+    ExpressionNodePtr MakeConstant(double value, wstring name)
+    {
+        return make_shared<const ExpressionNode>(ExpressionNode{ NodeKind::Constant, Function::Sin, value, move(name), {} });
+    }
+
+    ExpressionNodePtr MakeVariable(wstring name)
+    {
+        return make_shared<const ExpressionNode>(ExpressionNode{ NodeKind::Variable, Function::Sin, 0, move(name), {} });
+    }
+
+    ExpressionNodePtr MakeOperation(NodeKind kind, vector<ExpressionNodePtr> operands)
+    {
+        return make_shared<const ExpressionNode>(ExpressionNode{ kind, Function::Sin, 0, {}, move(operands) });
+    }
+
+    ExpressionNodePtr MakeFunction(Function function, vector<ExpressionNodePtr> operands)
+    {
+        return make_shared<const ExpressionNode>(ExpressionNode{ NodeKind::Function, function, 0, {}, move(operands) });
+    }
+
+    void CollectVariables(const ExpressionNode& node, vector<wstring>& names)
+    {
+        if (node.kind == NodeKind::Variable)
+        {
+            if (find(names.begin(), names.end(), node.name) == names.end())
+            {
+                names.push_back(node.name);
+            }
+            return;
+        }
+
+        for (const auto& operand : node.operands)
+        {
+            CollectVariables(*operand, names);
+        }
+    }
+
+    wstring FormatLinear(const vector<ParsedEquation>& equations, FormatType formatType, wchar_t decimalSeparator, wchar_t listSeparator)
+    {
+        LinearWriter writer(formatType == FormatType::LinearInput, decimalSeparator, listSeparator);
+        writer.WriteEquations(equations);
+        return move(writer.Text());
+    }
+
+    wstring FormatMathML(const vector<ParsedEquation>& equations, const wstring& prefix, bool includeRoot, wchar_t decimalSeparator, wchar_t listSeparator)
+    {
+        MathMLWriter writer(prefix, decimalSeparator, listSeparator);
+        writer.WriteEquations(equations, includeRoot);
+        return move(writer.Text());
+    }
+}
@@ -0,0 +1,117 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "GraphingInterfaces/GraphingEnums.h"
+
+namespace NativeGraphingImpl
+{
+    enum class NodeKind : uint8_t
+    {
+        Number,
+        Constant,
+        Variable,
+        Negate,
+        Add,
+        Subtract,
+        Multiply,
+        Divide,
+        Power,
+        Factorial,
+        Function
+    };
+
+    enum class Function : uint8_t
+    {
+        Sin,
+        Cos,
+        Tan,
+        Sec,
+        Csc,
+        Cot,
+        Asin,
+        Acos,
+        Atan,
+        Sinh,
+        Cosh,
+        Tanh,
+        Asinh,
+        Acosh,
+        Atanh,
+        Exp,
+        Ln,
+        Log,
+        Sqrt,
+        Abs,
+        Floor,
+        Ceiling,
+        Round,
+        Sign,
+        Min,
+        Max
+    };
+
+    enum class Relation : uint8_t
+    {
+        None,
+        Equal,
+        Less,
+        LessEqual,
+        Greater,
+        GreaterEqual
+    };
+
+    // Node of the tree the parser builds. Trees are immutable once built, so equations can share subtrees.
+    struct ExpressionNode
+    {
+        NodeKind kind;
+        Function function;
+        double value;        // Number and Constant
+        std::wstring name;   // Number text as it was typed with a '.' separator, Constant and Variable name
+        std::vector<std::shared_ptr<const ExpressionNode>> operands;
+    };
+
+    using ExpressionNodePtr = std::shared_ptr<const ExpressionNode>;
+
+    // One item of the input, right is null and relation is None when the item has no relational operator
+    struct ParsedEquation
+    {
+        ExpressionNodePtr left;
+        Relation relation;
+        ExpressionNodePtr right;
+    };
+
+    struct FunctionInfo
+    {
+        Function function;
+        const wchar_t* name;
+        unsigned int arity;
+    };
+
+    const FunctionInfo& GetFunctionInfo(Function function);
+
+    ExpressionNodePtr MakeNumber(double value, std::wstring text);
+    ExpressionNodePtr MakeConstant(double value, std::wstring name);
+    ExpressionNodePtr MakeVariable(std::wstring name);
+    ExpressionNodePtr MakeOperation(NodeKind kind, std::vector<ExpressionNodePtr> operands);
+    ExpressionNodePtr MakeFunction(Function function, std::vector<ExpressionNodePtr> operands);
+
+    // Appends the names of the variables the tree references, in order of first appearance and without duplicates
+    void CollectVariables(const ExpressionNode& node, std::vector<std::wstring>& names);
+
+    // Writes the equations back in linear syntax. LinearInput only uses ASCII characters, so the text parses back to the same tree.
+    std::wstring FormatLinear(const std::vector<ParsedEquation>& equations, Graphing::FormatType formatType, wchar_t decimalSeparator, wchar_t listSeparator);
+
+    // Writes the equations as presentation MathML, every element carries the namespace prefix when one is given
+    std::wstring FormatMathML(
+        const std::vector<ParsedEquation>& equations,
+        const std::wstring& prefix,
+        bool includeRoot,
+        wchar_t decimalSeparator,
+        wchar_t listSeparator);
+}
@@ -0,0 +1,233 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "Graph.h"
+#include "GraphRenderer.h"
+#include "GraphingErrors.h"
+#include "MathSolver.h"
+#include <algorithm>
+
+using namespace std;
+using namespace Graphing;
+using namespace NativeGraphingImpl;
+
+namespace
+{
+    constexpr double s_defaultArgumentValue = 1.0;
+    const wstring s_xName = L"x";
+    const wstring s_yName = L"y";
+
+    bool References(const ExpressionNodePtr& node, const wstring& name)
+    {
+        if (node == nullptr)
+        {
+            return false;
+        }
+
+        vector<wstring> names;
+        CollectVariables(*node, names);
+        return find(names.begin(), names.end(), name) != names.end();
+    }
+
+    bool IsVariable(const ExpressionNodePtr& node, const wstring& name)
+    {
+        return node->kind == NodeKind::Variable && node->name == name;
+    }
+
+    // a < b is b > a
+    Relation Flip(Relation relation)
+    {
+        switch (relation)
+        {
+        case Relation::Less:
+            return Relation::Greater;
+        case Relation::LessEqual:
+            return Relation::GreaterEqual;
+        case Relation::Greater:
+            return Relation::Less;
+        case Relation::GreaterEqual:
+            return Relation::LessEqual;
+        default:
+            return relation;
+        }
+    }
+}
+
+Graph::Graph()
+    : m_argumentNames{ s_xName, s_yName }
+    , m_argumentValues{ 0, 0 }
+    , m_renderer(make_unique<GraphRenderer>(*this))
+    , m_equationsGeneration(0)
+    , m_initializationError(S_OK)
+{
+}
+
+Graph::~Graph() = default;
+
+optional<vector<shared_ptr<IEquation>>> Graph::TryInitialize(const IExpression* graphingExp)
+{
+    m_equations.clear();
+    m_variables.clear();
+    m_equationsGeneration++;
+    m_initializationError = S_OK;
+
+    vector<shared_ptr<IEquation>> equations;
+    if (graphingExp == nullptr)
+    {
+        return equations;
+    }
+
+    auto expression = dynamic_cast<const Expression*>(graphingExp);
+    if (expression == nullptr)
+    {
+        m_initializationError = E_INVALIDARG;
+        return nullopt;
+    }
+
+    try
+    {
+        vector<wstring> names{ s_xName, s_yName };
+        for (const auto& parsed : expression->GetEquations())
+        {
+            CollectVariables(*parsed.left, names);
+            if (parsed.right != nullptr)
+            {
+                CollectVariables(*parsed.right, names);
+            }
+        }
+
+        // Values set for a variable of the previous expression carry over to the new one
+        vector<double> values(names.size(), s_defaultArgumentValue);
+        for (size_t slot = YSlot + 1; slot < names.size(); slot++)
+        {
+            auto previous = find(m_argumentNames.begin() + YSlot + 1, m_argumentNames.end(), names[slot]);
+            if (previous != m_argumentNames.end())
+            {
+                values[slot] = m_argumentValues[previous - m_argumentNames.begin()];
+            }
+        }
+        m_argumentNames = move(names);
+        m_argumentValues = move(values);
+
+        const auto& parsedEquations = expression->GetEquations();
+        for (size_t i = 0; i < parsedEquations.size(); i++)
+        {
+            GraphedEquation graphed = Classify(parsedEquations[i], static_cast<unsigned int>(i), expression->GetTrigUnitMode());
+            graphed.arguments.assign(m_argumentValues.size(), 0);
+            for (const auto& [slot, reg] : graphed.program.ArgumentRegisters())
+            {
+                graphed.arguments[slot] = m_argumentValues[slot];
+            }
+            m_equations.push_back(move(graphed));
+            equations.push_back(m_equations.back().equation);
+        }
+
+        for (size_t slot = YSlot + 1; slot < m_argumentNames.size(); slot++)
+        {
+            m_variables.push_back(make_shared<Variable>(static_cast<int>(slot), m_argumentNames[slot]));
+        }
+    }
+    catch (const GraphingError& error)
+    {
+        m_equations.clear();
+        m_variables.clear();
+        m_initializationError = ErrorToHResult(error);
+        return nullopt;
+    }
+
+    return equations;
+}
+
+GraphedEquation Graph::Classify(const ParsedEquation& parsed, unsigned int id, EvalTrigUnitMode trigUnitMode) const
+{
+    GraphedEquation graphed{ make_shared<Equation>(id), PlotKind::FunctionOfX, Relation::Equal, Program{}, {} };
+
+    // An expression on its own is the right side of y=
+    if (parsed.right == nullptr)
+    {
+        if (References(parsed.left, s_yName))
+        {
+            throw SyntaxError(SyntaxErrorCode::InvalidEquationSyntax);
+        }
+        graphed.program = Program::Compile(*parsed.left, m_argumentNames, trigUnitMode);
+        return graphed;
+    }
+
+    const ExpressionNodePtr* function = nullptr;
+    if (IsVariable(parsed.left, s_yName) && !References(parsed.right, s_yName))
+    {
+        function = &parsed.right;
+        graphed.relation = parsed.relation;
+    }
+    else if (IsVariable(parsed.right, s_yName) && !References(parsed.left, s_yName))
+    {
+        function = &parsed.left;
+        graphed.relation = Flip(parsed.relation);
+    }
+    else if (IsVariable(parsed.left, s_xName) && !References(parsed.right, s_xName))
+    {
+        function = &parsed.right;
+        graphed.kind = PlotKind::FunctionOfY;
+        graphed.relation = parsed.relation;
+    }
+    else if (IsVariable(parsed.right, s_xName) && !References(parsed.left, s_xName))
+    {
+        function = &parsed.left;
+        graphed.kind = PlotKind::FunctionOfY;
+        graphed.relation = Flip(parsed.relation);
+    }
+
+    if (function != nullptr)
+    {
+        graphed.program = Program::Compile(**function, m_argumentNames, trigUnitMode);
+        return graphed;
+    }
+
+    bool hasGraphVariable = References(parsed.left, s_xName) || References(parsed.left, s_yName) || References(parsed.right, s_xName)
+                            || References(parsed.right, s_yName);
+    if (!hasGraphVariable)
+    {
+        throw SyntaxError(SyntaxErrorCode::EqualWithoutGraphVariable);
+    }
+
+    graphed.kind = PlotKind::Implicit;
+    graphed.relation = parsed.relation;
+    auto difference = MakeOperation(NodeKind::Subtract, { parsed.left, parsed.right });
+    graphed.program = Program::Compile(*difference, m_argumentNames, trigUnitMode);
+    return graphed;
+}
+
+void Graph::SetArgValue(wstring variableName, double value)
+{
+    auto found = find(m_argumentNames.begin() + YSlot + 1, m_argumentNames.end(), variableName);
+    if (found == m_argumentNames.end())
+    {
+        return;
+    }
+
+    // Only the equations that read the variable change, the renderer keeps the curves of the others
+    const size_t slot = found - m_argumentNames.begin();
+    m_argumentValues[slot] = value;
+    for (auto& graphed : m_equations)
+    {
+        if (graphed.program.UsesArgument(slot))
+        {
+            graphed.arguments[slot] = value;
+        }
+    }
+}
+
+shared_ptr<Renderer::IGraphRenderer> Graph::GetRenderer() const
+{
+    return shared_ptr<Renderer::IGraphRenderer>(shared_from_this(), m_renderer.get());
+}
+
+bool Graph::TryResetSelection()
+{
+    for (auto& graphed : m_equations)
+    {
+        graphed.equation->ResetSelection();
+    }
+    return true;
+}
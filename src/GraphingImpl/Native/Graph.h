@@ -0,0 +1,128 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "GraphingInterfaces/IGraph.h"
+#include "Mocks/GraphingOptions.h"
+#include "Equation.h"
+#include "Program.h"
+
+namespace NativeGraphingImpl
+{
+    class GraphRenderer;
+
+    enum class PlotKind : uint8_t
+    {
+        FunctionOfX, // y relation f(x)
+        FunctionOfY, // x relation g(y)
+        Implicit     // F(x, y) relation 0
+    };
+
+    struct GraphedEquation
+    {
+        std::shared_ptr<Equation> equation;
+        PlotKind kind;
+        Relation relation;
+        Program program;
+
+        // Indexed by argument slot like Graph::GetArgumentValues, with 0 for the variables the program does not read, so
+        // that they only change when the equation has to be evaluated again
+        std::vector<double> arguments;
+    };
+
+    class Variable : public Graphing::IVariable
+    {
+    public:
+        Variable(int id, std::wstring name)
+            : m_id(id)
+            , m_name(std::move(name))
+        {
+        }
+
+        int GetVariableID() const override
+        {
+            return m_id;
+        }
+
+        const std::wstring& GetVariableName() override
+        {
+            return m_name;
+        }
+
+    private:
+        int m_id;
+        std::wstring m_name;
+    };
+
+    // The equations of one graph compiled to programs over a shared argument list. Slot 0 is x, slot 1 is y and the
+    // variables the equations use follow in order of appearance, they start at 1 until SetArgValue changes them.
+    class Graph : public Graphing::IGraph, public std::enable_shared_from_this<Graph>
+    {
+    public:
+        static constexpr size_t XSlot = 0;
+        static constexpr size_t YSlot = 1;
+
+        Graph();
+        ~Graph();
+
+        std::optional<std::vector<std::shared_ptr<Graphing::IEquation>>> TryInitialize(const Graphing::IExpression* graphingExp = nullptr) override;
+
+        HRESULT GetInitializationError() override
+        {
+            return m_initializationError;
+        }
+
+        // The options are a plain property bag, the mock one already holds every value GraphControl sets
+        Graphing::IGraphingOptions& GetOptions() override
+        {
+            return m_graphingOptions;
+        }
+
+        std::vector<std::shared_ptr<Graphing::IVariable>> GetVariables() override
+        {
+            return m_variables;
+        }
+
+        void SetArgValue(std::wstring variableName, double value) override;
+
+        // The renderer shares the lifetime of the graph, it draws the graph's equations
+        std::shared_ptr<Graphing::Renderer::IGraphRenderer> GetRenderer() const override;
+
+        bool TryResetSelection() override;
+
+        std::shared_ptr<Graphing::Analyzer::IGraphAnalyzer> GetAnalyzer() const override
+        {
+            return nullptr;
+        }
+
+        const std::vector<GraphedEquation>& GetEquations() const
+        {
+            return m_equations;
+        }
+
+        // Changes whenever TryInitialize replaces the equations
+        size_t GetEquationsGeneration() const
+        {
+            return m_equationsGeneration;
+        }
+
+        // Indexed by argument slot, the x and y slots are scratch values for the caller to fill in
+        const std::vector<double>& GetArgumentValues() const
+        {
+            return m_argumentValues;
+        }
+
+    private:
+        GraphedEquation Classify(const ParsedEquation& parsed, unsigned int id, Graphing::EvalTrigUnitMode trigUnitMode) const;
+
+        std::vector<GraphedEquation> m_equations;
+        std::vector<std::shared_ptr<Graphing::IVariable>> m_variables;
+        std::vector<std::wstring> m_argumentNames;
+        std::vector<double> m_argumentValues;
+        MockGraphingImpl::GraphingOptions m_graphingOptions;
+        std::unique_ptr<GraphRenderer> m_renderer;
+        size_t m_equationsGeneration;
+        HRESULT m_initializationError;
+    };
+}
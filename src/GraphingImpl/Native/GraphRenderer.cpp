@@ -0,0 +1,602 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "GraphRenderer.h"
+#include "Bitmap.h"
+#include "Graph.h"
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
+using namespace Graphing;
+using namespace Graphing::Renderer;
+using namespace NativeGraphingImpl;
+
+namespace
+{
+    constexpr double s_zoomRatio = 2.0 / 3.0;
+    constexpr double s_smoothZoomRatio = 0.95;
+    constexpr double s_pinchZoomRatio = 0.9;
+    constexpr double s_moveRatio = 0.1;
+
+    // Ranges narrower than this relative to their position lose all precision, wider ones overflow the arithmetic
+    constexpr double s_minRelativeRange = 1e-12;
+    constexpr double s_maxRange = 1e100;
+
+    // How far from the pointer, in screen units, a curve can be and still be traced
+    constexpr double s_tracingDistance = 20;
+
+    // Screen units are 1/96 inch
+    constexpr float s_screenUnitsPerInch = 96;
+
+    // Grid lines are at least this far apart in screen units, at 1, 2 or 5 times a power of 10
+    constexpr double s_minGridSpacing = 40;
+    constexpr double s_gridLineWidth = 1;
+    constexpr double s_axisLineWidth = 1;
+    constexpr double s_asymptoteLineWidth = 1;
+
+    bool IsValidRange(double low, double high)
+    {
+        return isfinite(low) && isfinite(high) && high - low <= s_maxRange && high - low > s_minRelativeRange * max(fabs(low), fabs(high));
+    }
+
+    double RoundToPrecision(double value, double precision)
+    {
+        return precision > 0 ? round(value / precision) * precision : value;
+    }
+
+    double GridStep(double range, double screenSize)
+    {
+        const double minStep = range * s_minGridSpacing / screenSize;
+        const double power = pow(10, floor(log10(minStep)));
+        for (double multiple : { 1, 2, 5 })
+        {
+            if (multiple * power >= minStep)
+            {
+                return multiple * power;
+            }
+        }
+        return 10 * power;
+    }
+
+    // The center of the pixel a line one pixel wide at this position falls on, so that it stays sharp
+    double SnapToPixel(double position)
+    {
+        return floor(position) + 0.5;
+    }
+}
+
+GraphRenderer::GraphRenderer(Graph& graph)
+    : m_graph(graph)
+    , m_width(0)
+    , m_height(0)
+    , m_dpiX(96)
+    , m_dpiY(96)
+    , m_xMin(-10)
+    , m_xMax(10)
+    , m_yMin(-10)
+    , m_yMax(10)
+    , m_samplersGeneration(0)
+    , m_sampledView{}
+    , m_isSegmentIndexCurrent(false)
+    , m_rasterizer(nullptr)
+    , m_bitmap(nullptr)
+{
+}
+
+HRESULT GraphRenderer::SetGraphSize(unsigned int width, unsigned int height)
+{
+    m_width = width;
+    m_height = height;
+    MakeProportional();
+    return S_OK;
+}
+
+HRESULT GraphRenderer::SetDpi(float dpiX, float dpiY)
+{
+    if (!(dpiX > 0) || !(dpiY > 0))
+    {
+        return E_INVALIDARG;
+    }
+
+    m_dpiX = dpiX;
+    m_dpiY = dpiY;
+    return S_OK;
+}
+
+HRESULT GraphRenderer::DrawD2D1(ID2D1Factory* /* pDirect2dFactory */, ID2D1RenderTarget* /* pRenderTarget */, bool& hasSomeMissingDataOut)
+{
+    hasSomeMissingDataOut = SampleCurves();
+    return S_OK;
+}
+
+HRESULT GraphRenderer::GetClosePointData(
+    double inScreenPointX,
+    double inScreenPointY,
+    double precision,
+    int& formulaIdOut,
+    float& xScreenPointOut,
+    float& yScreenPointOut,
+    double& xValueOut,
+    double& yValueOut,
+    double& rhoValueOut,
+    double& thetaValueOut,
+    double& tValueOut)
+{
+    if (m_width == 0 || m_height == 0)
+    {
+        return E_FAIL;
+    }
+
+    // Tracing can come before the first frame or after a change that has not been drawn yet
+    if (!AreCurvesCurrent())
+    {
+        SampleCurves();
+    }
+    if (!m_isSegmentIndexCurrent)
+    {
+        BuildSegmentIndex();
+    }
+
+    SegmentHit hit;
+    if (!m_segmentIndex.FindNearest(inScreenPointX, inScreenPointY, s_tracingDistance, hit))
+    {
+        return S_FALSE;
+    }
+
+    // The nearest point of the polyline is within a fraction of a pixel of the curve. The coordinate the curve is swept
+    // along is rounded and the one equation found evaluated there, so that the values shown are exact.
+    const GraphedEquation& graphed = m_graph.GetEquations()[hit.curve];
+    double x = FromScreenX(hit.x);
+    double y = FromScreenY(hit.y);
+    vector<double> arguments = graphed.arguments;
+    if (graphed.kind == PlotKind::FunctionOfX)
+    {
+        arguments[Graph::XSlot] = RoundToPrecision(x, precision);
+        const double value = graphed.program.Evaluate(arguments.data());
+        if (isfinite(value))
+        {
+            x = arguments[Graph::XSlot];
+            y = value;
+        }
+    }
+    else
+    {
+        arguments[Graph::YSlot] = RoundToPrecision(y, precision);
+        const double value = graphed.program.Evaluate(arguments.data());
+        if (isfinite(value))
+        {
+            x = value;
+            y = arguments[Graph::YSlot];
+        }
+    }
+
+    formulaIdOut = static_cast<int>(hit.curve);
+    xScreenPointOut = static_cast<float>(ToScreenX(x));
+    yScreenPointOut = static_cast<float>(ToScreenY(y));
+    xValueOut = x;
+    yValueOut = y;
+    rhoValueOut = hypot(x, y);
+    thetaValueOut = atan2(y, x);
+    tValueOut = 0;
+    return S_OK;
+}
+
+HRESULT GraphRenderer::ScaleRange(double centerX, double centerY, double scale)
+{
+    if (!(scale > 0))
+    {
+        return E_INVALIDARG;
+    }
+
+    // The center is given in [-1, 1] across the view, y pointing up
+    double x = (m_xMin + m_xMax) / 2 + centerX * (m_xMax - m_xMin) / 2;
+    double y = (m_yMin + m_yMax) / 2 + centerY * (m_yMax - m_yMin) / 2;
+    return TrySetRanges(x + scale * (m_xMin - x), x + scale * (m_xMax - x), y + scale * (m_yMin - y), y + scale * (m_yMax - y));
+}
+
+HRESULT GraphRenderer::ChangeRange(ChangeRangeAction action)
+{
+    double xScale = 1;
+    double yScale = 1;
+    double xMove = 0;
+    double yMove = 0;
+
+    switch (action)
+    {
+    case ChangeRangeAction::ZoomIn:
+        xScale = yScale = s_zoomRatio;
+        break;
+    case ChangeRangeAction::ZoomOut:
+        xScale = yScale = 1 / s_zoomRatio;
+        break;
+    case ChangeRangeAction::SmoothZoomIn:
+        xScale = yScale = s_smoothZoomRatio;
+        break;
+    case ChangeRangeAction::SmoothZoomOut:
+        xScale = yScale = 1 / s_smoothZoomRatio;
+        break;
+    case ChangeRangeAction::PinchZoomIn:
+        xScale = yScale = s_pinchZoomRatio;
+        break;
+    case ChangeRangeAction::PinchZoomOut:
+        xScale = yScale = 1 / s_pinchZoomRatio;
+        break;
+    case ChangeRangeAction::WidenX:
+        xScale = 1 / s_zoomRatio;
+        break;
+    case ChangeRangeAction::ShrinkX:
+        xScale = s_zoomRatio;
+        break;
+    case ChangeRangeAction::WidenY:
+        yScale = 1 / s_zoomRatio;
+        break;
+    case ChangeRangeAction::ShrinkY:
+        yScale = s_zoomRatio;
+        break;
+    case ChangeRangeAction::MoveNegativeX:
+        xMove = -s_moveRatio;
+        break;
+    case ChangeRangeAction::MovePositiveX:
+        xMove = s_moveRatio;
+        break;
+    case ChangeRangeAction::MoveNegativeY:
+        yMove = -s_moveRatio;
+        break;
+    case ChangeRangeAction::MovePositiveY:
+        yMove = s_moveRatio;
+        break;
+    default:
+        // The Z axis only exists in 3D
+        return S_OK;
+    }
+
+    double xCenter = (m_xMin + m_xMax) / 2 + xMove * (m_xMax - m_xMin);
+    double yCenter = (m_yMin + m_yMax) / 2 + yMove * (m_yMax - m_yMin);
+    double xHalf = xScale * (m_xMax - m_xMin) / 2;
+    double yHalf = yScale * (m_yMax - m_yMin) / 2;
+    return TrySetRanges(xCenter - xHalf, xCenter + xHalf, yCenter - yHalf, yCenter + yHalf);
+}
+
+HRESULT GraphRenderer::MoveRangeByRatio(double ratioX, double ratioY)
+{
+    // A ratio of 1 moves the view by half of its size
+    double xShift = ratioX * (m_xMax - m_xMin) / 2;
+    double yShift = ratioY * (m_yMax - m_yMin) / 2;
+    return TrySetRanges(m_xMin + xShift, m_xMax + xShift, m_yMin + yShift, m_yMax + yShift);
+}
+
+HRESULT GraphRenderer::ResetRange()
+{
+    auto& options = m_graph.GetOptions();
+    auto xRange = options.GetDefaultXRange();
+    auto yRange = options.GetDefaultYRange();
+    if (FAILED(TrySetRanges(xRange.first, xRange.second, yRange.first, yRange.second)))
+    {
+        return TrySetRanges(-10, 10, -10, 10);
+    }
+    return S_OK;
+}
+
+HRESULT GraphRenderer::GetDisplayRanges(double& xMin, double& xMax, double& yMin, double& yMax)
+{
+    xMin = m_xMin;
+    xMax = m_xMax;
+    yMin = m_yMin;
+    yMax = m_yMax;
+    return S_OK;
+}
+
+HRESULT GraphRenderer::SetDisplayRanges(double xMin, double xMax, double yMin, double yMax)
+{
+    return TrySetRanges(xMin, xMax, yMin, yMax);
+}
+
+HRESULT GraphRenderer::PrepareGraph()
+{
+    return ResetRange();
+}
+
+// Draws the graph into a BMP image, at the size of the view in pixels for the dpi
+HRESULT GraphRenderer::GetBitmap(shared_ptr<IBitmap>& bitmapOut, bool& hasSomeMissingDataOut)
+{
+    if (m_width == 0 || m_height == 0)
+    {
+        return E_FAIL;
+    }
+
+    hasSomeMissingDataOut = SampleCurves();
+    if (m_rasterizer == nullptr)
+    {
+        m_rasterizer = make_unique<Rasterizer>();
+    }
+
+    const double scaleX = m_dpiX / s_screenUnitsPerInch;
+    const double scaleY = m_dpiY / s_screenUnitsPerInch;
+    m_rasterizer->Clear(
+        static_cast<unsigned int>(lround(m_width * scaleX)),
+        static_cast<unsigned int>(lround(m_height * scaleY)),
+        m_graph.GetOptions().GetBackColor());
+    DrawAxes(scaleX, scaleY);
+    DrawCurves(scaleX, scaleY);
+    m_rasterizer->Render();
+
+    // The image of the previous call is reused unless the caller still holds it
+    if (m_bitmap == nullptr || m_bitmap.use_count() > 1)
+    {
+        m_bitmap = make_shared<Bitmap>();
+    }
+    m_rasterizer->EncodeBitmap(m_dpiX, m_dpiY, m_bitmap->GetBuffer());
+    bitmapOut = m_bitmap;
+    return S_OK;
+}
+
+// Samples the equations that are functions of x or y over the view, reusing the strips cached by earlier frames. The implicit
+// ones are not drawn and count as missing data. While the view stays, only the curves whose variables changed are sampled
+// again. Returns whether some data is missing.
+bool GraphRenderer::SampleCurves()
+{
+    const auto& equations = m_graph.GetEquations();
+    const ViewState view{ m_xMin, m_xMax, m_yMin, m_yMax, m_width, m_height };
+    bool isViewChanged = !(m_sampledView == view);
+    if (m_samplersGeneration != m_graph.GetEquationsGeneration() || m_samplers.size() != equations.size())
+    {
+        // The samplers refer to the programs of the equations
+        m_samplers.clear();
+        for (const GraphedEquation& graphed : equations)
+        {
+            m_samplers.push_back(
+                graphed.kind == PlotKind::Implicit
+                    ? nullptr
+                    : make_unique<CurveSampler>(graphed.program, graphed.kind == PlotKind::FunctionOfX ? Graph::XSlot : Graph::YSlot));
+        }
+        m_curves.resize(equations.size());
+        m_curveArguments.assign(equations.size(), {});
+        m_curveCache.Clear();
+        m_samplersGeneration = m_graph.GetEquationsGeneration();
+        isViewChanged = true;
+    }
+
+    m_sampledView = view;
+    m_sampledArguments = m_graph.GetArgumentValues();
+    m_isSegmentIndexCurrent = m_isSegmentIndexCurrent && !isViewChanged;
+    if (m_width == 0 || m_height == 0)
+    {
+        return false;
+    }
+
+    const SampleWindow xWindow{ m_xMin, m_xMax, m_yMin, m_yMax, static_cast<double>(m_width), static_cast<double>(m_height) };
+    const SampleWindow yWindow{ m_yMin, m_yMax, m_xMin, m_xMax, static_cast<double>(m_height), static_cast<double>(m_width) };
+    bool hasMissingData = false;
+    m_curveCache.BeginFrame();
+    for (size_t i = 0; i < equations.size(); i++)
+    {
+        if (m_samplers[i] == nullptr)
+        {
+            m_curves[i].Clear();
+            hasMissingData = true;
+            continue;
+        }
+
+        // A curve that ran out of budget is sampled again to make progress
+        const vector<double>& arguments = equations[i].arguments;
+        if (!isViewChanged && !m_curves[i].hasMissingData && m_curveArguments[i] == arguments)
+        {
+            continue;
+        }
+
+        m_curveCache.Sample(i, *m_samplers[i], arguments, equations[i].kind == PlotKind::FunctionOfX ? xWindow : yWindow, m_curves[i]);
+        m_curveArguments[i] = arguments;
+        m_isSegmentIndexCurrent = false;
+        hasMissingData = hasMissingData || m_curves[i].hasMissingData;
+    }
+    m_curveCache.EndFrame();
+    return hasMissingData;
+}
+
+// The grid, the axes and the box around the view, in pixels scaled from screen units
+void GraphRenderer::DrawAxes(double scaleX, double scaleY)
+{
+    const auto& options = m_graph.GetOptions();
+    const double right = m_width * scaleX;
+    const double bottom = m_height * scaleY;
+    const double scale = (scaleX + scaleY) / 2;
+
+    if (options.GetShowGrid())
+    {
+        m_rasterizer->SetStroke(options.GetGridColor(), s_gridLineWidth * scale, LineStyle::Solid);
+        const double xStep = GridStep(m_xMax - m_xMin, m_width);
+        for (double i = ceil(m_xMin / xStep); i * xStep <= m_xMax; i++)
+        {
+            const double x = SnapToPixel(ToScreenX(i * xStep) * scaleX);
+            m_rasterizer->BeginFigure(x, 0);
+            m_rasterizer->AddLine(x, bottom);
+        }
+        const double yStep = GridStep(m_yMax - m_yMin, m_height);
+        for (double i = ceil(m_yMin / yStep); i * yStep <= m_yMax; i++)
+        {
+            const double y = SnapToPixel(ToScreenY(i * yStep) * scaleY);
+            m_rasterizer->BeginFigure(0, y);
+            m_rasterizer->AddLine(right, y);
+        }
+    }
+
+    if (options.GetShowAxis())
+    {
+        m_rasterizer->SetStroke(options.GetAxisColor(), s_axisLineWidth * scale, LineStyle::Solid);
+        if (m_xMin <= 0 && 0 <= m_xMax)
+        {
+            const double x = SnapToPixel(ToScreenX(0) * scaleX);
+            m_rasterizer->BeginFigure(x, 0);
+            m_rasterizer->AddLine(x, bottom);
+        }
+        if (m_yMin <= 0 && 0 <= m_yMax)
+        {
+            const double y = SnapToPixel(ToScreenY(0) * scaleY);
+            m_rasterizer->BeginFigure(0, y);
+            m_rasterizer->AddLine(right, y);
+        }
+    }
+
+    if (options.GetShowBox())
+    {
+        const double left = SnapToPixel(0);
+        const double top = SnapToPixel(0);
+        const double boxRight = SnapToPixel(right - 1);
+        const double boxBottom = SnapToPixel(bottom - 1);
+        m_rasterizer->SetStroke(options.GetBoxColor(), s_axisLineWidth * scale, LineStyle::Solid);
+        m_rasterizer->BeginFigure(left, top);
+        m_rasterizer->AddLine(boxRight, top);
+        m_rasterizer->AddLine(boxRight, boxBottom);
+        m_rasterizer->AddLine(left, boxBottom);
+        m_rasterizer->AddLine(left, top);
+    }
+}
+
+// The sampled curves in the color, width and style of their equations, over their asymptotes when those are marked
+void GraphRenderer::DrawCurves(double scaleX, double scaleY)
+{
+    const auto& options = m_graph.GetOptions();
+    const auto& equations = m_graph.GetEquations();
+    const double scale = (scaleX + scaleY) / 2;
+
+    if (options.GetMarkVerticalAsymptotes())
+    {
+        m_rasterizer->SetStroke(options.GetAsymptotesColor(), s_asymptoteLineWidth * scale, LineStyle::Dash);
+        for (size_t i = 0; i < equations.size(); i++)
+        {
+            const PlotKind kind = equations[i].kind;
+            for (double asymptote : m_curves[i].asymptotes)
+            {
+                if (kind == PlotKind::FunctionOfX)
+                {
+                    const double x = SnapToPixel(ToScreenX(asymptote) * scaleX);
+                    m_rasterizer->BeginFigure(x, 0);
+                    m_rasterizer->AddLine(x, m_height * scaleY);
+                }
+                else
+                {
+                    const double y = SnapToPixel(ToScreenY(asymptote) * scaleY);
+                    m_rasterizer->BeginFigure(0, y);
+                    m_rasterizer->AddLine(m_width * scaleX, y);
+                }
+            }
+        }
+    }
+
+    for (size_t i = 0; i < equations.size(); i++)
+    {
+        const Equation& equation = *equations[i].equation;
+        const EquationOptions& equationOptions = equation.GetOptions();
+        const float width = equation.IsEquationSelected() ? equationOptions.GetSelectedEquationLineWidth() : equationOptions.GetLineWidth();
+        m_rasterizer->SetStroke(equationOptions.GetGraphColor(), width * scale, equationOptions.GetLineStyle());
+
+        const SampledCurve& curve = m_curves[i];
+        for (size_t polyline = 0; polyline < curve.polylineStarts.size(); polyline++)
+        {
+            const size_t start = curve.polylineStarts[polyline];
+            const size_t end = polyline + 1 < curve.polylineStarts.size() ? curve.polylineStarts[polyline + 1] : curve.points.size();
+            const auto [startX, startY] = ToScreen(equations[i].kind, curve.points[start]);
+            m_rasterizer->BeginFigure(startX * scaleX, startY * scaleY);
+            for (size_t point = start + 1; point < end; point++)
+            {
+                const auto [x, y] = ToScreen(equations[i].kind, curve.points[point]);
+                m_rasterizer->AddLine(x * scaleX, y * scaleY);
+            }
+        }
+    }
+}
+
+bool GraphRenderer::AreCurvesCurrent() const
+{
+    const ViewState view{ m_xMin, m_xMax, m_yMin, m_yMax, m_width, m_height };
+    return m_samplersGeneration == m_graph.GetEquationsGeneration() && m_samplers.size() == m_graph.GetEquations().size()
+           && m_sampledView == view && m_sampledArguments == m_graph.GetArgumentValues();
+}
+
+// Indexes the polylines of the curves in screen units, with the margin tracing searches within
+void GraphRenderer::BuildSegmentIndex()
+{
+    const auto& equations = m_graph.GetEquations();
+    m_segmentIndex.Clear(m_width, m_height, s_tracingDistance);
+    for (size_t i = 0; i < m_curves.size(); i++)
+    {
+        const SampledCurve& curve = m_curves[i];
+        for (size_t polyline = 0; polyline < curve.polylineStarts.size(); polyline++)
+        {
+            const size_t start = curve.polylineStarts[polyline];
+            const size_t end = polyline + 1 < curve.polylineStarts.size() ? curve.polylineStarts[polyline + 1] : curve.points.size();
+            auto [lastX, lastY] = ToScreen(equations[i].kind, curve.points[start]);
+            if (end - start == 1)
+            {
+                m_segmentIndex.AddSegment(i, lastX, lastY, lastX, lastY);
+            }
+            for (size_t point = start + 1; point < end; point++)
+            {
+                const auto [x, y] = ToScreen(equations[i].kind, curve.points[point]);
+                m_segmentIndex.AddSegment(i, lastX, lastY, x, y);
+                lastX = x;
+                lastY = y;
+            }
+        }
+    }
+    m_segmentIndex.Build();
+    m_isSegmentIndexCurrent = true;
+}
+
+HRESULT GraphRenderer::TrySetRanges(double xMin, double xMax, double yMin, double yMax)
+{
+    if (!IsValidRange(xMin, xMax) || !IsValidRange(yMin, yMax))
+    {
+        return E_INVALIDARG;
+    }
+
+    m_xMin = xMin;
+    m_xMax = xMax;
+    m_yMin = yMin;
+    m_yMax = yMax;
+    MakeProportional();
+    return S_OK;
+}
+
+// With ForceProportional a unit has the same length on both axes, the y range grows or shrinks around its center to match
+void GraphRenderer::MakeProportional()
+{
+    if (!m_graph.GetOptions().GetForceProportional() || m_width == 0 || m_height == 0)
+    {
+        return;
+    }
+
+    double unitsPerPixel = (m_xMax - m_xMin) / m_width;
+    double yCenter = (m_yMin + m_yMax) / 2;
+    double yHalf = unitsPerPixel * m_height / 2;
+    m_yMin = yCenter - yHalf;
+    m_yMax = yCenter + yHalf;
+}
+
+// A function of y has its argument on the y axis
+pair<double, double> GraphRenderer::ToScreen(PlotKind kind, const CurvePoint& point) const
+{
+    return kind == PlotKind::FunctionOfX ? make_pair(ToScreenX(point.x), ToScreenY(point.y)) : make_pair(ToScreenX(point.y), ToScreenY(point.x));
+}
+
+double GraphRenderer::ToScreenX(double x) const
+{
+    return (x - m_xMin) / (m_xMax - m_xMin) * m_width;
+}
+
+double GraphRenderer::ToScreenY(double y) const
+{
+    return (m_yMax - y) / (m_yMax - m_yMin) * m_height;
+}
+
+double GraphRenderer::FromScreenX(double screenX) const
+{
+    return m_xMin + screenX / m_width * (m_xMax - m_xMin);
+}
+
+double GraphRenderer::FromScreenY(double screenY) const
+{
+    return m_yMax - screenY / m_height * (m_yMax - m_yMin);
+}
@@ -0,0 +1,114 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "GraphingInterfaces/GraphingEnums.h"
+#include "GraphingInterfaces/IGraphRenderer.h"
+#include "CurveCache.h"
+#include "Rasterizer.h"
+#include "SegmentIndex.h"
+
+namespace NativeGraphingImpl
+{
+    class Bitmap;
+    class Graph;
+    enum class PlotKind : uint8_t;
+
+    // Keeps the view of a graph. Screen positions are in the same units as the size given to SetGraphSize, with the origin
+    // at the top left corner.
+    class GraphRenderer : public Graphing::Renderer::IGraphRenderer
+    {
+    public:
+        explicit GraphRenderer(Graph& graph);
+
+        HRESULT SetGraphSize(unsigned int width, unsigned int height) override;
+        HRESULT SetDpi(float dpiX, float dpiY) override;
+
+        HRESULT DrawD2D1(ID2D1Factory* pDirect2dFactory, ID2D1RenderTarget* pRenderTarget, bool& hasSomeMissingDataOut) override;
+        HRESULT GetClosePointData(
+            double inScreenPointX,
+            double inScreenPointY,
+            double precision,
+            int& formulaIdOut,
+            float& xScreenPointOut,
+            float& yScreenPointOut,
+            double& xValueOut,
+            double& yValueOut,
+            double& rhoValueOut,
+            double& thetaValueOut,
+            double& tValueOut) override;
+
+        HRESULT ScaleRange(double centerX, double centerY, double scale) override;
+        HRESULT ChangeRange(Graphing::Renderer::ChangeRangeAction action) override;
+        HRESULT MoveRangeByRatio(double ratioX, double ratioY) override;
+        HRESULT ResetRange() override;
+        HRESULT GetDisplayRanges(double& xMin, double& xMax, double& yMin, double& yMax) override;
+        HRESULT SetDisplayRanges(double xMin, double xMax, double yMin, double yMax) override;
+        HRESULT PrepareGraph() override;
+
+        HRESULT GetBitmap(std::shared_ptr<Graphing::IBitmap>& bitmapOut, bool& hasSomeMissingDataOut) override;
+
+        // The strips of the curves kept between frames, with its size and hit rate
+        CurveCache& GetCurveCache()
+        {
+            return m_curveCache;
+        }
+
+    private:
+        bool SampleCurves();
+        bool AreCurvesCurrent() const;
+        void BuildSegmentIndex();
+        void DrawAxes(double scaleX, double scaleY);
+        void DrawCurves(double scaleX, double scaleY);
+        HRESULT TrySetRanges(double xMin, double xMax, double yMin, double yMax);
+        void MakeProportional();
+        std::pair<double, double> ToScreen(PlotKind kind, const CurvePoint& point) const;
+        double ToScreenX(double x) const;
+        double ToScreenY(double y) const;
+        double FromScreenX(double screenX) const;
+        double FromScreenY(double screenY) const;
+
+        Graph& m_graph;
+        unsigned int m_width;
+        unsigned int m_height;
+        float m_dpiX;
+        float m_dpiY;
+        double m_xMin;
+        double m_xMax;
+        double m_yMin;
+        double m_yMax;
+
+        // One sampler and curve per equation, null for implicit equations, with the arguments the curve was sampled for
+        std::vector<std::unique_ptr<CurveSampler>> m_samplers;
+        std::vector<SampledCurve> m_curves;
+        std::vector<std::vector<double>> m_curveArguments;
+        size_t m_samplersGeneration;
+        CurveCache m_curveCache;
+
+        // What the curves were sampled for, and their polylines on screen for tracing
+        struct ViewState
+        {
+            double xMin;
+            double xMax;
+            double yMin;
+            double yMax;
+            unsigned int width;
+            unsigned int height;
+
+            bool operator==(const ViewState& other) const
+            {
+                return xMin == other.xMin && xMax == other.xMax && yMin == other.yMin && yMax == other.yMax && width == other.width
+                       && height == other.height;
+            }
+        };
+        ViewState m_sampledView;
+        std::vector<double> m_sampledArguments;
+        SegmentIndex m_segmentIndex;
+        bool m_isSegmentIndexCurrent;
+
+        // Draws GetBitmap, made on first use since it starts threads
+        std::unique_ptr<Rasterizer> m_rasterizer;
+        std::shared_ptr<Bitmap> m_bitmap;
+    };
+}
@@ -0,0 +1,77 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstdint>
+
+namespace NativeGraphingImpl
+{
+    // The error type and code values are the ones GraphControl maps to messages, see GraphControl/Models/Equation.h
+    enum class ErrorType : int
+    {
+        Evaluation = 0,
+        Syntax = 1,
+        Abort = 2
+    };
+
+    namespace SyntaxErrorCode
+    {
+        constexpr int ParenthesisMismatch = 1;
+        constexpr int UnmatchedParenthesis = 2;
+        constexpr int TooManyDecimalPoints = 3;
+        constexpr int DecimalPointWithoutDigits = 4;
+        constexpr int UnexpectedEndOfExpression = 5;
+        constexpr int UnexpectedToken = 6;
+        constexpr int InvalidToken = 7;
+        constexpr int TooManyEquals = 8;
+        constexpr int EqualWithoutGraphVariable = 10;
+        constexpr int InvalidEquationSyntax = 11;
+        constexpr int EmptyExpression = 12;
+        constexpr int IncorrectNumParameter = 26;
+        constexpr int InvalidVariableNameFormat = 32;
+        constexpr int GeneralError = 52;
+    }
+
+    namespace EvaluationErrorCode
+    {
+        constexpr int DivideByZero = -15;
+        constexpr int NotSupported = -503;
+        constexpr int GeneralError = -504;
+        constexpr int TooComplexToSolve = -506;
+    }
+
+    // Thrown by the parser and the graph builder, MathSolver turns it into the error code and type out parameters
+    struct GraphingError
+    {
+        ErrorType type;
+        int code;
+    };
+
+    inline GraphingError SyntaxError(int code)
+    {
+        return GraphingError{ ErrorType::Syntax, code };
+    }
+
+    // IGraph::GetInitializationError can only return an HRESULT, so the error travels as a failure code with the customer bit
+    // set. The type goes in the facility bits and the code in the low word.
+    constexpr uint32_t GraphingErrorHResultMask = 0xA0000000;
+
+    inline HRESULT ErrorToHResult(const GraphingError& error)
+    {
+        return static_cast<HRESULT>(GraphingErrorHResultMask | (static_cast<uint32_t>(error.type) << 16) | static_cast<uint16_t>(error.code));
+    }
+
+    inline bool TryHResultToError(HRESULT hr, GraphingError& error)
+    {
+        auto value = static_cast<uint32_t>(hr);
+        if ((value & 0xFFF00000) != GraphingErrorHResultMask)
+        {
+            return false;
+        }
+
+        error.type = static_cast<ErrorType>((value >> 16) & 0xF);
+        error.code = static_cast<int16_t>(value & 0xFFFF);
+        return true;
+    }
+}
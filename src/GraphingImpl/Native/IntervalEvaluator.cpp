@@ -0,0 +1,502 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "IntervalEvaluator.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+using namespace std;
+using namespace NativeGraphingImpl;
+
+namespace
+{
+    constexpr double s_pi = 3.14159265358979323846;
+    constexpr double s_infinity = numeric_limits<double>::infinity();
+
+    // Gamma decreases on (0, s_gammaMinimumAt] and increases after it
+    constexpr double s_gammaMinimumAt = 1.4616321449683623;
+    constexpr double s_gammaMinimum = 0.8856031944108887;
+
+    // The range between two values of a monotonic function, a NaN bound is unknown so anything can be reached
+    Interval Hull(double first, double second)
+    {
+        if (isnan(first) || isnan(second))
+        {
+            return Interval::Entire();
+        }
+        return { min(first, second), max(first, second), false, false };
+    }
+
+    Interval Undefined(Interval interval)
+    {
+        interval.mayBeUndefined = true;
+        return interval;
+    }
+
+    Interval Jump(Interval interval)
+    {
+        interval.mayJump = true;
+        return interval;
+    }
+
+    bool ContainsZero(const Interval& interval)
+    {
+        return interval.low <= 0 && interval.high >= 0;
+    }
+
+    Interval Add(const Interval& left, const Interval& right)
+    {
+        // inf - inf leaves the bound unknown
+        double low = left.low + right.low;
+        double high = left.high + right.high;
+        return { isnan(low) ? -s_infinity : low, isnan(high) ? s_infinity : high, false, false };
+    }
+
+    Interval Negate(const Interval& interval)
+    {
+        return { -interval.high, -interval.low, false, false };
+    }
+
+    Interval Multiply(const Interval& left, const Interval& right)
+    {
+        // 0 * inf only appears when one operand is exactly 0 at that bound and the other is unbounded, the product is 0
+        double products[] = { left.low * right.low, left.low * right.high, left.high * right.low, left.high * right.high };
+        for (double& product : products)
+        {
+            if (isnan(product))
+            {
+                product = 0;
+            }
+        }
+        return { *min_element(begin(products), end(products)), *max_element(begin(products), end(products)), false, false };
+    }
+
+    Interval Divide(const Interval& left, const Interval& right)
+    {
+        if (!ContainsZero(right))
+        {
+            return Multiply(left, Hull(1 / right.low, 1 / right.high));
+        }
+        if (right.low == 0 && right.high == 0)
+        {
+            return Interval::Empty();
+        }
+        return Jump(Undefined(Interval::Entire()));
+    }
+
+    Interval Abs(const Interval& interval)
+    {
+        if (interval.low >= 0)
+        {
+            return interval;
+        }
+        if (interval.high <= 0)
+        {
+            return Negate(interval);
+        }
+        return { 0, max(-interval.low, interval.high), false, false };
+    }
+
+    // Functions that are constant between steps
+    template <typename Function>
+    Interval Step(const Interval& interval, Function function)
+    {
+        Interval result = Hull(function(interval.low), function(interval.high));
+        result.mayJump = result.low != result.high;
+        return result;
+    }
+
+    template <typename Function>
+    Interval Monotonic(const Interval& interval, Function function)
+    {
+        return Hull(function(interval.low), function(interval.high));
+    }
+
+    // Monotonic functions defined on [domainLow, domainHigh]
+    template <typename Function>
+    Interval MonotonicOn(const Interval& interval, double domainLow, double domainHigh, Function function)
+    {
+        if (interval.high < domainLow || interval.low > domainHigh)
+        {
+            return Interval::Empty();
+        }
+
+        Interval result = Hull(function(max(interval.low, domainLow)), function(min(interval.high, domainHigh)));
+        result.mayBeUndefined = interval.low < domainLow || interval.high > domainHigh;
+        return result;
+    }
+
+    // Whether at + 2k pi is in [low, high] for some integer k
+    bool ContainsPeriodic(double low, double high, double at)
+    {
+        return at + 2 * s_pi * ceil((low - at) / (2 * s_pi)) <= high;
+    }
+
+    // Sin and cos reach 1 at maximumAt + 2k pi and -1 half a period later
+    template <typename Function>
+    Interval Periodic(const Interval& interval, double maximumAt, Function function)
+    {
+        if (!(interval.high - interval.low < 2 * s_pi))
+        {
+            return { -1, 1, false, false };
+        }
+
+        Interval result = Monotonic(interval, function);
+        if (ContainsPeriodic(interval.low, interval.high, maximumAt))
+        {
+            result.high = 1;
+        }
+        if (ContainsPeriodic(interval.low, interval.high, maximumAt + s_pi))
+        {
+            result.low = -1;
+        }
+        return result;
+    }
+
+    Interval Tan(const Interval& interval)
+    {
+        // The poles are at (k + 1/2) pi
+        if (!(interval.high - interval.low < s_pi) || floor(interval.low / s_pi + 0.5) != floor(interval.high / s_pi + 0.5))
+        {
+            return Jump(Interval::Entire());
+        }
+        return Monotonic(interval, [](double value) { return tan(value); });
+    }
+
+    // x^exponent for a constant exponent, as pow computes it
+    Interval PowerOf(const Interval& base, double exponent)
+    {
+        auto power = [exponent](double value) { return pow(value, exponent); };
+        if (exponent == 0)
+        {
+            return Interval::Point(1);
+        }
+
+        if (exponent != floor(exponent))
+        {
+            // A fractional power of a negative number is NaN, the pole of a negative power at 0 is at the edge of the domain
+            return MonotonicOn(base, 0, s_infinity, power);
+        }
+
+        const bool isEven = fmod(exponent, 2) == 0;
+        if (exponent > 0)
+        {
+            return Monotonic(isEven ? Abs(base) : base, power);
+        }
+        if (!ContainsZero(base))
+        {
+            return Monotonic(base, power);
+        }
+        if (base.low == 0 && base.high == 0)
+        {
+            return Interval::Empty();
+        }
+
+        // A pole at 0, an even power goes to +inf on both sides
+        Interval result = Jump(Undefined(Interval::Entire()));
+        if (isEven)
+        {
+            result.low = min(power(base.low), power(base.high));
+        }
+        return result;
+    }
+
+    Interval Power(const Interval& base, const Interval& exponent)
+    {
+        if (exponent.low == exponent.high)
+        {
+            return PowerOf(base, exponent.low);
+        }
+        if (base.low > 0)
+        {
+            Interval logarithm = Monotonic(base, [](double value) { return log(value); });
+            return Monotonic(Multiply(exponent, logarithm), [](double value) { return exp(value); });
+        }
+        return Jump(Undefined(Interval::Entire()));
+    }
+
+    // sign(x) |x|^exponent, the exponents of real odd roots
+    Interval SignedPower(const Interval& base, const Interval& exponent)
+    {
+        const double value = exponent.low;
+        auto power = [value](double x) { return copysign(pow(fabs(x), value), x); };
+        if (exponent.low != exponent.high || (value <= 0 && ContainsZero(base)))
+        {
+            return Jump(Undefined(Interval::Entire()));
+        }
+        return Monotonic(base, power);
+    }
+
+    // |x|^exponent, the exponents of real even roots
+    Interval AbsPower(const Interval& base, const Interval& exponent)
+    {
+        if (exponent.low != exponent.high)
+        {
+            return Jump(Undefined(Interval::Entire()));
+        }
+
+        const double value = exponent.low;
+        auto power = [value](double x) { return pow(x, value); };
+        Interval magnitude = Abs(base);
+        if (value >= 0 || magnitude.low > 0)
+        {
+            return Monotonic(magnitude, power);
+        }
+        if (magnitude.high == 0)
+        {
+            return Interval::Empty();
+        }
+        return Jump(Undefined(Interval{ power(magnitude.high), s_infinity, false, false }));
+    }
+
+    Interval Cosh(const Interval& interval)
+    {
+        auto function = [](double value) { return cosh(value); };
+        if (ContainsZero(interval))
+        {
+            return { 1, max(function(interval.low), function(interval.high)), false, false };
+        }
+        return Monotonic(interval, function);
+    }
+
+    Interval Gamma(const Interval& interval)
+    {
+        auto function = [](double value) { return tgamma(value); };
+        if (interval.low > 0)
+        {
+            if (interval.low < s_gammaMinimumAt && interval.high > s_gammaMinimumAt)
+            {
+                return { s_gammaMinimum, max(function(interval.low), function(interval.high)), false, false };
+            }
+            return Monotonic(interval, function);
+        }
+
+        // Between two poles on the negative side gamma is continuous but not monotonic
+        if (interval.high < 0 && interval.low != floor(interval.low) && floor(interval.low) == floor(interval.high))
+        {
+            return Interval::Entire();
+        }
+        return Jump(Undefined(Interval::Entire()));
+    }
+
+    Interval Bounds(OpCode op, const Interval& left, const Interval& right)
+    {
+        switch (op)
+        {
+        case OpCode::Add:
+            return Add(left, right);
+        case OpCode::Subtract:
+            return Add(left, Negate(right));
+        case OpCode::Multiply:
+            return Multiply(left, right);
+        case OpCode::Divide:
+            return Divide(left, right);
+        case OpCode::Negate:
+            return Negate(left);
+        case OpCode::Power:
+            return Power(left, right);
+        case OpCode::SignedPower:
+            return SignedPower(left, right);
+        case OpCode::AbsPower:
+            return AbsPower(left, right);
+        case OpCode::Sqrt:
+            return MonotonicOn(left, 0, s_infinity, [](double value) { return sqrt(value); });
+        case OpCode::Abs:
+            return Abs(left);
+        case OpCode::Sign:
+            return Step(left, [](double value) { return Apply(OpCode::Sign, value, value); });
+        case OpCode::Floor:
+            return Step(left, [](double value) { return floor(value); });
+        case OpCode::Ceiling:
+            return Step(left, [](double value) { return ceil(value); });
+        case OpCode::Round:
+            return Step(left, [](double value) { return round(value); });
+        case OpCode::Exp:
+            return Monotonic(left, [](double value) { return exp(value); });
+        case OpCode::Ln:
+            // ln(0) is -inf, which the graph does not draw
+            return MonotonicOn(left, numeric_limits<double>::denorm_min(), s_infinity, [](double value) { return log(value); });
+        case OpCode::Log10:
+            return MonotonicOn(left, numeric_limits<double>::denorm_min(), s_infinity, [](double value) { return log10(value); });
+        case OpCode::Sin:
+            return Periodic(left, s_pi / 2, [](double value) { return sin(value); });
+        case OpCode::Cos:
+            return Periodic(left, 0, [](double value) { return cos(value); });
+        case OpCode::Tan:
+            return Tan(left);
+        case OpCode::Asin:
+            return MonotonicOn(left, -1, 1, [](double value) { return asin(value); });
+        case OpCode::Acos:
+            return MonotonicOn(left, -1, 1, [](double value) { return acos(value); });
+        case OpCode::Atan:
+            return Monotonic(left, [](double value) { return atan(value); });
+        case OpCode::Sinh:
+            return Monotonic(left, [](double value) { return sinh(value); });
+        case OpCode::Cosh:
+            return Cosh(left);
+        case OpCode::Tanh:
+            return Monotonic(left, [](double value) { return tanh(value); });
+        case OpCode::Asinh:
+            return Monotonic(left, [](double value) { return asinh(value); });
+        case OpCode::Acosh:
+            return MonotonicOn(left, 1, s_infinity, [](double value) { return acosh(value); });
+        case OpCode::Atanh:
+            return MonotonicOn(left, nextafter(-1.0, 0.0), nextafter(1.0, 0.0), [](double value) { return atanh(value); });
+        case OpCode::Min:
+            return { min(left.low, right.low), min(left.high, right.high), false, false };
+        case OpCode::Max:
+            return { max(left.low, right.low), max(left.high, right.high), false, false };
+        case OpCode::Gamma:
+            return Gamma(left);
+        }
+        return Jump(Undefined(Interval::Entire()));
+    }
+
+    Interval Union(const Interval& first, const Interval& second)
+    {
+        return { min(first.low, second.low), max(first.high, second.high), false, false };
+    }
+
+    Interval Square(const Interval& interval)
+    {
+        return PowerOf(interval, 2);
+    }
+
+    // Bounds of the derivative of the instruction from the bounds of its operands, their derivatives and its value. Steps
+    // have a zero derivative and |x|, min and max take the derivatives of both sides at a kink, which is only valid where
+    // the value neither jumps nor leaves the domain.
+    Interval Slope(OpCode op, const Interval& left, const Interval& right, const Interval& leftSlope, const Interval& rightSlope, const Interval& value)
+    {
+        const Interval one = Interval::Point(1);
+        switch (op)
+        {
+        case OpCode::Add:
+            return Add(leftSlope, rightSlope);
+        case OpCode::Subtract:
+            return Add(leftSlope, Negate(rightSlope));
+        case OpCode::Multiply:
+            return Add(Multiply(leftSlope, right), Multiply(left, rightSlope));
+        case OpCode::Divide:
+            return Divide(Add(leftSlope, Negate(Multiply(value, rightSlope))), right);
+        case OpCode::Negate:
+            return Negate(leftSlope);
+        case OpCode::Power:
+            if (right.low == right.high)
+            {
+                return Multiply(Multiply(Interval::Point(right.low), PowerOf(left, right.low - 1)), leftSlope);
+            }
+            return Multiply(value, Add(Multiply(rightSlope, Bounds(OpCode::Ln, left, left)), Multiply(right, Divide(leftSlope, left))));
+        case OpCode::SignedPower:
+            return Multiply(Multiply(right, AbsPower(left, Add(right, Negate(one)))), leftSlope);
+        case OpCode::AbsPower:
+            return Multiply(Multiply(right, SignedPower(left, Add(right, Negate(one)))), leftSlope);
+        case OpCode::Sqrt:
+            return Divide(leftSlope, Multiply(Interval::Point(2), value));
+        case OpCode::Abs:
+            return Multiply(Step(left, [](double x) { return Apply(OpCode::Sign, x, x); }), leftSlope);
+        case OpCode::Sign:
+        case OpCode::Floor:
+        case OpCode::Ceiling:
+        case OpCode::Round:
+            return Interval::Point(0);
+        case OpCode::Exp:
+            return Multiply(value, leftSlope);
+        case OpCode::Ln:
+            return Divide(leftSlope, left);
+        case OpCode::Log10:
+            return Divide(leftSlope, Multiply(left, Interval::Point(log(10.0))));
+        case OpCode::Sin:
+            return Multiply(Bounds(OpCode::Cos, left, left), leftSlope);
+        case OpCode::Cos:
+            return Multiply(Negate(Bounds(OpCode::Sin, left, left)), leftSlope);
+        case OpCode::Tan:
+            return Multiply(Add(one, Square(value)), leftSlope);
+        case OpCode::Asin:
+            return Divide(leftSlope, Bounds(OpCode::Sqrt, Add(one, Negate(Square(left))), one));
+        case OpCode::Acos:
+            return Negate(Divide(leftSlope, Bounds(OpCode::Sqrt, Add(one, Negate(Square(left))), one)));
+        case OpCode::Atan:
+            return Divide(leftSlope, Add(one, Square(left)));
+        case OpCode::Sinh:
+            return Multiply(Cosh(left), leftSlope);
+        case OpCode::Cosh:
+            return Multiply(Bounds(OpCode::Sinh, left, left), leftSlope);
+        case OpCode::Tanh:
+            return Multiply(Add(one, Negate(Square(value))), leftSlope);
+        case OpCode::Asinh:
+            return Divide(leftSlope, Bounds(OpCode::Sqrt, Add(Square(left), one), one));
+        case OpCode::Acosh:
+            return Divide(leftSlope, Bounds(OpCode::Sqrt, Add(Square(left), Negate(one)), one));
+        case OpCode::Atanh:
+            return Divide(leftSlope, Add(one, Negate(Square(left))));
+        case OpCode::Min:
+            return left.high <= right.low ? leftSlope : right.high <= left.low ? rightSlope : Union(leftSlope, rightSlope);
+        case OpCode::Max:
+            return left.low >= right.high ? leftSlope : right.low >= left.high ? rightSlope : Union(leftSlope, rightSlope);
+        case OpCode::Gamma:
+            break;
+        }
+        return Interval::Entire();
+    }
+}
+
+Interval Interval::Point(double value)
+{
+    return { value, value, false, false };
+}
+
+Interval Interval::Entire()
+{
+    return { -s_infinity, s_infinity, false, false };
+}
+
+Interval Interval::Empty()
+{
+    return { s_infinity, -s_infinity, true, false };
+}
+
+Interval NativeGraphingImpl::Apply(OpCode op, const Interval& left, const Interval& right)
+{
+    // Unary instructions have right == left, so their flags are not mixed with anything else
+    Interval result = left.IsEmpty() || right.IsEmpty() ? Interval::Empty() : Bounds(op, left, right);
+    result.mayBeUndefined = result.mayBeUndefined || left.mayBeUndefined || right.mayBeUndefined;
+    result.mayJump = result.mayJump || left.mayJump || right.mayJump;
+    return result;
+}
+
+IntervalEvaluator::IntervalEvaluator(const Program& program)
+    : m_program(program)
+    , m_registers(program.RegisterCount(), Interval::Entire())
+    , m_slopes(program.RegisterCount(), Interval::Point(0))
+{
+    const auto& constants = program.Constants();
+    for (size_t i = 0; i < constants.size(); i++)
+    {
+        m_registers[i] = Interval::Point(constants[i]);
+    }
+}
+
+Interval IntervalEvaluator::Evaluate(const double* arguments, size_t sweepSlot, double low, double high, Interval& slope)
+{
+    for (const auto& [slot, reg] : m_program.ArgumentRegisters())
+    {
+        const bool isSweep = slot == sweepSlot;
+        m_registers[reg] = isSweep ? Interval{ low, high, false, false } : Interval::Point(arguments[slot]);
+        m_slopes[reg] = Interval::Point(isSweep ? 1 : 0);
+    }
+
+    for (const Instruction& instruction : m_program.Instructions())
+    {
+        // The target can be one of the operands
+        const Interval left = m_registers[instruction.left];
+        const Interval right = m_registers[instruction.right];
+        const Interval value = Apply(instruction.op, left, right);
+        m_slopes[instruction.target] = Slope(instruction.op, left, right, m_slopes[instruction.left], m_slopes[instruction.right], value);
+        m_registers[instruction.target] = value;
+    }
+
+    slope = m_slopes[m_program.ResultRegister()];
+    return m_registers[m_program.ResultRegister()];
+}
@@ -0,0 +1,64 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cmath>
+#include "Program.h"
+
+namespace NativeGraphingImpl
+{
+    // Bounds of a value over a range of inputs. The bounds are not rounded outwards, they can miss the true range by a
+    // few units in the last place, which is far below what a graph can show.
+    struct Interval
+    {
+        double low;
+        double high;
+
+        // Part of the inputs is outside the domain, such as the square root of [-1, 4]
+        bool mayBeUndefined;
+
+        // The value may not be continuous over the inputs: a pole, a step of floor or sign, or a branch of tan
+        bool mayJump;
+
+        static Interval Point(double value);
+        static Interval Entire();
+        static Interval Empty();
+
+        // None of the inputs has a defined value
+        bool IsEmpty() const
+        {
+            return !(low <= high);
+        }
+
+        bool IsBounded() const
+        {
+            return std::isfinite(low) && std::isfinite(high);
+        }
+    };
+
+    // The instruction applied to every value in the operands
+    Interval Apply(OpCode op, const Interval& left, const Interval& right);
+
+    // Evaluates a program over a range of one argument with interval arithmetic. The bounds are conservative: every value
+    // the program takes over the range is inside them, and a jump over the range is always reported, but both can be
+    // reported when the function is in fact smooth, since the operands of an instruction are bounded independently.
+    //
+    // The derivative with respect to the argument is bounded along with the value. Where the function is continuous, the
+    // mean value theorem turns it into bounds that overestimate by the square of the range instead of the range itself.
+    class IntervalEvaluator
+    {
+    public:
+        // program must outlive the evaluator
+        explicit IntervalEvaluator(const Program& program);
+
+        // arguments is indexed by slot as for Program::Evaluate, the value in sweepSlot ranges over [low, high]. slope
+        // receives the bounds of the derivative, which only hold where the result can neither jump nor be undefined.
+        Interval Evaluate(const double* arguments, size_t sweepSlot, double low, double high, Interval& slope);
+
+    private:
+        const Program& m_program;
+        std::vector<Interval> m_registers;
+        std::vector<Interval> m_slopes;
+    };
+}
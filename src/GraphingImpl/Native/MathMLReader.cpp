@@ -0,0 +1,499 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "MathMLReader.h"
+#include "GraphingErrors.h"
+#include <algorithm>
+#include <cwchar>
+#include <cwctype>
+#include <vector>
+
+using namespace std;
+using namespace NativeGraphingImpl;
+
+namespace
+{
+    struct Element
+    {
+        wstring name;
+        wstring text;
+        vector<pair<wstring, wstring>> attributes;
+        vector<Element> children;
+
+        const wstring* FindAttribute(const wchar_t* attributeName) const
+        {
+            for (const auto& attribute : attributes)
+            {
+                if (attribute.first == attributeName)
+                {
+                    return &attribute.second;
+                }
+            }
+            return nullptr;
+        }
+
+        bool IsToken() const
+        {
+            return name == L"mi" || name == L"mn" || name == L"mo";
+        }
+    };
+
+    struct NamedEntity
+    {
+        const wchar_t* name;
+        wchar_t value;
+    };
+
+    constexpr NamedEntity s_entities[] = {
+        { L"lt", L'<' },          { L"gt", L'>' },         { L"amp", L'&' },           { L"quot", L'"' },
+        { L"apos", L'\'' },       { L"nbsp", L'\xA0' },    { L"minus", L'\x2212' },    { L"times", L'\xD7' },
+        { L"divide", L'\xF7' },   { L"middot", L'\xB7' },  { L"pi", L'\x3C0' },        { L"le", L'\x2264' },
+        { L"ge", L'\x2265' },     { L"leq", L'\x2264' },   { L"geq", L'\x2265' },      { L"InvisibleTimes", L'\x2062' },
+        { L"it", L'\x2062' },     { L"ApplyFunction", L'\x2061' }, { L"af", L'\x2061' }, { L"Sqrt", L'\x221A' },
+    };
+
+    class MarkupReader
+    {
+    public:
+        explicit MarkupReader(const wstring& markup)
+            : m_markup(markup)
+            , m_position(0)
+        {
+        }
+
+        Element ReadDocument()
+        {
+            SkipMisc();
+            Element root = ReadElement();
+            SkipMisc();
+            if (m_position != m_markup.size())
+            {
+                throw SyntaxError(SyntaxErrorCode::InvalidToken);
+            }
+            return root;
+        }
+
+    private:
+        [[noreturn]] static void Fail()
+        {
+            throw SyntaxError(SyntaxErrorCode::InvalidToken);
+        }
+
+        bool At(const wchar_t* text) const
+        {
+            return m_markup.compare(m_position, wcslen(text), text) == 0;
+        }
+
+        void SkipSpace()
+        {
+            while (m_position < m_markup.size() && iswspace(m_markup[m_position]))
+            {
+                m_position++;
+            }
+        }
+
+        void SkipPast(const wchar_t* terminator)
+        {
+            size_t end = m_markup.find(terminator, m_position);
+            if (end == wstring::npos)
+            {
+                Fail();
+            }
+            m_position = end + wcslen(terminator);
+        }
+
+        // Skips white space, the XML declaration and comments
+        void SkipMisc()
+        {
+            while (true)
+            {
+                SkipSpace();
+                if (At(L"<?"))
+                {
+                    SkipPast(L"?>");
+                }
+                else if (At(L"<!--"))
+                {
+                    SkipPast(L"-->");
+                }
+                else
+                {
+                    return;
+                }
+            }
+        }
+
+        wstring ReadName()
+        {
+            size_t start = m_position;
+            while (m_position < m_markup.size() && (iswalnum(m_markup[m_position]) || wcschr(L"_-.:", m_markup[m_position]) != nullptr))
+            {
+                m_position++;
+            }
+            if (start == m_position)
+            {
+                Fail();
+            }
+            return m_markup.substr(start, m_position - start);
+        }
+
+        static wstring LocalName(const wstring& name)
+        {
+            size_t colon = name.find(L':');
+            return colon == wstring::npos ? name : name.substr(colon + 1);
+        }
+
+        void AppendEntity(wstring& text)
+        {
+            size_t end = m_markup.find(L';', m_position);
+            if (end == wstring::npos)
+            {
+                Fail();
+            }
+
+            wstring entity = m_markup.substr(m_position + 1, end - m_position - 1);
+            m_position = end + 1;
+
+            if (entity.size() > 1 && entity[0] == L'#')
+            {
+                bool isHex = entity[1] == L'x' || entity[1] == L'X';
+                wchar_t* parsedEnd = nullptr;
+                unsigned long value = wcstoul(entity.c_str() + (isHex ? 2 : 1), &parsedEnd, isHex ? 16 : 10);
+                if (*parsedEnd != L'\0' || value == 0 || value > 0xFFFF)
+                {
+                    Fail();
+                }
+                text += static_cast<wchar_t>(value);
+                return;
+            }
+
+            for (const auto& named : s_entities)
+            {
+                if (entity == named.name)
+                {
+                    text += named.value;
+                    return;
+                }
+            }
+            Fail();
+        }
+
+        Element ReadElement()
+        {
+            if (!At(L"<"))
+            {
+                Fail();
+            }
+            m_position++;
+
+            Element element;
+            wstring qualifiedName = ReadName();
+            element.name = LocalName(qualifiedName);
+
+            while (true)
+            {
+                SkipSpace();
+                if (At(L"/>"))
+                {
+                    m_position += 2;
+                    return element;
+                }
+                if (At(L">"))
+                {
+                    m_position++;
+                    break;
+                }
+
+                wstring attributeName = LocalName(ReadName());
+                SkipSpace();
+                if (!At(L"="))
+                {
+                    Fail();
+                }
+                m_position++;
+                SkipSpace();
+
+                wchar_t quote = m_position < m_markup.size() ? m_markup[m_position] : L'\0';
+                if (quote != L'"' && quote != L'\'')
+                {
+                    Fail();
+                }
+                m_position++;
+
+                wstring value;
+                while (m_position < m_markup.size() && m_markup[m_position] != quote)
+                {
+                    if (m_markup[m_position] == L'&')
+                    {
+                        AppendEntity(value);
+                    }
+                    else
+                    {
+                        value += m_markup[m_position++];
+                    }
+                }
+                if (m_position >= m_markup.size())
+                {
+                    Fail();
+                }
+                m_position++;
+                element.attributes.emplace_back(move(attributeName), move(value));
+            }
+
+            while (true)
+            {
+                if (m_position >= m_markup.size())
+                {
+                    Fail();
+                }
+                if (At(L"</"))
+                {
+                    m_position += 2;
+                    if (ReadName() != qualifiedName)
+                    {
+                        Fail();
+                    }
+                    SkipSpace();
+                    if (!At(L">"))
+                    {
+                        Fail();
+                    }
+                    m_position++;
+                    return element;
+                }
+                if (At(L"<!--"))
+                {
+                    SkipPast(L"-->");
+                }
+                else if (At(L"<"))
+                {
+                    element.children.push_back(ReadElement());
+                }
+                else if (m_markup[m_position] == L'&')
+                {
+                    AppendEntity(element.text);
+                }
+                else
+                {
+                    element.text += m_markup[m_position++];
+                }
+            }
+        }
+
+        const wstring& m_markup;
+        size_t m_position;
+    };
+
+    wstring Trim(const wstring& text)
+    {
+        size_t start = 0;
+        size_t end = text.size();
+        while (start < end && iswspace(text[start]))
+        {
+            start++;
+        }
+        while (end > start && iswspace(text[end - 1]))
+        {
+            end--;
+        }
+        return text.substr(start, end - start);
+    }
+
+    class LinearEmitter
+    {
+    public:
+        explicit LinearEmitter(wchar_t listSeparator)
+            : m_listSeparator(listSeparator)
+        {
+        }
+
+        void Emit(const Element& element)
+        {
+            const wstring& name = element.name;
+            if (element.IsToken())
+            {
+                m_text += Trim(element.text);
+                m_text += L' ';
+            }
+            else if (name == L"math" || name == L"mrow" || name == L"mstyle" || name == L"mpadded")
+            {
+                EmitChildren(element);
+            }
+            else if (name == L"semantics")
+            {
+                if (!element.children.empty())
+                {
+                    Emit(element.children[0]);
+                }
+            }
+            else if (name == L"mfenced")
+            {
+                EmitFenced(element);
+            }
+            else if (name == L"mfrac")
+            {
+                RequireChildren(element, 2);
+                m_text += L"((";
+                Emit(element.children[0]);
+                m_text += L")/(";
+                Emit(element.children[1]);
+                m_text += L"))";
+            }
+            else if (name == L"msup")
+            {
+                RequireChildren(element, 2);
+                EmitBase(element.children[0]);
+                EmitExponent(element.children[1]);
+            }
+            else if (name == L"msub" || name == L"msubsup")
+            {
+                RequireChildren(element, name == L"msub" ? 2 : 3);
+                EmitSubscript(element.children[0], element.children[1]);
+                if (name == L"msubsup")
+                {
+                    EmitExponent(element.children[2]);
+                }
+            }
+            else if (name == L"msqrt")
+            {
+                m_text += L"sqrt(";
+                EmitChildren(element);
+                m_text += L')';
+            }
+            else if (name == L"mroot")
+            {
+                RequireChildren(element, 2);
+                m_text += L"((";
+                Emit(element.children[0]);
+                m_text += L")^(1/(";
+                Emit(element.children[1]);
+                m_text += L")))";
+            }
+            else if (name == L"mspace" || name == L"mtext" || name == L"annotation" || name == L"annotation-xml")
+            {
+                m_text += L' ';
+            }
+            else
+            {
+                throw SyntaxError(SyntaxErrorCode::InvalidToken);
+            }
+        }
+
+        wstring& Text()
+        {
+            return m_text;
+        }
+
+    private:
+        static void RequireChildren(const Element& element, size_t count)
+        {
+            if (element.children.size() != count)
+            {
+                throw SyntaxError(SyntaxErrorCode::InvalidToken);
+            }
+        }
+
+        void EmitChildren(const Element& element)
+        {
+            for (const auto& child : element.children)
+            {
+                Emit(child);
+            }
+        }
+
+        void EmitFenced(const Element& element)
+        {
+            const wstring* open = element.FindAttribute(L"open");
+            const wstring* close = element.FindAttribute(L"close");
+            const wstring* separatorsAttribute = element.FindAttribute(L"separators");
+
+            wstring separators;
+            if (separatorsAttribute == nullptr)
+            {
+                separators = m_listSeparator;
+            }
+            else
+            {
+                for (wchar_t ch : *separatorsAttribute)
+                {
+                    if (!iswspace(ch))
+                    {
+                        separators += ch;
+                    }
+                }
+            }
+
+            m_text += open != nullptr ? *open : L"(";
+            for (size_t i = 0; i < element.children.size(); i++)
+            {
+                if (i > 0 && !separators.empty())
+                {
+                    m_text += separators[min(i - 1, separators.size() - 1)];
+                }
+                Emit(element.children[i]);
+            }
+            m_text += close != nullptr ? *close : L")";
+        }
+
+        void EmitBase(const Element& base)
+        {
+            // A token base stays bare so that a function name keeps its power, as in sin^2 x
+            if (base.IsToken())
+            {
+                Emit(base);
+            }
+            else
+            {
+                m_text += L'(';
+                Emit(base);
+                m_text += L')';
+            }
+        }
+
+        void EmitExponent(const Element& exponent)
+        {
+            m_text += L"^(";
+            Emit(exponent);
+            m_text += L')';
+        }
+
+        void EmitSubscript(const Element& base, const Element& subscript)
+        {
+            if (!base.IsToken())
+            {
+                throw SyntaxError(SyntaxErrorCode::InvalidVariableNameFormat);
+            }
+
+            m_text += Trim(base.text);
+            m_text += L'_';
+            if (subscript.IsToken())
+            {
+                m_text += Trim(subscript.text);
+                m_text += L' ';
+            }
+            else
+            {
+                m_text += L'(';
+                Emit(subscript);
+                m_text += L')';
+            }
+        }
+
+        wchar_t m_listSeparator;
+        wstring m_text;
+    };
+}
+
+namespace NativeGraphingImpl
+{
+    wstring ConvertMathMLToLinear(const wstring& mathML, wchar_t listSeparator)
+    {
+        MarkupReader reader(mathML);
+        Element root = reader.ReadDocument();
+
+        LinearEmitter emitter(listSeparator);
+        emitter.Emit(root);
+        return move(emitter.Text());
+    }
+}
@@ -0,0 +1,15 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <string>
+
+namespace NativeGraphingImpl
+{
+    // Converts the presentation MathML subset the equation editor and GraphControl produce (math, mrow, mi, mn, mo,
+    // mfenced, mfrac, msup, msub, msubsup, msqrt, mroot) into linear syntax for ExpressionParser. Token elements are
+    // followed by a space so that adjacent identifiers are never read as one name. Namespace prefixes are ignored.
+    // Malformed markup throws a syntax GraphingError.
+    std::wstring ConvertMathMLToLinear(const std::wstring& mathML, wchar_t listSeparator);
+}
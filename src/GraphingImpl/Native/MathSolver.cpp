@@ -0,0 +1,142 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "MathSolver.h"
+#include "ExpressionParser.h"
+#include "Graph.h"
+#include "GraphingErrors.h"
+#include "MathMLReader.h"
+#include <atomic>
+
+using namespace std;
+using namespace Graphing;
+using namespace NativeGraphingImpl;
+
+namespace
+{
+    atomic<unsigned int> s_nextExpressionID{ 1 };
+}
+
+namespace Graphing
+{
+    unique_ptr<IMathSolver> IMathSolver::CreateMathSolver()
+    {
+        return make_unique<NativeGraphingImpl::MathSolver>();
+    }
+}
+
+namespace NativeGraphingImpl
+{
+    wchar_t GetDecimalSeparator(LocalizationType type)
+    {
+        return type == LocalizationType::DecimalCommaAndListSemicolon ? L',' : L'.';
+    }
+
+    wchar_t GetListSeparator(LocalizationType type)
+    {
+        return type == LocalizationType::DecimalCommaAndListSemicolon || type == LocalizationType::DecimalPointAndListSemicolon ? L';' : L',';
+    }
+}
+
+Expression::Expression(vector<ParsedEquation> equations, EvalTrigUnitMode trigUnitMode)
+    : m_equations(move(equations))
+    , m_trigUnitMode(trigUnitMode)
+    , m_id(s_nextExpressionID++)
+{
+}
+
+unique_ptr<IExpression> MathSolver::ParseInput(const wstring& input, int& errorCodeOut, int& errorTypeOut)
+{
+    LocalizationType localization = m_parsingOptions.GetLocalizationType();
+    wchar_t decimalSeparator = GetDecimalSeparator(localization);
+    wchar_t listSeparator = GetListSeparator(localization);
+
+    try
+    {
+        wstring linear;
+        switch (m_parsingOptions.GetFormatType())
+        {
+        case FormatType::MathML:
+            linear = ConvertMathMLToLinear(input, listSeparator);
+            break;
+        case FormatType::MathMLNoWrapper:
+            linear = ConvertMathMLToLinear(L"<mrow>" + input + L"</mrow>", listSeparator);
+            break;
+        default:
+            linear = input;
+            break;
+        }
+
+        ExpressionParser parser(decimalSeparator, listSeparator);
+        return make_unique<Expression>(parser.Parse(linear), m_evalOptions.GetTrigUnitMode());
+    }
+    catch (const GraphingError& error)
+    {
+        errorCodeOut = error.code;
+        errorTypeOut = static_cast<int>(error.type);
+        return nullptr;
+    }
+}
+
+void MathSolver::HRErrorToErrorInfo(HRESULT hr, int& errorCodeOut, int& errorTypeOut)
+{
+    GraphingError error;
+    if (!TryHResultToError(hr, error))
+    {
+        error = GraphingError{ ErrorType::Evaluation, EvaluationErrorCode::GeneralError };
+    }
+
+    errorCodeOut = error.code;
+    errorTypeOut = static_cast<int>(error.type);
+}
+
+shared_ptr<IGraph> MathSolver::CreateGrapher(const IExpression* expression)
+{
+    auto graph = make_shared<Graph>();
+    if (expression != nullptr)
+    {
+        graph->TryInitialize(expression);
+    }
+    return graph;
+}
+
+shared_ptr<IGraph> MathSolver::CreateGrapher()
+{
+    return make_shared<Graph>();
+}
+
+wstring MathSolver::Serialize(const IExpression* expression)
+{
+    auto nativeExpression = dynamic_cast<const Expression*>(expression);
+    if (nativeExpression == nullptr)
+    {
+        return L"";
+    }
+
+    LocalizationType localization = m_formatOptions.GetLocalizationType();
+    wchar_t decimalSeparator = GetDecimalSeparator(localization);
+    wchar_t listSeparator = GetListSeparator(localization);
+
+    switch (m_formatOptions.GetFormatType())
+    {
+    case FormatType::MathML:
+    case FormatType::MathMLNoWrapper:
+        return FormatMathML(
+            nativeExpression->GetEquations(),
+            m_formatOptions.GetMathMLPrefix(),
+            m_formatOptions.GetFormatType() == FormatType::MathML,
+            decimalSeparator,
+            listSeparator);
+    case FormatType::Linear:
+        return FormatLinear(nativeExpression->GetEquations(), FormatType::Linear, decimalSeparator, listSeparator);
+    default:
+        // The other formats belong to the full math engine, linear input is the closest one that still parses back
+        return FormatLinear(nativeExpression->GetEquations(), FormatType::LinearInput, decimalSeparator, listSeparator);
+    }
+}
+
+IGraphFunctionAnalysisData MathSolver::Analyze(const Analyzer::IGraphAnalyzer* /* analyzer */)
+{
+    return IGraphFunctionAnalysisData{};
+}
@@ -0,0 +1,184 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "GraphingInterfaces/IMathSolver.h"
+#include "ExpressionTree.h"
+
+namespace NativeGraphingImpl
+{
+    wchar_t GetDecimalSeparator(Graphing::LocalizationType type);
+    wchar_t GetListSeparator(Graphing::LocalizationType type);
+
+    class ParsingOptions : public Graphing::IParsingOptions
+    {
+    public:
+        ParsingOptions()
+            : m_formatType(Graphing::FormatType::MathML)
+            , m_localizationType(Graphing::LocalizationType::DecimalPointAndListComma)
+        {
+        }
+
+        void SetFormatType(Graphing::FormatType type) override
+        {
+            m_formatType = type;
+        }
+
+        void SetLocalizationType(Graphing::LocalizationType value) override
+        {
+            m_localizationType = value;
+        }
+
+        Graphing::FormatType GetFormatType() const
+        {
+            return m_formatType;
+        }
+
+        Graphing::LocalizationType GetLocalizationType() const
+        {
+            return m_localizationType;
+        }
+
+    private:
+        Graphing::FormatType m_formatType;
+        Graphing::LocalizationType m_localizationType;
+    };
+
+    class EvalOptions : public Graphing::IEvalOptions
+    {
+    public:
+        EvalOptions()
+            : m_unit(Graphing::EvalTrigUnitMode::Radians)
+        {
+        }
+
+        Graphing::EvalTrigUnitMode GetTrigUnitMode() const override
+        {
+            return m_unit;
+        }
+        void SetTrigUnitMode(Graphing::EvalTrigUnitMode value) override
+        {
+            m_unit = value;
+        }
+
+    private:
+        Graphing::EvalTrigUnitMode m_unit;
+    };
+
+    class FormatOptions : public Graphing::IFormatOptions
+    {
+    public:
+        FormatOptions()
+            : m_formatType(Graphing::FormatType::MathML)
+            , m_localizationType(Graphing::LocalizationType::DecimalPointAndListComma)
+        {
+        }
+
+        void SetFormatType(Graphing::FormatType type) override
+        {
+            m_formatType = type;
+        }
+
+        void SetMathMLPrefix(const std::wstring& value) override
+        {
+            m_mathMLPrefix = value;
+        }
+
+        void SetLocalizationType(Graphing::LocalizationType value) override
+        {
+            m_localizationType = value;
+        }
+
+        Graphing::FormatType GetFormatType() const
+        {
+            return m_formatType;
+        }
+
+        const std::wstring& GetMathMLPrefix() const
+        {
+            return m_mathMLPrefix;
+        }
+
+        Graphing::LocalizationType GetLocalizationType() const
+        {
+            return m_localizationType;
+        }
+
+    private:
+        Graphing::FormatType m_formatType;
+        std::wstring m_mathMLPrefix;
+        Graphing::LocalizationType m_localizationType;
+    };
+
+    // The parsed input. The trig unit mode is captured at parse time, GraphControl parses again whenever it changes.
+    class Expression : public Graphing::IExpression
+    {
+    public:
+        Expression(std::vector<ParsedEquation> equations, Graphing::EvalTrigUnitMode trigUnitMode);
+
+        unsigned int GetExpressionID() const override
+        {
+            return m_id;
+        }
+
+        bool IsEmptySet() const override
+        {
+            return m_equations.empty();
+        }
+
+        const std::vector<ParsedEquation>& GetEquations() const
+        {
+            return m_equations;
+        }
+
+        Graphing::EvalTrigUnitMode GetTrigUnitMode() const
+        {
+            return m_trigUnitMode;
+        }
+
+    private:
+        std::vector<ParsedEquation> m_equations;
+        Graphing::EvalTrigUnitMode m_trigUnitMode;
+        unsigned int m_id;
+    };
+
+    // Portable implementation of the math engine for graphing. It parses linear syntax and the MathML subset GraphControl
+    // sends, and graphs explicit, inverse and implicit equations and inequalities in x and y with real arithmetic.
+    class MathSolver : public Graphing::IMathSolver
+    {
+    public:
+        Graphing::IParsingOptions& ParsingOptions() override
+        {
+            return m_parsingOptions;
+        }
+
+        Graphing::IEvalOptions& EvalOptions() override
+        {
+            return m_evalOptions;
+        }
+
+        Graphing::IFormatOptions& FormatOptions() override
+        {
+            return m_formatOptions;
+        }
+
+        std::unique_ptr<Graphing::IExpression> ParseInput(const std::wstring& input, int& errorCodeOut, int& errorTypeOut) override;
+
+        void HRErrorToErrorInfo(HRESULT hr, int& errorCodeOut, int& errorTypeOut) override;
+
+        std::shared_ptr<Graphing::IGraph> CreateGrapher(const Graphing::IExpression* expression) override;
+
+        std::shared_ptr<Graphing::IGraph> CreateGrapher() override;
+
+        std::wstring Serialize(const Graphing::IExpression* expression) override;
+
+        // Function analysis is not implemented, graphs have no analyzer so GraphControl reports that analysis could not be performed
+        Graphing::IGraphFunctionAnalysisData Analyze(const Graphing::Analyzer::IGraphAnalyzer* analyzer) override;
+
+    private:
+        NativeGraphingImpl::ParsingOptions m_parsingOptions;
+        NativeGraphingImpl::EvalOptions m_evalOptions;
+        NativeGraphingImpl::FormatOptions m_formatOptions;
+    };
+}
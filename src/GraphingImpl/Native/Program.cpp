@@ -0,0 +1,624 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "Program.h"
+#include "GraphingErrors.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <map>
+#include <tuple>
+
+using namespace std;
+using namespace Graphing;
+using namespace NativeGraphingImpl;
+
+namespace
+{
+    constexpr double Pi = 3.14159265358979323846;
+    constexpr uint16_t MaxRegisters = 0xFFFF;
+
+    // Integer powers up to this are expanded into multiplications
+    constexpr double MaxMultipliedPower = 16;
+
+    bool IsCommutative(OpCode op)
+    {
+        return op == OpCode::Add || op == OpCode::Multiply || op == OpCode::Min || op == OpCode::Max;
+    }
+
+    bool IsMultipliedPower(double value)
+    {
+        return value >= 2 && value <= MaxMultipliedPower && value == floor(value);
+    }
+
+    bool TryGetInteger(const ExpressionNode& node, double& value)
+    {
+        if (node.kind == NodeKind::Number)
+        {
+            value = node.value;
+        }
+        else if (node.kind == NodeKind::Negate && node.operands[0]->kind == NodeKind::Number)
+        {
+            value = -node.operands[0]->value;
+        }
+        else
+        {
+            return false;
+        }
+        return value == floor(value) && fabs(value) < 1e9;
+    }
+}
+
+namespace NativeGraphingImpl
+{
+    bool IsUnary(OpCode op)
+    {
+        switch (op)
+        {
+        case OpCode::Add:
+        case OpCode::Subtract:
+        case OpCode::Multiply:
+        case OpCode::Divide:
+        case OpCode::Power:
+        case OpCode::SignedPower:
+        case OpCode::AbsPower:
+        case OpCode::Min:
+        case OpCode::Max:
+            return false;
+        default:
+            return true;
+        }
+    }
+
+    double Apply(OpCode op, double left, double right)
+    {
+        switch (op)
+        {
+        case OpCode::Add:
+            return left + right;
+        case OpCode::Subtract:
+            return left - right;
+        case OpCode::Multiply:
+            return left * right;
+        case OpCode::Divide:
+            return left / right;
+        case OpCode::Negate:
+            return -left;
+        case OpCode::Power:
+            return pow(left, right);
+        case OpCode::SignedPower:
+            return copysign(pow(fabs(left), right), left);
+        case OpCode::AbsPower:
+            return pow(fabs(left), right);
+        case OpCode::Sqrt:
+            return sqrt(left);
+        case OpCode::Abs:
+            return fabs(left);
+        case OpCode::Sign:
+            return left > 0 ? 1.0 : left < 0 ? -1.0 : left;
+        case OpCode::Floor:
+            return floor(left);
+        case OpCode::Ceiling:
+            return ceil(left);
+        case OpCode::Round:
+            return round(left);
+        case OpCode::Exp:
+            return exp(left);
+        case OpCode::Ln:
+            return log(left);
+        case OpCode::Log10:
+            return log10(left);
+        case OpCode::Sin:
+            return sin(left);
+        case OpCode::Cos:
+            return cos(left);
+        case OpCode::Tan:
+            return tan(left);
+        case OpCode::Asin:
+            return asin(left);
+        case OpCode::Acos:
+            return acos(left);
+        case OpCode::Atan:
+            return atan(left);
+        case OpCode::Sinh:
+            return sinh(left);
+        case OpCode::Cosh:
+            return cosh(left);
+        case OpCode::Tanh:
+            return tanh(left);
+        case OpCode::Asinh:
+            return asinh(left);
+        case OpCode::Acosh:
+            return acosh(left);
+        case OpCode::Atanh:
+            return atanh(left);
+        case OpCode::Min:
+            return fmin(left, right);
+        case OpCode::Max:
+            return fmax(left, right);
+        case OpCode::Gamma:
+            return tgamma(left);
+        }
+        return NAN;
+    }
+
+    class ProgramBuilder
+    {
+    public:
+        ProgramBuilder(const vector<wstring>& argumentNames, EvalTrigUnitMode trigUnitMode)
+            : m_argumentNames(argumentNames)
+            , m_trigUnitMode(trigUnitMode)
+        {
+        }
+
+        Program Build(const ExpressionNode& root)
+        {
+            int result = Lower(root);
+            return Emit(result);
+        }
+
+    private:
+        enum class DagKind : uint8_t
+        {
+            Constant,
+            Argument,
+            Operation
+        };
+
+        struct DagNode
+        {
+            DagKind kind;
+            OpCode op;
+            int left;
+            int right;
+            double constant;
+            size_t slot;
+        };
+
+        // Nodes are identified by their content, constants compare by bit pattern so that 0 and -0 stay apart
+        using DagKey = tuple<DagKind, OpCode, int, int, uint64_t, size_t>;
+
+        int Intern(const DagNode& node)
+        {
+            uint64_t bits = 0;
+            memcpy(&bits, &node.constant, sizeof(bits));
+            DagKey key{ node.kind, node.op, node.left, node.right, bits, node.slot };
+
+            auto found = m_index.find(key);
+            if (found != m_index.end())
+            {
+                return found->second;
+            }
+
+            int id = static_cast<int>(m_nodes.size());
+            m_nodes.push_back(node);
+            m_index.emplace(key, id);
+            return id;
+        }
+
+        int Constant(double value)
+        {
+            return Intern(DagNode{ DagKind::Constant, OpCode::Add, -1, -1, value, 0 });
+        }
+
+        bool IsConstant(int id, double value) const
+        {
+            return m_nodes[id].kind == DagKind::Constant && m_nodes[id].constant == value;
+        }
+
+        int Operation(OpCode op, int left, int right = -1)
+        {
+            const DagNode& leftNode = m_nodes[left];
+            bool unary = IsUnary(op);
+
+            if (leftNode.kind == DagKind::Constant && (unary || m_nodes[right].kind == DagKind::Constant))
+            {
+                return Constant(Apply(op, leftNode.constant, unary ? 0 : m_nodes[right].constant));
+            }
+
+            switch (op)
+            {
+            case OpCode::Add:
+                if (IsConstant(left, 0))
+                {
+                    return right;
+                }
+                if (IsConstant(right, 0))
+                {
+                    return left;
+                }
+                break;
+            case OpCode::Subtract:
+                if (IsConstant(right, 0))
+                {
+                    return left;
+                }
+                if (IsConstant(left, 0))
+                {
+                    return Operation(OpCode::Negate, right);
+                }
+                break;
+            case OpCode::Multiply:
+                if (IsConstant(left, 1))
+                {
+                    return right;
+                }
+                if (IsConstant(right, 1))
+                {
+                    return left;
+                }
+                break;
+            case OpCode::Divide:
+                if (IsConstant(right, 1))
+                {
+                    return left;
+                }
+                break;
+            case OpCode::Power:
+                if (IsConstant(right, 1))
+                {
+                    return left;
+                }
+                if (m_nodes[right].kind == DagKind::Constant && IsMultipliedPower(m_nodes[right].constant))
+                {
+                    return IntegerPower(left, static_cast<int>(m_nodes[right].constant));
+                }
+                if (IsConstant(right, 0.5))
+                {
+                    return Operation(OpCode::Sqrt, left);
+                }
+                if (IsConstant(right, -1))
+                {
+                    return Operation(OpCode::Divide, Constant(1), left);
+                }
+                break;
+            case OpCode::Negate:
+                if (leftNode.kind == DagKind::Operation && leftNode.op == OpCode::Negate)
+                {
+                    return leftNode.left;
+                }
+                break;
+            default:
+                break;
+            }
+
+            if (IsCommutative(op) && right < left)
+            {
+                swap(left, right);
+            }
+            return Intern(DagNode{ DagKind::Operation, op, left, unary ? -1 : right, 0, 0 });
+        }
+
+        // base^exponent by repeated squaring for an exponent of at least 2, cheaper than pow and within an ulp or two of it
+        int IntegerPower(int base, int exponent)
+        {
+            int result = -1;
+            int square = base;
+            while (true)
+            {
+                if ((exponent & 1) != 0)
+                {
+                    result = result < 0 ? square : Operation(OpCode::Multiply, result, square);
+                }
+                exponent >>= 1;
+                if (exponent == 0)
+                {
+                    return result;
+                }
+                square = Operation(OpCode::Multiply, square, square);
+            }
+        }
+
+        int ToRadians(int angle)
+        {
+            switch (m_trigUnitMode)
+            {
+            case EvalTrigUnitMode::Degrees:
+                return Operation(OpCode::Multiply, angle, Constant(Pi / 180));
+            case EvalTrigUnitMode::Grads:
+                return Operation(OpCode::Multiply, angle, Constant(Pi / 200));
+            default:
+                return angle;
+            }
+        }
+
+        int FromRadians(int angle)
+        {
+            switch (m_trigUnitMode)
+            {
+            case EvalTrigUnitMode::Degrees:
+                return Operation(OpCode::Multiply, angle, Constant(180 / Pi));
+            case EvalTrigUnitMode::Grads:
+                return Operation(OpCode::Multiply, angle, Constant(200 / Pi));
+            default:
+                return angle;
+            }
+        }
+
+        int LowerPower(const ExpressionNode& node)
+        {
+            int base = Lower(*node.operands[0]);
+
+            // A fraction with an odd denominator is a real root, (-8)^(1/3) is -2 rather than the NaN pow gives
+            const ExpressionNode& exponent = *node.operands[1];
+            double numerator = 0;
+            double denominator = 0;
+            if (exponent.kind == NodeKind::Divide && TryGetInteger(*exponent.operands[0], numerator)
+                && TryGetInteger(*exponent.operands[1], denominator) && fmod(fabs(denominator), 2) == 1)
+            {
+                OpCode op = fmod(fabs(numerator), 2) == 1 ? OpCode::SignedPower : OpCode::AbsPower;
+                return Operation(op, base, Constant(numerator / denominator));
+            }
+
+            return Operation(OpCode::Power, base, Lower(exponent));
+        }
+
+        int LowerFunction(const ExpressionNode& node)
+        {
+            int argument = Lower(*node.operands[0]);
+            switch (node.function)
+            {
+            case Function::Sin:
+                return Operation(OpCode::Sin, ToRadians(argument));
+            case Function::Cos:
+                return Operation(OpCode::Cos, ToRadians(argument));
+            case Function::Tan:
+                return Operation(OpCode::Tan, ToRadians(argument));
+            case Function::Sec:
+                return Operation(OpCode::Divide, Constant(1), Operation(OpCode::Cos, ToRadians(argument)));
+            case Function::Csc:
+                return Operation(OpCode::Divide, Constant(1), Operation(OpCode::Sin, ToRadians(argument)));
+            case Function::Cot:
+            {
+                int radians = ToRadians(argument);
+                return Operation(OpCode::Divide, Operation(OpCode::Cos, radians), Operation(OpCode::Sin, radians));
+            }
+            case Function::Asin:
+                return FromRadians(Operation(OpCode::Asin, argument));
+            case Function::Acos:
+                return FromRadians(Operation(OpCode::Acos, argument));
+            case Function::Atan:
+                return FromRadians(Operation(OpCode::Atan, argument));
+            case Function::Sinh:
+                return Operation(OpCode::Sinh, argument);
+            case Function::Cosh:
+                return Operation(OpCode::Cosh, argument);
+            case Function::Tanh:
+                return Operation(OpCode::Tanh, argument);
+            case Function::Asinh:
+                return Operation(OpCode::Asinh, argument);
+            case Function::Acosh:
+                return Operation(OpCode::Acosh, argument);
+            case Function::Atanh:
+                return Operation(OpCode::Atanh, argument);
+            case Function::Exp:
+                return Operation(OpCode::Exp, argument);
+            case Function::Ln:
+                return Operation(OpCode::Ln, argument);
+            case Function::Log:
+                return Operation(OpCode::Log10, argument);
+            case Function::Sqrt:
+                return Operation(OpCode::Sqrt, argument);
+            case Function::Abs:
+                return Operation(OpCode::Abs, argument);
+            case Function::Floor:
+                return Operation(OpCode::Floor, argument);
+            case Function::Ceiling:
+                return Operation(OpCode::Ceiling, argument);
+            case Function::Round:
+                return Operation(OpCode::Round, argument);
+            case Function::Sign:
+                return Operation(OpCode::Sign, argument);
+            case Function::Min:
+                return Operation(OpCode::Min, argument, Lower(*node.operands[1]));
+            case Function::Max:
+                return Operation(OpCode::Max, argument, Lower(*node.operands[1]));
+            }
+            throw GraphingError{ ErrorType::Evaluation, EvaluationErrorCode::NotSupported };
+        }
+
+        int Lower(const ExpressionNode& node)
+        {
+            switch (node.kind)
+            {
+            case NodeKind::Number:
+            case NodeKind::Constant:
+                return Constant(node.value);
+            case NodeKind::Variable:
+            {
+                auto found = find(m_argumentNames.begin(), m_argumentNames.end(), node.name);
+                if (found == m_argumentNames.end())
+                {
+                    throw GraphingError{ ErrorType::Evaluation, EvaluationErrorCode::GeneralError };
+                }
+                size_t slot = static_cast<size_t>(found - m_argumentNames.begin());
+                return Intern(DagNode{ DagKind::Argument, OpCode::Add, -1, -1, 0, slot });
+            }
+            case NodeKind::Negate:
+                return Operation(OpCode::Negate, Lower(*node.operands[0]));
+            case NodeKind::Add:
+                return Operation(OpCode::Add, Lower(*node.operands[0]), Lower(*node.operands[1]));
+            case NodeKind::Subtract:
+                return Operation(OpCode::Subtract, Lower(*node.operands[0]), Lower(*node.operands[1]));
+            case NodeKind::Multiply:
+                return Operation(OpCode::Multiply, Lower(*node.operands[0]), Lower(*node.operands[1]));
+            case NodeKind::Divide:
+                return Operation(OpCode::Divide, Lower(*node.operands[0]), Lower(*node.operands[1]));
+            case NodeKind::Power:
+                return LowerPower(node);
+            case NodeKind::Factorial:
+                return Operation(OpCode::Gamma, Operation(OpCode::Add, Lower(*node.operands[0]), Constant(1)));
+            case NodeKind::Function:
+                return LowerFunction(node);
+            }
+            throw GraphingError{ ErrorType::Evaluation, EvaluationErrorCode::NotSupported };
+        }
+
+        Program Emit(int result)
+        {
+            // Nodes are created after their operands, so index order is already a valid evaluation order
+            size_t count = m_nodes.size();
+            vector<bool> live(count, false);
+            vector<size_t> lastUse(count, 0);
+            live[result] = true;
+            for (size_t i = count; i-- > 0;)
+            {
+                const DagNode& node = m_nodes[i];
+                if (!live[i] || node.kind != DagKind::Operation)
+                {
+                    continue;
+                }
+                for (int operand : { node.left, node.right })
+                {
+                    if (operand >= 0)
+                    {
+                        live[operand] = true;
+                        lastUse[operand] = max(lastUse[operand], i);
+                    }
+                }
+            }
+
+            Program program;
+            vector<int> registers(count, -1);
+            for (size_t i = 0; i < count; i++)
+            {
+                if (live[i] && m_nodes[i].kind == DagKind::Constant)
+                {
+                    registers[i] = static_cast<int>(program.m_constants.size());
+                    program.m_constants.push_back(m_nodes[i].constant);
+                }
+            }
+            int nextRegister = static_cast<int>(program.m_constants.size());
+            for (size_t i = 0; i < count; i++)
+            {
+                if (live[i] && m_nodes[i].kind == DagKind::Argument)
+                {
+                    registers[i] = nextRegister++;
+                    program.m_argumentRegisters.emplace_back(static_cast<uint16_t>(m_nodes[i].slot), static_cast<uint16_t>(registers[i]));
+                }
+            }
+            int firstTemporary = nextRegister;
+
+            // Linear scan, a temporary goes back to the pool once the instruction that reads it last has been emitted.
+            // The target may reuse an operand register because every operand is read before the target is written.
+            vector<int> freeRegisters;
+            for (size_t i = 0; i < count; i++)
+            {
+                const DagNode& node = m_nodes[i];
+                if (!live[i] || node.kind != DagKind::Operation)
+                {
+                    continue;
+                }
+
+                for (int operand : { node.left, node.right })
+                {
+                    if (operand >= 0 && lastUse[operand] == i && registers[operand] >= firstTemporary
+                        && find(freeRegisters.begin(), freeRegisters.end(), registers[operand]) == freeRegisters.end())
+                    {
+                        freeRegisters.push_back(registers[operand]);
+                    }
+                }
+
+                if (!freeRegisters.empty())
+                {
+                    registers[i] = freeRegisters.back();
+                    freeRegisters.pop_back();
+                }
+                else
+                {
+                    registers[i] = nextRegister++;
+                }
+
+                if (nextRegister > MaxRegisters)
+                {
+                    throw GraphingError{ ErrorType::Evaluation, EvaluationErrorCode::TooComplexToSolve };
+                }
+
+                program.m_instructions.push_back(Instruction{ node.op,
+                                                              static_cast<uint16_t>(registers[i]),
+                                                              static_cast<uint16_t>(registers[node.left]),
+                                                              static_cast<uint16_t>(node.right >= 0 ? registers[node.right] : registers[node.left]) });
+            }
+
+            program.m_result = static_cast<uint16_t>(registers[result]);
+            program.m_registerCount = static_cast<uint16_t>(nextRegister);
+            return program;
+        }
+
+        const vector<wstring>& m_argumentNames;
+        EvalTrigUnitMode m_trigUnitMode;
+        vector<DagNode> m_nodes;
+        map<DagKey, int> m_index;
+    };
+}
+
+Program::Program()
+    : m_result(0)
+    , m_registerCount(0)
+{
+}
+
+Program Program::Compile(const ExpressionNode& root, const vector<wstring>& argumentNames, EvalTrigUnitMode trigUnitMode)
+{
+    ProgramBuilder builder(argumentNames, trigUnitMode);
+    return builder.Build(root);
+}
+
+void Program::InitializeRegisters(double* registers) const
+{
+    copy(m_constants.begin(), m_constants.end(), registers);
+}
+
+double Program::Evaluate(const double* arguments, double* registers) const
+{
+    for (const auto& argument : m_argumentRegisters)
+    {
+        registers[argument.second] = arguments[argument.first];
+    }
+
+    for (const auto& instruction : m_instructions)
+    {
+        registers[instruction.target] = Apply(instruction.op, registers[instruction.left], registers[instruction.right]);
+    }
+
+    return registers[m_result];
+}
+
+double Program::Evaluate(const double* arguments) const
+{
+    vector<double> registers(m_registerCount);
+    InitializeRegisters(registers.data());
+    return Evaluate(arguments, registers.data());
+}
+
+bool Program::UsesArgument(size_t slot) const
+{
+    for (const auto& argument : m_argumentRegisters)
+    {
+        if (argument.first == slot)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+vector<bool> Program::InstructionsUsing(size_t slot) const
+{
+    // Registers are shared, so what a register depends on is that of the instruction that wrote it last
+    vector<bool> isRegisterUsing(m_registerCount, false);
+    for (const auto& argument : m_argumentRegisters)
+    {
+        isRegisterUsing[argument.second] = argument.first == slot;
+    }
+
+    vector<bool> isUsing(m_instructions.size());
+    for (size_t i = 0; i < m_instructions.size(); i++)
+    {
+        const Instruction& instruction = m_instructions[i];
+        isUsing[i] = isRegisterUsing[instruction.left] || (!IsUnary(instruction.op) && isRegisterUsing[instruction.right]);
+        isRegisterUsing[instruction.target] = isUsing[i];
+    }
+    return isUsing;
+}
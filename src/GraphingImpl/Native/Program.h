@@ -0,0 +1,118 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "ExpressionTree.h"
+
+namespace NativeGraphingImpl
+{
+    enum class OpCode : uint8_t
+    {
+        Add,
+        Subtract,
+        Multiply,
+        Divide,
+        Negate,
+        Power,
+        SignedPower, // sign(x) * |x|^y, a real root such as x^(1/3) keeps the sign of x
+        AbsPower,    // |x|^y, a real root such as x^(2/3) is defined for negative x
+        Sqrt,
+        Abs,
+        Sign,
+        Floor,
+        Ceiling,
+        Round,
+        Exp,
+        Ln,
+        Log10,
+        Sin,
+        Cos,
+        Tan,
+        Asin,
+        Acos,
+        Atan,
+        Sinh,
+        Cosh,
+        Tanh,
+        Asinh,
+        Acosh,
+        Atanh,
+        Min,
+        Max,
+        Gamma
+    };
+
+    // target = op(left, right), unary operations ignore right
+    struct Instruction
+    {
+        OpCode op;
+        uint16_t target;
+        uint16_t left;
+        uint16_t right;
+    };
+
+    bool IsUnary(OpCode op);
+    double Apply(OpCode op, double left, double right);
+
+    // Register bytecode compiled from an expression tree. The tree is first turned into a DAG where equal subexpressions
+    // are one node, constant operands are folded and trivial operations (x+0, x*1, x^1) are dropped. Nodes the result does
+    // not depend on are removed and temporaries share registers once their last reader has run.
+    //
+    // The register file holds the constants first, then the arguments the program reads, then the temporaries.
+    class Program
+    {
+    public:
+        Program();
+
+        // argumentNames gives the slot of each variable, every variable in the tree must be in the list
+        static Program Compile(const ExpressionNode& root, const std::vector<std::wstring>& argumentNames, Graphing::EvalTrigUnitMode trigUnitMode);
+
+        // Writes the constants, a register file only needs this once before any number of Evaluate calls
+        void InitializeRegisters(double* registers) const;
+
+        // arguments is indexed by slot, registers must hold RegisterCount() values set up by InitializeRegisters
+        double Evaluate(const double* arguments, double* registers) const;
+        double Evaluate(const double* arguments) const;
+
+        size_t RegisterCount() const
+        {
+            return m_registerCount;
+        }
+
+        uint16_t ResultRegister() const
+        {
+            return m_result;
+        }
+
+        const std::vector<double>& Constants() const
+        {
+            return m_constants;
+        }
+
+        // Pairs of (argument slot, register)
+        const std::vector<std::pair<uint16_t, uint16_t>>& ArgumentRegisters() const
+        {
+            return m_argumentRegisters;
+        }
+
+        const std::vector<Instruction>& Instructions() const
+        {
+            return m_instructions;
+        }
+
+        bool UsesArgument(size_t slot) const;
+
+        // Whether each instruction depends on the argument in slot, through its operands or the instructions they come from
+        std::vector<bool> InstructionsUsing(size_t slot) const;
+
+    private:
+        std::vector<double> m_constants;
+        std::vector<std::pair<uint16_t, uint16_t>> m_argumentRegisters;
+        std::vector<Instruction> m_instructions;
+        uint16_t m_result;
+        uint16_t m_registerCount;
+
+        friend class ProgramBuilder;
+    };
+}
@@ -0,0 +1,375 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "Rasterizer.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+using namespace std;
+using namespace Graphing;
+using namespace Graphing::Renderer;
+using namespace NativeGraphingImpl;
+
+namespace
+{
+    // Width and height in pixels of a tile
+    constexpr int s_tileSize = 64;
+
+    // Lengths of the dashes and gaps of each line style in line widths, indexed by LineStyle
+    struct DashPattern
+    {
+        size_t count;
+        float lengths[6];
+    };
+    constexpr DashPattern s_dashPatterns[] = {
+        { 0, {} },                          // Solid
+        { 2, { 1, 2 } },                    // Dot
+        { 2, { 4, 2 } },                    // Dash
+        { 4, { 4, 2, 1, 2 } },              // DashDot
+        { 6, { 4, 2, 1, 2, 1, 2 } },        // DashDotDot
+    };
+
+    constexpr size_t s_bitmapFileHeaderSize = 14;
+    constexpr size_t s_bitmapInfoHeaderSize = 40;
+    constexpr double s_metersPerInch = 0.0254;
+
+    uint32_t ToPixel(const Color& color)
+    {
+        return static_cast<uint32_t>(color.B) | static_cast<uint32_t>(color.G) << 8 | static_cast<uint32_t>(color.R) << 16
+               | static_cast<uint32_t>(color.A) << 24;
+    }
+
+    BYTE* WriteLittleEndian(BYTE* out, uint32_t value, size_t size)
+    {
+        for (size_t i = 0; i < size; i++)
+        {
+            *out++ = static_cast<BYTE>(value >> (8 * i));
+        }
+        return out;
+    }
+}
+
+Rasterizer::Rasterizer(size_t threadCount)
+    : m_pool(threadCount)
+    , m_width(0)
+    , m_height(0)
+    , m_background(0)
+    , m_lastX(0)
+    , m_lastY(0)
+    , m_dashPosition(0)
+    , m_isFigureOpen(false)
+    , m_tileColumns(0)
+    , m_tileRows(0)
+{
+}
+
+void Rasterizer::Clear(unsigned int width, unsigned int height, const Color& background)
+{
+    m_width = width;
+    m_height = height;
+    m_background = ToPixel(background);
+    m_pixels.resize(static_cast<size_t>(width) * height);
+    m_strokes.clear();
+    m_segments.clear();
+    m_isFigureOpen = false;
+
+    m_tileColumns = (width + s_tileSize - 1) / s_tileSize;
+    m_tileRows = (height + s_tileSize - 1) / s_tileSize;
+    m_tileSegments.resize(m_tileColumns * m_tileRows);
+    for (auto& segments : m_tileSegments)
+    {
+        segments.clear();
+    }
+}
+
+void Rasterizer::SetStroke(const Color& color, double width, LineStyle style)
+{
+    Stroke stroke{};
+    stroke.color[0] = color.B;
+    stroke.color[1] = color.G;
+    stroke.color[2] = color.R;
+    stroke.color[3] = color.A / 255.0f;
+    stroke.halfWidth = static_cast<float>(max(0.0, width) / 2);
+
+    const size_t patternIndex = static_cast<size_t>(style);
+    if (patternIndex < size(s_dashPatterns) && width > 0)
+    {
+        const DashPattern& pattern = s_dashPatterns[patternIndex];
+        stroke.dashCount = pattern.count;
+        for (size_t i = 0; i < pattern.count; i++)
+        {
+            stroke.dashes[i] = static_cast<float>(pattern.lengths[i] * width);
+            stroke.patternLength += stroke.dashes[i];
+        }
+    }
+
+    m_strokes.push_back(stroke);
+    m_isFigureOpen = false;
+}
+
+void Rasterizer::BeginFigure(double x, double y)
+{
+    m_isFigureOpen = isfinite(x) && isfinite(y) && !m_strokes.empty();
+    m_lastX = x;
+    m_lastY = y;
+    m_dashPosition = 0;
+}
+
+void Rasterizer::AddLine(double x, double y)
+{
+    if (!m_isFigureOpen)
+    {
+        BeginFigure(x, y);
+        return;
+    }
+    if (!isfinite(x) || !isfinite(y))
+    {
+        m_isFigureOpen = false;
+        return;
+    }
+
+    AddSegment(m_lastX, m_lastY, x, y, m_dashPosition);
+
+    const float patternLength = m_strokes.back().patternLength;
+    if (patternLength > 0)
+    {
+        const double length = hypot(x - m_lastX, y - m_lastY);
+        m_dashPosition = isfinite(length) ? fmod(m_dashPosition + length, patternLength) : 0;
+    }
+    m_lastX = x;
+    m_lastY = y;
+}
+
+void Rasterizer::Render()
+{
+    m_pool.ParallelFor(m_tileSegments.size(), [this](size_t tile) { RenderTile(tile); });
+}
+
+void Rasterizer::EncodeBitmap(float dpiX, float dpiY, vector<BYTE>& data) const
+{
+    const size_t headerSize = s_bitmapFileHeaderSize + s_bitmapInfoHeaderSize;
+    const size_t pixelSize = m_pixels.size() * sizeof(uint32_t);
+    data.resize(headerSize + pixelSize);
+
+    BYTE* out = data.data();
+    *out++ = 'B';
+    *out++ = 'M';
+    out = WriteLittleEndian(out, static_cast<uint32_t>(data.size()), 4);
+    out = WriteLittleEndian(out, 0, 4);
+    out = WriteLittleEndian(out, static_cast<uint32_t>(headerSize), 4);
+
+    // A negative height stores the rows from the top
+    out = WriteLittleEndian(out, static_cast<uint32_t>(s_bitmapInfoHeaderSize), 4);
+    out = WriteLittleEndian(out, m_width, 4);
+    out = WriteLittleEndian(out, static_cast<uint32_t>(-static_cast<int32_t>(m_height)), 4);
+    out = WriteLittleEndian(out, 1, 2);
+    out = WriteLittleEndian(out, 32, 2);
+    out = WriteLittleEndian(out, 0, 4);
+    out = WriteLittleEndian(out, static_cast<uint32_t>(pixelSize), 4);
+    out = WriteLittleEndian(out, static_cast<uint32_t>(lround(dpiX / s_metersPerInch)), 4);
+    out = WriteLittleEndian(out, static_cast<uint32_t>(lround(dpiY / s_metersPerInch)), 4);
+    out = WriteLittleEndian(out, 0, 4);
+    out = WriteLittleEndian(out, 0, 4);
+
+    for (uint32_t pixel : m_pixels)
+    {
+        out = WriteLittleEndian(out, pixel, 4);
+    }
+}
+
+// Clips the segment to the image, with room for the width of the stroke, and adds it to the tiles it reaches
+void Rasterizer::AddSegment(double x0, double y0, double x1, double y1, double dashStart)
+{
+    const Stroke& stroke = m_strokes.back();
+    const double dx = x1 - x0;
+    const double dy = y1 - y0;
+    if (!isfinite(dx) || !isfinite(dy))
+    {
+        return;
+    }
+
+    const double margin = stroke.halfWidth + 2;
+    double t0 = 0;
+    double t1 = 1;
+    auto clip = [&t0, &t1](double direction, double distance) {
+        if (direction == 0)
+        {
+            return distance >= 0;
+        }
+        const double t = distance / direction;
+        if (direction < 0)
+        {
+            t0 = max(t0, t);
+        }
+        else
+        {
+            t1 = min(t1, t);
+        }
+        return t0 <= t1;
+    };
+    if (!clip(-dx, x0 + margin) || !clip(dx, m_width + margin - x0) || !clip(-dy, y0 + margin) || !clip(dy, m_height + margin - y0))
+    {
+        return;
+    }
+
+    if (stroke.patternLength > 0 && t0 > 0)
+    {
+        dashStart = fmod(dashStart + t0 * hypot(dx, dy), stroke.patternLength);
+    }
+
+    const Segment segment{ static_cast<float>(x0 + t0 * dx),
+                           static_cast<float>(y0 + t0 * dy),
+                           static_cast<float>(x0 + t1 * dx),
+                           static_cast<float>(y0 + t1 * dy),
+                           static_cast<float>(dashStart),
+                           static_cast<uint32_t>(m_strokes.size() - 1) };
+    m_segments.push_back(segment);
+    BinSegment(static_cast<uint32_t>(m_segments.size() - 1));
+}
+
+void Rasterizer::BinSegment(uint32_t index)
+{
+    const Segment& segment = m_segments[index];
+    const float reach = m_strokes[segment.stroke].halfWidth + 1;
+    const int left = max(0, static_cast<int>(floor((min(segment.x0, segment.x1) - reach) / s_tileSize)));
+    const int right = min(static_cast<int>(m_tileColumns) - 1, static_cast<int>(floor((max(segment.x0, segment.x1) + reach) / s_tileSize)));
+    const int top = max(0, static_cast<int>(floor((min(segment.y0, segment.y1) - reach) / s_tileSize)));
+    const int bottom = min(static_cast<int>(m_tileRows) - 1, static_cast<int>(floor((max(segment.y0, segment.y1) + reach) / s_tileSize)));
+
+    // A long slanted segment crosses few of the tiles in its bounding box
+    const float dx = segment.x1 - segment.x0;
+    const float dy = segment.y1 - segment.y0;
+    const float lengthSquared = dx * dx + dy * dy;
+    const float maxDistance = s_tileSize * sqrt(2.0f) / 2 + reach;
+    for (int row = top; row <= bottom; row++)
+    {
+        for (int column = left; column <= right; column++)
+        {
+            const float centerX = (column + 0.5f) * s_tileSize;
+            const float centerY = (row + 0.5f) * s_tileSize;
+            const float t = lengthSquared > 0 ? clamp(((centerX - segment.x0) * dx + (centerY - segment.y0) * dy) / lengthSquared, 0.0f, 1.0f) : 0;
+            if (hypot(segment.x0 + t * dx - centerX, segment.y0 + t * dy - centerY) <= maxDistance)
+            {
+                m_tileSegments[row * m_tileColumns + column].push_back(index);
+            }
+        }
+    }
+}
+
+void Rasterizer::RenderTile(size_t tile)
+{
+    const int left = static_cast<int>(tile % m_tileColumns) * s_tileSize;
+    const int top = static_cast<int>(tile / m_tileColumns) * s_tileSize;
+    const int right = min(static_cast<int>(m_width), left + s_tileSize);
+    const int bottom = min(static_cast<int>(m_height), top + s_tileSize);
+    for (int y = top; y < bottom; y++)
+    {
+        fill_n(m_pixels.begin() + static_cast<size_t>(y) * m_width + left, right - left, m_background);
+    }
+
+    // Coverage of the current stroke, rows of the tile from its top left corner
+    array<float, s_tileSize * s_tileSize> coverage{};
+    const auto& segments = m_tileSegments[tile];
+    for (size_t i = 0; i < segments.size(); i++)
+    {
+        const Segment& segment = m_segments[segments[i]];
+        const Stroke& stroke = m_strokes[segment.stroke];
+        CoverSegment(segment, stroke, left, top, right, bottom, coverage.data());
+        if (i + 1 == segments.size() || m_segments[segments[i + 1]].stroke != segment.stroke)
+        {
+            Blend(stroke, left, top, right, bottom, coverage.data());
+        }
+    }
+}
+
+// Keeps in coverage the largest coverage of each pixel by the segments of the stroke
+void Rasterizer::CoverSegment(const Segment& segment, const Stroke& stroke, int left, int top, int right, int bottom, float* coverage) const
+{
+    const float reach = stroke.halfWidth + 0.5f;
+    const int xStart = max(left, static_cast<int>(floor(min(segment.x0, segment.x1) - reach)));
+    const int xEnd = min(right, static_cast<int>(ceil(max(segment.x0, segment.x1) + reach)));
+    const int yStart = max(top, static_cast<int>(floor(min(segment.y0, segment.y1) - reach)));
+    const int yEnd = min(bottom, static_cast<int>(ceil(max(segment.y0, segment.y1) + reach)));
+
+    const float dx = segment.x1 - segment.x0;
+    const float dy = segment.y1 - segment.y0;
+    const float lengthSquared = dx * dx + dy * dy;
+    const float length = sqrt(lengthSquared);
+    for (int y = yStart; y < yEnd; y++)
+    {
+        float* row = coverage + (y - top) * s_tileSize - left;
+        const float centerY = y + 0.5f;
+        for (int x = xStart; x < xEnd; x++)
+        {
+            const float centerX = x + 0.5f;
+            const float t =
+                lengthSquared > 0 ? clamp(((centerX - segment.x0) * dx + (centerY - segment.y0) * dy) / lengthSquared, 0.0f, 1.0f) : 0;
+            const float distance = hypot(segment.x0 + t * dx - centerX, segment.y0 + t * dy - centerY);
+            float pixelCoverage = min(1.0f, reach - distance);
+            if (pixelCoverage <= row[x])
+            {
+                continue;
+            }
+            if (stroke.dashCount > 0)
+            {
+                pixelCoverage = min(pixelCoverage, DashCoverage(stroke, segment.dashStart + t * length));
+            }
+            row[x] = max(row[x], pixelCoverage);
+        }
+    }
+}
+
+// Blends the color of the stroke over the tile by the coverage, and clears the coverage for the next stroke
+void Rasterizer::Blend(const Stroke& stroke, int left, int top, int right, int bottom, float* coverage)
+{
+    for (int y = top; y < bottom; y++)
+    {
+        float* row = coverage + (y - top) * s_tileSize - left;
+        uint32_t* pixels = m_pixels.data() + static_cast<size_t>(y) * m_width;
+        for (int x = left; x < right; x++)
+        {
+            if (row[x] <= 0)
+            {
+                continue;
+            }
+
+            const float alpha = row[x] * stroke.color[3];
+            uint32_t pixel = 0;
+            for (int channel = 0; channel < 4; channel++)
+            {
+                const float target = channel < 3 ? stroke.color[channel] : 255.0f;
+                const float value = static_cast<float>((pixels[x] >> (8 * channel)) & 0xFF);
+                pixel |= static_cast<uint32_t>(lround(value + (target - value) * alpha)) << (8 * channel);
+            }
+            pixels[x] = pixel;
+            row[x] = 0;
+        }
+    }
+}
+
+// How much of a pixel at a position along the figure is inside a dash, with a soft end one pixel long
+float Rasterizer::DashCoverage(const Stroke& stroke, float position)
+{
+    float offset = fmod(position, stroke.patternLength);
+    if (offset < 0)
+    {
+        offset += stroke.patternLength;
+    }
+
+    // Depth of the position into the nearest dash, negative in a gap. The dashes of the patterns before and after count
+    // near the ends of the pattern.
+    float depth = -stroke.patternLength;
+    float start = 0;
+    for (size_t i = 0; i + 1 < stroke.dashCount; i += 2)
+    {
+        for (float shift : { -stroke.patternLength, 0.0f, stroke.patternLength })
+        {
+            const float dashStart = start + shift;
+            depth = max(depth, min(offset - dashStart, dashStart + stroke.dashes[i] - offset));
+        }
+        start += stroke.dashes[i] + stroke.dashes[i + 1];
+    }
+    return clamp(depth + 0.5f, 0.0f, 1.0f);
+}
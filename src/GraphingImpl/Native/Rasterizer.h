@@ -0,0 +1,108 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "GraphingInterfaces/Common.h"
+#include "GraphingInterfaces/GraphingEnums.h"
+#include "ThreadPool.h"
+
+namespace NativeGraphingImpl
+{
+    // Draws anti-aliased lines into a 32 bit BGRA image without a graphics device.
+    //
+    // Figures are cut into segments clipped to the image as they are added, and each segment is listed in the square tiles
+    // it reaches. Render then has the thread pool render the tiles independently. In a tile a pixel is covered by the part
+    // of a line within half its width of the pixel center, with a soft edge one pixel wide, and the segments of one stroke
+    // are merged before being blended so the joins of a polyline are not blended twice. Dashes follow the length of the
+    // figure across its segments.
+    //
+    // The buffers are kept between frames, drawing an image of the same size again does not allocate.
+    class Rasterizer
+    {
+    public:
+        explicit Rasterizer(size_t threadCount = ThreadPool::DefaultThreadCount());
+
+        // Starts a new image filled with background. Coordinates are in pixels with the origin at the top left corner.
+        void Clear(unsigned int width, unsigned int height, const Graphing::Color& background);
+
+        // The stroke of the figures that follow, width is in pixels
+        void SetStroke(const Graphing::Color& color, double width, Graphing::Renderer::LineStyle style);
+
+        // A figure is a polyline, a point that is not finite ends it
+        void BeginFigure(double x, double y);
+        void AddLine(double x, double y);
+
+        void Render();
+
+        unsigned int GetWidth() const
+        {
+            return m_width;
+        }
+
+        unsigned int GetHeight() const
+        {
+            return m_height;
+        }
+
+        // Rows from the top, each pixel is B, G, R, A from the lowest byte
+        const std::vector<uint32_t>& GetPixels() const
+        {
+            return m_pixels;
+        }
+
+        // Writes the image as a BMP file, data keeps its capacity. dpi is stored in the header.
+        void EncodeBitmap(float dpiX, float dpiY, std::vector<BYTE>& data) const;
+
+    private:
+        struct Stroke
+        {
+            float color[4];
+            float halfWidth;
+
+            // Lengths in pixels of the dashes and the gaps between them, in turn from a dash
+            float dashes[6];
+            size_t dashCount;
+            float patternLength;
+        };
+
+        struct Segment
+        {
+            float x0;
+            float y0;
+            float x1;
+            float y1;
+
+            // Position in the dash pattern of the start of the segment
+            float dashStart;
+            uint32_t stroke;
+        };
+
+        void AddSegment(double x0, double y0, double x1, double y1, double dashStart);
+        void BinSegment(uint32_t index);
+        void RenderTile(size_t tile);
+        void CoverSegment(const Segment& segment, const Stroke& stroke, int left, int top, int right, int bottom, float* coverage) const;
+        void Blend(const Stroke& stroke, int left, int top, int right, int bottom, float* coverage);
+        static float DashCoverage(const Stroke& stroke, float position);
+
+        ThreadPool m_pool;
+        unsigned int m_width;
+        unsigned int m_height;
+        uint32_t m_background;
+        std::vector<uint32_t> m_pixels;
+
+        std::vector<Stroke> m_strokes;
+        std::vector<Segment> m_segments;
+
+        // The figure being added
+        double m_lastX;
+        double m_lastY;
+        double m_dashPosition;
+        bool m_isFigureOpen;
+
+        // Indices in m_segments of the segments that reach each tile, in the order they were added
+        size_t m_tileColumns;
+        size_t m_tileRows;
+        std::vector<std::vector<uint32_t>> m_tileSegments;
+    };
+}
@@ -0,0 +1,187 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "SegmentIndex.h"
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
+using namespace NativeGraphingImpl;
+
+namespace
+{
+    // Width and height of a cell in screen units, about the distance tracing searches within
+    constexpr double s_cellSize = 32;
+
+    // The point of a segment nearest to a position, as a fraction of the way from its start
+    double NearestParameter(double x0, double y0, double x1, double y1, double x, double y)
+    {
+        const double dx = x1 - x0;
+        const double dy = y1 - y0;
+        const double lengthSquared = dx * dx + dy * dy;
+        return lengthSquared > 0 ? clamp(((x - x0) * dx + (y - y0) * dy) / lengthSquared, 0.0, 1.0) : 0;
+    }
+}
+
+SegmentIndex::SegmentIndex()
+    : m_width(0)
+    , m_height(0)
+    , m_margin(0)
+    , m_left(0)
+    , m_top(0)
+    , m_columns(0)
+    , m_rows(0)
+{
+}
+
+void SegmentIndex::Clear(double width, double height, double margin)
+{
+    m_width = width;
+    m_height = height;
+    m_margin = margin;
+    m_left = -margin;
+    m_top = -margin;
+    m_columns = max<size_t>(1, static_cast<size_t>(ceil((width + 2 * margin) / s_cellSize)));
+    m_rows = max<size_t>(1, static_cast<size_t>(ceil((height + 2 * margin) / s_cellSize)));
+    m_segments.clear();
+    m_cellStarts.clear();
+    m_cellSegments.clear();
+}
+
+// Clips the segment to the screen and its margin
+void SegmentIndex::AddSegment(size_t curve, double x0, double y0, double x1, double y1)
+{
+    const double dx = x1 - x0;
+    const double dy = y1 - y0;
+    if (!isfinite(dx) || !isfinite(dy))
+    {
+        return;
+    }
+
+    double t0 = 0;
+    double t1 = 1;
+    auto clip = [&t0, &t1](double direction, double distance) {
+        if (direction == 0)
+        {
+            return distance >= 0;
+        }
+        const double t = distance / direction;
+        if (direction < 0)
+        {
+            t0 = max(t0, t);
+        }
+        else
+        {
+            t1 = min(t1, t);
+        }
+        return t0 <= t1;
+    };
+    if (!clip(-dx, x0 + m_margin) || !clip(dx, m_width + m_margin - x0) || !clip(-dy, y0 + m_margin) || !clip(dy, m_height + m_margin - y0))
+    {
+        return;
+    }
+
+    m_segments.push_back({ static_cast<float>(x0 + t0 * dx),
+                           static_cast<float>(y0 + t0 * dy),
+                           static_cast<float>(x0 + t1 * dx),
+                           static_cast<float>(y0 + t1 * dy),
+                           static_cast<uint32_t>(curve) });
+}
+
+void SegmentIndex::Build()
+{
+    // Counts the segments of each cell, turns the counts into the ends of the cells and fills the cells from their end
+    const size_t cellCount = m_columns * m_rows;
+    m_cellStarts.assign(cellCount + 1, 0);
+    for (const Segment& segment : m_segments)
+    {
+        VisitCells(segment, [this](size_t cell) { m_cellStarts[cell]++; });
+    }
+
+    uint32_t end = 0;
+    for (size_t cell = 0; cell < cellCount; cell++)
+    {
+        end += m_cellStarts[cell];
+        m_cellStarts[cell] = end;
+    }
+    m_cellStarts[cellCount] = end;
+
+    m_cellSegments.resize(end);
+    for (size_t i = m_segments.size(); i-- > 0;)
+    {
+        VisitCells(m_segments[i], [this, i](size_t cell) { m_cellSegments[--m_cellStarts[cell]] = static_cast<uint32_t>(i); });
+    }
+}
+
+bool SegmentIndex::FindNearest(double x, double y, double maxDistance, SegmentHit& hit) const
+{
+    if (m_cellStarts.empty())
+    {
+        return false;
+    }
+
+    const auto firstColumn = static_cast<ptrdiff_t>(floor((x - maxDistance - m_left) / s_cellSize));
+    const auto lastColumn = static_cast<ptrdiff_t>(floor((x + maxDistance - m_left) / s_cellSize));
+    const auto firstRow = static_cast<ptrdiff_t>(floor((y - maxDistance - m_top) / s_cellSize));
+    const auto lastRow = static_cast<ptrdiff_t>(floor((y + maxDistance - m_top) / s_cellSize));
+
+    bool found = false;
+    double bestDistance = maxDistance;
+    for (ptrdiff_t row = max<ptrdiff_t>(0, firstRow); row <= min<ptrdiff_t>(m_rows - 1, lastRow); row++)
+    {
+        for (ptrdiff_t column = max<ptrdiff_t>(0, firstColumn); column <= min<ptrdiff_t>(m_columns - 1, lastColumn); column++)
+        {
+            const size_t cell = row * m_columns + column;
+            for (uint32_t i = m_cellStarts[cell]; i < m_cellStarts[cell + 1]; i++)
+            {
+                const Segment& segment = m_segments[m_cellSegments[i]];
+                const double t = NearestParameter(segment.x0, segment.y0, segment.x1, segment.y1, x, y);
+                const double nearestX = segment.x0 + t * (segment.x1 - segment.x0);
+                const double nearestY = segment.y0 + t * (segment.y1 - segment.y0);
+                const double distance = hypot(nearestX - x, nearestY - y);
+                if (distance <= bestDistance)
+                {
+                    bestDistance = distance;
+                    found = true;
+                    hit = { segment.curve, nearestX, nearestY, distance };
+                }
+            }
+        }
+    }
+    return found;
+}
+
+// Calls visit with every cell the segment passes through, and maybe a few it only passes near
+template <typename Visit>
+void SegmentIndex::VisitCells(const Segment& segment, Visit visit) const
+{
+    const auto clampColumn = [this](double position) {
+        return min<ptrdiff_t>(m_columns - 1, max<ptrdiff_t>(0, static_cast<ptrdiff_t>(floor((position - m_left) / s_cellSize))));
+    };
+    const auto clampRow = [this](double position) {
+        return min<ptrdiff_t>(m_rows - 1, max<ptrdiff_t>(0, static_cast<ptrdiff_t>(floor((position - m_top) / s_cellSize))));
+    };
+    const ptrdiff_t firstColumn = clampColumn(min(segment.x0, segment.x1));
+    const ptrdiff_t lastColumn = clampColumn(max(segment.x0, segment.x1));
+    const ptrdiff_t firstRow = clampRow(min(segment.y0, segment.y1));
+    const ptrdiff_t lastRow = clampRow(max(segment.y0, segment.y1));
+
+    // A cell the segment passes through holds a point of it within half a diagonal of its center
+    const double halfDiagonal = s_cellSize * sqrt(2.0) / 2 + 1e-3;
+    for (ptrdiff_t row = firstRow; row <= lastRow; row++)
+    {
+        for (ptrdiff_t column = firstColumn; column <= lastColumn; column++)
+        {
+            const double centerX = m_left + (column + 0.5) * s_cellSize;
+            const double centerY = m_top + (row + 0.5) * s_cellSize;
+            const double t = NearestParameter(segment.x0, segment.y0, segment.x1, segment.y1, centerX, centerY);
+            const double distance =
+                hypot(segment.x0 + t * (segment.x1 - segment.x0) - centerX, segment.y0 + t * (segment.y1 - segment.y0) - centerY);
+            if (distance <= halfDiagonal)
+            {
+                visit(row * m_columns + column);
+            }
+        }
+    }
+}
@@ -0,0 +1,73 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace NativeGraphingImpl
+{
+    // The point of an indexed segment nearest to a position
+    struct SegmentHit
+    {
+        size_t curve;
+        double x;
+        double y;
+        double distance;
+    };
+
+    // Finds the segment of a set of polylines nearest to a point on screen.
+    //
+    // The segments are clipped to the screen and listed in the cells of a uniform grid they pass near, stored one cell
+    // after the other. A search only looks at the cells within its distance of the point, so it costs the same however
+    // many curves and segments there are. The buffers are kept between frames.
+    class SegmentIndex
+    {
+    public:
+        SegmentIndex();
+
+        // Starts a new index over a screen of this size, segments further than margin outside of it are dropped
+        void Clear(double width, double height, double margin);
+
+        // A zero length segment stands for a point
+        void AddSegment(size_t curve, double x0, double y0, double x1, double y1);
+
+        // Sorts the segments into the cells, to be called once all of them are added
+        void Build();
+
+        size_t GetSegmentCount() const
+        {
+            return m_segments.size();
+        }
+
+        // Returns false when no segment is within maxDistance of the point, which must not exceed the margin
+        bool FindNearest(double x, double y, double maxDistance, SegmentHit& hit) const;
+
+    private:
+        struct Segment
+        {
+            float x0;
+            float y0;
+            float x1;
+            float y1;
+            uint32_t curve;
+        };
+
+        template <typename Visit>
+        void VisitCells(const Segment& segment, Visit visit) const;
+
+        double m_width;
+        double m_height;
+        double m_margin;
+        double m_left;
+        double m_top;
+        size_t m_columns;
+        size_t m_rows;
+        std::vector<Segment> m_segments;
+
+        // The segments of cell i are at m_cellStarts[i] up to m_cellStarts[i + 1] in m_cellSegments
+        std::vector<uint32_t> m_cellStarts;
+        std::vector<uint32_t> m_cellSegments;
+    };
+}
@@ -0,0 +1,161 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "ThreadPool.h"
+#include <algorithm>
+
+using namespace std;
+using namespace NativeGraphingImpl;
+
+ThreadPool::ThreadPool(size_t threadCount)
+    : m_task(nullptr)
+    , m_generation(0)
+    , m_busyWorkers(0)
+    , m_isStopping(false)
+{
+    // Queue 0 belongs to the calling thread
+    threadCount = max<size_t>(1, threadCount);
+    for (size_t i = 0; i < threadCount; i++)
+    {
+        m_queues.push_back(make_unique<Queue>());
+    }
+    for (size_t i = 1; i < threadCount; i++)
+    {
+        m_threads.emplace_back(&ThreadPool::WorkerLoop, this, i);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        lock_guard<mutex> lock(m_lock);
+        m_isStopping = true;
+    }
+    m_started.notify_all();
+    for (thread& worker : m_threads)
+    {
+        worker.join();
+    }
+}
+
+size_t ThreadPool::DefaultThreadCount()
+{
+    return max<size_t>(1, thread::hardware_concurrency());
+}
+
+void ThreadPool::ParallelFor(size_t count, const function<void(size_t)>& task)
+{
+    lock_guard<mutex> callLock(m_callLock);
+    if (m_threads.empty() || count <= 1)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            task(i);
+        }
+        return;
+    }
+
+    const size_t queueCount = m_queues.size();
+    for (size_t i = 0; i < queueCount; i++)
+    {
+        lock_guard<mutex> lock(m_queues[i]->lock);
+        m_queues[i]->begin = count * i / queueCount;
+        m_queues[i]->end = count * (i + 1) / queueCount;
+    }
+
+    {
+        lock_guard<mutex> lock(m_lock);
+        m_task = &task;
+        m_generation++;
+        m_busyWorkers = m_threads.size();
+    }
+    m_started.notify_all();
+
+    Work(0);
+
+    // Every worker has to see the loop before the task goes away, even one that wakes up after the work is done
+    unique_lock<mutex> lock(m_lock);
+    m_finished.wait(lock, [this] { return m_busyWorkers == 0; });
+    m_task = nullptr;
+}
+
+void ThreadPool::WorkerLoop(size_t index)
+{
+    size_t generation = 0;
+    while (true)
+    {
+        {
+            unique_lock<mutex> lock(m_lock);
+            m_started.wait(lock, [this, generation] { return m_isStopping || m_generation != generation; });
+            if (m_isStopping)
+            {
+                return;
+            }
+            generation = m_generation;
+        }
+
+        Work(index);
+
+        bool isLast;
+        {
+            lock_guard<mutex> lock(m_lock);
+            isLast = --m_busyWorkers == 0;
+        }
+        if (isLast)
+        {
+            m_finished.notify_one();
+        }
+    }
+}
+
+void ThreadPool::Work(size_t index)
+{
+    size_t iteration;
+    while (TakeOwn(index, iteration) || Steal(index, iteration))
+    {
+        (*m_task)(iteration);
+    }
+}
+
+bool ThreadPool::TakeOwn(size_t index, size_t& iteration)
+{
+    Queue& queue = *m_queues[index];
+    lock_guard<mutex> lock(queue.lock);
+    if (queue.begin == queue.end)
+    {
+        return false;
+    }
+    iteration = queue.begin++;
+    return true;
+}
+
+// Takes the back half of the first queue found with iterations left, runs the first of them and keeps the rest
+bool ThreadPool::Steal(size_t index, size_t& iteration)
+{
+    const size_t queueCount = m_queues.size();
+    for (size_t offset = 1; offset < queueCount; offset++)
+    {
+        Queue& victim = *m_queues[(index + offset) % queueCount];
+        size_t begin;
+        size_t end;
+        {
+            lock_guard<mutex> lock(victim.lock);
+            if (victim.begin == victim.end)
+            {
+                continue;
+            }
+            begin = victim.begin + (victim.end - victim.begin) / 2;
+            end = victim.end;
+            victim.end = begin;
+        }
+
+        Queue& own = *m_queues[index];
+        lock_guard<mutex> lock(own.lock);
+        own.begin = begin + 1;
+        own.end = end;
+        iteration = begin;
+        return true;
+    }
+    return false;
+}
@@ -0,0 +1,65 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace NativeGraphingImpl
+{
+    // A fixed set of threads that run the iterations of a loop. Each thread starts with an equal share of the iterations
+    // and, once it has run its own, steals half of what is left to another thread, so uneven iterations still keep every
+    // thread busy. The thread that calls ParallelFor runs iterations too.
+    class ThreadPool
+    {
+    public:
+        // threadCount includes the calling thread, a pool of one thread runs the loop on the caller
+        explicit ThreadPool(size_t threadCount);
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        static size_t DefaultThreadCount();
+
+        size_t GetThreadCount() const
+        {
+            return m_queues.size();
+        }
+
+        // Runs task for every index below count and returns once all of them are done. task must not throw. Calls from
+        // several threads run one after the other.
+        void ParallelFor(size_t count, const std::function<void(size_t)>& task);
+
+    private:
+        // The iterations left to a thread, the owner takes them from the front and thieves from the back
+        struct Queue
+        {
+            std::mutex lock;
+            size_t begin = 0;
+            size_t end = 0;
+        };
+
+        void WorkerLoop(size_t index);
+        void Work(size_t index);
+        bool TakeOwn(size_t index, size_t& iteration);
+        bool Steal(size_t index, size_t& iteration);
+
+        std::vector<std::unique_ptr<Queue>> m_queues;
+        std::vector<std::thread> m_threads;
+
+        std::mutex m_callLock;
+        std::mutex m_lock;
+        std::condition_variable m_started;
+        std::condition_variable m_finished;
+        const std::function<void(size_t)>* m_task;
+        size_t m_generation;
+        size_t m_busyWorkers;
+        bool m_isStopping;
+    };
+}
@@ -6,6 +6,10 @@
 #define WIN32_LEAN_AND_MEAN
 #endif
 
+// Windows headers define a min/max macro.
+// Include the below #def to avoid this behavior.
+#define NOMINMAX
+
 #include <windows.h>
 #include <iomanip>
 #include <iostream>